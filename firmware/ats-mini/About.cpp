@@ -55,7 +55,7 @@ void drawAboutHelp(uint8_t arrow)
     spr.drawString("To see this screen again,", 130, 70 + 16 * 4, 2);
     spr.drawString("go to Menu->Settings->About.", 130, 70 + 16 * 5, 2);
   }
-  spr.pushSprite(0, 0);
+  displayPush();
 }
 
 //
@@ -105,13 +105,18 @@ static void drawAboutSystem(uint8_t arrow)
   );
   spr.drawString(text, 2, 70 + 16 * 2, 2);
 
+#ifdef LCD_DMA
+  // Display status can not be read back over the DMA bus
+  sprintf(text, "Display ID: %08lX", displayGetId());
+#else
   sprintf(
     text,
     "Display ID: %08lX, STAT: %02X%08lX",
-    tft.readcommand32(ST7789_RDDID, 1),
+    displayGetId(),
     tft.readcommand8(ST7789_RDDST, 1),
     tft.readcommand32(ST7789_RDDST, 2)
   );
+#endif
   spr.drawString(text, 2, 70 + 16 * 3, 2);
 
   char *ip = getWiFiIPAddress();
@@ -123,7 +128,7 @@ static void drawAboutSystem(uint8_t arrow)
     uint16_t rgb = (i&1? 0x001F:0) | (i&2? 0x07E0:0) | (i&4? 0xF800:0);
     spr.fillRect(i*40, 160, 40, 20, rgb);
   }
-  spr.pushSprite(0, 0);
+  displayPush();
 }
 
 //
@@ -137,7 +142,75 @@ static void drawAboutAuthors(uint8_t arrow)
   spr.drawString(AUTHORS_LINE2, 2, 70 + 16, 2);
   spr.drawString(AUTHORS_LINE3, 2, 70 + 16 * 2, 2);
   spr.drawString(AUTHORS_LINE4, 2, 70 + 16 * 3, 2);
-  spr.pushSprite(0, 0);
+  displayPush();
+}
+
+//
+// Show BOOT screen with boot phase times
+//
+#define BOOT_ROWS 6 // Rows of phases in each column
+
+static void drawAboutBoot(uint8_t arrow)
+{
+  drawAboutCommon(arrow);
+
+  char text[64];
+  uint32_t total = 0;
+  const BootPhase *p;
+
+  // Two columns of phases, total in place of the last one. Phases
+  // that do not fit still count towards the total.
+  for(int j=0 ; (p = bootGetPhase(j)) ; j++)
+  {
+    if(j < BOOT_ROWS * 2 - 1)
+    {
+      sprintf(text, "%s: %lu +%lu ms", p->name, p->start / 1000, p->end? (p->end - p->start) / 1000 : 0);
+      spr.drawString(text, 2 + 160 * (j / BOOT_ROWS), 70 + 16 * (j % BOOT_ROWS - 1), 2);
+    }
+    total = p->end > total? p->end : total;
+  }
+
+  sprintf(text, "total: %lu ms", total / 1000);
+  spr.drawString(text, 2 + 160, 70 + 16 * (BOOT_ROWS - 2), 2);
+  displayPush();
+}
+
+//
+// Show STORAGE screen with writes and usage
+//
+static void drawAboutStorage(uint8_t arrow, bool refresh)
+{
+  drawAboutCommon(arrow);
+
+  char text[100];
+  const PrefsStats *stats = prefsGetStats(refresh);
+
+  sprintf(text, "SAVES: %lu, NVS WRITES: %lu", stats->saves, stats->writes);
+  spr.drawString(text, 2, 70 + 16 * -1, 2);
+
+  sprintf(text, "LAST SAVE: %lu WRITES, %lu us", stats->lastWrites, stats->lastTime);
+  spr.drawString(text, 2, 70 + 16 * 0, 2);
+
+  sprintf(
+    text,
+    "WRITES: SETTINGS %lu, BANDS %lu, MEM %lu",
+    stats->settingsWrites, stats->bandsWrites, stats->memoriesWrites
+  );
+  spr.drawString(text, 2, 70 + 16 * 1, 2);
+
+  sprintf(text, "REQUESTS: %lu, COALESCED %lu", stats->requests, stats->coalesced);
+  spr.drawString(text, 2, 70 + 16 * 2, 2);
+
+  sprintf(text, "NVS: USED %lu, FREE %lu", stats->nvsUsed, stats->nvsFree);
+  spr.drawString(text, 2, 70 + 16 * 3, 2);
+
+  sprintf(
+    text,
+    "FS: USED %luk of %luk, WRITTEN %luk",
+    stats->fsUsed / 1024U, stats->fsTotal / 1024U, stats->fsWritten / 1024U
+  );
+  spr.drawString(text, 2, 70 + 16 * 4, 2);
+  displayPush();
 }
 
 //
@@ -145,11 +218,20 @@ static void drawAboutAuthors(uint8_t arrow)
 //
 void drawAbout()
 {
-  switch(doAbout(0))
+  static uint8_t lastScreen = 0xFF;
+  uint8_t screen = doAbout(0);
+
+  // Screens are redrawn often, only refresh costly data when entered
+  bool entered = screen!=lastScreen;
+  lastScreen = screen;
+
+  switch(screen)
   {
     case 0: drawAboutHelp(1); break;
     case 1: drawAboutAuthors(3); break;
-    case 2: drawAboutSystem(2); break;
+    case 2: drawAboutSystem(3); break;
+    case 3: drawAboutBoot(3); break;
+    case 4: drawAboutStorage(2, entered); break;
     default: break;
   }
 }
@@ -0,0 +1,342 @@
+#include "Common.h"
+#include "Utils.h"
+#include "Menu.h"
+#include "Storage.h"
+#include "Bank.h"
+#include <LittleFS.h>
+#include <ctype.h>
+
+//
+// Memory bank, a large station list kept on LittleFS next to the NVS
+// memory slots. Entries are stored sorted by frequency. The frequency
+// and group of each entry are kept in a PSRAM index, so lookups do
+// not touch the file, while entries themselves are read a page at a
+// time. The bank is loaded from a CSV file with lines like:
+//
+//   group,band,freq,mode[,name]
+//
+
+#define BANK_PATH  "/bank.bin"
+#define BANK_TEMP  "/bank.tmp"
+#define BANK_MAX   4096  // Maximum number of entries
+#define BANK_PAGE  16    // Entries cached for the menu
+
+struct BankKey
+{
+  uint32_t freq;        // Frequency (Hz)
+  uint8_t  group;       // Group number
+};
+
+static SemaphoreHandle_t bankLock = 0; // Guards the index, cache, and file
+static BankKey *bankIndex = 0;         // Frequency index, in PSRAM
+static int bankCount = 0;              // Number of entries
+static BankEntry bankPage[BANK_PAGE];  // Cached page of entries
+static int bankPageStart = -1;         // First cached entry, or -1 for none
+
+//
+// Read entries from the bank file, returns number of entries read
+//
+static int bankReadFile(int pos, BankEntry *list, int count)
+{
+  if(pos<0 || pos>=bankCount || count<=0) return(0);
+  count = pos + count > bankCount? bankCount - pos : count;
+
+  File file = LittleFS.open(BANK_PATH, "r");
+  if(!file) return(0);
+
+  int result = 0;
+  if(file.seek(pos * sizeof(BankEntry), fs::SeekSet))
+    result = file.read((uint8_t *)list, count * sizeof(BankEntry)) / sizeof(BankEntry);
+
+  file.close();
+  return(result);
+}
+
+//
+// Build frequency index from the bank file
+//
+static bool bankLoadIndex()
+{
+  free(bankIndex);
+  bankIndex = 0;
+  bankCount = 0;
+  bankPageStart = -1;
+
+  File file = LittleFS.open(BANK_PATH, "r");
+  if(!file) return(false);
+
+  int total = file.size() / sizeof(BankEntry);
+  total = total > BANK_MAX? BANK_MAX : total;
+  bankIndex = total? (BankKey *)ps_malloc(total * sizeof(BankKey)) : 0;
+
+  // Read entries a page at a time
+  while(bankIndex && bankCount<total)
+  {
+    int n = file.read((uint8_t *)bankPage, sizeof(bankPage)) / sizeof(BankEntry);
+    if(n<=0) break;
+
+    for(int j=0 ; j<n && bankCount<total ; j++, bankCount++)
+    {
+      bankIndex[bankCount].freq  = bankPage[j].freq;
+      bankIndex[bankCount].group = bankPage[j].group;
+    }
+  }
+
+  file.close();
+  return(bankCount>0);
+}
+
+//
+// Load bank index, call once the file system is mounted
+//
+bool bankInit()
+{
+  if(!bankLock) bankLock = xSemaphoreCreateMutex();
+  if(!bankLock) return(false);
+
+  xSemaphoreTake(bankLock, portMAX_DELAY);
+  bool result = bankLoadIndex();
+  xSemaphoreGive(bankLock);
+  return(result);
+}
+
+int bankGetCount()
+{
+  return(bankCount);
+}
+
+//
+// Get bank entry, reading its page if not cached. The entry is valid
+// until the next call. For loop() only, other tasks use bankQuery().
+//
+const BankEntry *bankGet(int pos)
+{
+  const BankEntry *result = 0;
+
+  if(!bankLock || pos<0) return(0);
+  xSemaphoreTake(bankLock, portMAX_DELAY);
+
+  if(pos<bankCount)
+  {
+    if(bankPageStart<0 || pos<bankPageStart || pos>=bankPageStart+BANK_PAGE)
+    {
+      // Center page around the entry, the menu scrolls both ways
+      int start = pos - BANK_PAGE / 2;
+      start = start > bankCount - BANK_PAGE? bankCount - BANK_PAGE : start;
+      start = start < 0? 0 : start;
+      bankPageStart = bankReadFile(start, bankPage, BANK_PAGE) > pos - start? start : -1;
+    }
+
+    if(bankPageStart>=0) result = &bankPage[pos - bankPageStart];
+  }
+
+  xSemaphoreGive(bankLock);
+  return(result);
+}
+
+//
+// Find the first entry at or above given frequency
+//
+int bankFind(uint32_t freq)
+{
+  if(!bankLock) return(0);
+  xSemaphoreTake(bankLock, portMAX_DELAY);
+
+  int lo = 0, hi = bankCount;
+  while(lo < hi)
+  {
+    int mid = (lo + hi) / 2;
+    if(bankIndex[mid].freq < freq) lo = mid + 1; else hi = mid;
+  }
+
+  xSemaphoreGive(bankLock);
+  return(lo);
+}
+
+//
+// Check if name contains text, ignoring case
+//
+static bool bankMatch(const char *name, const char *text)
+{
+  for( ; *name ; name++)
+  {
+    int j;
+    for(j=0 ; text[j] && name[j] && tolower(name[j])==tolower(text[j]) ; j++);
+    if(!text[j]) return(true);
+  }
+
+  return(!*text);
+}
+
+//
+// Read up to count entries starting at pos, with names containing
+// text (unless 0) and in given group (unless negative), in a single
+// pass. Returns number of entries read and sets *next to the entry
+// following the last one checked. The lock is held for one page at
+// a time, so that loop() does not stall on long searches.
+//
+int bankQuery(int pos, const char *text, int group, BankEntry *list, int count, int *next)
+{
+  BankEntry page[BANK_PAGE];
+  int found = 0;
+
+  for(pos = pos<0? 0 : pos ; bankLock && found<count ; )
+  {
+    xSemaphoreTake(bankLock, portMAX_DELAY);
+
+    // Skip entries in other groups without reading them
+    while(group>=0 && pos<bankCount && bankIndex[pos].group!=group) pos++;
+    int n = bankReadFile(pos, page, BANK_PAGE);
+
+    xSemaphoreGive(bankLock);
+    if(n<=0) break;
+
+    int j;
+    for(j=0 ; j<n && found<count ; j++)
+      if((group<0 || page[j].group==group) && (!text || bankMatch(page[j].name, text)))
+        list[found++] = page[j];
+
+    pos += j;
+  }
+
+  *next = pos;
+  return(found);
+}
+
+//
+// Parse "group,band,freq,mode[,name]" line into a bank entry,
+// return error message or 0 if successful
+//
+static const char *bankParseLine(char *line, BankEntry *entry)
+{
+  char *fields[5] = { line };
+  int n = 1;
+
+  // Split line into fields, the last one (name) may contain commas
+  for(char *p=line ; *p && n<ITEM_COUNT(fields) ; p++)
+    if(*p == ',') { *p = '\0'; fields[n++] = p + 1; }
+
+  if(n<4) return("Expected 'group,band,freq,mode'");
+
+  int group = atoi(fields[0]);
+  if(group<0 || group>255) return("Invalid group number");
+
+  Memory mem;
+  memset(&mem, 0, sizeof(mem));
+  mem.freq = strtoul(fields[2], 0, 10);
+
+  for(mem.mode=0 ; mem.mode<getTotalModes() ; mem.mode++)
+    if(!strcmp(bandModeDesc[mem.mode], fields[3])) break;
+  if(mem.mode>=getTotalModes()) return("No such mode");
+
+  int band = findBandByName(fields[1], &mem);
+  if(band<0) return("No such band");
+
+  if(!mem.freq || !isMemoryInBand(getBandPlan(band), &mem))
+    return("Invalid frequency or mode");
+
+  memset(entry, 0, sizeof(*entry));
+  entry->freq  = mem.freq;
+  entry->band  = band;
+  entry->mode  = mem.mode;
+  entry->group = group;
+  if(n>4) strncpy(entry->name, fields[4], sizeof(entry->name) - 1);
+  return(0);
+}
+
+static int bankCompare(const void *a, const void *b)
+{
+  const BankEntry *x = (const BankEntry *)a;
+  const BankEntry *y = (const BankEntry *)b;
+
+  if(x->freq != y->freq) return(x->freq < y->freq? -1 : 1);
+  if(x->group != y->group) return(x->group - y->group);
+  return(strcmp(x->name, y->name));
+}
+
+//
+// Replace bank with entries from a CSV file, return error message
+// or 0 if successful. Nothing changes unless every line is valid.
+//
+const char *bankImport(const char *path)
+{
+  static char error[64];
+  const char *result = 0;
+  char line[80];
+  int count = 0;
+
+  File file = LittleFS.open(path, "r");
+  if(!file) return("No bank file");
+
+  BankEntry *list = (BankEntry *)ps_malloc(BANK_MAX * sizeof(BankEntry));
+  if(!list)
+  {
+    file.close();
+    return("Out of memory");
+  }
+
+  for(int n=1 ; !result && file.available() ; n++)
+  {
+    size_t length = file.readBytesUntil('\n', line, sizeof(line) - 1);
+    line[length] = '\0';
+
+    // Lines filling the whole buffer may have been split
+    if(length >= sizeof(line) - 1)
+    {
+      snprintf(error, sizeof(error), "Line %d: %s", n, "Line too long");
+      result = error;
+      continue;
+    }
+
+    // Skip empty lines
+    if(length && line[length-1]=='\r') line[--length] = '\0';
+    if(!length) continue;
+
+    if(count>=BANK_MAX)
+      result = "Too many entries";
+    else if((result = bankParseLine(line, &list[count])))
+    {
+      snprintf(error, sizeof(error), "Line %d: %s", n, result);
+      result = error;
+    }
+    else
+      count++;
+  }
+
+  file.close();
+
+  if(!result)
+  {
+    qsort(list, count, sizeof(BankEntry), bankCompare);
+
+    // Write sorted entries, then replace the bank file
+    file = LittleFS.open(BANK_TEMP, "w");
+    if(!file)
+      result = "Cannot write bank";
+    else
+    {
+      size_t size = count * sizeof(BankEntry);
+      size_t written = file.write((const uint8_t *)list, size);
+      bool ok = written==size;
+      file.close();
+      diskCountWrite(written);
+
+      if(!ok || !bankLock) result = "Cannot write bank";
+      else
+      {
+        // Rename replaces the old bank, which stays if it fails
+        xSemaphoreTake(bankLock, portMAX_DELAY);
+        if(!LittleFS.rename(BANK_TEMP, BANK_PATH))
+        {
+          LittleFS.remove(BANK_TEMP);
+          result = "Cannot write bank";
+        }
+        bankLoadIndex();
+        xSemaphoreGive(bankLock);
+      }
+    }
+  }
+
+  free(list);
+  return(result);
+}
@@ -0,0 +1,23 @@
+#ifndef BANK_H
+#define BANK_H
+
+#define BANK_CSV_PATH "/bank.csv"
+
+struct BankEntry
+{
+  uint32_t freq;        // Frequency (Hz)
+  uint8_t  band;        // Band index
+  uint8_t  mode;        // Modulation
+  uint8_t  group;       // Group (category) number
+  uint8_t  reserved;    // Unused, zero
+  char     name[24];    // Station name (UTF-8), zero-terminated
+};
+
+bool bankInit();
+int bankGetCount();
+const BankEntry *bankGet(int pos);
+int bankFind(uint32_t freq);
+int bankQuery(int pos, const char *text, int group, BankEntry *list, int count, int *next);
+const char *bankImport(const char *path);
+
+#endif // BANK_H
@@ -18,6 +18,9 @@ static uint8_t batteryState = 255;
 // Current battery voltage
 static float batteryVolts = 4.0;
 
+// Battery voltage last reported to remotes
+static float batteryVoltsEmitted = 0.0;
+
 //
 // Measure and return battery voltage
 //
@@ -58,10 +61,41 @@ float batteryMonitor()
       break;
   }
 
+  // Let remotes know about noticeable voltage changes
+  if(fabs(batteryVolts - batteryVoltsEmitted) >= 0.05)
+  {
+    batteryVoltsEmitted = batteryVolts;
+    remoteEmit(TOPIC_BATTERY);
+  }
+
   // Return current voltage
   return(batteryVolts);
 }
 
+//
+// Return a value that changes whenever the battery indicator drawn
+// by drawBattery() changes
+//
+uint32_t batteryGetDisplayState()
+{
+  char voltage[8];
+
+  // Charging indicator does not show the voltage
+  if(batteryVolts > 4.3) return(0xFFFFFFFF);
+
+  sprintf(voltage, "%.02f", batteryVolts);
+  return((batteryState << 16) | (atoi(voltage) * 100 + atoi(voltage + 2)));
+}
+
+//
+// Return true if drawBattery() shows the voltage, rather than the
+// charging indicator
+//
+bool batteryHasVoltage()
+{
+  return(batteryVolts <= 4.3);
+}
+
 //
 // Show last measured battery voltage and status at given screen
 // coordinates. Return true if voltage was drawn.
@@ -70,9 +104,6 @@ bool drawBattery(int x, int y)
 {
   if(sleepOn()) return false;
 
-  // Measure battery voltage and status
-  batteryMonitor();
-
   // Set display information
   spr.drawRoundRect(x, y + 1, 28, 14, 3, TH.batt_border);
   spr.drawLine(x + 29, y + 5, x + 29, y + 10, TH.batt_border);
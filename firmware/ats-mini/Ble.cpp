@@ -5,9 +5,7 @@
 
 NordicUART BLESerial = NordicUART(RECEIVER_NAME);
 
-static uint32_t bleRemoteTimer = millis();
-static uint8_t bleRemoteSeqnum = 0;
-static bool bleRemoteLogOn = false;
+static RemoteState bleRemote = { .echo = true, .bandwidth = 4000 };
 
 //
 // Get current connection status
@@ -25,6 +23,7 @@ int8_t getBleStatus()
 void bleStop()
 {
   if(!BLESerial.isStarted()) return;
+  if(mirrorGetStream() == &BLESerial) mirrorStop();
   BLESerial.stop();
 }
 
@@ -48,12 +47,8 @@ int bleDoCommand(uint8_t bleMode)
   if(bleMode == BLE_OFF) return 0;
 
   if (BLEDevice::getServer()->getConnectedCount() > 0) {
-    if (BLESerial.available()) {
-      char bleChar = BLESerial.read();
-      BLESerial.write(bleChar);
-      // Execute the remote command and return the event
-      return remoteDoCommand(bleChar);
-    }
+    // Execute the remote command and return the event
+    return remoteDoInput(&BLESerial, &bleRemote);
   }
   return 0;
 }
@@ -63,66 +58,5 @@ int bleDoCommand(uint8_t bleMode)
 //
 void bleTickTime()
 {
-  if(bleRemoteLogOn && (millis() - bleRemoteTimer >= 500))
-  {
-    // Mark time and increment diagnostic sequence number
-    bleRemoteTimer = millis();
-    bleRemoteSeqnum++;
-    // Show status via BLE
-    blePrintStatus();
-  }
-}
-
-//
-// Print current status to BLE
-//
-void blePrintStatus()
-{
-  if(!BLESerial.isStarted()) return;
-  if(BLEDevice::getServer()->getConnectedCount() == 0) return;
-
-  // Prepare information ready to be sent
-  float remoteVoltage = batteryMonitor();
-
-  // S-Meter conditional on compile option
-  rx.getCurrentReceivedSignalQuality();
-  uint8_t remoteRssi = rx.getCurrentRSSI();
-  uint8_t remoteSnr = rx.getCurrentSNR();
-
-  // Use rx.getFrequency to force read of capacitor value from SI4732/5
-  rx.getFrequency();
-  uint16_t tuningCapacitor = rx.getAntennaTuningCapacitor();
-
-  // Format status string
-  char statusBuffer[128];
-  snprintf(statusBuffer, sizeof(statusBuffer),
-    "%u,%u,%d,%d,%s,%s,%s,%s,%hu,%hu,%hu,%hu,%hu,%.2f,%hu\r\n",
-    VER_APP,
-    currentFrequency,
-    currentBFO,
-    ((currentMode == USB) ? getCurrentBand()->usbCal :
-     (currentMode == LSB) ? getCurrentBand()->lsbCal : 0),
-    getCurrentBand()->bandName,
-    bandModeDesc[currentMode],
-    getCurrentStep()->desc,
-    getCurrentBandwidth()->desc,
-    agcIdx,
-    volume,
-    remoteRssi,
-    remoteSnr,
-    tuningCapacitor,
-    remoteVoltage,
-    bleRemoteSeqnum
-  );
-
-  // Send via BLE
-  BLESerial.write((uint8_t*)statusBuffer, strlen(statusBuffer));
-}
-
-//
-// Toggle BLE remote logging
-//
-void bleToggleMonitor()
-{
-  bleRemoteLogOn = !bleRemoteLogOn;
+  if(getBleStatus() > 0) remoteTickTime(&BLESerial, &bleRemote);
 }
@@ -11,7 +11,10 @@
 #define NORDIC_UART_CHARACTERISTIC_UUID_RX "6E400002-B5A3-F393-E0A9-E50E24DCCA9E"
 #define NORDIC_UART_CHARACTERISTIC_UUID_TX "6E400003-B5A3-F393-E0A9-E50E24DCCA9E"
 
-class NordicUART : public BLEServerCallbacks, public BLECharacteristicCallbacks {
+// Longest notification sent at once, longer writes get split
+#define NORDIC_UART_CHUNK 64
+
+class NordicUART : public Stream, public BLEServerCallbacks, public BLECharacteristicCallbacks {
 private:
   // BLE components
   BLEServer* pServer;
@@ -25,7 +28,7 @@ private:
   // Data handling
   std::binary_semaphore dataConsumed{1};
   String incomingPacket;
-  size_t unreadByteCount = 0;
+  volatile size_t unreadByteCount = 0;
 
   // Device attributes
   const char *deviceName;
@@ -138,12 +141,19 @@ public:
     }
   }
 
-  int available()
+  int available() override
   {
     return unreadByteCount;
   }
 
-  int read()
+  int peek() override
+  {
+    if (unreadByteCount > 0)
+      return incomingPacket[incomingPacket.length() - unreadByteCount];
+    return -1;
+  }
+
+  int read() override
   {
     if (unreadByteCount > 0)
     {
@@ -157,22 +167,29 @@ public:
     return -1;
   }
 
-  size_t write(uint8_t *data, size_t size)
+  size_t write(const uint8_t *data, size_t size) override
   {
-   if (pTxCharacteristic)
-   {
-     pTxCharacteristic->setValue(data, size);
-     pTxCharacteristic->notify();
-     return size;
-   }
-   else
-      return 0;
+    if (!pTxCharacteristic) return 0;
+
+    for (size_t i = 0; i < size; i += NORDIC_UART_CHUNK)
+    {
+      pTxCharacteristic->setValue(data + i, size - i < NORDIC_UART_CHUNK ? size - i : NORDIC_UART_CHUNK);
+      pTxCharacteristic->notify();
+    }
+    return size;
   }
 
-  size_t write(uint8_t byte)
+  size_t write(uint8_t byte) override
   {
     return write(&byte, 1);
-  };
+  }
+
+  int availableForWrite() override
+  {
+    return pTxCharacteristic ? NORDIC_UART_CHUNK : 0;
+  }
+
+  using Print::write;
 };
 
 #endif
@@ -78,18 +78,35 @@
 // Data Types
 //
 
+//
+// Band plan entry, constant and kept in flash
+//
 typedef struct
 {
   const char *bandName;   // Band description
   uint8_t bandType;       // Band type (FM, MW, or SW)
-  uint8_t bandMode;       // Band mode (FM, AM, LSB, or USB)
+  uint8_t bandMode;       // Default band mode (FM, AM, LSB, or USB)
   uint16_t minimumFreq;   // Minimum frequency of the band
   uint16_t maximumFreq;   // Maximum frequency of the band
-  uint16_t currentFreq;   // Default frequency or current frequency
+  uint16_t currentFreq;   // Default frequency
   int8_t currentStepIdx;  // Default frequency step
+  int8_t bandwidthIdx;    // Default index of the table bandwidthFM, bandwidthAM or bandwidthSSB
+} BandPlan;
+
+//
+// Band state, changed by the user and loaded when the band is first
+// used (see getBand())
+//
+typedef struct
+{
+  const BandPlan *plan;   // Band plan entry, 0 until loaded
+  uint8_t bandMode;       // Band mode (FM, AM, LSB, or USB)
+  uint16_t currentFreq;   // Current frequency
+  int8_t currentStepIdx;  // Current frequency step
   int8_t bandwidthIdx;    // Index of the table bandwidthFM, bandwidthAM or bandwidthSSB;
   int16_t usbCal;         // USB calibration value
   int16_t lsbCal;         // LSB calibration value
+  int16_t currentBFO;     // Current BFO offset (Hz), added to currentFreq
 } Band;
 
 typedef struct __attribute__((packed))
@@ -133,6 +150,7 @@ extern bool pushAndRotate;
 extern bool seekStop;
 extern uint8_t rssi;
 extern uint8_t snr;
+extern uint8_t rssiPeak;
 
 extern uint8_t volume;
 extern uint8_t currentSquelch;
@@ -178,12 +196,19 @@ bool checkStopSeeking();
 
 // Battery.c
 float batteryMonitor();
+uint32_t batteryGetDisplayState();
+bool batteryHasVoltage();
 bool drawBattery(int x, int y);
 
 // Scan.c
+#define SCAN_POINTS 200  // Number of frequencies to scan
 void scanRun(uint16_t centerFreq, uint16_t step);
-float scanGetRSSI(uint16_t freq);
-float scanGetSNR(uint16_t freq);
+uint16_t scanGetPoints(uint16_t *startFreq, uint16_t *step);
+bool scanGetPoint(uint16_t idx, uint8_t *rssi, uint8_t *snr);
+uint16_t scanGetUpdates();
+void scanMeasureStart();
+bool scanMeasure(uint16_t freq, uint16_t dwell, uint8_t *rssi, uint8_t *snr);
+void scanMeasureStop();
 
 // Station.c
 const char *getStationName();
@@ -205,6 +230,7 @@ bool ntpSyncTime();
 
 void netRequestConnect();
 void netTickTime();
+int netDoCommand();
 
 // Ble.cpp
 int bleDoCommand(uint8_t bleModeIdx);
@@ -212,16 +238,67 @@ void bleInit(uint8_t bleMode);
 void bleStop();
 int8_t getBleStatus();
 void bleTickTime();
-void blePrintStatus();
-void bleToggleMonitor();
 
 // Remote.c
 #define REMOTE_CHANGED   1
 #define REMOTE_CLICK     2
 #define REMOTE_PREFS     4
 #define REMOTE_DIRECTION 8
-void remoteTickTime();
-int remoteDoCommand(char key);
-char readSerialChar();
+
+// Remote event topics
+#define TOPIC_FREQ       0  // Frequency, band, mode
+#define TOPIC_SIGNAL     1  // RSSI, SNR
+#define TOPIC_RDS        2  // RDS PI, PS, RT
+#define TOPIC_BATTERY    3  // Battery voltage
+#define TOPIC_SCAN       4  // Scan results
+#define TOPIC_MEMORY     5  // Memory slots
+#define TOPIC_COUNT      6
+
+#define REMOTE_LINE_SIZE  64 // Longest tagged command
+#define REMOTE_QUEUE_SIZE  8 // Maximum queued tagged commands
+
+typedef struct
+{
+  Stream  *channel;      // Stream the remote is connected to
+  bool     echo;         // TRUE: Echo untagged commands back
+  uint32_t remoteTimer;  // Last status report time
+  uint8_t  remoteSeqnum; // Status report sequence number
+  bool     remoteLogOn;  // TRUE: Periodically report status
+  uint32_t bandwidth;    // Bytes per second for bulk output (mirror)
+  uint8_t  topicMask;    // Subscribed topics (1 << TOPIC_*)
+  uint16_t topicSeen[TOPIC_COUNT]; // Last published topic generation
+  uint16_t topicRate[TOPIC_COUNT]; // Minimum msecs between publications
+  uint32_t topicTime[TOPIC_COUNT]; // Last publication time
+  char     line[REMOTE_LINE_SIZE];  // Tagged command being received
+  uint8_t  lineLength;              // Received tagged command length
+  bool     lineOverflow;            // TRUE: Tagged command too long
+  char     queue[REMOTE_QUEUE_SIZE][REMOTE_LINE_SIZE]; // Tagged commands
+  uint8_t  queueHead;               // First queued tagged command
+  uint8_t  queueCount;              // Number of queued tagged commands
+} RemoteState;
+
+void remoteTickTime(Stream *stream, RemoteState *state);
+int remoteDoInput(Stream *stream, RemoteState *state);
+void remoteEmit(uint8_t topic);
+const char *remoteParseMemories(const char *text, Memory *list);
+void remoteSetMemories(const Memory *list);
+void remoteExportMemories(Print *out);
+char readSerialChar(Stream *stream);
+
+// Mirror.cpp
+bool mirrorStart(Stream *stream, uint32_t bandwidth);
+void mirrorStop();
+Stream *mirrorGetStream();
+void mirrorRequestFrame();
+void mirrorTickTime();
+
+// Display.cpp
+bool displayInit();
+void displayPush();
+void displayPush(int x, int y, int w, int h);
+void displayTickTime();
+void displayFlush();
+void displayCommand(uint8_t cmd);
+uint32_t displayGetId();
 
 #endif // COMMON_H
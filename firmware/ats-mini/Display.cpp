@@ -0,0 +1,238 @@
+#include "Common.h"
+
+//
+// Display output. By default, the screen buffer is pushed to the
+// display by TFT_eSPI, blocking until the transfer completes.
+//
+// When built with LCD_DMA, the display bus is handed over to the
+// ESP32-S3 LCD_CAM i80 peripheral. The screen buffer becomes a back
+// buffer: pushed rows are copied into a front buffer that a display
+// task on the other core sends to the display with DMA. While a
+// transfer is in progress, new pushes are collected and sent as soon
+// as the display is free, so only the latest frame is shown.
+//
+
+#ifdef LCD_DMA
+
+#include "esp_lcd_panel_io.h"
+#include "esp_lcd_io_i80.h"
+
+#define DISPLAY_PCLK_HZ  20000000  // i80 bus write clock
+#define DISPLAY_FPS            50  // Maximum display frames per second
+#define DISPLAY_ROW_OFFSET     35  // 170 pixel panel offset in rotation 3, as in TFT_eSPI
+
+static esp_lcd_panel_io_handle_t displayIO = 0;
+static SemaphoreHandle_t displayDone;  // Given when a DMA transfer completes
+static TaskHandle_t displayTask;       // Task sending front buffer to the display
+static uint16_t *displayFront = 0;     // Front buffer, owned by the display task when busy
+static volatile bool displayBusy;      // TRUE: Display task is sending front buffer
+static int16_t displayY0, displayY1;   // Rows pushed since the last transfer
+static uint32_t displayId;             // Display ID read at startup
+
+//
+// Called from interrupt when a DMA transfer completes
+//
+static bool displayTransferDone(esp_lcd_panel_io_handle_t io, esp_lcd_panel_io_event_data_t *event, void *ctx)
+{
+  BaseType_t woken = pdFALSE;
+  xSemaphoreGiveFromISR(displayDone, &woken);
+  return(woken==pdTRUE);
+}
+
+//
+// Display task, sends rows of the front buffer to the display
+//
+static void displayTaskLoop(void *arg)
+{
+  uint32_t lastTime = 0;
+
+  for(;;)
+  {
+    uint32_t rows;
+    xTaskNotifyWait(0, 0xFFFFFFFF, &rows, portMAX_DELAY);
+
+    // Frame pacing, pushes arriving meanwhile are coalesced by loop()
+    uint32_t elapsed = millis() - lastTime;
+    if(elapsed < 1000 / DISPLAY_FPS) vTaskDelay(pdMS_TO_TICKS(1000 / DISPLAY_FPS - elapsed));
+    lastTime = millis();
+
+    int y0 = (rows >> 16) + DISPLAY_ROW_OFFSET;
+    int y1 = (rows & 0xFFFF) + DISPLAY_ROW_OFFSET;
+    int width = spr.width();
+    uint8_t caset[4] = { 0, 0, (uint8_t)((width - 1) >> 8), (uint8_t)(width - 1) };
+    uint8_t raset[4] = { (uint8_t)(y0 >> 8), (uint8_t)y0, (uint8_t)(y1 >> 8), (uint8_t)y1 };
+
+    esp_lcd_panel_io_tx_param(displayIO, ST7789_CASET, caset, sizeof(caset));
+    esp_lcd_panel_io_tx_param(displayIO, ST7789_RASET, raset, sizeof(raset));
+    esp_lcd_panel_io_tx_color(
+      displayIO, ST7789_RAMWR,
+      displayFront + (rows >> 16) * width,
+      (y1 - y0 + 1) * width * sizeof(uint16_t)
+    );
+
+    // Wait for the transfer, then give front buffer back to loop()
+    xSemaphoreTake(displayDone, portMAX_DELAY);
+    displayBusy = false;
+  }
+}
+
+//
+// Initialize display output, call after creating the screen buffer
+//
+bool displayInit()
+{
+  size_t size = spr.width() * spr.height() * sizeof(uint16_t);
+
+  // Display bus will not be readable once the i80 peripheral has it
+  displayId = tft.readcommand32(ST7789_RDDID, 1);
+
+  displayFront = (uint16_t *)heap_caps_aligned_alloc(64, size, MALLOC_CAP_SPIRAM);
+  displayDone  = xSemaphoreCreateBinary();
+  if(!displayFront || !displayDone) return(false);
+
+  esp_lcd_i80_bus_handle_t bus;
+  esp_lcd_i80_bus_config_t busConfig = {};
+  busConfig.dc_gpio_num = TFT_DC;
+  busConfig.wr_gpio_num = TFT_WR;
+  busConfig.clk_src = LCD_CLK_SRC_DEFAULT;
+  busConfig.data_gpio_nums[0] = TFT_D0;
+  busConfig.data_gpio_nums[1] = TFT_D1;
+  busConfig.data_gpio_nums[2] = TFT_D2;
+  busConfig.data_gpio_nums[3] = TFT_D3;
+  busConfig.data_gpio_nums[4] = TFT_D4;
+  busConfig.data_gpio_nums[5] = TFT_D5;
+  busConfig.data_gpio_nums[6] = TFT_D6;
+  busConfig.data_gpio_nums[7] = TFT_D7;
+  busConfig.bus_width = 8;
+  busConfig.max_transfer_bytes = size;
+  busConfig.dma_burst_size = 64;
+  if(esp_lcd_new_i80_bus(&busConfig, &bus)!=ESP_OK) return(false);
+
+  esp_lcd_panel_io_i80_config_t ioConfig = {};
+  ioConfig.cs_gpio_num = TFT_CS;
+  ioConfig.pclk_hz = DISPLAY_PCLK_HZ;
+  ioConfig.trans_queue_depth = 4;
+  ioConfig.on_color_trans_done = displayTransferDone;
+  ioConfig.lcd_cmd_bits = 8;
+  ioConfig.lcd_param_bits = 8;
+  ioConfig.dc_levels.dc_data_level = 1;
+  if(esp_lcd_new_panel_io_i80(bus, &ioConfig, &displayIO)!=ESP_OK) return(false);
+
+  // Arduino loop() runs on core 1, send frames from core 0
+  displayY0 = spr.height();
+  displayY1 = -1;
+  xTaskCreatePinnedToCore(displayTaskLoop, "display", 4096, 0, 2, &displayTask, 0);
+  return(true);
+}
+
+//
+// Push screen buffer area to the display. The DMA transfer works on
+// whole rows, columns are ignored.
+//
+void displayPush(int x, int y, int w, int h)
+{
+  // Fall back to TFT_eSPI until the i80 bus is up
+  if(!displayIO)
+  {
+    spr.pushSprite(x, y, x, y, w, h);
+    return;
+  }
+
+  displayY0 = y < displayY0? y : displayY0;
+  displayY1 = y + h - 1 > displayY1? y + h - 1 : displayY1;
+  displayTickTime();
+}
+
+//
+// Tick display time, handing pushed rows to the display task
+//
+void displayTickTime()
+{
+  // Nothing to send or front buffer still in use
+  if(displayY1 < displayY0 || displayBusy) return;
+
+  // Screen buffer holds the latest frame, take the rows from it
+  int width = spr.width();
+  const uint16_t *fb = (const uint16_t *)spr.getPointer();
+  memcpy(
+    displayFront + displayY0 * width,
+    fb + displayY0 * width,
+    (displayY1 - displayY0 + 1) * width * sizeof(uint16_t)
+  );
+
+  displayBusy = true;
+  xTaskNotify(displayTask, (displayY0 << 16) | displayY1, eSetValueWithOverwrite);
+  displayY0 = spr.height();
+  displayY1 = -1;
+}
+
+//
+// Wait until all pushed rows have been sent to the display
+//
+void displayFlush()
+{
+  while(displayIO && (displayBusy || displayY1 >= displayY0))
+  {
+    displayTickTime();
+    delay(1);
+  }
+}
+
+//
+// Send command to the display
+//
+void displayCommand(uint8_t cmd)
+{
+  if(!displayIO)
+  {
+    tft.writecommand(cmd);
+    return;
+  }
+
+  // Commands must not interleave with pixel data
+  displayFlush();
+  esp_lcd_panel_io_tx_param(displayIO, cmd, 0, 0);
+}
+
+//
+// Get display ID
+//
+uint32_t displayGetId()
+{
+  return(displayIO? displayId : tft.readcommand32(ST7789_RDDID, 1));
+}
+
+#else // !LCD_DMA
+
+bool displayInit()
+{
+  return(true);
+}
+
+void displayPush(int x, int y, int w, int h)
+{
+  spr.pushSprite(x, y, x, y, w, h);
+}
+
+void displayTickTime() {}
+void displayFlush() {}
+
+void displayCommand(uint8_t cmd)
+{
+  tft.writecommand(cmd);
+}
+
+uint32_t displayGetId()
+{
+  return(tft.readcommand32(ST7789_RDDID, 1));
+}
+
+#endif // LCD_DMA
+
+//
+// Push the whole screen buffer to the display
+//
+void displayPush()
+{
+  displayPush(0, 0, spr.width(), spr.height());
+}
@@ -4,13 +4,40 @@
 #include "Utils.h"
 #include "Menu.h"
 #include "Draw.h"
+#include "splash_data.h"
+
+#define DRAW_MAX_WIDGETS  24  // Maximum number of widgets in a layout
+#define DRAW_MAX_PASSES    3  // Maximum partial drawing passes per frame
+
+//
+// Screen widget: a screen area that only changes when the value
+// returned by its hash function changes. The area must cover every
+// pixel the widget may draw.
+//
+struct Widget
+{
+  int16_t x, y, w, h;
+  uint32_t (*hash)();
+};
+
+static uint32_t drawHashes[DRAW_MAX_WIDGETS]; // Widget hashes on screen
+static uint8_t drawLayoutIdx;   // Layout on screen
+static uint8_t drawThemeIdx;    // Theme on screen
+static bool drawValid = false;  // TRUE: Screen can be drawn partially
+static bool drawSaveIcon;       // Save indicator state for this frame
+static bool drawLayerOn;        // TRUE: Static layout parts come from the background layer
+
+static uint8_t drawMaxFps = DRAW_MAX_FPS; // Maximum frames per second
+static uint8_t drawPending = 0;           // Highest pending redraw priority
+static uint32_t drawTime = 0;             // Last frame drawing time (ms)
+static DrawStats drawStats = { .timeMin = 0xFFFFFFFF };
 
 //
 // Draw preferences write indicator
 //
 void drawSaveIndicator(int x, int y)
 {
-  if(prefsAreWritten() || switchThemeEditor())
+  if(drawSaveIcon)
   {
     // Draw preferences write request icon
     spr.fillRect(x+3, y+2, 3, 5, TH.save_icon);
@@ -52,6 +79,9 @@ void drawWiFiIndicator(int x, int y)
 {
   int8_t status = getWiFiStatus();
 
+  // Icon is static, it may come from the background layer
+  if(drawLayerOn) return;
+
   // If need to draw WiFi icon...
   if(status || switchThemeEditor())
   {
@@ -107,7 +137,44 @@ void drawMessage(const char *msg)
   if(sleepOn()) return;
 
   drawZoomedMenu(msg, true);
-  spr.pushSprite(0, 0);
+  displayPush();
+  drawInvalidate();
+  mirrorRequestFrame();
+}
+
+//
+// Decode compressed splash screen into the screen buffer and push it
+//
+void drawSplash()
+{
+  uint16_t *fb = (uint16_t *)spr.getPointer();
+  int size = spr.width() * spr.height();
+
+  if(!fb || (spr.width()!=SPLASH_WIDTH) || (spr.height()!=SPLASH_HEIGHT)) return;
+
+  for(int j=0, k=0 ; (j<(int)sizeof(splash_data)) && (k<size) ; )
+  {
+    uint8_t n = pgm_read_byte(&splash_data[j++]);
+    int run = n<0x80? n + 1 : n - 0x80 + 2;
+    run = k + run > size? size - k : run;
+
+    if(n<0x80)
+    {
+      // Literal pixels
+      memcpy_P(fb + k, &splash_data[j], run * sizeof(uint16_t));
+      j += (n + 1) * sizeof(uint16_t);
+      k += run;
+    }
+    else
+    {
+      // Repeated pixel
+      uint16_t c = pgm_read_byte(&splash_data[j]) | (pgm_read_byte(&splash_data[j+1]) << 8);
+      for(j+=2 ; run-- ; ) fb[k++] = c;
+    }
+  }
+
+  displayPush();
+  drawInvalidate();
 }
 
 //
@@ -127,26 +194,205 @@ void drawBandAndMode(const char *band, const char *mode, int x, int y)
 }
 
 //
-// Draw radio text
+// Glyph atlas: frequency digits pre-rendered in the current theme
+// colors, copied into the screen buffer instead of being rasterized
+// on every frame
 //
-void drawRadioText(int y, int ymax)
+#define ATLAS_GLYPHS "0123456789."
+
+struct GlyphAtlas
 {
-  const char *rt = getRadioText();
+  uint8_t font;             // TFT_eSPI font number
+  TFT_eSprite *sprite;      // Glyphs side by side
+  uint16_t fg, bg;          // Colors the glyphs were rendered with
+  uint16_t offset[sizeof(ATLAS_GLYPHS)]; // Glyph offsets, last is atlas width
+};
 
-  // Draw potentially multi-line radio text
-  spr.setTextDatum(TC_DATUM);
-  spr.setTextColor(TH.rds_text);
-  for(; *rt && (y<ymax) ; y+=17, rt+=strlen(rt)+1)
-    spr.drawString(rt, 160, y, 2);
+static GlyphAtlas atlasLarge = { .font = 7 };
+static GlyphAtlas atlasSmall = { .font = 4 };
 
-  // Show program info if we have it and there is enough space
-  if((y<ymax) && *getProgramInfo())
-    spr.drawString(getProgramInfo(), 160, y, 2);
+//
+// Get glyph width in the given font
+//
+static int glyphWidth(char c, uint8_t font)
+{
+  char text[2] = { c, '\0' };
+  return(spr.textWidth(text, font));
+}
+
+//
+// Render atlas glyphs in given colors, return FALSE if out of memory
+//
+static bool atlasBuild(GlyphAtlas *atlas, uint16_t fg, uint16_t bg)
+{
+  // Atlas is up to date
+  if(atlas->sprite && atlas->sprite->created() && (atlas->fg==fg) && (atlas->bg==bg))
+    return(true);
+
+  if(!atlas->sprite)
+  {
+    // Lay glyphs out side by side
+    for(int j=0 ; ATLAS_GLYPHS[j] ; j++)
+      atlas->offset[j + 1] = atlas->offset[j] + glyphWidth(ATLAS_GLYPHS[j], atlas->font);
+
+    atlas->sprite = new TFT_eSprite(&tft);
+  }
+
+  if(!atlas->sprite->created() &&
+     !atlas->sprite->createSprite(atlas->offset[sizeof(ATLAS_GLYPHS) - 1], spr.fontHeight(atlas->font)))
+    return(false);
+
+  atlas->sprite->fillSprite(bg);
+  atlas->sprite->setTextColor(fg);
+  atlas->sprite->setTextDatum(TL_DATUM);
+  for(int j=0 ; ATLAS_GLYPHS[j] ; j++)
+  {
+    char text[2] = { ATLAS_GLYPHS[j], '\0' };
+    atlas->sprite->drawString(text, atlas->offset[j], 0, atlas->font);
+  }
+
+  atlas->fg = fg;
+  atlas->bg = bg;
+  return(true);
+}
+
+//
+// Clip area to the current viewport
+//
+static void drawClip(int x, int y, int w, int h, int *x0, int *y0, int *x1, int *y1)
+{
+  int vx0 = spr.getViewportX();
+  int vy0 = spr.getViewportY();
+  int vx1 = vx0 + spr.getViewportWidth();
+  int vy1 = vy0 + spr.getViewportHeight();
+
+  *x0 = x > vx0? x : vx0;
+  *y0 = y > vy0? y : vy0;
+  *x1 = x + w < vx1? x + w : vx1;
+  *y1 = y + h < vy1? y + h : vy1;
+}
+
+//
+// Copy w x h pixels from a sprite at sx, sy into the screen buffer at
+// x, y. Clipped to the current viewport.
+//
+static void drawBlit(TFT_eSprite *from, int sx, int sy, int x, int y, int w, int h)
+{
+  const uint16_t *src = (const uint16_t *)from->getPointer();
+  uint16_t *dst = (uint16_t *)spr.getPointer();
+  int srcWidth = from->width();
+  int dstWidth = spr.width();
+  int x0, y0, x1, y1;
+
+  drawClip(x, y, w, h, &x0, &y0, &x1, &y1);
+
+  for(int row=y0 ; (x1 > x0) && (row < y1) ; row++)
+    memcpy(
+      dst + row * dstWidth + x0,
+      src + (row - y + sy) * srcWidth + sx + x0 - x,
+      (x1 - x0) * sizeof(uint16_t)
+    );
+}
+
+//
+// Same as drawBlit(), skipping pixels of the given background color
+//
+static void drawBlitText(TFT_eSprite *from, int sx, int sy, int x, int y, int w, int h, uint16_t bg)
+{
+  const uint16_t *src = (const uint16_t *)from->getPointer();
+  uint16_t *dst = (uint16_t *)spr.getPointer();
+  int srcWidth = from->width();
+  int dstWidth = spr.width();
+  int x0, y0, x1, y1;
+
+  // Sprite pixels are stored byte swapped
+  bg = (bg >> 8) | (bg << 8);
+
+  drawClip(x, y, w, h, &x0, &y0, &x1, &y1);
+
+  for(int row=y0 ; row<y1 ; row++)
+  {
+    const uint16_t *s = src + (row - y + sy) * srcWidth + sx + x0 - x;
+    uint16_t *d = dst + row * dstWidth + x0;
+
+    for(int col=x0 ; col<x1 ; col++, s++, d++)
+      if(*s!=bg) *d = *s;
+  }
+}
+
+//
+// Copy text glyphs from the atlas into the screen buffer, with the
+// top left corner at x, y
+//
+static void atlasDraw(GlyphAtlas *atlas, const char *text, int x, int y)
+{
+  for(; *text ; text++)
+  {
+    const char *p = strchr(ATLAS_GLYPHS, *text);
+    if(!p) continue;
+
+    int j = p - ATLAS_GLYPHS;
+    int w = atlas->offset[j + 1] - atlas->offset[j];
+    drawBlit(atlas->sprite, atlas->offset[j], 0, x, y, w, atlas->sprite->height());
+    x += w;
+  }
+}
+
+//
+// Draw text using the atlas if possible, aligned as TFT_eSPI would
+// with ML_DATUM (right = false) or MR_DATUM (right = true)
+//
+static void drawDigits(GlyphAtlas *atlas, const char *text, int x, int y, bool right)
+{
+  if(!atlasBuild(atlas, TH.freq_text, TH.bg))
+  {
+    // Out of memory, rasterize glyphs
+    spr.setTextDatum(right? MR_DATUM : ML_DATUM);
+    spr.setTextColor(TH.freq_text);
+    spr.drawString(text, x, y, atlas->font);
+    return;
+  }
+
+  int width = 0;
+  for(const char *p = text ; *p ; p++) width += glyphWidth(*p, atlas->font);
+
+  atlasDraw(atlas, text, right? x - width : x, y - atlas->sprite->height() / 2);
+}
+
+//
+// Format frequency into large and small (sub-kHz) digits
+//
+static void drawFreqDigits(char *large, char *small, uint32_t freq)
+{
+  if(currentMode==FM)
+  {
+    sprintf(large, "%.2f", freq / 100.0);
+    *small = '\0';
+  }
+  else if(isSSB())
+  {
+    freq = freq * 1000 + currentBFO;
+    sprintf(large, "%3.3lu", freq / 1000);
+    sprintf(small, ".%3.3lu", freq % 1000);
+  }
+  else
+  {
+    sprintf(large, "%lu", freq);
+    strcpy(small, ".000");
+  }
 }
 
 //
 // Draw frequency
 //
+void drawFrequencyUnits(int x, int y)
+{
+  // FM frequencies are measured in MHz, SSB/AM frequencies in kHz
+  spr.setTextDatum(ML_DATUM);
+  spr.setTextColor(TH.funit_text);
+  spr.drawString(currentMode==FM? "MHz" : "kHz", x, y);
+}
+
 void drawFrequency(uint32_t freq, int x, int y, int ux, int uy, uint8_t hl)
 {
   struct Line { int x, y, w; };
@@ -190,48 +436,21 @@ void drawFrequency(uint32_t freq, int x, int y, int ux, int uy, uint8_t hl)
   // Lower 7 bits specify the selected digit
   hl &= 0x7F;
 
-  spr.setTextDatum(MR_DATUM);
-  spr.setTextColor(TH.freq_text);
+  char large[16], small[8];
 
+  // Large digits are right aligned, small digits follow them
+  drawFreqDigits(large, small, freq);
+  drawDigits(&atlasLarge, large, x, y, true);
+  if(*small) drawDigits(&atlasSmall, small, 4+x, 17+y, false);
+
+  // Determine where underscore is located
   if(currentMode==FM)
-  {
-    // Determine where underscore is located
     li = hl<ITEM_COUNT(hlDigitsFM)? &hlDigitsFM[hl] : 0;
-
-    // FM frequency
-    spr.drawFloat(freq/100.00, 2, x, y, 7);
-    spr.setTextDatum(ML_DATUM);
-    spr.setTextColor(TH.funit_text);
-    spr.drawString("MHz", ux, uy);
-  }
   else
-  {
-    // Determine where underscore is located
     li = hl<ITEM_COUNT(hlDigitsAMSSB)? &hlDigitsAMSSB[hl] : 0;
 
-    if(isSSB())
-    {
-      // SSB frequency
-      char text[32];
-      freq = freq * 1000 + currentBFO;
-      sprintf(text, "%3.3lu", freq / 1000);
-      spr.drawString(text, x, y, 7);
-      spr.setTextDatum(ML_DATUM);
-      sprintf(text, ".%3.3lu", freq % 1000);
-      spr.drawString(text, 4+x, 17+y, 4);
-    }
-    else
-    {
-      // AM frequency
-      spr.drawNumber(freq, x, y, 7);
-      spr.setTextDatum(ML_DATUM);
-      spr.drawString(".000", 4+x, 17+y, 4);
-    }
-
-    // SSB/AM frequencies are measured in kHz
-    spr.setTextColor(TH.funit_text);
-    spr.drawString("kHz", ux, uy);
-  }
+  // Units are static, they may come from the background layer
+  if(!drawLayerOn) drawFrequencyUnits(ux, uy);
 
   // If drawing an underscore...
   if(li)
@@ -272,7 +491,7 @@ void drawScale(uint32_t freq)
   freq = freq / 10 - 20 - slack;
 
   // Get band edges
-  const Band *band = getCurrentBand();
+  const BandPlan *band = getCurrentBand()->plan;
   uint32_t minFreq = band->minimumFreq / 10;
   uint32_t maxFreq = band->maximumFreq / 10;
 
@@ -311,10 +530,16 @@ void drawScale(uint32_t freq)
 //
 // Draw S-meter
 //
-void drawSMeter(int strength, int x, int y)
+void drawSMeterIcon(int x, int y)
 {
   spr.drawTriangle(x + 1, y + 1, x + 11, y + 1, x + 6, y + 6, TH.smeter_icon);
   spr.drawLine(x + 6, y + 1, x + 6, y + 14, TH.smeter_icon);
+}
+
+void drawSMeter(int strength, int peak, int x, int y)
+{
+  // Icon is static, it may come from the background layer
+  if(!drawLayerOn) drawSMeterIcon(x, y);
 
   for(int i=0 ; i<strength ; i++)
   {
@@ -323,6 +548,10 @@ void drawSMeter(int strength, int x, int y)
     else
       spr.fillRect(15+x + (i*4), 2+y, 2, 12, TH.smeter_bar_plus);
   }
+
+  // Peak hold marker
+  if(peak>strength)
+    spr.fillRect(15+x + ((peak-1)*4), 2+y, 2, 12, peak>10? TH.smeter_bar_plus : TH.smeter_bar);
 }
 
 //
@@ -348,11 +577,469 @@ void drawStationName(const char *name, int x, int y)
   spr.drawString(name, x, y, 4);
 }
 
+//
+// Scan graphs: background grid layer, rendered once per theme, and
+// scan data converted to graph heights once per scan update
+//
+#define SCAN_GRAPH_Y      129  // Top graph row
+#define SCAN_GRAPH_HEIGHT  40  // Graph height (rows)
+#define SCAN_GRID_PERIOD   40  // Vertical grid line spacing (pixels)
+
+static TFT_eSprite *scanGrid = 0;
+static uint16_t scanGridFg, scanGridBg;
+
+static uint8_t scanLevelRSSI[SCAN_POINTS];
+static uint8_t scanLevelSNR[SCAN_POINTS];
+static uint16_t scanLevelStart, scanLevelStep, scanLevelCount;
+static uint16_t scanLevelUpdates;
+
+//
+// Render grid layer: dotted horizontal lines every 10 rows and dotted
+// vertical lines every SCAN_GRID_PERIOD pixels, return FALSE if out
+// of memory
+//
+static bool scanGridBuild()
+{
+  if(!scanGrid) scanGrid = new TFT_eSprite(&tft);
+
+  if(scanGrid->created() && (scanGridFg==TH.scan_grid) && (scanGridBg==TH.bg))
+    return(true);
+
+  if(!scanGrid->created() &&
+     !scanGrid->createSprite(spr.width() + SCAN_GRID_PERIOD, SCAN_GRAPH_HEIGHT + 1))
+    return(false);
+
+  scanGrid->fillSprite(TH.bg);
+
+  for(int y=0 ; y<=SCAN_GRAPH_HEIGHT ; y+=2)
+    for(int x=0 ; x<scanGrid->width() ; x+=2)
+      if(!(y % 10) || !(x % SCAN_GRID_PERIOD))
+        scanGrid->drawPixel(x, y, TH.scan_grid);
+
+  scanGridFg = TH.scan_grid;
+  scanGridBg = TH.bg;
+  return(true);
+}
+
+//
+// Convert scan data to graph heights, if it has changed
+//
+static void scanLevelsUpdate()
+{
+  uint16_t start, step;
+  uint16_t count = scanGetPoints(&start, &step);
+
+  if((scanLevelUpdates==scanGetUpdates()) && (scanLevelCount==count)) return;
+
+  scanLevelUpdates = scanGetUpdates();
+  scanLevelCount   = count;
+  scanLevelStart   = start;
+  scanLevelStep    = step;
+
+  uint8_t minRSSI = 255, maxRSSI = 0, minSNR = 255, maxSNR = 0;
+
+  for(int j=0 ; j<count ; j++)
+  {
+    scanGetPoint(j, &scanLevelRSSI[j], &scanLevelSNR[j]);
+    minRSSI = scanLevelRSSI[j] < minRSSI? scanLevelRSSI[j] : minRSSI;
+    maxRSSI = scanLevelRSSI[j] > maxRSSI? scanLevelRSSI[j] : maxRSSI;
+    minSNR  = scanLevelSNR[j] < minSNR? scanLevelSNR[j] : minSNR;
+    maxSNR  = scanLevelSNR[j] > maxSNR? scanLevelSNR[j] : maxSNR;
+  }
+
+  for(int j=0 ; j<count ; j++)
+  {
+    scanLevelRSSI[j] = SCAN_GRAPH_HEIGHT * (scanLevelRSSI[j] - minRSSI) / (maxRSSI - minRSSI + 1);
+    scanLevelSNR[j]  = SCAN_GRAPH_HEIGHT * (scanLevelSNR[j] - minSNR) / (maxSNR - minSNR + 1);
+  }
+}
+
+//
+// Get scan data index for given frequency, -1 if none
+//
+static int scanLevelIndex(int freq)
+{
+  if((freq < scanLevelStart) || (freq >= scanLevelStart + scanLevelStep * scanLevelCount))
+    return(-1);
+
+  return((freq - scanLevelStart) / scanLevelStep);
+}
+
+//
+// Draw scan graphs
+//
+void drawScanGraphs(uint32_t freq)
+{
+  // Scale offset
+  int16_t offset = (freq % 10) / 10.0 * 8;
+
+  // Start drawing frequencies from the left
+  int f0 = freq / 10 - 20;
+
+  // Get band edges
+  const BandPlan *band = getCurrentBand()->plan;
+  int minFreq = band->minimumFreq / 10;
+  int maxFreq = band->maximumFreq / 10;
+
+  // Columns within the band, graph segments go from a column to the
+  // next one, vertical grid lines are on multiples of 5
+  int first = minFreq > f0? minFreq - f0 : 0;
+  int last  = maxFreq < f0 + 41? maxFreq - f0 : 41;
+  int xv    = (5 - (f0 % 5 + 5) % 5) % 5 * 8 - offset;
+  int shift = (SCAN_GRID_PERIOD - xv % SCAN_GRID_PERIOD) % SCAN_GRID_PERIOD;
+
+  if((first <= last) && (first <= 40) && scanGridBuild())
+  {
+    // Grid is opaque, nothing else is drawn under the graphs
+    int x0 = first * 8 - offset;
+    int x1 = last * 8 - offset;
+    drawBlit(scanGrid, x0 + shift, 0, x0, SCAN_GRAPH_Y, x1 - x0, SCAN_GRAPH_HEIGHT + 1);
+
+    // Vertical line at the band end
+    if((last <= 40) && !((f0 + last) % 5))
+      for(int y=0 ; y<=SCAN_GRAPH_HEIGHT ; y+=2)
+        spr.drawPixel(x1, SCAN_GRAPH_Y + y, TH.scan_grid);
+  }
+
+  // Graph lines between neighboring frequencies
+  scanLevelsUpdate();
+  for(int i=first ; i<last ; i++)
+  {
+    int16_t x = i * 8 - offset;
+    int j1 = scanLevelIndex((f0 + i) * 10);
+    int j2 = scanLevelIndex((f0 + i + 1) * 10);
+    int snr1  = j1 >= 0? scanLevelSNR[j1] : 0;
+    int snr2  = j2 >= 0? scanLevelSNR[j2] : 0;
+    int rssi1 = j1 >= 0? scanLevelRSSI[j1] : 0;
+    int rssi2 = j2 >= 0? scanLevelRSSI[j2] : 0;
+
+    spr.drawLine(x, 169-snr1, x+8, 169-snr2, TH.scan_snr);
+    spr.drawLine(x, 169-rssi1, x+8, 169-rssi2, TH.scan_rssi);
+  }
+
+  // Scale pointer
+  spr.fillTriangle(156, 125, 160, 130, 164, 125, TH.scale_pointer);
+  spr.drawLine(160, 130, 160, 169, TH.scale_pointer);
+}
+
+//
+// Background layer: static parts of the current layout, rendered once
+// per theme, layout, and layer state, copied in place of clearing the
+// screen buffer. The state covers things that rarely change, such as
+// units, icons, and meter legends.
+//
+static TFT_eSprite *layerBg = 0;
+static uint8_t layerThemeIdx;
+static uint8_t layerLayoutIdx;
+static uint32_t layerState;
+static bool layerValid = false;
+
+//
+// Copy screen buffer area into a sprite of the same size
+//
+static void layerGrab(TFT_eSprite *to, int x, int y)
+{
+  const uint16_t *src = (const uint16_t *)spr.getPointer();
+  uint16_t *dst = (uint16_t *)to->getPointer();
+
+  for(int row=0 ; row<to->height() ; row++)
+    memcpy(
+      dst + row * to->width(),
+      src + (row + y) * spr.width() + x,
+      to->width() * sizeof(uint16_t)
+    );
+}
+
+//
+// Allocate sprite once, return FALSE if out of memory
+//
+static bool layerAlloc(TFT_eSprite **sprite, int w, int h)
+{
+  if(!*sprite) *sprite = new TFT_eSprite(&tft);
+  return((*sprite)->created() || (*sprite)->createSprite(w, h));
+}
+
+//
+// Render background layer for the current theme, layout, and layer
+// state, using the screen buffer as scratch space. Return FALSE if
+// out of memory.
+//
+static bool layerBuild(uint32_t state, const char *statusLine1, const char *statusLine2)
+{
+  // Layer is up to date
+  if(layerValid && (layerThemeIdx==themeIdx) && (layerLayoutIdx==uiLayoutIdx) && (layerState==state))
+    return(true);
+
+  layerValid = false;
+  if(!layerAlloc(&layerBg, spr.width(), spr.height())) return(false);
+
+  // Static layout parts, drawn directly
+  drawLayerOn = false;
+  spr.fillSprite(TH.bg);
+  switch(uiLayoutIdx)
+  {
+    case UI_SMETER:
+      drawLayoutSmeterStatic(statusLine1, statusLine2);
+      break;
+    default:
+      drawLayoutDefaultStatic(statusLine1, statusLine2);
+      break;
+  }
+  layerGrab(layerBg, 0, 0);
+
+  // Screen buffer contents are gone, redraw it whole
+  drawValid = false;
+
+  layerThemeIdx  = themeIdx;
+  layerLayoutIdx = uiLayoutIdx;
+  layerState     = state;
+  layerValid     = true;
+  return(true);
+}
+
+//
+// Clear screen buffer area to the background
+//
+static void layerClear(int x, int y, int w, int h)
+{
+  if(drawLayerOn)
+    drawBlit(layerBg, x, y, x, y, w, h);
+  else
+    spr.fillRect(x, y, w, h, TH.bg);
+}
+
+//
+// Returns TRUE if static layout parts come from the background layer
+//
+bool drawLayerActive()
+{
+  return(drawLayerOn);
+}
+
+//
+// Draw side bar frame, for a menu or for the information box
+//
+void drawSideBarFrame(int x, int y, int sx, bool menu)
+{
+  spr.fillSmoothRoundRect(1+x, 1+y, 76+sx, 110, 4, menu? TH.menu_border : TH.box_border);
+  spr.fillSmoothRoundRect(2+x, 2+y, 74+sx, 108, 4, menu? TH.menu_bg : TH.box_bg);
+}
+
+//
+// Text hash functions, also used by widgets
+//
+#define HASH_INIT 2166136261u
+
+static uint32_t hashMix(uint32_t hash, uint32_t value)
+{
+  return((hash ^ value) * 16777619u);
+}
+
+static uint32_t hashStr(uint32_t hash, const char *s)
+{
+  for(; s && *s ; s++) hash = hashMix(hash, (uint8_t)*s);
+  return(hashMix(hash, 0));
+}
+
+static uint32_t hashRadioText(uint32_t hash)
+{
+  // Radio text is multi-line, terminated by an empty line
+  for(const char *rt = getRadioText() ; *rt ; rt += strlen(rt) + 1)
+    hash = hashStr(hash, rt);
+
+  return(hashStr(hash, getProgramInfo()));
+}
+
+//
+// Text cache: radio text and long station names change every few
+// seconds at most. They are rendered into sprites when changed and
+// copied into the screen buffer. Overlong names scroll by copying a
+// different part of the cached text.
+//
+#define TEXT_RT_LINES        2  // Radio text lines cached
+#define TEXT_NAME_WIDTH    480  // Longest station name cached (pixels)
+#define TEXT_NAME_GAP       40  // Gap between scrolled name copies (pixels)
+#define TEXT_SCROLL_TIME    40  // Time to scroll by one pixel (ms)
+#define TEXT_SCROLL_PAUSE   50  // Scroll steps to wait at the start
+
+struct TextCache
+{
+  TFT_eSprite *sprite;
+  uint32_t key;       // Hash of the text that was rendered
+  uint16_t fg, bg;    // Colors the text was rendered with
+  uint8_t rdsMode;    // RDS mode the text was rendered for
+  int16_t size;       // Text width or height
+  uint32_t time;      // Time the text was rendered
+  bool valid;
+};
+
+static TextCache textRadio;
+static TextCache textName;
+static int16_t textNameX = 320; // Long station name position
+
+//
+// Returns TRUE if cached text is up to date
+//
+static bool textCacheValid(const TextCache *cache, uint32_t key)
+{
+  return(
+    cache->valid && (cache->key==key) &&
+    (cache->rdsMode==getRDSMode()) && (cache->fg==TH.rds_text) && (cache->bg==TH.bg)
+  );
+}
+
+//
+// Mark cached text as up to date
+//
+static void textCacheDone(TextCache *cache, uint32_t key, int size)
+{
+  cache->key     = key;
+  cache->rdsMode = getRDSMode();
+  cache->fg      = TH.rds_text;
+  cache->bg      = TH.bg;
+  cache->size    = size;
+  cache->time    = millis();
+  cache->valid   = true;
+}
+
+//
+// Render radio text lines and program info, return FALSE if out of
+// memory. The cached size is the height of the rendered text.
+//
+static bool textRadioBuild(int height)
+{
+  uint32_t key = hashRadioText(hashMix(HASH_INIT, height));
+  if(textCacheValid(&textRadio, key)) return(true);
+
+  textRadio.valid = false;
+  if(!layerAlloc(&textRadio.sprite, spr.width(), 17 * TEXT_RT_LINES)) return(false);
+
+  TFT_eSprite *s = textRadio.sprite;
+  const char *rt = getRadioText();
+  int y;
+
+  s->fillSprite(TH.bg);
+  s->setTextDatum(TC_DATUM);
+  s->setTextColor(TH.rds_text);
+
+  // Draw potentially multi-line radio text
+  for(y=0 ; *rt && (y<height) ; y+=17, rt+=strlen(rt)+1)
+    s->drawString(rt, 160, y, 2);
+
+  // Show program info if we have it and there is enough space
+  if((y<height) && *getProgramInfo())
+  {
+    s->drawString(getProgramInfo(), 160, y, 2);
+    y += 17;
+  }
+
+  textCacheDone(&textRadio, key, y);
+  return(true);
+}
+
+//
+// Render long station name, return FALSE if out of memory or if the
+// name is too long. The cached size is the width of the name.
+//
+static bool textNameBuild(const char *name)
+{
+  uint32_t key = hashStr(HASH_INIT, name);
+  if(textCacheValid(&textName, key)) return(true);
+
+  int width = spr.textWidth(name, 2);
+
+  textName.valid = false;
+  if((width > TEXT_NAME_WIDTH) || !layerAlloc(&textName.sprite, TEXT_NAME_WIDTH, 16))
+    return(false);
+
+  textName.sprite->fillSprite(TH.bg);
+  textName.sprite->setTextDatum(TL_DATUM);
+  textName.sprite->setTextColor(TH.rds_text);
+  textName.sprite->drawString(name, 0, 0, 2);
+
+  textCacheDone(&textName, key, width);
+  return(true);
+}
+
+//
+// Returns TRUE if the long station name on screen is scrolling
+//
+static bool textNameScrolling()
+{
+  return(
+    ((uint8_t)*getStationName()==0xFF) &&
+    textCacheValid(&textName, hashStr(HASH_INIT, getStationName() + 1)) &&
+    (textName.size > spr.width() - textNameX)
+  );
+}
+
+//
+// Get long station name scroll offset for the current frame
+//
+static int textNameOffset()
+{
+  if(!textNameScrolling()) return(0);
+
+  int step = (drawTime - textName.time) / TEXT_SCROLL_TIME;
+  step %= TEXT_SCROLL_PAUSE + textName.size + TEXT_NAME_GAP;
+  return(step < TEXT_SCROLL_PAUSE? 0 : step - TEXT_SCROLL_PAUSE);
+}
+
+//
+// Draw radio text
+//
+void drawRadioText(int y, int ymax)
+{
+  // Draw cached text, if possible
+  if((ymax - y <= 17 * TEXT_RT_LINES) && textRadioBuild(ymax - y))
+  {
+    drawBlitText(textRadio.sprite, 0, 0, 0, y, spr.width(), textRadio.size, TH.bg);
+    return;
+  }
+
+  const char *rt = getRadioText();
+
+  // Draw potentially multi-line radio text
+  spr.setTextDatum(TC_DATUM);
+  spr.setTextColor(TH.rds_text);
+  for(; *rt && (y<ymax) ; y+=17, rt+=strlen(rt)+1)
+    spr.drawString(rt, 160, y, 2);
+
+  // Show program info if we have it and there is enough space
+  if((y<ymax) && *getProgramInfo())
+    spr.drawString(getProgramInfo(), 160, y, 2);
+}
+
 //
 // Draw long (EIBI) station name
 //
 void drawLongStationName(const char *name, int x, int y)
 {
+  textNameX = x;
+
+  // Draw cached text, if possible
+  if(textNameBuild(name))
+  {
+    int width = textName.size;
+    int room  = spr.width() - x;
+
+    if(width > room)
+    {
+      // Scroll overlong name, followed by its copy
+      int offset = textNameOffset();
+      int next = x + width - offset + TEXT_NAME_GAP;
+      drawBlitText(textName.sprite, offset, 0, x, y, width - offset, 16, TH.bg);
+      if(next < spr.width())
+        drawBlitText(textName.sprite, 0, 0, next, y, spr.width() - next, 16, TH.bg);
+    }
+    else if(width <= 60)
+      drawBlitText(textName.sprite, 0, 0, x + room / 3 - width / 2, y, width, 16, TH.bg);
+    else
+      drawBlitText(textName.sprite, 0, 0, x + (room + width) / 4 - width / 2, y, width, 16, TH.bg);
+
+    return;
+  }
+
   int width = spr.textWidth(name, 2);
   spr.setTextColor(TH.rds_text);
 
@@ -374,81 +1061,398 @@ void drawLongStationName(const char *name, int x, int y)
 }
 
 //
-// Draw scan graphs
+// Widget hash functions
 //
-void drawScanGraphs(uint32_t freq)
+static uint32_t hashScaleFreq(uint32_t hash)
 {
-  // Scale offset
-  int16_t offset = (freq % 10) / 10.0 * 8;
+  hash = hashMix(hash, isSSB()? (currentFrequency + currentBFO/1000) : currentFrequency);
+  hash = hashMix(hash, (uintptr_t)getCurrentBand());
+  return(hashMix(hash, currentMode));
+}
 
-  // Start drawing frequencies from the left
-  freq = freq / 10 - 20;
+static uint32_t hashSave()
+{
+  return(drawSaveIcon);
+}
 
-  // Get band edges
-  const Band *band = getCurrentBand();
-  uint32_t minFreq = band->minimumFreq / 10;
-  uint32_t maxFreq = band->maximumFreq / 10;
+static uint32_t hashBle()
+{
+  return(getBleStatus());
+}
+
+static uint32_t hashStatus()
+{
+  return(hashMix(hashMix(HASH_INIT, getWiFiStatus()), batteryGetDisplayState()));
+}
+
+static uint32_t hashMeter()
+{
+  uint32_t hash = hashMix(HASH_INIT, getStrength(rssi));
+  hash = hashMix(hash, getStrength(rssiPeak));
+  return(hashMix(hash, (currentMode==FM) && rx.getCurrentPilot()));
+}
 
-  for(int i=0 ; i<41 ; i++, freq++)
+static uint32_t hashStereo()
+{
+  return((currentMode==FM) && rx.getCurrentPilot());
+}
+
+static uint32_t hashBand()
+{
+  return(hashMix(hashStr(HASH_INIT, getCurrentBand()->plan->bandName), currentMode));
+}
+
+//
+// Large frequency digits are hashed in fixed columns from the right,
+// so that only changed digits get redrawn
+//
+#define FREQ_COLUMN_WIDTH 32
+
+static uint32_t hashFreqColumn(int column)
+{
+  char large[16], small[8];
+  int x1 = FREQ_OFFSET_X - column * FREQ_COLUMN_WIDTH;
+  int x0 = x1 - FREQ_COLUMN_WIDTH;
+  int right = FREQ_OFFSET_X;
+  uint32_t hash = HASH_INIT;
+
+  drawFreqDigits(large, small, currentFrequency);
+
+  // Hash glyphs overlapping the column, with their positions
+  for(int j=strlen(large)-1 ; (j>=0) && (right>x0) ; j--)
   {
-    int16_t x = i * 8 - offset;
+    int left = right - glyphWidth(large[j], 7);
+    if(left < x1) hash = hashMix(hashMix(hash, large[j]), right);
+    right = left;
+  }
 
-    if(freq >= minFreq && freq <= maxFreq)
-    {
-      if((freq % 5) == 0) {
-        for(int y=0; y<42; y+=2) {
-          spr.drawPixel(x, 169-y, TH.scan_grid);
-        }
-      }
+  return(hash);
+}
 
-      if((freq+1) <= maxFreq) {
-        for(int xd=x; xd<(x+8); xd+=2) {
-          spr.drawPixel(xd, 169-40, TH.scan_grid);
-          spr.drawPixel(xd, 169-30, TH.scan_grid);
-          spr.drawPixel(xd, 169-20, TH.scan_grid);
-          spr.drawPixel(xd, 169-10, TH.scan_grid);
-          spr.drawPixel(xd, 169-0, TH.scan_grid);
-        }
-        int snr1 = 40 * scanGetSNR(freq * 10);
-        int snr2 = 40 * scanGetSNR((freq+1) * 10);
-        spr.drawLine(x, 169-snr1, x+8, 169-snr2, TH.scan_snr);
-        int rssi1 = 40 * scanGetRSSI(freq * 10);
-        int rssi2 = 40 * scanGetRSSI((freq+1) * 10);
-        spr.drawLine(x, 169-rssi1, x+8, 169-rssi2, TH.scan_rssi);
-      }
+template<int column> static uint32_t hashFreqDigit()
+{
+  return(hashFreqColumn(column));
+}
+
+static uint32_t hashFreqUnits()
+{
+  char large[16], small[8];
+  drawFreqDigits(large, small, currentFrequency);
+  return(hashStr(hashMix(HASH_INIT, currentMode), small));
+}
+
+static uint32_t hashFreqCursor()
+{
+  uint32_t hash = hashMix(HASH_INIT, currentMode);
+  return(hashMix(hash, currentCmd == CMD_FREQ ? getFreqInputPos() + (pushAndRotate ? 0x80 : 0) : 100));
+}
+
+static uint32_t hashStation()
+{
+  return(hashMix(hashStr(HASH_INIT, getStationName()), textNameOffset()));
+}
+
+static uint32_t hashSideBar()
+{
+  uint32_t hash = hashMix(HASH_INIT, currentCmd);
+  hash = hashMix(hash, seekMode());
+  hash = hashMix(hash, (uintptr_t)getCurrentStep());
+  hash = hashMix(hash, (uintptr_t)getCurrentBandwidth());
+  hash = hashMix(hash, (agcNdx << 8) | (uint8_t)agcIdx);
+  hash = hashMix(hash, volume);
+  hash = hashMix(hash, (muteOn(MUTE_MAIN) << 1) | muteOn(MUTE_SQUELCH));
+  hash = hashMix(hash, getRdsPiCode());
+  hash = hashMix(hash, currentMode);
+  hash = hashMix(hash, isSSB()? SsbAvcIdx : AmAvcIdx);
+  return(hashStr(hash, clockGet()));
+}
+
+static uint32_t hashScale()
+{
+  return(hashRadioText(hashScaleFreq(HASH_INIT)));
+}
+
+static uint32_t hashSmallScale()
+{
+  return(hashScaleFreq(HASH_INIT));
+}
+
+static uint32_t hashMeters()
+{
+  uint32_t hash = hashMix(HASH_INIT, rssi);
+  hash = hashMix(hash, rssiPeak);
+  hash = hashMix(hash, snr);
+  hash = hashMix(hash, currentMode);
+  return(hashRadioText(hash));
+}
+
+//
+// Widgets making up each screen layout
+//
+static const Widget widgetsDefault[] =
+{
+  { SAVE_OFFSET_X, SAVE_OFFSET_Y, 9, 14, hashSave },
+  { BLE_OFFSET_X, BLE_OFFSET_Y, 7, 14, hashBle },
+  { WIFI_OFFSET_X - 17, BATT_OFFSET_Y, 320 - WIFI_OFFSET_X + 17, 17, hashStatus },
+  { METER_OFFSET_X, METER_OFFSET_Y, 84, 15, hashMeter },
+  { BAND_OFFSET_X - 54, BAND_OFFSET_Y - 1, 150, 30, hashBand },
+  { FREQ_OFFSET_X - FREQ_COLUMN_WIDTH * 1, FREQ_OFFSET_Y - 24, FREQ_COLUMN_WIDTH, 48, hashFreqDigit<0> },
+  { FREQ_OFFSET_X - FREQ_COLUMN_WIDTH * 2, FREQ_OFFSET_Y - 24, FREQ_COLUMN_WIDTH, 48, hashFreqDigit<1> },
+  { FREQ_OFFSET_X - FREQ_COLUMN_WIDTH * 3, FREQ_OFFSET_Y - 24, FREQ_COLUMN_WIDTH, 48, hashFreqDigit<2> },
+  { FREQ_OFFSET_X - FREQ_COLUMN_WIDTH * 4, FREQ_OFFSET_Y - 24, FREQ_COLUMN_WIDTH, 48, hashFreqDigit<3> },
+  { FREQ_OFFSET_X - FREQ_COLUMN_WIDTH * 5, FREQ_OFFSET_Y - 24, FREQ_COLUMN_WIDTH, 48, hashFreqDigit<4> },
+  { FREQ_OFFSET_X - FREQ_COLUMN_WIDTH * 6, FREQ_OFFSET_Y - 24, FREQ_COLUMN_WIDTH, 48, hashFreqDigit<5> },
+  { FREQ_OFFSET_X, FREQ_OFFSET_Y - 30, 320 - FREQ_OFFSET_X, 62, hashFreqUnits },
+  { 84, FREQ_OFFSET_Y + 24, 236, 8, hashFreqCursor },
+  { 60, RDS_OFFSET_Y, 260, 27, hashStation },
+  { MENU_OFFSET_X, MENU_OFFSET_Y, 88, 112, hashSideBar },
+  { 0, 120, 320, 50, hashScale },
+};
+
+static const Widget widgetsSmeter[] =
+{
+  { SAVE_OFFSET_X, SAVE_OFFSET_Y, 9, 14, hashSave },
+  { BLE_OFFSET_X, BLE_OFFSET_Y, 7, 14, hashBle },
+  { WIFI_OFFSET_X - 17, BATT_OFFSET_Y, 320 - WIFI_OFFSET_X + 17, 17, hashStatus },
+  { ALT_STEREO_OFFSET_X - 12, ALT_STEREO_OFFSET_Y - 8, 25, 17, hashStereo },
+  { BAND_OFFSET_X - 54, BAND_OFFSET_Y - 1, 150, 30, hashBand },
+  { FREQ_OFFSET_X - FREQ_COLUMN_WIDTH * 1, FREQ_OFFSET_Y - 24, FREQ_COLUMN_WIDTH, 48, hashFreqDigit<0> },
+  { FREQ_OFFSET_X - FREQ_COLUMN_WIDTH * 2, FREQ_OFFSET_Y - 24, FREQ_COLUMN_WIDTH, 48, hashFreqDigit<1> },
+  { FREQ_OFFSET_X - FREQ_COLUMN_WIDTH * 3, FREQ_OFFSET_Y - 24, FREQ_COLUMN_WIDTH, 48, hashFreqDigit<2> },
+  { FREQ_OFFSET_X - FREQ_COLUMN_WIDTH * 4, FREQ_OFFSET_Y - 24, FREQ_COLUMN_WIDTH, 48, hashFreqDigit<3> },
+  { FREQ_OFFSET_X - FREQ_COLUMN_WIDTH * 5, FREQ_OFFSET_Y - 24, FREQ_COLUMN_WIDTH, 48, hashFreqDigit<4> },
+  { FREQ_OFFSET_X - FREQ_COLUMN_WIDTH * 6, FREQ_OFFSET_Y - 24, FREQ_COLUMN_WIDTH, 48, hashFreqDigit<5> },
+  { FREQ_OFFSET_X, FREQ_OFFSET_Y - 30, 320 - FREQ_OFFSET_X, 62, hashFreqUnits },
+  { 84, FREQ_OFFSET_Y + 24, 236, 8, hashFreqCursor },
+  { 60, RDS_OFFSET_Y, 260, 27, hashStation },
+  { ALT_MENU_OFFSET_X, ALT_MENU_OFFSET_Y, 88, 112, hashSideBar },
+  { 0, 111, 320, 19, hashSmallScale },
+  { 0, 121, 320, 49, hashMeters },
+};
+
+//
+// Extend rectangle to cover another rectangle
+//
+static void drawUnion(Widget &r, const Widget &q)
+{
+  int x1 = r.x + r.w > q.x + q.w? r.x + r.w : q.x + q.w;
+  int y1 = r.y + r.h > q.y + q.h? r.y + r.h : q.y + q.h;
+  r.x = r.x < q.x? r.x : q.x;
+  r.y = r.y < q.y? r.y : q.y;
+  r.w = x1 - r.x;
+  r.h = y1 - r.y;
+}
+
+//
+// Add rectangle to the list, merging it with overlapping ones
+//
+static int drawAddRect(Widget *rects, int count, Widget r)
+{
+  for(int j=0 ; j<count ; )
+  {
+    const Widget &q = rects[j];
+
+    if((r.x <= q.x + q.w) && (q.x <= r.x + r.w) && (r.y <= q.y + q.h) && (q.y <= r.y + r.h))
+    {
+      // Start over, the merged rectangle may overlap others now
+      drawUnion(r, q);
+      rects[j] = rects[--count];
+      j = 0;
     }
+    else j++;
   }
-  // Scale pointer
-  spr.fillTriangle(156, 125, 160, 130, 164, 125, TH.scale_pointer);
-  spr.drawLine(160, 130, 160, 169, TH.scale_pointer);
+
+  rects[count] = r;
+  return(count + 1);
 }
 
 //
-// Draw screen according to given command
+// Get state of the background layer contents that may change
+// without changing the theme or the layout
+//
+static uint32_t drawLayerState(const char *statusLine1, const char *statusLine2)
+{
+  uint32_t hash = hashMix(HASH_INIT, currentMode==FM);
+  hash = hashMix(hash, getWiFiStatus());
+  hash = hashMix(hash, batteryHasVoltage());
+  if(uiLayoutIdx==UI_SMETER)
+    hash = hashMix(hash, drawLayoutSmeterLegend(statusLine1, statusLine2));
+  return(hash);
+}
+
+//
+// Draw current layout into the screen buffer
+//
+static void drawLayout(const char *statusLine1, const char *statusLine2)
+{
+  switch(uiLayoutIdx)
+  {
+    case UI_SMETER:
+      drawLayoutSmeter(statusLine1, statusLine2);
+      break;
+    default:
+      drawLayoutDefault(statusLine1, statusLine2);
+      break;
+  }
+}
+
+//
+// Account for a drawn frame
+//
+static void drawFrameDone(uint32_t start)
+{
+  uint32_t time = micros() - start;
+
+  drawStats.frames++;
+  drawStats.timeTotal += time;
+  drawStats.timeMin = time < drawStats.timeMin? time : drawStats.timeMin;
+  drawStats.timeMax = time > drawStats.timeMax? time : drawStats.timeMax;
+}
+
+//
+// Force next drawScreen() to redraw the whole screen
+//
+void drawInvalidate()
+{
+  drawValid = false;
+}
+
+//
+// Draw screen according to given command. Only the widgets that have
+// changed since the last frame are redrawn and sent to the display.
 //
 void drawScreen(const char *statusLine1, const char *statusLine2)
 {
+  // Any pending requests are satisfied by this frame, or dropped
+  // while the display sleeps
+  drawPending = 0;
   if(sleepOn()) return;
 
-  // Clear screen buffer
-  spr.fillSprite(TH.bg);
+  uint32_t start = micros();
+  drawTime = millis();
+
+  // Use the same battery and save indicator state in all drawing passes
+  batteryMonitor();
+  drawSaveIcon = prefsAreWritten() || switchThemeEditor();
 
   // About screen is a special case
   if(currentCmd==CMD_ABOUT)
   {
+    spr.fillSprite(TH.bg);
     drawAbout();
+    drawInvalidate();
+    mirrorRequestFrame();
+    drawFrameDone(start);
     return;
   }
 
-  switch(uiLayoutIdx)
+  const Widget *widgets = uiLayoutIdx==UI_SMETER? widgetsSmeter : widgetsDefault;
+  int count = uiLayoutIdx==UI_SMETER? ITEM_COUNT(widgetsSmeter) : ITEM_COUNT(widgetsDefault);
+
+  // Menus, scan graphs, and status lines overlap other widgets,
+  // these screens are always drawn whole
+  bool partial = !statusLine1 && !statusLine2 && !switchThemeEditor() &&
+    ((currentCmd==CMD_NONE) || (currentCmd==CMD_FREQ) || ((currentCmd==CMD_SEEK) && !zoomMenu));
+
+  // Theme editor changes colors, do not cache anything while it is on
+  if(switchThemeEditor()) layerValid = false;
+  drawLayerOn = !switchThemeEditor() &&
+    layerBuild(drawLayerState(statusLine1, statusLine2), statusLine1, statusLine2);
+
+  // Collect changed widget areas
+  Widget rects[DRAW_MAX_WIDGETS];
+  int rectCount = 0;
+  for(int j=0 ; j<count ; j++)
   {
-    case UI_SMETER:
-      drawLayoutSmeter(statusLine1, statusLine2);
-      break;
-    default:
-      drawLayoutDefault(statusLine1, statusLine2);
-      break;
+    uint32_t hash = widgets[j].hash();
+    if(hash!=drawHashes[j]) rectCount = drawAddRect(rects, rectCount, widgets[j]);
+    drawHashes[j] = hash;
+  }
+
+  if(!partial || !drawValid || (drawLayoutIdx!=uiLayoutIdx) || (drawThemeIdx!=themeIdx))
+  {
+    // Redraw the whole screen
+    layerClear(0, 0, spr.width(), spr.height());
+    drawLayout(statusLine1, statusLine2);
+    displayPush();
+    mirrorRequestFrame();
+  }
+  else if(rectCount)
+  {
+    // Each pass draws the whole layout, limit the number of passes
+    if(rectCount > DRAW_MAX_PASSES)
+    {
+      for(int j=1 ; j<rectCount ; j++) drawUnion(rects[0], rects[j]);
+      rectCount = 1;
+    }
+
+    // Redraw and send changed areas only
+    for(int j=0 ; j<rectCount ; j++)
+    {
+      const Widget &r = rects[j];
+      spr.setViewport(r.x, r.y, r.w, r.h, false);
+      layerClear(r.x, r.y, r.w, r.h);
+      drawLayout(0, 0);
+      spr.resetViewport();
+      displayPush(r.x, r.y, r.w, r.h);
+    }
+
+    mirrorRequestFrame();
   }
 
-  spr.pushSprite(0, 0);
+  drawValid     = partial;
+  drawLayoutIdx = uiLayoutIdx;
+  drawThemeIdx  = themeIdx;
+  drawFrameDone(start);
+}
+
+//
+// Request screen redraw, requests are coalesced until the next frame
+//
+void drawRequest(uint8_t priority)
+{
+  drawStats.requests++;
+  drawPending = priority > drawPending? priority : drawPending;
+}
+
+//
+// Tick drawing time, drawing requested frames no faster than allowed
+//
+void drawTickTime()
+{
+  uint32_t elapsed = millis() - drawTime;
+
+  if((drawPending >= REDRAW_NOW) && (elapsed >= 1000 / drawMaxFps))
+    drawScreen();
+  else if(drawPending && (elapsed >= DRAW_DEFER_TIME))
+    drawScreen();
+  else if((currentCmd==CMD_NONE) && (elapsed >= TEXT_SCROLL_TIME) && !sleepOn() && textNameScrolling())
+    drawScreen();
+}
+
+//
+// Set maximum frames per second
+//
+void drawSetMaxFps(uint8_t fps)
+{
+  drawMaxFps = fps? fps : 1;
+}
+
+uint8_t drawGetMaxFps()
+{
+  return(drawMaxFps);
+}
+
+//
+// Get or reset frame drawing statistics
+//
+const DrawStats *drawGetStats()
+{
+  return(&drawStats);
+}
+
+void drawResetStats()
+{
+  memset(&drawStats, 0, sizeof(drawStats));
+  drawStats.timeMin = 0xFFFFFFFF;
 }
@@ -32,26 +32,60 @@
 #define BLE_OFFSET_X   104    // BLE x offset
 #define BLE_OFFSET_Y     0    // BLE y offset
 
+// Redraw request priorities
+#define REDRAW_LATER     1    // Cosmetic changes (meters, RDS, clock), may be deferred
+#define REDRAW_NOW       2    // Frequency changes and user input
+
+#define DRAW_MAX_FPS    30    // Default maximum frames per second
+#define DRAW_DEFER_TIME 200   // Maximum delay for deferred redraws (ms)
+
+// Frame drawing statistics
+struct DrawStats
+{
+  uint32_t requests;    // Redraw requests made
+  uint32_t frames;      // Frames drawn
+  uint32_t timeMin;     // Shortest frame drawing time (us)
+  uint32_t timeMax;     // Longest frame drawing time (us)
+  uint32_t timeTotal;   // Total frame drawing time (us)
+};
+
+void drawRequest(uint8_t priority);
+void drawTickTime();
+void drawSetMaxFps(uint8_t fps);
+uint8_t drawGetMaxFps();
+const DrawStats *drawGetStats();
+void drawResetStats();
+
+void drawSplash();
 void drawMessage(const char *msg);
 void drawZoomedMenu(const char *text, bool force = false);
 void drawScanGraphs(uint32_t freq);
 void drawScreen(const char *statusLine1 = 0, const char *statusLine2 = 0);
+void drawInvalidate();
 
 void drawWiFiIndicator(int x, int y);
 void drawSaveIndicator(int x, int y);
 void drawBleIndicator(int x, int y);
 void drawBandAndMode(const char *band, const char *mode, int x, int y);
+void drawFrequencyUnits(int x, int y);
 void drawFrequency(uint32_t freq, int x, int y, int ux, int uy, uint8_t hl);
 void drawLongStationName(const char *name, int x, int y);
 void drawStationName(const char *name, int x, int y);
-void drawSMeter(int strength, int x, int y);
+void drawSMeterIcon(int x, int y);
+void drawSMeter(int strength, int peak, int x, int y);
 void drawStereoIndicator(int x, int y, bool stereo = true);
 bool drawWiFiStatus(const char *statusLine1, const char *statusLine2, int x, int y);
 void drawRadioText(int y, int ymax);
 void drawScale(uint32_t freq);
 
+bool drawLayerActive();
+void drawSideBarFrame(int x, int y, int sx, bool menu);
+
 void drawLayoutDefault(const char *statusLine1, const char *statusLine2);
 void drawLayoutSmeter(const char *statusLine1, const char *statusLine2);
+void drawLayoutDefaultStatic(const char *statusLine1, const char *statusLine2);
+void drawLayoutSmeterStatic(const char *statusLine1, const char *statusLine2);
+bool drawLayoutSmeterLegend(const char *statusLine1, const char *statusLine2);
 
 void drawAbout();
 void drawAboutHelp(uint8_t arrow);
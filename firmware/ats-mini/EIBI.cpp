@@ -1,6 +1,7 @@
 #include "Common.h"
 #include "Draw.h"
 #include "EIBI.h"
+#include "Storage.h"
 #include "Button.h"
 
 #include <HTTPClient.h>
@@ -462,7 +463,7 @@ bool eibiLoadSchedule()
           if(eibiParseLine(p, entry))
           {
             // Write it to the output file
-            file.write((uint8_t*)&entry, sizeof(entry));
+            diskCountWrite(file.write((uint8_t*)&entry, sizeof(entry)));
             lineCnt++;
 
             if(!(lineCnt & 31))
@@ -4,6 +4,21 @@
 #include "Menu.h"
 #include "Draw.h"
 
+//
+// Draw static parts of the default layout, kept in the background layer
+//
+void drawLayoutDefaultStatic(const char *statusLine1, const char *statusLine2)
+{
+  // Draw WiFi icon
+  drawWiFiIndicator(batteryHasVoltage() ? WIFI_OFFSET_X : BATT_OFFSET_X - 13, WIFI_OFFSET_Y);
+
+  // Draw frequency units
+  drawFrequencyUnits(FUNIT_OFFSET_X, FUNIT_OFFSET_Y);
+
+  // Draw S-meter icon
+  drawSMeterIcon(METER_OFFSET_X, METER_OFFSET_Y);
+}
+
 void drawLayoutDefault(const char *statusLine1, const char *statusLine2)
 {
   // Draw preferences write request icon
@@ -23,7 +38,7 @@ void drawLayoutDefault(const char *statusLine1, const char *statusLine2)
 
   // Draw band and mode
   drawBandAndMode(
-    getCurrentBand()->bandName,
+    getCurrentBand()->plan->bandName,
     bandModeDesc[currentMode],
     BAND_OFFSET_X, BAND_OFFSET_Y
   );
@@ -54,7 +69,7 @@ void drawLayoutDefault(const char *statusLine1, const char *statusLine2)
   drawSideBar(currentCmd, MENU_OFFSET_X, MENU_OFFSET_Y, MENU_DELTA_X);
 
   // Draw S-meter
-  drawSMeter(getStrength(rssi), METER_OFFSET_X, METER_OFFSET_Y);
+  drawSMeter(getStrength(rssi), getStrength(rssiPeak), METER_OFFSET_X, METER_OFFSET_Y);
 
   // Indicate FM pilot detection (stereo indicator)
   drawStereoIndicator(METER_OFFSET_X, METER_OFFSET_Y, (currentMode==FM) && rx.getCurrentPilot());
@@ -45,15 +45,25 @@ static int getInterpolatedStrength(int rssi)
 //
 // Draw small tuner scale
 //
+#define SCALE_START  51
+#define SCALE_END   269
+#define SCALE_Y     120
+
+static void drawSmallScaleLine(int y)
+{
+  for(int i=SCALE_START+3; i<=SCALE_END-3; i+=2) spr.drawPixel(i, y, TH.scale_line);
+  spr.drawCircle(SCALE_START, y, 3, TH.scale_line);
+  spr.drawCircle(SCALE_END, y, 3, TH.scale_line);
+}
+
 static void drawSmallScale(uint32_t freq, int y)
 {
-  const Band *band = getCurrentBand();
-  const uint16_t scaleStart = 51;
-  const uint16_t scaleEnd = 269;
+  const BandPlan *band = getCurrentBand()->plan;
+  const uint16_t scaleStart = SCALE_START;
+  const uint16_t scaleEnd = SCALE_END;
 
-  for(int i=scaleStart+3; i<=scaleEnd-3; i+=2) spr.drawPixel(i, y, TH.scale_line);
-  spr.drawCircle(scaleStart, y, 3, TH.scale_line);
-  spr.drawCircle(scaleEnd, y, 3, TH.scale_line);
+  // Scale line is static, it may come from the background layer
+  if(!drawLayerActive()) drawSmallScaleLine(y);
   spr.fillCircle(scaleStart + (scaleEnd-scaleStart) * (freq - band->minimumFreq) / (band->maximumFreq - band->minimumFreq), y, 3, TH.scale_pointer);
 
   char lim[8];
@@ -84,7 +94,10 @@ static void drawAltStereoIndicator(int x, int y, bool stereo = true)
   // Add an "else" statement here to draw a mono indicator
 }
 
-static void drawLargeSMeter(int rssi, int strength, int x, int y)
+//
+// Draw S-meter legend and meter labels
+//
+static void drawLargeMetersLegend(int x, int y)
 {
   // S-Meter legend
   spr.setTextDatum(TC_DATUM);
@@ -117,14 +130,23 @@ static void drawLargeSMeter(int rssi, int strength, int x, int y)
 
   spr.setTextDatum(BL_DATUM);
   spr.drawString("S", x - 10, 36 + y, 2);
+  spr.drawString("N", x - 10, 12 + y, 2);
+}
+
+static void drawLargeSMeter(int rssi, int strength, int peak, int x, int y)
+{
+  // Legend is static, it may come from the background layer
+  if(!drawLayerActive()) drawLargeMetersLegend(x, y);
+
+  spr.setTextColor(TH.scale_text);
   spr.setTextDatum(BR_DATUM);
   spr.drawNumber(rssi, x - 15, 40 + y, 4);
 
-  // S-Meter
+  // S-Meter, with the peak hold marker
   for(int i=0; i<49; i++)
-    if (i<28 && i<strength)
+    if (i<28 && (i<strength || (i==peak-1)))
       spr.fillRect(x+(i*5), 11+y, 3, 10, TH.smeter_bar);
-    else if (i<strength)
+    else if (i<strength || (i==peak-1))
       spr.fillRect(x+(i*5), 11+y, 3, 10, TH.smeter_bar_plus);
     else
       spr.fillRect(x+(i*5), 11+y, 3, 10, TH.smeter_bar_empty);
@@ -133,8 +155,6 @@ static void drawLargeSMeter(int rssi, int strength, int x, int y)
 static void drawLargeSNMeter(int snr, int x, int y)
 {
   spr.setTextColor(TH.scale_text);
-  spr.setTextDatum(BL_DATUM);
-  spr.drawString("N", x - 10, 12 + y, 2);
   spr.setTextDatum(BR_DATUM);
   spr.drawNumber(snr, x - 15, 16 + y, 4);
 
@@ -147,6 +167,36 @@ static void drawLargeSNMeter(int snr, int x, int y)
       spr.fillRect(x+(i*5), y - 1, 3, 10, TH.smeter_bar_empty);
 }
 
+//
+// Draw static parts of the S-meter layout, kept in the background layer
+//
+void drawLayoutSmeterStatic(const char *statusLine1, const char *statusLine2)
+{
+  // Draw WiFi icon
+  drawWiFiIndicator(batteryHasVoltage() ? WIFI_OFFSET_X : BATT_OFFSET_X - 13, WIFI_OFFSET_Y);
+
+  // Draw frequency units
+  drawFrequencyUnits(FUNIT_OFFSET_X, FUNIT_OFFSET_Y);
+
+  // Draw band scale line
+  drawSmallScaleLine(SCALE_Y);
+
+  // Draw S & SN meters legend
+  if(drawLayoutSmeterLegend(statusLine1, statusLine2))
+    drawLargeMetersLegend(ALT_METER_OFFSET_X, ALT_METER_OFFSET_Y);
+}
+
+//
+// Returns TRUE if the large S & SN meters are shown
+//
+bool drawLayoutSmeterLegend(const char *statusLine1, const char *statusLine2)
+{
+  return(
+    (currentCmd != CMD_SCAN) && !statusLine1 && !statusLine2 &&
+    !*getRadioText() && !*getProgramInfo()
+  );
+}
+
 //
 // Draw alternative screen layout with the large S-meter.
 //
@@ -169,7 +219,7 @@ void drawLayoutSmeter(const char *statusLine1, const char *statusLine2)
 
   // Draw band and mode
   drawBandAndMode(
-    getCurrentBand()->bandName,
+    getCurrentBand()->plan->bandName,
     bandModeDesc[currentMode],
     BAND_OFFSET_X, BAND_OFFSET_Y
   );
@@ -196,7 +246,7 @@ void drawLayoutSmeter(const char *statusLine1, const char *statusLine2)
     drawStationName(getStationName(), RDS_OFFSET_X, RDS_OFFSET_Y);
 
   // Draw band scale
-  drawSmallScale(isSSB()? (currentFrequency + currentBFO/1000) : currentFrequency, 120);
+  drawSmallScale(isSSB()? (currentFrequency + currentBFO/1000) : currentFrequency, SCALE_Y);
 
   // Draw left-side menu/info bar
   // @@@ FIXME: Frequency display (above) intersects the side bar!
@@ -219,7 +269,7 @@ void drawLayoutSmeter(const char *statusLine1, const char *statusLine2)
       // Draw SN-meter
       drawLargeSNMeter(snr, ALT_METER_OFFSET_X, ALT_METER_OFFSET_Y);
       // Draw S-meter
-      drawLargeSMeter(rssi, getInterpolatedStrength(rssi), ALT_METER_OFFSET_X, ALT_METER_OFFSET_Y);
+      drawLargeSMeter(rssi, getInterpolatedStrength(rssi), getInterpolatedStrength(rssiPeak), ALT_METER_OFFSET_X, ALT_METER_OFFSET_Y);
     }
   }
 }
@@ -3,8 +3,10 @@
 #include "Themes.h"
 #include "Utils.h"
 #include "Menu.h"
+#include "Storage.h"
 #include "Draw.h"
 #include "EIBI.h"
+#include "Bank.h"
 
 //
 // Bands Menu
@@ -14,33 +16,33 @@
 // bands by deleting lines. Change bands by editing lines below.
 //
 // NOTE:
-// You have to RESET PREFERENCES after adding or removing lines in this
-// table. Turn your receiver on with the encoder push button pressed
-// at first time to RESET the preferences.
+// Band settings are saved by band name and lower limit, so changing the
+// table does not require resetting preferences. Bands whose name or
+// lower limit change start with their defaults.
 //
 
 int bandIdx = 0;
 
 // Band limits are expanded to align with the nearest tuning scale mark
 // Do not forget to update the bands table in the manual.md
-Band bands[] =
+static const BandPlan bandPlan[] =
 {
-  {"VHF",  FM_BAND_TYPE, FM,   6400, 10800, 10390, 2, 0, 0, 0},
+  {"VHF",  FM_BAND_TYPE, FM,   6400, 10800, 10390, 2, 0},
   // All band. LW, MW and SW (from 150kHz to 30MHz)
-  {"ALL",  SW_BAND_TYPE, AM,    150, 30000, 15000, 1, 4, 0, 0},
-  {"11M",  SW_BAND_TYPE, AM,  25600, 26100, 25850, 1, 4, 0, 0},
-  {"13M",  SW_BAND_TYPE, AM,  21500, 21900, 21650, 1, 4, 0, 0},
-  {"15M",  SW_BAND_TYPE, AM,  18900, 19100, 18950, 1, 4, 0, 0},
-  {"16M",  SW_BAND_TYPE, AM,  17400, 18100, 17650, 1, 4, 0, 0},
-  {"19M",  SW_BAND_TYPE, AM,  15100, 15900, 15450, 1, 4, 0, 0},
-  {"22M",  SW_BAND_TYPE, AM,  13500, 13900, 13650, 1, 4, 0, 0},
-  {"25M",  SW_BAND_TYPE, AM,  11000, 13000, 11850, 1, 4, 0, 0},
-  {"31M",  SW_BAND_TYPE, AM,   9000, 11000,  9650, 1, 4, 0, 0},
-  {"41M",  SW_BAND_TYPE, AM,   7000,  9000,  7300, 1, 4, 0, 0},
-  {"49M",  SW_BAND_TYPE, AM,   5000,  7000,  6000, 1, 4, 0, 0},
-  {"60M",  SW_BAND_TYPE, AM,   4000,  5100,  4950, 1, 4, 0, 0},
-  {"75M",  SW_BAND_TYPE, AM,   3500,  4000,  3950, 1, 4, 0, 0},
-  {"90M",  SW_BAND_TYPE, AM,   3000,  3500,  3300, 1, 4, 0, 0},
+  {"ALL",  SW_BAND_TYPE, AM,    150, 30000, 15000, 1, 4},
+  {"11M",  SW_BAND_TYPE, AM,  25600, 26100, 25850, 1, 4},
+  {"13M",  SW_BAND_TYPE, AM,  21500, 21900, 21650, 1, 4},
+  {"15M",  SW_BAND_TYPE, AM,  18900, 19100, 18950, 1, 4},
+  {"16M",  SW_BAND_TYPE, AM,  17400, 18100, 17650, 1, 4},
+  {"19M",  SW_BAND_TYPE, AM,  15100, 15900, 15450, 1, 4},
+  {"22M",  SW_BAND_TYPE, AM,  13500, 13900, 13650, 1, 4},
+  {"25M",  SW_BAND_TYPE, AM,  11000, 13000, 11850, 1, 4},
+  {"31M",  SW_BAND_TYPE, AM,   9000, 11000,  9650, 1, 4},
+  {"41M",  SW_BAND_TYPE, AM,   7000,  9000,  7300, 1, 4},
+  {"49M",  SW_BAND_TYPE, AM,   5000,  7000,  6000, 1, 4},
+  {"60M",  SW_BAND_TYPE, AM,   4000,  5100,  4950, 1, 4},
+  {"75M",  SW_BAND_TYPE, AM,   3500,  4000,  3950, 1, 4},
+  {"90M",  SW_BAND_TYPE, AM,   3000,  3500,  3300, 1, 4},
 //  {"25M",  SW_BAND_TYPE, AM,  11600, 12100, 11850, 1, 4, 0},
 //  {"31M",  SW_BAND_TYPE, AM,   9400,  9900,  9650, 1, 4, 0},
 //  {"41M",  SW_BAND_TYPE, AM,   7200,  7500,  7300, 1, 4, 0},
@@ -48,25 +50,90 @@ Band bands[] =
 //  {"60M",  SW_BAND_TYPE, AM,   4700,  5100,  4950, 1, 4, 0},
 //  {"75M",  SW_BAND_TYPE, AM,   3900,  4000,  3950, 1, 4, 0},
 //  {"90M",  SW_BAND_TYPE, AM,   3200,  3400,  3300, 1, 4, 0},
-  {"MW3",  MW_BAND_TYPE, AM,   1700,  3500,  2500, 1, 4, 0, 0},
-  {"MW2",  MW_BAND_TYPE, AM,    495,  1701,   783, 2, 4, 0, 0},
-  {"MW1",  MW_BAND_TYPE, AM,    150,  1800,   810, 3, 4, 0, 0},
-  {"160M", MW_BAND_TYPE, LSB,  1800,  2000,  1900, 5, 4, 0, 0},
-  {"80M",  SW_BAND_TYPE, LSB,  3500,  4000,  3800, 5, 4, 0, 0},
-  {"40M",  SW_BAND_TYPE, LSB,  7000,  7300,  7150, 5, 4, 0, 0},
-  {"30M",  SW_BAND_TYPE, LSB, 10000, 10200, 10125, 5, 4, 0, 0},
-  {"20M",  SW_BAND_TYPE, USB, 14000, 14400, 14100, 5, 4, 0, 0},
-  {"17M",  SW_BAND_TYPE, USB, 18000, 18200, 18115, 5, 4, 0, 0},
-  {"15M",  SW_BAND_TYPE, USB, 21000, 21500, 21225, 5, 4, 0, 0},
-  {"12M",  SW_BAND_TYPE, USB, 24800, 25000, 24940, 5, 4, 0, 0},
-  {"10M",  SW_BAND_TYPE, USB, 28000, 29700, 28500, 5, 4, 0, 0},
+  {"MW3",  MW_BAND_TYPE, AM,   1700,  3500,  2500, 1, 4},
+  {"MW2",  MW_BAND_TYPE, AM,    495,  1701,   783, 2, 4},
+  {"MW1",  MW_BAND_TYPE, AM,    150,  1800,   810, 3, 4},
+  {"160M", MW_BAND_TYPE, LSB,  1800,  2000,  1900, 5, 4},
+  {"80M",  SW_BAND_TYPE, LSB,  3500,  4000,  3800, 5, 4},
+  {"40M",  SW_BAND_TYPE, LSB,  7000,  7300,  7150, 5, 4},
+  {"30M",  SW_BAND_TYPE, LSB, 10000, 10200, 10125, 5, 4},
+  {"20M",  SW_BAND_TYPE, USB, 14000, 14400, 14100, 5, 4},
+  {"17M",  SW_BAND_TYPE, USB, 18000, 18200, 18115, 5, 4},
+  {"15M",  SW_BAND_TYPE, USB, 21000, 21500, 21225, 5, 4},
+  {"12M",  SW_BAND_TYPE, USB, 24800, 25000, 24940, 5, 4},
+  {"10M",  SW_BAND_TYPE, USB, 28000, 29700, 28500, 5, 4},
   // https://www.hfunderground.com/wiki/CB
   // Also see MIN_CB_FREQUENCY and MAX_CB_FREQUENCY
-  {"CB",   SW_BAND_TYPE, AM,  25000, 28000, 27135, 0, 4, 0, 0},
+  {"CB",   SW_BAND_TYPE, AM,  25000, 28000, 27135, 0, 4},
 };
 
-int getTotalBands() { return(ITEM_COUNT(bands)); }
-Band *getCurrentBand() { return(&bands[bandIdx]); }
+// Band state, loaded when the band is first used
+static Band bands[ITEM_COUNT(bandPlan)];
+
+int getTotalBands() { return(ITEM_COUNT(bandPlan)); }
+const BandPlan *getBandPlan(int idx) { return(&bandPlan[idx]); }
+bool isBandLoaded(int idx) { return(!!bands[idx].plan); }
+Band *getCurrentBand() { return(getBand(bandIdx)); }
+
+//
+// Get band state, loading it from preferences on first use
+//
+Band *getBand(int idx)
+{
+  Band *band = &bands[idx];
+
+  if(!band->plan)
+  {
+    band->plan = &bandPlan[idx];
+    prefsLoadBand(idx);
+  }
+
+  return(band);
+}
+
+//
+// Band indices sorted by band name, for lookups by name
+//
+static uint8_t bandsByName[ITEM_COUNT(bands)];
+static bool bandsByNameReady = false;
+
+static void initBandsByName()
+{
+  // Insertion sort keeps bands with equal names in table order
+  for(int i=0 ; i<getTotalBands() ; i++)
+  {
+    int j;
+    for(j=i ; j>0 && strcmp(bandPlan[bandsByName[j-1]].bandName, bandPlan[i].bandName)>0 ; j--)
+      bandsByName[j] = bandsByName[j-1];
+    bandsByName[j] = i;
+  }
+
+  bandsByNameReady = true;
+}
+
+//
+// Find band by name. If several bands have the same name, prefer
+// the first one containing given memory. Returns -1 if not found.
+//
+int findBandByName(const char *name, const Memory *memory)
+{
+  if(!bandsByNameReady) initBandsByName();
+
+  // Binary search for the first band with given name
+  int lo = 0, hi = getTotalBands();
+  while(lo < hi)
+  {
+    int mid = (lo + hi) / 2;
+    if(strcmp(bandPlan[bandsByName[mid]].bandName, name) < 0) lo = mid + 1; else hi = mid;
+  }
+
+  if(lo>=getTotalBands() || strcmp(bandPlan[bandsByName[lo]].bandName, name)) return(-1);
+
+  for(int j=lo ; memory && j<getTotalBands() && !strcmp(bandPlan[bandsByName[j]].bandName, name) ; j++)
+    if(isMemoryInBand(&bandPlan[bandsByName[j]], memory)) return(bandsByName[j]);
+
+  return(bandsByName[lo]);
+}
 
 //
 // Main Menu
@@ -171,12 +238,36 @@ int getTotalModes() { return(ITEM_COUNT(bandModeDesc)); }
 // Memory Menu
 //
 
-uint8_t memoryIdx = 0;
+uint16_t memoryIdx = 0;
 Memory memories[MEMORY_COUNT];
 Memory newMemory;
 
 int getTotalMemories() { return(ITEM_COUNT(memories)); }
 
+// Memory menu lists memory slots, followed by the memory bank
+static int getTotalMenuMemories() { return(getTotalMemories() + bankGetCount()); }
+
+//
+// Get memory slot or bank entry by memory menu index, or 0 if not
+// available. A bank entry is valid until the next call.
+//
+static const Memory *getMenuMemory(int idx)
+{
+  static Memory bankMemory;
+
+  if(idx<getTotalMemories()) return(&memories[idx]);
+
+  const BankEntry *entry = bankGet(idx - getTotalMemories());
+  if(!entry) return(0);
+
+  memset(&bankMemory, 0, sizeof(bankMemory));
+  bankMemory.freq = entry->freq;
+  bankMemory.band = entry->band;
+  bankMemory.mode = entry->mode;
+  memcpy(bankMemory.name, entry->name, sizeof(bankMemory.name));
+  return(&bankMemory);
+}
+
 //
 // RDS Menu
 //
@@ -195,6 +286,7 @@ static const RDSMode rdsMode[] =
 };
 
 uint8_t getRDSMode() { return(rdsMode[rdsModeIdx].mode); }
+int getTotalRDSModes() { return(ITEM_COUNT(rdsMode)); }
 
 //
 // Sleep Mode Menu
@@ -204,6 +296,8 @@ uint8_t sleepModeIdx = SLEEP_LOCKED;
 static const char *sleepModeDesc[] =
 { "Locked", "Unlocked", "CPU Sleep" };
 
+int getTotalSleepModes() { return(ITEM_COUNT(sleepModeDesc)); }
+
 //
 // UTC Offset Menu
 // FIXME: add more offsets https://en.wikipedia.org/wiki/List_of_UTC_offsets
@@ -246,6 +340,8 @@ static const char *uiLayoutDesc[] =
 #define UI_DEFAULT   0
 #define UI_SMETER    1
 
+int getTotalUILayouts() { return(ITEM_COUNT(uiLayoutDesc)); }
+
 //
 // Bluetooth Mode Menu
 //
@@ -264,6 +360,8 @@ uint8_t wifiModeIdx = NET_OFF;
 static const char *wifiModeDesc[] =
 { "Off", "AP Only", "AP+Connect", "Connect", "Sync Only" };
 
+int getTotalWiFiModes() { return(ITEM_COUNT(wifiModeDesc)); }
+
 //
 // Step Menu
 //
@@ -322,7 +420,8 @@ static int getLastStep(int mode)
 
 const Step *getCurrentStep()
 {
-  uint8_t idx = bands[bandIdx].currentStepIdx > getLastStep(currentMode) ? defaultStepIdx[currentMode] : bands[bandIdx].currentStepIdx;
+  const Band *band = getCurrentBand();
+  uint8_t idx = band->currentStepIdx > getLastStep(currentMode) ? defaultStepIdx[currentMode] : band->currentStepIdx;
   return(&steps[currentMode][idx]);
 }
 
@@ -357,7 +456,7 @@ static uint8_t getMinFreqInputPos()
 
 static uint8_t getMaxFreqInputPos()
 {
-  return (uint8_t)log10(getCurrentBand()->maximumFreq) * 2 + (currentMode != FM ? 6 : -2);
+  return (uint8_t)log10(getCurrentBand()->plan->maximumFreq) * 2 + (currentMode != FM ? 6 : -2);
 }
 
 //
@@ -416,7 +515,8 @@ static int getLastBandwidth(int mode)
 
 const Bandwidth *getCurrentBandwidth()
 {
-  return(&bandwidths[currentMode][bands[bandIdx].bandwidthIdx > getLastBandwidth(currentMode) ? defaultBwIdx[currentMode] : bands[bandIdx].bandwidthIdx]);
+  const Band *band = getCurrentBand();
+  return(&bandwidths[currentMode][band->bandwidthIdx > getLastBandwidth(currentMode) ? defaultBwIdx[currentMode] : band->bandwidthIdx]);
 }
 
 static void setBandwidth()
@@ -559,10 +659,12 @@ void doFmRegion(int16_t enc)
 
 void doCal(int16_t enc)
 {
+  Band *band = getCurrentBand();
+
   if (currentMode == USB)
-    bands[bandIdx].usbCal = clamp_range(bands[bandIdx].usbCal, 10*enc, -MAX_CAL, MAX_CAL);
+    band->usbCal = clamp_range(band->usbCal, 10*enc, -MAX_CAL, MAX_CAL);
   else if (currentMode == LSB)
-    bands[bandIdx].lsbCal = clamp_range(bands[bandIdx].lsbCal, 10*enc, -MAX_CAL, MAX_CAL);
+    band->lsbCal = clamp_range(band->lsbCal, 10*enc, -MAX_CAL, MAX_CAL);
   // else: no calibration change for other modes
 
   // If in SSB mode set the SI4732/5 BFO value
@@ -645,14 +747,14 @@ static void doScrollDir(int16_t enc)
 uint8_t doAbout(int16_t enc)
 {
   static uint8_t aboutScreen = 0;
-  aboutScreen = clamp_range(aboutScreen, enc, 0, 2);
+  aboutScreen = clamp_range(aboutScreen, enc, 0, 4);
   return aboutScreen;
 }
 
 bool tuneToMemory(const Memory *memory)
 {
   uint16_t freq = freqFromHz(memory->freq, memory->mode);
-  int bfo = bfoFromHz(memory->freq);
+  int16_t bfo = bfoFromHz(memory->freq);
 
   // Must have frequency
   if(!memory->freq) return(false);
@@ -661,44 +763,48 @@ bool tuneToMemory(const Memory *memory)
   if(memory->band>=getTotalBands()) return(false);
 
   // Band must contain frequency and modulation
-  if(!isMemoryInBand(&bands[memory->band], memory)) return(false);
+  if(!isMemoryInBand(&bandPlan[memory->band], memory)) return(false);
 
   // Must differ from the current band, frequency and modulation
-  // FIXME: bands should store frequency in Hz (otherwise sub-kHz
-  // digits are lost after a power cycle)
-  if(memory->band==bandIdx && freq==bands[bandIdx].currentFreq && memory->mode==bands[bandIdx].bandMode)
+  const Band *band = getCurrentBand();
+  if(memory->band==bandIdx && memory->mode==band->bandMode &&
+     memory->freq==freqToHz(band->currentFreq, band->bandMode) + band->currentBFO)
     return(true);
 
   // Save current band settings
-  bands[bandIdx].currentFreq = currentFrequency + currentBFO / 1000;
+  getCurrentBand()->currentFreq = currentFrequency;
+  getCurrentBand()->currentBFO  = currentBFO;
 
   // Use default step when changing modes
-  if(bands[memory->band].bandMode != memory->mode)
-    bands[memory->band].currentStepIdx = defaultStepIdx[memory->mode];
+  Band *target = getBand(memory->band);
+  if(target->bandMode != memory->mode)
+    target->currentStepIdx = defaultStepIdx[memory->mode];
 
-  // Load frequency and modulation from memory slot
-  bands[memory->band].currentFreq = freq;
-  bands[memory->band].bandMode    = memory->mode;
+  // Load frequency, BFO, and modulation from memory slot
+  target->currentFreq = freq;
+  target->currentBFO  = bfo;
+  target->bandMode    = memory->mode;
 
   // Enable the new band
   selectBand(memory->band);
 
-  // Update BFO if present in memory slot
-  if(bfo) updateBFO(bfo);
-
   return(true);
 }
 
 static void doMemory(int16_t enc)
 {
-  memoryIdx = wrap_range(memoryIdx, enc, 0, LAST_ITEM(memories));
-  if(!tuneToMemory(&memories[memoryIdx])) tuneToMemory(&newMemory);
+  memoryIdx = wrap_range(memoryIdx, enc, 0, getTotalMenuMemories() - 1);
+  const Memory *memory = getMenuMemory(memoryIdx);
+  if(!memory || !tuneToMemory(memory)) tuneToMemory(&newMemory);
 }
 
-static void clickMemory(uint8_t idx, bool shortPress)
+static void clickMemory(uint16_t idx, bool shortPress)
 {
   // Must have a valid index
-  if(idx>LAST_ITEM(memories)) return;
+  if(idx>=getTotalMenuMemories()) return;
+
+  // Bank entries cannot be changed from the menu
+  if(shortPress && idx>LAST_ITEM(memories)) return;
 
   if(shortPress)
   {
@@ -706,6 +812,8 @@ static void clickMemory(uint8_t idx, bool shortPress)
     if(!memories[idx].freq) memories[idx] = newMemory;
     // Otherwise, delete memory slot contents
     else memories[idx].freq = 0;
+    // Let remotes know about changes
+    remoteEmit(TOPIC_MEMORY);
   }
   // On a click, do nothing, slot already activated in doMemory()
   else currentCmd = CMD_NONE;
@@ -713,10 +821,10 @@ static void clickMemory(uint8_t idx, bool shortPress)
 
 void doStep(int16_t enc)
 {
-  uint8_t idx = bands[bandIdx].currentStepIdx;
+  uint8_t idx = getCurrentBand()->currentStepIdx;
 
   idx = wrap_range(idx, enc, 0, getLastStep(currentMode));
-  bands[bandIdx].currentStepIdx = idx;
+  getCurrentBand()->currentStepIdx = idx;
 
   rx.setFrequencyStep(steps[currentMode][idx].step);
 
@@ -752,7 +860,7 @@ void doAgc(int16_t enc)
 void doMode(int16_t enc)
 {
   // This is our current mode for the current band
-  currentMode = bands[bandIdx].bandMode;
+  currentMode = getCurrentBand()->bandMode;
 
   // Cannot change away from FM mode
   if(currentMode==FM) return;
@@ -763,10 +871,12 @@ void doMode(int16_t enc)
   while(currentMode==FM);
 
   // Save current band settings
-  bands[bandIdx].currentFreq = currentFrequency + currentBFO / 1000;
-  bands[bandIdx].currentStepIdx = defaultStepIdx[currentMode];
-  bands[bandIdx].bandwidthIdx = defaultBwIdx[currentMode];
-  bands[bandIdx].bandMode = currentMode;
+  Band *band = getCurrentBand();
+  band->currentFreq = currentFrequency;
+  band->currentBFO = currentBFO;
+  band->currentStepIdx = defaultStepIdx[currentMode];
+  band->bandwidthIdx = defaultBwIdx[currentMode];
+  band->bandMode = currentMode;
 
   // Enable the new band
   selectBand(bandIdx);
@@ -793,8 +903,10 @@ void doSoftMute(int16_t enc)
 void doBand(int16_t enc)
 {
   // Save current band settings
-  bands[bandIdx].currentFreq = currentFrequency + currentBFO / 1000;
-  bands[bandIdx].bandMode = currentMode;
+  Band *band = getCurrentBand();
+  band->currentFreq = currentFrequency;
+  band->currentBFO = currentBFO;
+  band->bandMode = currentMode;
 
   // Change band
   bandIdx = wrap_range(bandIdx, enc, 0, LAST_ITEM(bands));
@@ -805,10 +917,10 @@ void doBand(int16_t enc)
 
 void doBandwidth(int16_t enc)
 {
-  uint8_t idx = bands[bandIdx].bandwidthIdx;
+  uint8_t idx = getCurrentBand()->bandwidthIdx;
 
   idx = wrap_range(idx, enc, 0, getLastBandwidth(currentMode));
-  bands[bandIdx].bandwidthIdx = idx;
+  getCurrentBand()->bandwidthIdx = idx;
   setBandwidth();
 }
 
@@ -976,7 +1088,7 @@ void selectBand(uint8_t idx, bool drawLoadingSSB)
 
   // Set band and mode
   bandIdx = min(idx, LAST_ITEM(bands));
-  currentMode = bands[bandIdx].bandMode;
+  currentMode = getCurrentBand()->bandMode;
 
   // Load SSB patch as needed
   if(isSSB())
@@ -985,7 +1097,7 @@ void selectBand(uint8_t idx, bool drawLoadingSSB)
     unloadSSB();
 
   // Switch radio to the selected band
-  useBand(&bands[bandIdx]);
+  useBand(getCurrentBand());
 
   // Set bandwidth for the current mode
   setBandwidth();
@@ -1012,8 +1124,7 @@ static void drawCommon(const char *title, int x, int y, int sx, bool cursor = fa
   spr.setTextDatum(MC_DATUM);
 
   spr.setTextColor(TH.menu_hdr);
-  spr.fillSmoothRoundRect(1+x, 1+y, 76+sx, 110, 4, TH.menu_border);
-  spr.fillSmoothRoundRect(2+x, 2+y, 74+sx, 108, 4, TH.menu_bg);
+  drawSideBarFrame(x, y, sx, true);
 
   spr.drawString(title, 40+x+(sx/2), 12+y, 2);
   spr.drawLine(1+x, 23+y, 76+sx, 23+y, TH.menu_border);
@@ -1028,8 +1139,7 @@ static void drawMenu(int x, int y, int sx)
 {
   spr.setTextDatum(MC_DATUM);
 
-  spr.fillSmoothRoundRect(1+x, 1+y, 76+sx, 110, 4, TH.menu_border);
-  spr.fillSmoothRoundRect(2+x, 2+y, 74+sx, 108, 4, TH.menu_bg);
+  drawSideBarFrame(x, y, sx, true);
   spr.setTextColor(TH.menu_hdr);
 
   spr.drawString("Menu", 40+x+(sx/2), 12+y, 2);
@@ -1057,8 +1167,7 @@ static void drawSettings(int x, int y, int sx)
 {
   spr.setTextDatum(MC_DATUM);
 
-  spr.fillSmoothRoundRect(1+x, 1+y, 76+sx, 110, 4, TH.menu_border);
-  spr.fillSmoothRoundRect(2+x, 2+y, 74+sx, 108, 4, TH.menu_bg);
+  drawSideBarFrame(x, y, sx, true);
   spr.setTextColor(TH.menu_hdr);
   spr.drawString("Settings", 40+x+(sx/2), 12+y, 2);
   spr.drawLine(1+x, 23+y, 76+sx, 23+y, TH.menu_border);
@@ -1105,7 +1214,7 @@ static void drawMode(int x, int y, int sx)
 static void drawStep(int x, int y, int sx)
 {
   int count = getLastStep(currentMode) + 1;
-  int idx   = bands[bandIdx].currentStepIdx + count;
+  int idx   = getCurrentBand()->currentStepIdx + count;
 
   drawCommon(menu[MENU_STEP], x, y, sx, true);
 
@@ -1167,21 +1276,21 @@ static void drawBand(int x, int y, int sx)
   for(int i=-2 ; i<3 ; i++)
   {
     if(i==0) {
-      drawZoomedMenu(bands[abs((bandIdx+count+i)%count)].bandName);
+      drawZoomedMenu(bandPlan[abs((bandIdx+count+i)%count)].bandName);
       spr.setTextColor(TH.menu_hl_text, TH.menu_hl_bg);
     } else {
       spr.setTextColor(TH.menu_item);
     }
 
     spr.setTextDatum(MC_DATUM);
-    spr.drawString(bands[abs((bandIdx+count+i)%count)].bandName, 40+x+(sx/2), 64+y+(i*16), 2);
+    spr.drawString(bandPlan[abs((bandIdx+count+i)%count)].bandName, 40+x+(sx/2), 64+y+(i*16), 2);
   }
 }
 
 static void drawBandwidth(int x, int y, int sx)
 {
   int count = getLastBandwidth(currentMode) + 1;
-  int idx   = bands[bandIdx].bandwidthIdx + count;
+  int idx   = getCurrentBand()->bandwidthIdx + count;
 
   drawCommon(menu[MENU_BW], x, y, sx, true);
 
@@ -1350,22 +1459,27 @@ static void drawUTCOffset(int x, int y, int sx)
 static void drawMemory(int x, int y, int sx)
 {
   char label_memory[16];
-  sprintf(label_memory, "%s %2.2d", menu[MENU_MEMORY], memoryIdx + 1);
+  const BankEntry *entry = memoryIdx>LAST_ITEM(memories)? bankGet(memoryIdx - getTotalMemories()) : 0;
+  if(entry)
+    sprintf(label_memory, "Bank %d", entry->group);
+  else
+    sprintf(label_memory, "%s %2.2d", menu[MENU_MEMORY], memoryIdx + 1);
   drawCommon(label_memory, x, y, sx, true);
 
-  int count = ITEM_COUNT(memories);
+  int count = getTotalMenuMemories();
   for(int i=-2 ; i<3 ; i++)
   {
     int j = abs((memoryIdx+count+i)%count);
+    const Memory *memory = getMenuMemory(j);
     char buf[16];
     const char *text = buf;
 
-    if(!memories[j].freq)
+    if(!memory || !memory->freq)
       text = "- - -";
-    else if(memories[j].mode==FM)
-      sprintf(buf, "%3.2f %s", memories[j].freq / 1000000.0, bandModeDesc[memories[j].mode]);
+    else if(memory->mode==FM)
+      sprintf(buf, "%3.2f %s", memory->freq / 1000000.0, bandModeDesc[memory->mode]);
     else
-      sprintf(buf, "%5lu %s", memories[j].freq / 1000, bandModeDesc[memories[j].mode]);
+      sprintf(buf, "%5lu %s", memory->freq / 1000, bandModeDesc[memory->mode]);
 
     if(i==0) {
       drawZoomedMenu(text);
@@ -1564,8 +1678,7 @@ static void drawInfo(int x, int y, int sx)
   // Info box
   spr.setTextDatum(ML_DATUM);
   spr.setTextColor(TH.box_text);
-  spr.fillSmoothRoundRect(1+x, 1+y, 76+sx, 110, 4, TH.box_border);
-  spr.fillSmoothRoundRect(2+x, 2+y, 74+sx, 108, 4, TH.box_bg);
+  drawSideBarFrame(x, y, sx, false);
 
   spr.drawString("Step:", 6+x, 64+y+(-3*16), 2);
   spr.drawString(getCurrentStep()->desc, 48+x, 64+y+(-3*16), 2);
@@ -80,7 +80,6 @@ typedef struct
 // Global Variables
 //
 
-extern Band bands[];
 extern Memory memories[];
 extern const UTCOffset utcOffsets[];
 extern const char *bandModeDesc[];
@@ -106,14 +105,22 @@ void doSelectDigit(int16_t enc);
 bool clickHandler(uint16_t cmd, bool shortPress);
 void selectBand(uint8_t idx, bool drawLoadingSSB = true);
 int getTotalBands();
+int findBandByName(const char *name, const Memory *memory = 0);
 int getTotalModes();
 int getTotalMemories();
 Band *getCurrentBand();
+Band *getBand(int idx);
+const BandPlan *getBandPlan(int idx);
+bool isBandLoaded(int idx);
 uint8_t getFreqInputPos();
 int getFreqInputStep();
 const Step *getCurrentStep();
 const Bandwidth *getCurrentBandwidth();
 uint8_t getRDSMode();
+int getTotalRDSModes();
+int getTotalSleepModes();
+int getTotalUILayouts();
+int getTotalWiFiModes();
 
 int getCurrentUTCOffset();
 int getTotalUTCOffsets();
@@ -0,0 +1,243 @@
+#include "Common.h"
+
+//
+// Remote display mirror. Screen areas that changed since the last
+// update are sent to the remote as text lines, one per rectangle:
+//
+//   ~D,<frame>,<x>,<y>,<w>,<h>,<data>\r\n
+//
+// <data> is base64 encoded, run-length compressed RGB565 pixels,
+// high byte first. Each rectangle row is a sequence of packets, each
+// starting with a header byte N: for N < 0x80, N+1 literal pixels
+// follow; for N >= 0x80, a single pixel follows, repeated N-0x80+2
+// times. A frame ends with a "~D,<frame>\r\n" line.
+//
+
+#define MIRROR_FPS   10  // Maximum mirror frames per second
+#define MIRROR_ROWS  10  // Height of a dirty rectangle band
+
+static Stream *mirrorStream = 0;    // Remote receiving the mirror
+static uint16_t *mirrorShadow = 0;  // Screen contents the remote has
+static uint8_t *mirrorBuf = 0;      // Compressed rectangle
+static uint32_t mirrorBandwidth;    // Bytes per second
+static int32_t mirrorTokens;        // Bytes allowed to send now
+static uint32_t mirrorTimer;        // Last mirror update time
+static uint16_t mirrorFrame;        // Frame sequence number
+static uint16_t mirrorBand;         // Next band to compare
+static uint16_t mirrorRects;        // Rectangles sent in this frame
+static bool mirrorFull;             // TRUE: Send whole screen
+static bool mirrorChanged;          // TRUE: Screen has been redrawn
+
+//
+// Compress a row of pixels, return compressed size
+//
+static size_t mirrorEncodeRow(uint8_t *out, const uint16_t *p, int w)
+{
+  uint8_t *start = out;
+
+  for(int k=0 ; k<w ; )
+  {
+    int run;
+
+    // Count repeated pixels
+    for(run=1 ; (k+run<w) && (run<129) && (p[k+run]==p[k]) ; run++);
+
+    if(run>=2)
+    {
+      *out++ = 0x80 + run - 2;
+      memcpy(out, &p[k], 2);
+      out += 2;
+    }
+    else
+    {
+      // Count literal pixels until the next run
+      for(run=1 ; (k+run<w) && (run<128) ; run++)
+        if((k+run+1<w) && (p[k+run]==p[k+run+1])) break;
+
+      *out++ = run - 1;
+      memcpy(out, &p[k], run * 2);
+      out += run * 2;
+    }
+
+    k += run;
+  }
+
+  return(out - start);
+}
+
+//
+// Write data to the remote as base64, return number of bytes written
+//
+static size_t mirrorWriteBase64(const uint8_t *data, size_t size)
+{
+  static const char b64[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  char out[256];
+  size_t n = 0, total = 0;
+
+  for(size_t j=0 ; j<size ; j+=3)
+  {
+    uint32_t v = data[j] << 16;
+    if(j+1<size) v |= data[j+1] << 8;
+    if(j+2<size) v |= data[j+2];
+
+    out[n++] = b64[(v >> 18) & 0x3F];
+    out[n++] = b64[(v >> 12) & 0x3F];
+    out[n++] = j+1<size? b64[(v >> 6) & 0x3F] : '=';
+    out[n++] = j+2<size? b64[v & 0x3F] : '=';
+
+    if(n > sizeof(out) - 4)
+    {
+      total += mirrorStream->write((uint8_t *)out, n);
+      n = 0;
+    }
+  }
+
+  if(n) total += mirrorStream->write((uint8_t *)out, n);
+  return(total);
+}
+
+//
+// Send screen rectangle to the remote, return number of bytes sent
+//
+static size_t mirrorSendRect(const uint16_t *fb, int x, int y, int w, int h)
+{
+  int width = spr.width();
+  size_t size = 0;
+
+  for(int j=y ; j<y+h ; j++)
+  {
+    // The remote is going to have these pixels now
+    uint16_t *p = mirrorShadow + j * width + x;
+    memcpy(p, fb + j * width + x, w * sizeof(uint16_t));
+    size += mirrorEncodeRow(mirrorBuf + size, p, w);
+  }
+
+  size_t sent = mirrorStream->printf("~D,%u,%d,%d,%d,%d,", mirrorFrame, x, y, w, h);
+  sent += mirrorWriteBase64(mirrorBuf, size);
+  sent += mirrorStream->print("\r\n");
+
+  mirrorRects++;
+  return(sent);
+}
+
+//
+// Start mirroring display to the given remote
+//
+bool mirrorStart(Stream *stream, uint32_t bandwidth)
+{
+  mirrorStop();
+
+  // Worst case compressed band takes less than 3 bytes per pixel
+  mirrorShadow = (uint16_t *)ps_malloc(spr.width() * spr.height() * sizeof(uint16_t));
+  mirrorBuf    = (uint8_t *)ps_malloc(spr.width() * MIRROR_ROWS * 3);
+
+  if(!mirrorShadow || !mirrorBuf)
+  {
+    mirrorStop();
+    return(false);
+  }
+
+  mirrorStream    = stream;
+  mirrorBandwidth = bandwidth;
+  mirrorTokens    = bandwidth / MIRROR_FPS;
+  mirrorTimer     = millis();
+  mirrorBand      = 0;
+  mirrorRects     = 0;
+  mirrorFull      = true;
+  mirrorChanged   = true;
+  return(true);
+}
+
+//
+// Stop mirroring display
+//
+void mirrorStop()
+{
+  free(mirrorShadow);
+  free(mirrorBuf);
+  mirrorShadow = 0;
+  mirrorBuf    = 0;
+  mirrorStream = 0;
+}
+
+//
+// Get remote receiving the mirror (0 if mirror is off)
+//
+Stream *mirrorGetStream()
+{
+  return(mirrorStream);
+}
+
+//
+// Called after the screen buffer has been pushed to the display
+//
+void mirrorRequestFrame()
+{
+  mirrorChanged = true;
+}
+
+//
+// Tick mirror time, sending changed screen areas to the remote
+//
+void mirrorTickTime()
+{
+  // Nothing to do if no remote or no changes
+  if(!mirrorStream || (!mirrorChanged && !mirrorBand)) return;
+
+  // Limit frame rate
+  uint32_t now = millis();
+  if(now - mirrorTimer < 1000 / MIRROR_FPS) return;
+
+  // Refill bandwidth budget, allowing one frame worth of burst
+  int32_t burst = mirrorBandwidth / MIRROR_FPS;
+  mirrorTokens += (now - mirrorTimer) * mirrorBandwidth / 1000;
+  mirrorTokens  = mirrorTokens > burst? burst : mirrorTokens;
+  mirrorTimer   = now;
+
+  // Wait for budget and for the remote to accept data
+  if(mirrorTokens <= 0 || !mirrorStream->availableForWrite()) return;
+
+  // Starting a new frame, changes made after this go into the next one
+  if(!mirrorBand) mirrorChanged = false;
+
+  const uint16_t *fb = (const uint16_t *)spr.getPointer();
+  int width  = spr.width();
+  int height = spr.height();
+
+  // Compare and send bands until out of budget. A band may overdraw
+  // the budget, it will be paid back by the next updates.
+  while((mirrorBand < height) && (mirrorTokens > 0))
+  {
+    int y  = mirrorBand;
+    int h  = height - y < MIRROR_ROWS? height - y : MIRROR_ROWS;
+    int x0 = mirrorFull? 0 : width;
+    int x1 = mirrorFull? width - 1 : -1;
+
+    for(int j=y ; !mirrorFull && j<y+h ; j++)
+    {
+      const uint16_t *a = fb + j * width;
+      const uint16_t *b = mirrorShadow + j * width;
+
+      if(!memcmp(a, b, width * sizeof(uint16_t))) continue;
+
+      int l, r;
+      for(l=0 ; a[l]==b[l] ; l++);
+      for(r=width-1 ; a[r]==b[r] ; r--);
+      x0 = l<x0? l : x0;
+      x1 = r>x1? r : x1;
+    }
+
+    if(x1 >= x0) mirrorTokens -= mirrorSendRect(fb, x0, y, x1 - x0 + 1, h);
+    mirrorBand += h;
+  }
+
+  // Finish frame once all bands have been compared
+  if(mirrorBand >= height)
+  {
+    if(mirrorRects) mirrorStream->printf("~D,%u\r\n", mirrorFrame++);
+    mirrorBand  = 0;
+    mirrorRects = 0;
+    mirrorFull  = false;
+  }
+}
@@ -4,6 +4,7 @@
 #include "Utils.h"
 #include "Menu.h"
 #include "Draw.h"
+#include "Bank.h"
 
 #include <WiFi.h>
 #include <WiFiUdp.h>
@@ -11,8 +12,11 @@
 #include <ESPAsyncWebServer.h>
 #include <NTPClient.h>
 #include <ESPmDNS.h>
+#include <LittleFS.h>
 
 #define CONNECT_TIME  3000  // Time of inactivity to start connecting WiFi
+#define WS_RX_SIZE    256   // WebSocket input buffer size
+#define WS_TX_SIZE    1024  // WebSocket output message size
 
 //
 // Access Point (AP) mode settings
@@ -39,11 +43,120 @@ AsyncWebServer server(80);
 WiFiUDP ntpUDP;
 NTPClient ntpClient(ntpUDP, "pool.ntp.org");
 
+// WebSocket for remote control
+AsyncWebSocket ws("/ws");
+
+//
+// Remote control stream over the WebSocket. Input arrives from the
+// network task and is buffered until loop() reads it, output is sent
+// to all connected clients in messages of up to WS_TX_SIZE bytes.
+//
+class WebSocketStream : public Stream
+{
+private:
+  portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+  uint8_t rxBuf[WS_RX_SIZE];
+  volatile uint16_t rxHead = 0;
+  volatile uint16_t rxTail = 0;
+  char txBuf[WS_TX_SIZE];
+  uint16_t txLen = 0;
+
+public:
+  void receive(const uint8_t *data, size_t size)
+  {
+    portENTER_CRITICAL(&lock);
+    for(size_t j=0 ; j<size ; j++)
+    {
+      uint16_t next = (rxHead + 1) % WS_RX_SIZE;
+      // Drop input if loop() does not keep up
+      if(next == rxTail) break;
+      rxBuf[rxHead] = data[j];
+      rxHead = next;
+    }
+    portEXIT_CRITICAL(&lock);
+  }
+
+  int available() override
+  {
+    return((rxHead - rxTail + WS_RX_SIZE) % WS_RX_SIZE);
+  }
+
+  int peek() override
+  {
+    return(rxHead != rxTail? rxBuf[rxTail] : -1);
+  }
+
+  int read() override
+  {
+    if(rxHead == rxTail) return(-1);
+    int result = rxBuf[rxTail];
+    rxTail = (rxTail + 1) % WS_RX_SIZE;
+    return(result);
+  }
+
+  size_t write(uint8_t byte) override
+  {
+    txBuf[txLen++] = byte;
+    if((byte == '\n') || (txLen >= WS_TX_SIZE)) flush();
+    return(1);
+  }
+
+  size_t write(const uint8_t *data, size_t size) override
+  {
+    for(size_t j=0 ; j<size ; j++) write(data[j]);
+    return(size);
+  }
+
+  int availableForWrite() override
+  {
+    return(ws.count() && ws.availableForWriteAll()? WS_TX_SIZE : 0);
+  }
+
+  void flush() override
+  {
+    if(txLen && ws.count()) ws.textAll(txBuf, txLen);
+    txLen = 0;
+  }
+
+  using Print::write;
+};
+
+static WebSocketStream wsStream;
+static RemoteState wsRemote = { .bandwidth = 50000 };
+
+// Memories uploaded via web, waiting for loop() to apply them
+static Memory webMemories[MEMORY_COUNT];
+static volatile bool webMemoriesReady = false;
+
+// Memory bank uploaded via web, waiting for loop() to import it.
+// Upload state is only used by the web server task, the import
+// status is only written by loop().
+#define WEB_BANK_PAGE 50
+static File webBankFile;
+static AsyncWebServerRequest *webBankUpload = 0; // Upload being received
+static bool webBankUploadOk = false;             // TRUE: Upload is written
+static volatile bool webBankReady = false;
+static char webBankStatus[64] = "";
+
+// Snapshot images are uploaded to a file, same as the memory bank
+#define WEB_SNAPSHOT_PATH "/snapshot.bin"
+static File webSnapshotFile;
+static AsyncWebServerRequest *webSnapshotUpload = 0; // Upload being received
+static bool webSnapshotUploadOk = false;             // TRUE: Upload is written
+static volatile bool webSnapshotReady = false;
+static char webSnapshotStatus[64] = "";
+
 static bool wifiInitAP();
 static bool wifiConnect();
 static void webInit();
 
 static void webSetConfig(AsyncWebServerRequest *request);
+static void webSetMemory(AsyncWebServerRequest *request);
+static void webUploadBank(AsyncWebServerRequest *request, const String &filename, size_t index, uint8_t *data, size_t len, bool final);
+static void webUploadSnapshot(AsyncWebServerRequest *request, const String &filename, size_t index, uint8_t *data, size_t len, bool final);
+static void webGetSnapshot(AsyncWebServerRequest *request);
+static bool webAuthorized(AsyncWebServerRequest *request);
+static void webSocketEvent(AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len);
 
 static const String webInputField(const String &name, const String &value, bool pass = false);
 static const String webStyleSheet();
@@ -51,7 +164,8 @@ static const String webPage(const String &body);
 static const String webUtcOffsetSelector();
 static const String webThemeSelector();
 static const String webRadioPage();
-static const String webMemoryPage();
+static const String webMemoryPage(AsyncWebServerRequest *request);
+static const String webBankPage(AsyncWebServerRequest *request);
 static const String webConfigPage();
 
 //
@@ -72,6 +186,58 @@ void netTickTime()
     connectTime = millis();
     itIsTimeToWiFi = false;
   }
+
+  // Apply memories uploaded via web
+  if(webMemoriesReady)
+  {
+    remoteSetMemories(webMemories);
+    webMemoriesReady = false;
+  }
+
+  // Import memory bank uploaded via web
+  if(webBankReady)
+  {
+    const char *error = bankImport(BANK_CSV_PATH);
+    snprintf(webBankStatus, sizeof(webBankStatus), "%s", error? error : "");
+    webBankReady = false;
+  }
+
+  // Import snapshot uploaded via web
+  if(webSnapshotReady)
+  {
+    const char *error = "Cannot read snapshot";
+    File file = LittleFS.open(WEB_SNAPSHOT_PATH, "r");
+    size_t size = file? file.size() : 0;
+    uint8_t *buf = size && size<=SNAPSHOT_MAX? (uint8_t *)malloc(size) : 0;
+
+    if(buf && file.read(buf, size)==size) error = prefsImport(buf, size, true);
+    if(file) file.close();
+    LittleFS.remove(WEB_SNAPSHOT_PATH);
+    free(buf);
+
+    snprintf(webSnapshotStatus, sizeof(webSnapshotStatus), "%s", error? error : "");
+    webSnapshotReady = false;
+
+    // Restart with the new preferences, once the reply is sent
+    if(!error)
+    {
+      prefsFlush();
+      delay(500);
+      ESP.restart();
+    }
+  }
+
+  // Periodically print status to WebSocket clients
+  if(ws.count()) remoteTickTime(&wsStream, &wsRemote);
+  ws.cleanupClients();
+}
+
+//
+// Receive and execute WebSocket command
+//
+int netDoCommand()
+{
+  return(remoteDoInput(&wsStream, &wsRemote));
 }
 
 //
@@ -110,6 +276,7 @@ void netStop()
 {
   wifi_mode_t mode = WiFi.getMode();
 
+  if(mirrorGetStream() == &wsStream) mirrorStop();
   MDNS.end();
 
   // If network connection up, shut it down
@@ -318,16 +485,53 @@ static void webInit()
   });
 
   server.on("/memory", HTTP_ANY, [] (AsyncWebServerRequest *request) {
-    request->send(200, "text/html", webMemoryPage());
+    request->send(200, "text/html", webMemoryPage(request));
   });
 
+  server.on("/memory.csv", HTTP_ANY, [] (AsyncWebServerRequest *request) {
+    AsyncResponseStream *response = request->beginResponseStream("text/plain");
+    remoteExportMemories(response);
+    request->send(response);
+  });
+
+  // This method loads all memories at once
+  server.on("/setmemory", HTTP_ANY, webSetMemory);
+
+  server.on("/bank.csv", HTTP_ANY, [] (AsyncWebServerRequest *request) {
+    request->send(LittleFS, BANK_CSV_PATH, "text/plain");
+  });
+
+  // Memory bank is uploaded as a CSV file
+  server.on("/setbank", HTTP_POST, [] (AsyncWebServerRequest *request) {
+    if(request!=webBankUpload)
+      request->send(409, "text/plain", "Error: Import pending");
+    else if(!webBankUploadOk)
+      request->send(500, "text/plain", "Error: Cannot write bank");
+    else
+      request->redirect("/memory");
+    if(request==webBankUpload) webBankUpload = 0;
+  }, webUploadBank, nullptr);
+
   server.on("/config", HTTP_ANY, [] (AsyncWebServerRequest *request) {
-    if(loginUsername != "" && loginPassword != "")
-      if(!request->authenticate(loginUsername.c_str(), loginPassword.c_str()))
-        return request->requestAuthentication();
+    if(!webAuthorized(request)) return request->requestAuthentication();
     request->send(200, "text/html", webConfigPage());
   });
 
+  // Snapshot includes network passwords, it needs a login
+  server.on("/snapshot.bin", HTTP_ANY, webGetSnapshot);
+
+  server.on("/setsnapshot", HTTP_POST, [] (AsyncWebServerRequest *request) {
+    if(!webAuthorized(request))
+      request->requestAuthentication();
+    else if(request!=webSnapshotUpload)
+      request->send(409, "text/plain", "Error: Import pending");
+    else if(!webSnapshotUploadOk)
+      request->send(500, "text/plain", "Error: Cannot write snapshot");
+    else
+      request->redirect("/config");
+    if(request==webSnapshotUpload) webSnapshotUpload = 0;
+  }, webUploadSnapshot, nullptr);
+
   server.onNotFound([] (AsyncWebServerRequest *request) {
     request->send(404, "text/plain", "Not found");
   });
@@ -335,6 +539,10 @@ static void webInit()
   // This method saves configuration form contents
   server.on("/setconfig", HTTP_ANY, webSetConfig);
 
+  // WebSocket accepts remote control commands
+  ws.onEvent(webSocketEvent);
+  server.addHandler(&ws);
+
   // Start web server
   server.begin();
 }
@@ -412,6 +620,122 @@ void webSetConfig(AsyncWebServerRequest *request)
     netRequestConnect();
 }
 
+void webSetMemory(AsyncWebServerRequest *request)
+{
+  // Previous upload has not been applied yet
+  if(webMemoriesReady)
+  {
+    request->send(503, "text/plain", "Busy, try again");
+    return;
+  }
+
+  if(!request->hasParam("memories", true))
+  {
+    request->send(400, "text/plain", "No memories");
+    return;
+  }
+
+  // Validate all memories before applying any of them
+  const char *error = remoteParseMemories(request->getParam("memories", true)->value().c_str(), webMemories);
+  if(error)
+  {
+    request->send(400, "text/plain", String("Error: ") + error);
+    return;
+  }
+
+  // Memories will be applied and saved by netTickTime()
+  webMemoriesReady = true;
+  request->redirect("/memory");
+}
+
+void webUploadBank(AsyncWebServerRequest *request, const String &filename, size_t index, uint8_t *data, size_t len, bool final)
+{
+  if(!index)
+  {
+    // Previous upload has not been imported yet, reject this one
+    webBankUpload   = webBankReady? 0 : request;
+    webBankUploadOk = false;
+    if(!webBankUpload) return;
+
+    if(webBankFile) webBankFile.close();
+    webBankFile = LittleFS.open(BANK_CSV_PATH, "w");
+  }
+
+  if(request!=webBankUpload || !webBankFile) return;
+  if(len) diskCountWrite(webBankFile.write(data, len));
+
+  // Bank will be imported by netTickTime()
+  if(final)
+  {
+    webBankFile.close();
+    webBankUploadOk = true;
+    webBankReady = true;
+  }
+}
+
+//
+// Check web UI login, if there is one
+//
+static bool webAuthorized(AsyncWebServerRequest *request)
+{
+  return(loginUsername == "" || loginPassword == "" ||
+         request->authenticate(loginUsername.c_str(), loginPassword.c_str()));
+}
+
+static void webGetSnapshot(AsyncWebServerRequest *request)
+{
+  if(!webAuthorized(request)) return request->requestAuthentication();
+
+  uint8_t *buf = (uint8_t *)malloc(SNAPSHOT_MAX);
+  size_t size = buf? prefsExport(buf, SNAPSHOT_MAX, true) : 0;
+
+  if(!size)
+    request->send(500, "text/plain", "Cannot make snapshot");
+  else
+  {
+    AsyncResponseStream *response = request->beginResponseStream("application/octet-stream");
+    response->addHeader("Content-Disposition", "attachment; filename=snapshot.bin");
+    response->write(buf, size);
+    request->send(response);
+  }
+
+  free(buf);
+}
+
+static void webUploadSnapshot(AsyncWebServerRequest *request, const String &filename, size_t index, uint8_t *data, size_t len, bool final)
+{
+  if(!index)
+  {
+    // Previous upload has not been imported yet, reject this one
+    webSnapshotUpload   = webSnapshotReady || !webAuthorized(request)? 0 : request;
+    webSnapshotUploadOk = false;
+    if(!webSnapshotUpload) return;
+
+    if(webSnapshotFile) webSnapshotFile.close();
+    webSnapshotFile = LittleFS.open(WEB_SNAPSHOT_PATH, "w");
+  }
+
+  if(request!=webSnapshotUpload || !webSnapshotFile) return;
+  if(len) diskCountWrite(webSnapshotFile.write(data, len));
+
+  // Snapshot will be imported by netTickTime()
+  if(final)
+  {
+    webSnapshotFile.close();
+    webSnapshotUploadOk = true;
+    webSnapshotReady = true;
+  }
+}
+
+static void webSocketEvent(AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len)
+{
+  AwsFrameInfo *info = (AwsFrameInfo *)arg;
+
+  // Pass text to the remote control stream
+  if((type == WS_EVT_DATA) && (info->opcode == WS_TEXT))
+    wsStream.receive(data, len);
+}
+
 static const String webInputField(const String &name, const String &value, bool pass)
 {
   String newValue(value);
@@ -570,7 +894,7 @@ static const String webRadioPage()
 "</TR>"
 "<TR>"
   "<TD CLASS='LABEL'>Band</TD>"
-  "<TD>" + String(getCurrentBand()->bandName) + "</TD>"
+  "<TD>" + String(getCurrentBand()->plan->bandName) + "</TD>"
 "</TR>"
 "<TR>"
   "<TD CLASS='LABEL'>Frequency</TD>"
@@ -592,9 +916,111 @@ static const String webRadioPage()
 );
 }
 
-static const String webMemoryPage()
+//
+// String receiving printed text
+//
+class StringPrint : public Print
+{
+public:
+  String text;
+  size_t write(uint8_t byte) override { text += (char)byte; return(1); }
+};
+
+//
+// List a page of memory bank entries, starting at "from", or at
+// "freq" (kHz), optionally matching "group" and "q" (name)
+//
+static const String webBankPage(AsyncWebServerRequest *request)
+{
+  String q   = request->hasParam("q")? request->getParam("q")->value() : "";
+  int group  = request->hasParam("group") && request->getParam("group")->value()!=""?
+    request->getParam("group")->value().toInt() : -1;
+  int pos    = request->hasParam("from")? request->getParam("from")->value().toInt() : 0;
+  String items = "";
+  static BankEntry list[WEB_BANK_PAGE];
+
+  if(request->hasParam("freq") && request->getParam("freq")->value()!="")
+    pos = bankFind(request->getParam("freq")->value().toFloat() * 1000);
+
+  // Read matching entries in one pass
+  int count = bankQuery(pos, q!=""? q.c_str() : 0, group, list, WEB_BANK_PAGE, &pos);
+
+  for(int j=0 ; j<count ; j++)
+  {
+    const BankEntry &entry = list[j];
+
+    String name = entry.name;
+    name.replace("&", "&amp;");
+    name.replace("<", "&lt;");
+
+    String freq = entry.mode == FM?
+      String(entry.freq / 1000000.0) + "MHz "
+    : String(entry.freq / 1000.0) + "kHz ";
+
+    items += "<TR><TD CLASS='LABEL' WIDTH='10%'>" + String(entry.group) + "</TD><TD>" +
+      freq + bandModeDesc[entry.mode] + " " + name + "</TD></TR>";
+  }
+
+  q.replace("&", "&amp;");
+  q.replace("'", "&#39;");
+  String filter =
+    "<INPUT TYPE='HIDDEN' NAME='q' VALUE='" + q + "'>"
+    "<INPUT TYPE='HIDDEN' NAME='group' VALUE='" + (group>=0? String(group) : String("")) + "'>";
+
+  return(
+"<TABLE COLUMNS=2>"
+"<TR><TH CLASS='HEADING' COLSPAN=2>"
+  "Memory Bank, " + String(bankGetCount()) + " entries "
+  "(<A HREF='/bank.csv'>Download</A>) " + (webBankReady? "Importing..." : webBankStatus) +
+"</TH></TR>" + items +
+"</TABLE>"
+"<FORM ACTION='/memory' METHOD='GET'>"
+  "<TABLE COLUMNS=1><TR><TH CLASS='HEADING'>" +
+  (pos>=0 && pos<bankGetCount()?
+    "<INPUT TYPE='HIDDEN' NAME='from' VALUE='" + String(pos) + "'>" + filter +
+    "<INPUT TYPE='SUBMIT' VALUE='Next'>" : String("")) +
+  "</TH></TR></TABLE>"
+"</FORM>"
+"<FORM ACTION='/memory' METHOD='GET'>"
+  "<TABLE COLUMNS=2>"
+  "<TR>"
+    "<TD CLASS='LABEL'>Name</TD>"
+    "<TD>" + webInputField("q", "") + "</TD>"
+  "</TR>"
+  "<TR>"
+    "<TD CLASS='LABEL'>Group</TD>"
+    "<TD>" + webInputField("group", "") + "</TD>"
+  "</TR>"
+  "<TR>"
+    "<TD CLASS='LABEL'>Frequency (kHz)</TD>"
+    "<TD>" + webInputField("freq", "") + "</TD>"
+  "</TR>"
+  "<TR><TH COLSPAN=2 CLASS='HEADING'>"
+    "<INPUT TYPE='SUBMIT' VALUE='Find'>"
+  "</TH></TR>"
+  "</TABLE>"
+"</FORM>"
+"<FORM ACTION='/setbank' METHOD='POST' ENCTYPE='multipart/form-data'>"
+  "<TABLE COLUMNS=1>"
+  "<TR><TD>"
+    "<INPUT TYPE='FILE' NAME='bank' ACCEPT='.csv,.txt'>"
+  "</TD></TR>"
+  "<TR><TH CLASS='HEADING'>"
+    "<INPUT TYPE='SUBMIT' VALUE='Upload'>"
+  "</TH></TR>"
+  "</TABLE>"
+"</FORM>"
+  );
+}
+
+static const String webMemoryPage(AsyncWebServerRequest *request)
 {
   String items = "";
+  StringPrint list;
+
+  remoteExportMemories(&list);
+  list.text.replace("&", "&amp;");
+  list.text.replace("<", "&lt;");
 
   for(int j=0 ; j<MEMORY_COUNT ; j++)
   {
@@ -619,6 +1045,20 @@ static const String webMemoryPage()
   "<A HREF='/'>Status</A>&nbsp;|&nbsp;<A HREF='/config'>Config</A>"
 "</P>"
 "<TABLE COLUMNS=2>" + items + "</TABLE>"
+"<FORM ACTION='/setmemory' METHOD='POST'>"
+  "<TABLE COLUMNS=1>"
+  "<TR><TH CLASS='HEADING'>"
+    "Edit Memories (<A HREF='/memory.csv'>Download</A>)"
+  "</TH></TR>"
+  "<TR><TD>"
+    "<TEXTAREA NAME='memories' ROWS=12 STYLE='width: 95%;'>" + list.text + "</TEXTAREA>"
+  "</TD></TR>"
+  "<TR><TH CLASS='HEADING'>"
+    "<INPUT TYPE='SUBMIT' VALUE='Save'>"
+  "</TH></TR>"
+  "</TABLE>"
+"</FORM>"
++ webBankPage(request)
 );
 }
 
@@ -705,5 +1145,18 @@ const String webConfigPage()
   "</TH></TR>"
   "</TABLE>"
 "</FORM>"
+"<FORM ACTION='/setsnapshot' METHOD='POST' ENCTYPE='multipart/form-data'>"
+  "<TABLE COLUMNS=1>"
+  "<TR><TH CLASS='HEADING'>"
+    "Snapshot (<A HREF='/snapshot.bin'>Download</A>) " + (webSnapshotReady? "Importing..." : webSnapshotStatus) +
+  "</TH></TR>"
+  "<TR><TD>"
+    "<INPUT TYPE='FILE' NAME='snapshot' ACCEPT='.bin'>"
+  "</TD></TR>"
+  "<TR><TH CLASS='HEADING'>"
+    "<INPUT TYPE='SUBMIT' VALUE='Restore'>"
+  "</TH></TR>"
+  "</TABLE>"
+"</FORM>"
 );
 }
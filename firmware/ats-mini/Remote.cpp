@@ -1,12 +1,51 @@
 #include "Common.h"
+#include "Storage.h"
 #include "Themes.h"
 #include "Utils.h"
 #include "Menu.h"
 #include "Draw.h"
+#include <ctype.h>
 
-static uint32_t remoteTimer = millis();
-static uint8_t remoteSeqnum = 0;
-static bool remoteLogOn = false;
+#define REMOTE_SURVEY_SIZE  200   // Maximum frequencies per survey
+#define REMOTE_SURVEY_DWELL 10000 // Maximum dwell time (msecs)
+
+// Topic letters used by subscribe/unsubscribe commands, in TOPIC_* order
+static const char remoteTopicNames[TOPIC_COUNT + 1] = "FSRBGM";
+
+// Topic generations, incremented on every change
+static uint16_t remoteTopicGen[TOPIC_COUNT];
+
+// TRUE: Current command failed
+static bool remoteFailed = false;
+
+// TRUE: Echo command input back to the remote
+static bool remoteEcho = true;
+
+//
+// Stream reading a queued command, while writing to the remote.
+// Reading past the end of the command returns '\r'.
+//
+class RemoteLineStream : public Stream
+{
+private:
+  Stream *output;
+  const char *data;
+  size_t size;
+  size_t pos;
+
+public:
+  RemoteLineStream(Stream *output, const char *data) :
+    output(output), data(data), size(strlen(data) + 1), pos(0) {}
+
+  int available() override { return(size - pos); }
+  int peek() override { return(pos < size - 1? (uint8_t)data[pos] : '\r'); }
+  int read() override { int ch = peek(); pos += pos < size; return(ch); }
+
+  size_t write(uint8_t byte) override { return(output->write(byte)); }
+  size_t write(const uint8_t *buf, size_t n) override { return(output->write(buf, n)); }
+  int availableForWrite() override { return(output->availableForWrite()); }
+  using Print::write;
+};
 
 static uint8_t char2nibble(char key)
 {
@@ -19,64 +58,65 @@ static uint8_t char2nibble(char key)
 //
 // Capture current screen image to the remote
 //
-static void remoteCaptureScreen()
+static void remoteCaptureScreen(Stream *stream)
 {
   uint16_t width  = spr.width();
   uint16_t height = spr.height();
 
   // 14 bytes of BMP header
-  Serial.println("");
-  Serial.print("424d"); // BM
+  stream->println("");
+  stream->print("424d"); // BM
   // Image size
-  Serial.printf("%08x", (unsigned int)htonl(14 + 40 + 12 + width * height * 2));
-  Serial.print("00000000");
+  stream->printf("%08x", (unsigned int)htonl(14 + 40 + 12 + width * height * 2));
+  stream->print("00000000");
   // Offset to image data
-  Serial.printf("%08x", (unsigned int)htonl(14 + 40 + 12));
+  stream->printf("%08x", (unsigned int)htonl(14 + 40 + 12));
   // Image header
-  Serial.print("28000000"); // Header size
-  Serial.printf("%08x", (unsigned int)htonl(width));
-  Serial.printf("%08x", (unsigned int)htonl(height));
-  Serial.print("01001000"); // 1 plane, 16 bpp
-  Serial.print("03000000"); // Compression
-  Serial.print("00000000"); // Compressed image size
-  Serial.print("00000000"); // X res
-  Serial.print("00000000"); // Y res
-  Serial.print("00000000"); // Color map
-  Serial.print("00000000"); // Colors
-  Serial.print("00f80000"); // Red mask
-  Serial.print("e0070000"); // Green mask
-  Serial.println("1f000000"); // Blue mask
+  stream->print("28000000"); // Header size
+  stream->printf("%08x", (unsigned int)htonl(width));
+  stream->printf("%08x", (unsigned int)htonl(height));
+  stream->print("01001000"); // 1 plane, 16 bpp
+  stream->print("03000000"); // Compression
+  stream->print("00000000"); // Compressed image size
+  stream->print("00000000"); // X res
+  stream->print("00000000"); // Y res
+  stream->print("00000000"); // Color map
+  stream->print("00000000"); // Colors
+  stream->print("00f80000"); // Red mask
+  stream->print("e0070000"); // Green mask
+  stream->println("1f000000"); // Blue mask
 
   // Image data
   for(int y=height-1 ; y>=0 ; y--)
   {
     for(int x=0 ; x<width ; x++)
     {
-      Serial.printf("%04x", htons(spr.readPixel(x, y)));
+      stream->printf("%04x", htons(spr.readPixel(x, y)));
     }
-    Serial.println("");
+    stream->println("");
   }
 }
 
-char readSerialChar()
+char readSerialChar(Stream *stream)
 {
   char key;
 
-  while (!Serial.available());
-  key = Serial.read();
-  Serial.print(key);
+  // Queued commands keep returning '\r' past their end
+  while (!stream->available() && stream->peek() < 0);
+  key = stream->read();
+  if (remoteEcho) stream->print(key);
   return key;
 }
 
-long int readSerialInteger()
+long int readSerialInteger(Stream *stream)
 {
   long int result = 0;
   while (true) {
-    char ch = Serial.peek();
+    char ch = stream->peek();
     if (ch == 0xFF) {
       continue;
     } else if ((ch >= '0') && (ch <= '9')) {
-      ch = readSerialChar();
+      ch = readSerialChar(stream);
       // Can overflow, but it's ok
       result = result * 10 + (ch - '0');
     } else {
@@ -85,18 +125,18 @@ long int readSerialInteger()
   }
 }
 
-void readSerialString(char *bufStr, uint8_t bufLen)
+void readSerialString(Stream *stream, char *bufStr, uint8_t bufLen)
 {
   uint8_t length = 0;
   while (true) {
-    char ch = Serial.peek();
+    char ch = stream->peek();
     if (ch == 0xFF) {
       continue;
     } else if (ch == ',' || ch < ' ') {
       bufStr[length] = '\0';
       return;
     } else {
-      ch = readSerialChar();
+      ch = readSerialChar(stream);
       bufStr[length] = ch;
       if (++length >= bufLen - 1) {
         bufStr[length] = '\0';
@@ -106,70 +146,66 @@ void readSerialString(char *bufStr, uint8_t bufLen)
   }
 }
 
-static bool expectNewline()
+static bool expectNewline(Stream *stream)
 {
   char ch;
-  while ((ch = Serial.peek()) == 0xFF);
+  while ((ch = stream->peek()) == 0xFF);
   if (ch == '\r') {
-    Serial.read();
+    stream->read();
     return true;
   }
   return false;
 }
 
-static bool showError(const char *message)
+static bool showError(Stream *stream, const char *message)
 {
   // Consume the remaining input
-  while (Serial.available()) readSerialChar();
-  Serial.printf("\r\nError: %s\r\n", message);
+  while (stream->available()) readSerialChar(stream);
+  stream->printf("\r\nError: %s\r\n", message);
+  remoteFailed = true;
   return false;
 }
 
-static void remoteGetMemories()
+static void remoteGetMemories(Stream *stream)
 {
   for (uint8_t i = 0; i < getTotalMemories(); i++) {
     if (memories[i].freq) {
-      Serial.printf("#%02d,%s,%ld,%s\r\n", i + 1, bands[memories[i].band].bandName, memories[i].freq, bandModeDesc[memories[i].mode]);
+      stream->printf("#%02d,%s,%ld,%s\r\n", i + 1, getBandPlan(memories[i].band)->bandName, memories[i].freq, bandModeDesc[memories[i].mode]);
     }
   }
 }
 
 
-static bool remoteSetMemory()
+static bool remoteSetMemory(Stream *stream)
 {
-  Serial.print('#');
+  stream->print('#');
   Memory mem;
   uint32_t freq = 0;
 
-  long int slot = readSerialInteger();
-  if (readSerialChar() != ',')
-    return showError("Expected ','");
+  memset(&mem, 0, sizeof(mem));
+
+  long int slot = readSerialInteger(stream);
+  if (readSerialChar(stream) != ',')
+    return showError(stream, "Expected ','");
   if (slot < 1 || slot > getTotalMemories())
-    return showError("Invalid memory slot number");
+    return showError(stream, "Invalid memory slot number");
 
   char band[8];
-  readSerialString(band, 8);
-  if (readSerialChar() != ',')
-    return showError("Expected ','");
-  mem.band = 0xFF;
-  for (int i = 0; i < getTotalBands(); i++) {
-    if (strcmp(bands[i].bandName, band) == 0) {
-      mem.band = i;
-      break;
-    }
-  }
-  if (mem.band == 0xFF)
-    return showError("No such band");
+  readSerialString(stream, band, 8);
+  if (readSerialChar(stream) != ',')
+    return showError(stream, "Expected ','");
+  if (findBandByName(band) < 0)
+    return showError(stream, "No such band");
 
-  freq = readSerialInteger();
-  if (readSerialChar() != ',')
-    return showError("Expected ','");
+  freq = readSerialInteger(stream);
+  if (readSerialChar(stream) != ',')
+    return showError(stream, "Expected ','");
 
   char mode[4];
-  readSerialString(mode, 4);
-  if (!expectNewline())
-    return showError("Expected newline");
-  Serial.println();
+  readSerialString(stream, mode, 4);
+  if (!expectNewline(stream))
+    return showError(stream, "Expected newline");
+  stream->println();
   mem.mode = 15;
   for (int i = 0; i < getTotalModes(); i++) {
     if (strcmp(bandModeDesc[i], mode) == 0) {
@@ -178,41 +214,364 @@ static bool remoteSetMemory()
     }
   }
   if (mem.mode == 15)
-    return showError("No such mode");
+    return showError(stream, "No such mode");
 
   mem.freq = freq;
 
-  if (!isMemoryInBand(&bands[mem.band], &mem)) {
+  // Handles duplicate band names (15M)
+  mem.band = findBandByName(band, &mem);
+
+  if (!isMemoryInBand(getBandPlan(mem.band), &mem)) {
     if (!freq) {
       // Clear slot
       memories[slot-1] = mem;
       return true;
-    } else {
-      // Handle duplicate band names (15M)
-      mem.band = 0xFF;
-      for (int i = getTotalBands()-1; i >= 0; i--) {
-        if (strcmp(bands[i].bandName, band) == 0) {
-          mem.band = i;
-          break;
-        }
-      }
-      if (mem.band == 0xFF)
-        return showError("No such band");
-      if (!isMemoryInBand(&bands[mem.band], &mem))
-        return showError("Invalid frequency or mode");
     }
+    return showError(stream, "Invalid frequency or mode");
   }
 
   memories[slot-1] = mem;
   return true;
 }
 
+//
+// Read a line without echoing it, return FALSE on timeout
+//
+static bool readSerialLine(Stream *stream, char *buf, size_t size, uint32_t timeout)
+{
+  uint32_t time = millis();
+  size_t length = 0;
+
+  while(millis() - time < timeout)
+  {
+    if(!stream->available())
+    {
+      delay(1);
+      continue;
+    }
+
+    char ch = stream->read();
+    time = millis();
+
+    if((ch == '\r') || (ch == '\n'))
+    {
+      buf[length] = '\0';
+      return(true);
+    }
+
+    if(length < size - 1) buf[length++] = ch;
+  }
+
+  return(false);
+}
+
+//
+// Parse "#slot,band,freq,mode[,name]" line into given memory list,
+// return error message or 0 if successful
+//
+static const char *parseMemoryLine(char *line, Memory *list)
+{
+  char *fields[5] = { line };
+  int n = 1;
+
+  // Split line into fields, the last one (name) may contain commas
+  for(char *p=line ; *p && n<ITEM_COUNT(fields) ; p++)
+    if(*p == ',') { *p = '\0'; fields[n++] = p + 1; }
+
+  if(line[0]!='#' || n<4) return("Expected '#slot,band,freq,mode'");
+
+  long int slot = atol(fields[0] + 1);
+  if(slot<1 || slot>getTotalMemories()) return("Invalid memory slot number");
+
+  Memory mem;
+  memset(&mem, 0, sizeof(mem));
+  mem.freq = strtoul(fields[2], 0, 10);
+
+  for(mem.mode=0 ; mem.mode<getTotalModes() ; mem.mode++)
+    if(!strcmp(bandModeDesc[mem.mode], fields[3])) break;
+  if(mem.mode>=getTotalModes()) return("No such mode");
+
+  int band = findBandByName(fields[1], &mem);
+  if(band<0) return("No such band");
+  mem.band = band;
+
+  // Zero frequency clears the slot
+  if(mem.freq && !isMemoryInBand(getBandPlan(band), &mem))
+    return("Invalid frequency or mode");
+
+  if(n>4) strncpy(mem.name, fields[4], sizeof(mem.name) - 1);
+
+  list[slot - 1] = mem;
+  return(0);
+}
+
+//
+// Parse a memory list, return error message or 0 if successful.
+// Slots missing from the list will be empty.
+//
+const char *remoteParseMemories(const char *text, Memory *list)
+{
+  char line[64];
+
+  memset(list, 0, sizeof(Memory) * getTotalMemories());
+
+  while(*text)
+  {
+    size_t length = strcspn(text, "\r\n");
+    if(length >= sizeof(line)) return("Line too long");
+
+    memcpy(line, text, length);
+    line[length] = '\0';
+    text += length;
+    text += strspn(text, "\r\n");
+
+    // Skip empty lines and block markers
+    if(!line[0] || line[0]=='{' || line[0]=='}') continue;
+
+    const char *error = parseMemoryLine(line, list);
+    if(error) return(error);
+  }
+
+  return(0);
+}
+
+//
+// Replace all memories and save them on the next tick
+//
+void remoteSetMemories(const Memory *list)
+{
+  memcpy(memories, list, sizeof(Memory) * getTotalMemories());
+  prefsRequestSave(SAVE_MEMORIES, true);
+  remoteEmit(TOPIC_MEMORY);
+}
+
+//
+// Print all memories as a block that can be loaded back with '{'
+//
+void remoteExportMemories(Print *out)
+{
+  out->print("{\r\n");
+
+  for(int i=0 ; i<getTotalMemories() ; i++)
+  {
+    const Memory *mem = &memories[i];
+    if(mem->freq)
+      out->printf("#%02d,%s,%lu,%s,%.*s\r\n",
+        i + 1, getBandPlan(mem->band)->bandName, (unsigned long)mem->freq,
+        bandModeDesc[mem->mode], (int)sizeof(mem->name), mem->name
+      );
+  }
+
+  out->print("}\r\n");
+}
+
+//
+// Load all memories from a "{...}" block. Nothing changes unless
+// every line is valid.
+//
+static bool remoteImportMemories(Stream *stream)
+{
+  static Memory list[MEMORY_COUNT];
+  const char *error = 0;
+  char line[64];
+
+  memset(list, 0, sizeof(list));
+
+  while(true)
+  {
+    if(!readSerialLine(stream, line, sizeof(line), 2000))
+      return showError(stream, "Timeout");
+
+    // Block ends with '}'
+    if(line[0]=='}') break;
+
+    // Remember the first error but consume the whole block
+    if(line[0] && !error) error = parseMemoryLine(line, list);
+  }
+
+  if(error) return showError(stream, error);
+
+  remoteSetMemories(list);
+  stream->print("Ok\r\n");
+  return(true);
+}
+
+//
+// Print snapshot image of all preferences as "~X,<size>,<hex>". Remote
+// streams are not authenticated, so network settings are left out.
+//
+static bool remoteExportSnapshot(Stream *stream)
+{
+  uint8_t *buf = (uint8_t *)malloc(SNAPSHOT_MAX);
+  if(!buf) return showError(stream, "Out of memory");
+
+  size_t size = prefsExport(buf, SNAPSHOT_MAX);
+  if(!size)
+  {
+    free(buf);
+    return showError(stream, "Snapshot too large");
+  }
+
+  stream->printf("~X,%u,", (unsigned)size);
+
+  // Write hex digits in chunks, byte writes are slow over BLE
+  for(size_t j=0 ; j<size ; j+=32)
+  {
+    char hex[65];
+    int n = 0;
+
+    for(size_t k=j ; k<size && k<j+32 ; k++)
+      n += sprintf(hex + n, "%02X", buf[k]);
+
+    stream->write((const uint8_t *)hex, n);
+  }
+
+  stream->print("\r\n");
+  free(buf);
+  return(true);
+}
+
+//
+// Load snapshot image sent as "x<hex>\r" and restart. Nothing changes
+// unless the image is valid. Images with network settings are refused.
+//
+static bool remoteImportSnapshot(Stream *stream)
+{
+  const char *error = 0;
+  uint32_t time = millis();
+  size_t size = 0;
+
+  uint8_t *buf = (uint8_t *)malloc(SNAPSHOT_MAX);
+  if(!buf) return showError(stream, "Out of memory");
+
+  // Read hex digits without echoing them, until newline
+  while(true)
+  {
+    if(millis() - time >= 2000)
+    {
+      free(buf);
+      return showError(stream, "Timeout");
+    }
+
+    if(!stream->available())
+    {
+      delay(1);
+      continue;
+    }
+
+    char ch = stream->read();
+    time = millis();
+
+    if((ch == '\r') || (ch == '\n')) break;
+
+    // Remember the first error but consume the whole image
+    if(error) continue;
+    if(!isxdigit(ch))
+      error = "Expected hex digits";
+    else if(size >= SNAPSHOT_MAX * 2)
+      error = "Snapshot too large";
+    else if(size++ & 1)
+      buf[size / 2 - 1] |= char2nibble(ch);
+    else
+      buf[size / 2] = char2nibble(ch) << 4;
+  }
+
+  if(!error && (size & 1)) error = "Expected hex digits";
+  if(!error) error = prefsImport(buf, size / 2);
+  free(buf);
+
+  if(error) return showError(stream, error);
+
+  // Restart with the new preferences
+  prefsFlush();
+  stream->print("\r\nOk\r\n");
+  stream->flush();
+  delay(500);
+  ESP.restart();
+  return(true);
+}
+
+//
+// Tune to each of given frequencies in the current band, measure
+// RSSI/SNR <dwell> msecs after tuning, and report results:
+//
+//   Q<dwell>,<start>,<stop>,<step>\r  - Range of frequencies
+//   q<dwell>,<freq>[,<freq>...]\r     - List of frequencies
+//
+// Replies with "~Q,<freq>,<rssi>,<snr>" per frequency, then "~Q".
+//
+static bool remoteSurvey(Stream *stream, bool range)
+{
+  static uint16_t freqs[REMOTE_SURVEY_SIZE];
+  uint16_t count = 0;
+
+  long int dwell = readSerialInteger(stream);
+  if (readSerialChar(stream) != ',')
+    return showError(stream, "Expected ','");
+  if (dwell < 0 || dwell > REMOTE_SURVEY_DWELL)
+    return showError(stream, "Invalid dwell time");
+
+  if (range) {
+    long int start = readSerialInteger(stream);
+    if (readSerialChar(stream) != ',')
+      return showError(stream, "Expected ','");
+    long int stop = readSerialInteger(stream);
+    if (readSerialChar(stream) != ',')
+      return showError(stream, "Expected ','");
+    long int step = readSerialInteger(stream);
+    if (!expectNewline(stream))
+      return showError(stream, "Expected newline");
+    if (step < 1 || stop < start || (stop - start) / step >= REMOTE_SURVEY_SIZE)
+      return showError(stream, "Invalid frequency range");
+    // Check limits before narrowing frequencies to 16 bits
+    if (start < 0 || stop > 0xFFFF)
+      return showError(stream, "Invalid frequency");
+    for (long int freq = start; freq <= stop; freq += step)
+      freqs[count++] = freq;
+  } else {
+    while (true) {
+      if (count >= REMOTE_SURVEY_SIZE)
+        return showError(stream, "Too many frequencies");
+      long int freq = readSerialInteger(stream);
+      // Check limits before narrowing frequencies to 16 bits
+      if (freq < 0 || freq > 0xFFFF)
+        return showError(stream, "Invalid frequency");
+      freqs[count++] = freq;
+      if (expectNewline(stream))
+        break;
+      if (readSerialChar(stream) != ',')
+        return showError(stream, "Expected ','");
+    }
+  }
+
+  stream->println();
+
+  // All frequencies must be in the current band
+  for (uint16_t j = 0; j < count; j++)
+    if (!isFreqInBand(getCurrentBand()->plan, freqs[j]))
+      return showError(stream, "Invalid frequency");
+
+  scanMeasureStart();
+
+  for (uint16_t j = 0; j < count; j++) {
+    uint8_t rssi, snr;
+    if (!scanMeasure(freqs[j], dwell, &rssi, &snr))
+      break;
+    stream->printf("~Q,%u,%hu,%hu\r\n", freqs[j], rssi, snr);
+  }
+
+  scanMeasureStop();
+
+  stream->print("~Q\r\n");
+  return true;
+}
+
 //
 // Set current color theme from the remote
 //
-static void remoteSetColorTheme()
+static void remoteSetColorTheme(Stream *stream)
 {
-  Serial.print("Enter a string of hex colors (x0001x0002...): ");
+  stream->print("Enter a string of hex colors (x0001x0002...): ");
 
   uint8_t *p = (uint8_t *)&(TH.bg);
 
@@ -220,20 +579,20 @@ static void remoteSetColorTheme()
   {
     if(i >= sizeof(ColorTheme)-offsetof(ColorTheme, bg))
     {
-      Serial.println(" Ok");
+      stream->println(" Ok");
       break;
     }
 
-    if(readSerialChar() != 'x')
+    if(readSerialChar(stream) != 'x')
     {
-      Serial.println(" Err");
+      stream->println(" Err");
       break;
     }
 
-    p[i + 1]  = char2nibble(readSerialChar()) * 16;
-    p[i + 1] |= char2nibble(readSerialChar());
-    p[i]      = char2nibble(readSerialChar()) * 16;
-    p[i]     |= char2nibble(readSerialChar());
+    p[i + 1]  = char2nibble(readSerialChar(stream)) * 16;
+    p[i + 1] |= char2nibble(readSerialChar(stream));
+    p[i]      = char2nibble(readSerialChar(stream)) * 16;
+    p[i]     |= char2nibble(readSerialChar(stream));
   }
 
   // Redraw screen
@@ -243,23 +602,23 @@ static void remoteSetColorTheme()
 //
 // Print current color theme to the remote
 //
-static void remoteGetColorTheme()
+static void remoteGetColorTheme(Stream *stream)
 {
-  Serial.printf("Color theme %s: ", TH.name);
+  stream->printf("Color theme %s: ", TH.name);
   const uint8_t *p = (uint8_t *)&(TH.bg);
 
   for(int i=0 ; i<sizeof(ColorTheme)-offsetof(ColorTheme, bg) ; i+=sizeof(uint16_t))
   {
-    Serial.printf("x%02X%02X", p[i+1], p[i]);
+    stream->printf("x%02X%02X", p[i+1], p[i]);
   }
 
-  Serial.println();
+  stream->println();
 }
 
 //
 // Print current status to the remote
 //
-void remotePrintStatus()
+void remotePrintStatus(Stream *stream, RemoteState *state)
 {
   // Prepare information ready to be sent
   float remoteVoltage = batteryMonitor();
@@ -274,13 +633,13 @@ void remotePrintStatus()
   uint16_t tuningCapacitor = rx.getAntennaTuningCapacitor();
 
   // Remote serial
-  Serial.printf("%u,%u,%d,%d,%s,%s,%s,%s,%hu,%hu,%hu,%hu,%hu,%.2f,%hu\r\n",
+  stream->printf("%u,%u,%d,%d,%s,%s,%s,%s,%hu,%hu,%hu,%hu,%hu,%.2f,%hu\r\n",
                 VER_APP,
                 currentFrequency,
                 currentBFO,
                 ((currentMode == USB) ? getCurrentBand()->usbCal :
                  (currentMode == LSB) ? getCurrentBand()->lsbCal : 0),
-                getCurrentBand()->bandName,
+                getCurrentBand()->plan->bandName,
                 bandModeDesc[currentMode],
                 getCurrentStep()->desc,
                 getCurrentBandwidth()->desc,
@@ -290,29 +649,201 @@ void remotePrintStatus()
                 remoteSnr,
                 tuningCapacitor,
                 remoteVoltage,
-                remoteSeqnum
+                state->remoteSeqnum
                 );
 }
 
+//
+// Mark topic as changed, so that subscribed remotes get updated
+//
+void remoteEmit(uint8_t topic)
+{
+  if(topic < TOPIC_COUNT) remoteTopicGen[topic]++;
+}
+
+//
+// Print current topic contents to the remote
+//
+static void remotePublish(Stream *stream, uint8_t topic)
+{
+  switch(topic)
+  {
+    case TOPIC_FREQ:
+      stream->printf("~F,%u,%d,%s,%s\r\n",
+        currentFrequency, currentBFO,
+        getCurrentBand()->plan->bandName, bandModeDesc[currentMode]
+      );
+      break;
+
+    case TOPIC_SIGNAL:
+      stream->printf("~S,%hu,%hu\r\n", rssi, snr);
+      break;
+
+    case TOPIC_RDS:
+    {
+      // Long station names are marked with a leading 0xFF
+      const char *name = getStationName();
+      if(*name == '\xFF') name++;
+      stream->printf("~R,%04X,%s,%s\r\n", getRdsPiCode(), name, getRadioText());
+      break;
+    }
+
+    case TOPIC_BATTERY:
+      stream->printf("~B,%.2f\r\n", batteryMonitor());
+      break;
+
+    case TOPIC_SCAN:
+    {
+      uint16_t startFreq, step;
+      uint16_t count = scanGetPoints(&startFreq, &step);
+      uint8_t rssi, snr;
+
+      stream->printf("~G,%u,%u,%u", startFreq, step, count);
+      for(uint16_t j=0 ; scanGetPoint(j, &rssi, &snr) ; j++)
+        stream->printf(",%hu,%hu", rssi, snr);
+      stream->print("\r\n");
+      break;
+    }
+
+    case TOPIC_MEMORY:
+      // Full memory list, terminated with an empty event
+      remoteGetMemories(stream);
+      stream->print("~M\r\n");
+      break;
+  }
+}
+
+//
+// Subscribe to a topic ("+<topic>[<msecs>]\r") or unsubscribe from
+// it ("-<topic>\r"), '*' stands for all topics
+//
+static bool remoteSubscribe(Stream *stream, RemoteState *state, bool on)
+{
+  char topic = readSerialChar(stream);
+  const char *p = topic? strchr(remoteTopicNames, topic) : 0;
+  uint8_t mask = topic=='*'? (1 << TOPIC_COUNT) - 1 : p? 1 << (p - remoteTopicNames) : 0;
+  if(!mask)
+    return showError(stream, "No such topic");
+
+  long int rate = on? readSerialInteger(stream) : 0;
+  if(!expectNewline(stream))
+    return showError(stream, "Expected newline");
+  stream->println();
+
+  for(int j=0 ; j<TOPIC_COUNT ; j++)
+  {
+    if(!(mask & (1 << j))) continue;
+
+    if(on)
+    {
+      // Publish current state on the next tick
+      state->topicRate[j] = rate > 0xFFFF? 0xFFFF : rate;
+      state->topicSeen[j] = remoteTopicGen[j] - 1;
+      state->topicTime[j] = millis() - state->topicRate[j];
+    }
+  }
+
+  state->topicMask = on? state->topicMask | mask : state->topicMask & ~mask;
+  return(true);
+}
+
+//
+// Print frame drawing statistics:
+// ~P,<max fps>,<requests>,<frames>,<min us>,<avg us>,<max us>
+//
+static void remoteFrameStats(Stream *stream)
+{
+  const DrawStats *stats = drawGetStats();
+
+  stream->printf("~P,%u,%lu,%lu,%lu,%lu,%lu\r\n",
+    drawGetMaxFps(),
+    (unsigned long)stats->requests,
+    (unsigned long)stats->frames,
+    (unsigned long)(stats->frames? stats->timeMin : 0),
+    (unsigned long)(stats->frames? stats->timeTotal / stats->frames : 0),
+    (unsigned long)stats->timeMax
+  );
+}
+
+//
+// Print storage statistics:
+// ~N,<saves>,<writes>,<last save writes>,<last save us>,
+//   <settings writes>,<bands writes>,<memories writes>,
+//   <requests>,<coalesced>,<NVS used>,<NVS free>,
+//   <FS bytes written>,<FS used>,<FS total>
+//
+static void remoteStorageStats(Stream *stream)
+{
+  const PrefsStats *stats = prefsGetStats(true);
+
+  stream->printf("~N,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu\r\n",
+    (unsigned long)stats->saves,
+    (unsigned long)stats->writes,
+    (unsigned long)stats->lastWrites,
+    (unsigned long)stats->lastTime,
+    (unsigned long)stats->settingsWrites,
+    (unsigned long)stats->bandsWrites,
+    (unsigned long)stats->memoriesWrites,
+    (unsigned long)stats->requests,
+    (unsigned long)stats->coalesced,
+    (unsigned long)stats->nvsUsed,
+    (unsigned long)stats->nvsFree,
+    (unsigned long)stats->fsWritten,
+    (unsigned long)stats->fsUsed,
+    (unsigned long)stats->fsTotal
+  );
+}
+
+//
+// Set maximum frames per second ("p<fps>\r"), resetting statistics
+//
+static bool remoteSetMaxFps(Stream *stream)
+{
+  long int fps = readSerialInteger(stream);
+  if(!expectNewline(stream))
+    return showError(stream, "Expected newline");
+  stream->println();
+
+  if(fps < 1 || fps > 100)
+    return showError(stream, "Frame rate must be 1..100");
+
+  drawSetMaxFps(fps);
+  drawResetStats();
+  return(true);
+}
+
 //
 // Tick remote time, periodically printing status
 //
-void remoteTickTime()
+void remoteTickTime(Stream *stream, RemoteState *state)
 {
-  if(remoteLogOn && (millis() - remoteTimer >= 500))
+  if(state->remoteLogOn && (millis() - state->remoteTimer >= 500))
   {
     // Mark time and increment diagnostic sequence number
-    remoteTimer = millis();
-    remoteSeqnum++;
+    state->remoteTimer = millis();
+    state->remoteSeqnum++;
     // Show status
-    remotePrintStatus();
+    remotePrintStatus(stream, state);
+  }
+
+  // Publish changed topics, no more often than requested
+  for(int j=0 ; j<TOPIC_COUNT ; j++)
+  {
+    if((state->topicMask & (1 << j)) &&
+       (state->topicSeen[j] != remoteTopicGen[j]) &&
+       (millis() - state->topicTime[j] >= state->topicRate[j]))
+    {
+      state->topicSeen[j] = remoteTopicGen[j];
+      state->topicTime[j] = millis();
+      remotePublish(stream, j);
+    }
   }
 }
 
 //
 // Recognize and execute given remote command
 //
-int remoteDoCommand(char key)
+static int remoteDoCommand(Stream *stream, RemoteState *state, char key)
 {
   int event = 0;
 
@@ -400,30 +931,80 @@ int remoteDoCommand(char key)
       event |= REMOTE_PREFS;
       break;
     case 'C':
-      remoteLogOn = false;
-      remoteCaptureScreen();
+      state->remoteLogOn = false;
+      remoteCaptureScreen(stream);
       break;
     case 't':
-      remoteLogOn = !remoteLogOn;
-      bleToggleMonitor(); // Also toggle BLE monitor
+      state->remoteLogOn = !state->remoteLogOn;
+      break;
+    case 'D':
+      if(mirrorGetStream() == state->channel)
+        mirrorStop();
+      else if(!mirrorStart(state->channel, state->bandwidth))
+      {
+        stream->println("Error: Not enough memory for mirror");
+        remoteFailed = true;
+      }
       break;
 
     case '$':
-      remoteGetMemories();
+      remoteGetMemories(stream);
       break;
     case '#':
-      if (remoteSetMemory())
-        event |= REMOTE_PREFS;
+      if (remoteSetMemory(stream))
+      {
+        remoteEmit(TOPIC_MEMORY);
+        prefsRequestSave(SAVE_MEMORIES);
+      }
+      break;
+    case '{':
+      // Tagged commands hold a single line, the block follows it
+      // on the transport
+      remoteImportMemories(state->channel);
+      break;
+    case '}':
+      remoteExportMemories(stream);
+      break;
+
+    case 'X':
+      remoteExportSnapshot(stream);
+      break;
+    case 'x':
+      remoteImportSnapshot(stream);
+      break;
+
+    case 'Q':
+      remoteSurvey(stream, true);
+      break;
+    case 'q':
+      remoteSurvey(stream, false);
+      break;
+
+    case 'P':
+      remoteFrameStats(stream);
+      break;
+    case 'p':
+      remoteSetMaxFps(stream);
+      break;
+    case 'N':
+      remoteStorageStats(stream);
+      break;
+
+    case '+':
+      remoteSubscribe(stream, state, true);
+      break;
+    case '-':
+      remoteSubscribe(stream, state, false);
       break;
 
     case 'T':
-      Serial.println(switchThemeEditor(!switchThemeEditor()) ? "Theme editor enabled" : "Theme editor disabled");
+      stream->println(switchThemeEditor(!switchThemeEditor()) ? "Theme editor enabled" : "Theme editor disabled");
       break;
     case '!':
-      if(switchThemeEditor()) remoteSetColorTheme();
+      if(switchThemeEditor()) remoteSetColorTheme(stream);
       break;
     case '@':
-      if(switchThemeEditor()) remoteGetColorTheme();
+      if(switchThemeEditor()) remoteGetColorTheme(stream);
       break;
 
     default:
@@ -434,3 +1015,101 @@ int remoteDoCommand(char key)
   // Command recognized
   return(event | REMOTE_CHANGED);
 }
+
+//
+// Acknowledge tagged command "[id]..."
+//
+static void remoteAcknowledge(Stream *stream, const char *line, bool ok)
+{
+  char *end;
+  unsigned long id = strtoul(line + 1, &end, 10);
+
+  if((end == line + 1) || (*end != ']'))
+    stream->printf("~A,,ERR\r\n");
+  else
+    stream->printf("~A,%lu,%s\r\n", id, ok? "OK" : "ERR");
+}
+
+//
+// Execute next queued tagged command
+//
+static int remoteDoQueued(Stream *stream, RemoteState *state)
+{
+  const char *line = state->queue[state->queueHead];
+  const char *cmd  = strchr(line, ']');
+  int event = 0;
+
+  state->queueHead = (state->queueHead + 1) % REMOTE_QUEUE_SIZE;
+  state->queueCount--;
+
+  remoteFailed = false;
+
+  // Queued commands are not echoed, only acknowledged
+  if(cmd && cmd[1])
+  {
+    RemoteLineStream input(stream, cmd + 1);
+    remoteEcho = false;
+    event = remoteDoCommand(&input, state, input.read());
+    remoteEcho = true;
+  }
+
+  remoteAcknowledge(stream, line, (event & REMOTE_CHANGED) && !remoteFailed);
+  return(event);
+}
+
+//
+// Receive and execute remote input. Commands prefixed with "[id]"
+// and terminated with a newline are queued and acknowledged with
+// "~A,<id>,OK" or "~A,<id>,ERR" once executed, so that they can be
+// pipelined. Other commands are executed immediately.
+//
+int remoteDoInput(Stream *stream, RemoteState *state)
+{
+  state->channel = stream;
+
+  // Receive tagged commands. Once the queue is full, leave input
+  // with the transport, so that the remote has to wait.
+  while((state->queueCount < REMOTE_QUEUE_SIZE) && (state->lineLength || (stream->peek() == '[')))
+  {
+    int ch = stream->read();
+    if(ch < 0) break;
+
+    if((ch != '\r') && (ch != '\n'))
+    {
+      if(state->lineLength < REMOTE_LINE_SIZE - 1)
+        state->line[state->lineLength++] = ch;
+      else
+        state->lineOverflow = true;
+      continue;
+    }
+
+    state->line[state->lineLength] = '\0';
+
+    if(state->lineOverflow)
+    {
+      stream->printf("\r\nError: %s\r\n", "Command too long");
+      remoteAcknowledge(stream, state->line, false);
+    }
+    else
+    {
+      int tail = (state->queueHead + state->queueCount++) % REMOTE_QUEUE_SIZE;
+      strcpy(state->queue[tail], state->line);
+    }
+
+    state->lineLength   = 0;
+    state->lineOverflow = false;
+  }
+
+  // Execute one queued command at a time, in order of arrival
+  if(state->queueCount) return(remoteDoQueued(stream, state));
+
+  // Execute untagged command
+  if(!state->lineLength && stream->available())
+  {
+    char key = stream->read();
+    if(state->echo) stream->write(key);
+    return(remoteDoCommand(stream, state, key));
+  }
+
+  return(0);
+}
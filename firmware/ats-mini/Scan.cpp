@@ -8,7 +8,7 @@
 #define TUNE_DELAY_AM_SSB  80
 
 #define SCAN_POLL_TIME    10 // Tuning status polling interval (msecs)
-#define SCAN_POINTS      200 // Number of frequencies to scan
+#define SCAN_TUNE_TIME   500 // Maximum time to wait for tuning (msecs)
 
 #define SCAN_OFF    0   // Scanner off, no data
 #define SCAN_RUN    1   // Scanner running
@@ -26,46 +26,50 @@ static uint8_t  scanStatus = SCAN_OFF;
 static uint16_t scanStartFreq;
 static uint16_t scanStep;
 static uint16_t scanCount;
-static uint8_t  scanMinRSSI;
-static uint8_t  scanMaxRSSI;
-static uint8_t  scanMinSNR;
-static uint8_t  scanMaxSNR;
 
-static inline uint8_t min(uint8_t a, uint8_t b) { return(a<b? a:b); }
-static inline uint8_t max(uint8_t a, uint8_t b) { return(a>b? a:b); }
+static uint16_t measureFreq; // Frequency to restore after measurements
+static uint16_t scanUpdates; // Incremented whenever scan data changes
 
-float scanGetRSSI(uint16_t freq)
+//
+// Get number of scanned points, their starting frequency and step
+//
+uint16_t scanGetPoints(uint16_t *startFreq, uint16_t *step)
 {
-  // Input frequency must be in range of existing data
-  if((scanStatus!=SCAN_DONE) || (freq<scanStartFreq) || (freq>=scanStartFreq+scanStep*scanCount))
-    return(0.0);
+  if(scanStatus!=SCAN_DONE) return(0);
 
-  uint8_t result = scanData[(freq - scanStartFreq) / scanStep].rssi;
-  return((result - scanMinRSSI) / (float)(scanMaxRSSI - scanMinRSSI + 1));
+  *startFreq = scanStartFreq;
+  *step      = scanStep;
+  return(scanCount);
 }
 
-float scanGetSNR(uint16_t freq)
+//
+// Get scan data update counter, changes whenever scan data changes
+//
+uint16_t scanGetUpdates()
 {
-  // Input frequency must be in range of existing data
-  if((scanStatus!=SCAN_DONE) || (freq<scanStartFreq) || (freq>=scanStartFreq+scanStep*scanCount))
-    return(0.0);
+  return(scanUpdates);
+}
 
-  uint8_t result = scanData[(freq - scanStartFreq) / scanStep].snr;
-  return((result - scanMinSNR) / (float)(scanMaxSNR - scanMinSNR + 1));
+//
+// Get raw RSSI/SNR values of a scanned point
+//
+bool scanGetPoint(uint16_t idx, uint8_t *rssi, uint8_t *snr)
+{
+  if((scanStatus!=SCAN_DONE) || (idx>=scanCount)) return(false);
+
+  *rssi = scanData[idx].rssi;
+  *snr  = scanData[idx].snr;
+  return(true);
 }
 
 static void scanInit(uint16_t centerFreq, uint16_t step)
 {
   scanStep    = step;
   scanCount   = 0;
-  scanMinRSSI = 255;
-  scanMaxRSSI = 0;
-  scanMinSNR  = 255;
-  scanMaxSNR  = 0;
   scanStatus  = SCAN_RUN;
   scanTime    = millis();
 
-  const Band *band = getCurrentBand();
+  const BandPlan *band = getCurrentBand()->plan;
   int freq = scanStep * (centerFreq / scanStep - SCAN_POINTS / 2);
 
   // Adjust to band boundaries
@@ -77,6 +81,7 @@ static void scanInit(uint16_t centerFreq, uint16_t step)
 
   // Clear scan data
   memset(scanData, 0, sizeof(scanData));
+  scanUpdates++;
 }
 
 static bool scanTickTime()
@@ -110,18 +115,13 @@ static bool scanTickTime()
   rx.getCurrentReceivedSignalQuality();
   scanData[scanCount].rssi = rx.getCurrentRSSI();
   scanData[scanCount].snr  = rx.getCurrentSNR();
-
-  // Measure range of values
-  scanMinRSSI = min(scanData[scanCount].rssi, scanMinRSSI);
-  scanMaxRSSI = max(scanData[scanCount].rssi, scanMaxRSSI);
-  scanMinSNR  = min(scanData[scanCount].snr, scanMinSNR);
-  scanMaxSNR  = max(scanData[scanCount].snr, scanMaxSNR);
+  scanUpdates++;
 
   // Next frequency to scan
   freq += scanStep;
 
   // Set next frequency to scan or expire scan
-  if((++scanCount >= SCAN_POINTS) || !isFreqInBand(getCurrentBand(), freq) || checkStopSeeking())
+  if((++scanCount >= SCAN_POINTS) || !isFreqInBand(getCurrentBand()->plan, freq) || checkStopSeeking())
     scanStatus = SCAN_DONE;
   else
     rx.setFrequency(freq); // Implies tuning delay
@@ -134,9 +134,9 @@ static bool scanTickTime()
 }
 
 //
-// Run entire scan once
+// Prepare for tuning and measuring frequencies directly
 //
-void scanRun(uint16_t centerFreq, uint16_t step)
+void scanMeasureStart()
 {
   // Set tuning delay
   rx.setMaxDelaySetFrequency(currentMode == FM ? TUNE_DELAY_FM : TUNE_DELAY_AM_SSB);
@@ -145,13 +145,60 @@ void scanRun(uint16_t centerFreq, uint16_t step)
   // Flag is set by rotary encoder and cleared on seek/scan entry
   seekStop = false;
   // Save current frequency
-  uint16_t curFreq = rx.getFrequency();
-  // Scan the whole range
-  for(scanInit(centerFreq, step) ; scanTickTime(););
+  measureFreq = rx.getFrequency();
+}
+
+//
+// Tune to given frequency, bypassing the UI, and measure RSSI/SNR
+// <dwell> msecs after tuning completes. Returns FALSE if the user
+// has interrupted measurements.
+//
+bool scanMeasure(uint16_t freq, uint16_t dwell, uint8_t *rssi, uint8_t *snr)
+{
+  rx.setFrequency(freq); // Implies tuning delay
+
+  // Poll for the tuning status
+  for(uint32_t time = millis() ; millis() - time < SCAN_TUNE_TIME ; delay(SCAN_POLL_TIME))
+  {
+    rx.getStatus(0, 0);
+    if(rx.getTuneCompleteTriggered()) break;
+  }
+
+  // Let the signal settle
+  for(uint32_t time = millis() ; millis() - time < dwell ; delay(SCAN_POLL_TIME))
+    if(checkStopSeeking()) return(false);
+
+  if(checkStopSeeking()) return(false);
+
+  // Measure RSSI/SNR values
+  rx.getCurrentReceivedSignalQuality();
+  *rssi = rx.getCurrentRSSI();
+  *snr  = rx.getCurrentSNR();
+  return(true);
+}
+
+//
+// Done tuning and measuring frequencies directly
+//
+void scanMeasureStop()
+{
   // Restore current frequency
-  rx.setFrequency(curFreq);
+  rx.setFrequency(measureFreq);
   // Unmute the audio
   muteOn(MUTE_TEMP, false);
   // Restore tuning delay
   rx.setMaxDelaySetFrequency(TUNE_DELAY_DEFAULT);
 }
+
+//
+// Run entire scan once
+//
+void scanRun(uint16_t centerFreq, uint16_t step)
+{
+  scanMeasureStart();
+  // Scan the whole range
+  for(scanInit(centerFreq, step) ; scanTickTime(););
+  scanMeasureStop();
+  // Let remotes know about new scan results
+  remoteEmit(TOPIC_SCAN);
+}
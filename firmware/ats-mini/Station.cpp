@@ -99,6 +99,7 @@ void clearStationInfo()
   bufRadioText[0]   = '\0'; // Multiline!
   bufRadioText[1]   = '\0';
   piCode = 0x0000;
+  remoteEmit(TOPIC_RDS);
 }
 
 static bool showStationName(const char *stationName, bool isLong = false)
@@ -114,6 +115,7 @@ static bool showStationName(const char *stationName, bool isLong = false)
     }
     else
       strcpy(bufStationName, stationName);
+    remoteEmit(TOPIC_RDS);
     return(true);
   }
 
@@ -239,6 +241,9 @@ bool checkRds()
     needRedraw |= (mode & RDS_PT) && showRdsProgramType(rx.getRdsProgramTypeX(), !!(mode & RDS_RBDS));
   }
 
+  // Let remotes know about changes
+  if(needRedraw) remoteEmit(TOPIC_RDS);
+
   // Return TRUE if any RDS information changes
   return(needRedraw);
 }
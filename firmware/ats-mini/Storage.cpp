@@ -2,23 +2,289 @@
 #include "Storage.h"
 #include "Themes.h"
 #include "Menu.h"
+#include "Utils.h"
 #include <LittleFS.h>
 #include "nvs_flash.h"
+#include "nvs.h"
+#include "esp_rom_crc.h"
 
 // Time of inactivity to start writing preferences
 #define STORE_TIME    10000
 
+// Time tuning has to settle before it is journaled
+#define JOURNAL_TIME  500
+
+// Tuning journal file and its size limit, in entries
+#define JOURNAL_FILE  "/tune.log"
+#define JOURNAL_TEMP  "/tune.tmp"
+#define JOURNAL_MAX   128
+#define JOURNAL_MAGIC 0xA6
+
+// Storage task stack size and priority, below loop()
+#define STORE_STACK   4096
+#define STORE_PRIO    1
+
+// NVS and LittleFS usage refresh interval, checking it walks both (ms)
+#define USAGE_TIME    5000
+
 // Preferences saved here
 Preferences prefs;
 
 static uint32_t itIsTimeToSave = 0;       // Preferences to save, or 0 for none
-static bool savingPrefsFlag    = false;   // TRUE: Saving preferences
+static volatile bool savingPrefsFlag = false; // TRUE: Saving preferences
 static uint32_t storeTime      = millis();
+static PrefsStats prefsStats;             // Storage statistics
+static uint32_t usageTime      = 0;       // Time NVS and LittleFS usage was checked
+static bool usageValid         = false;   // TRUE: NVS and LittleFS usage checked
+
+struct SavedBand
+{
+  uint8_t bandMode;       // Band mode (FM, AM, LSB, or USB)
+  uint16_t currentFreq;   // Current frequency
+  int8_t currentStepIdx;  // Current frequency step
+  int8_t bandwidthIdx;    // Index of the table bandwidthFM, bandwidthAM or bandwidthSSB;
+  int16_t usbCal;         // USB calibration value
+  int16_t lsbCal;         // LSB calibration value
+  int16_t currentBFO;     // Current BFO offset (Hz), missing in old records
+};
+
+// Size of band records saved before currentBFO
+#define SAVED_BAND_OLD offsetof(SavedBand, currentBFO)
+
+// Band records are shared with older firmware, their layout is fixed
+static_assert(sizeof(SavedBand)==12, "SavedBand size changed");
+static_assert(offsetof(SavedBand, currentFreq)==2, "SavedBand layout changed");
+static_assert(SAVED_BAND_OLD==10, "SavedBand layout changed");
+
+//
+// Settings record, stored as a single blob in two alternating slots.
+// The valid slot with the newer sequence number is current, so a save
+// interrupted by power loss leaves the previous slot in place.
+//
+struct __attribute__((packed)) SavedSettings
+{
+  uint32_t seq;           // Sequence number
+  uint32_t crc;           // CRC32 of the fields below
+  uint8_t version;        // Settings version
+  uint16_t app;           // Application version
+  uint8_t volume, band, wifiMode;
+  uint16_t brightness, sleep;
+  uint8_t fmAgc, amAgc, ssbAgc, amAvc, ssbAvc, amSoftMute, ssbSoftMute;
+  uint8_t theme, rdsMode, sleepMode, zoomMenu, utcOffset, squelch;
+  uint8_t fmRegion, uiLayout, bleMode;
+  bool scrollDir;
+};
+
+#define SETTINGS_DATA offsetof(SavedSettings, version)
+
+//
+// Tuning journal entry. Entries are appended to a LittleFS file as
+// tuning changes, so the last tuning survives power loss long before
+// the band record is rewritten. The last valid entry wins at boot.
+// Entries name their band by its NVS key, since band indices move
+// when the band plan changes.
+//
+struct __attribute__((packed)) JournalEntry
+{
+  uint8_t magic;          // JOURNAL_MAGIC
+  char band[16];          // Band key, see prefsBandKey()
+  uint8_t mode;           // Band mode
+  uint16_t freq;          // Tuned frequency, without BFO
+  int16_t bfo;            // BFO offset (Hz)
+  uint8_t check;          // Sum of the bytes above
+};
+
+static const char *settingsSlots[2] = { "SettingsA", "SettingsB" };
+
+//
+// Shadow copies of the values in NVS, as last written or read. Saves
+// only write entries that differ from their shadow copies.
+//
+static SavedSettings savedSettings;
+static bool savedSettingsValid = false;
+static uint8_t savedSettingsSlot = 1;     // Slot written last
+
+static SavedBand *savedBands = 0;
+static bool *savedBandsValid = 0;
+static bool savedBandsVersion = false;
+static bool savedBandsByName  = false;   // TRUE: NVS has the "ByName" marker
+
+static Memory savedMemories[MEMORY_COUNT];
+static bool savedMemoriesValid[MEMORY_COUNT];
+static bool savedMemoriesVersion = false;
+static bool savedMemoriesLegacy  = false; // TRUE: Read from individual entries
+
+//
+// Copy of everything that can be saved, taken by loop() and written
+// by the storage task, so that flash writes do not stall loop(). A
+// snapshot taken while the previous one is still pending replaces it,
+// adding its items.
+//
+struct PrefsSnapshot
+{
+  uint32_t items;                 // SAVE_* items to write, 0 for none
+  uint8_t bandIdx;                // Band saved by SAVE_CUR_BAND
+  SavedSettings settings;         // Settings record
+  JournalEntry tune;              // Tuning, for SAVE_TUNE
+  SavedBand *bands;               // All bands
+  bool *loaded;                   // Bands in use, others are unchanged
+  Memory memories[MEMORY_COUNT];  // All memories
+};
+
+static Preferences prefsWriter;           // Used by the writer only
+static PrefsSnapshot prefsSnapshots[2];  // Swapped between the two below
+static PrefsSnapshot *prefsPending = &prefsSnapshots[0]; // Next snapshot, guarded by prefsLock
+static PrefsSnapshot *prefsWriting = &prefsSnapshots[1]; // Snapshot being written
+static SemaphoreHandle_t prefsLock = 0;
+static TaskHandle_t prefsTask = 0;
+static volatile uint32_t prefsQueued  = 0; // Snapshots taken
+static volatile uint32_t prefsWritten = 0; // Snapshots written
+
+static JournalEntry journalTune;          // Last seen tuning
+static uint32_t journalTime = 0;          // Time tuning last changed
+static bool journalDirty    = false;      // TRUE: Tuning not journaled yet
+
+//
+// Allocate band shadow copies, returns FALSE if out of memory
+//
+static bool prefsShadowBands()
+{
+  if(!savedBands)
+  {
+    savedBands = (SavedBand *)calloc(getTotalBands(), sizeof(SavedBand));
+    savedBandsValid = (bool *)calloc(getTotalBands(), sizeof(bool));
+  }
+
+  return(savedBands && savedBandsValid);
+}
+
+//
+// Forget all shadow copies, the next save writes everything
+//
+static void prefsShadowReset()
+{
+  savedSettingsValid   = false;
+  savedBandsVersion    = false;
+  savedBandsByName     = false;
+  savedMemoriesVersion = false;
+  savedMemoriesLegacy  = false;
+  memset(savedMemoriesValid, 0, sizeof(savedMemoriesValid));
+  if(savedBandsValid) memset(savedBandsValid, 0, getTotalBands() * sizeof(bool));
+}
+
+//
+// Get journal entry check byte
+//
+static void prefsBandKey(uint8_t idx, char *key);
+
+static uint8_t prefsJournalCheck(const JournalEntry *e)
+{
+  uint8_t check = 0;
+
+  for(size_t j=0 ; j<offsetof(JournalEntry, check) ; j++)
+    check += ((const uint8_t *)e)[j];
+
+  return(check);
+}
+
+//
+// Compose journal entry from the current tuning
+//
+static void prefsJournalEntry(JournalEntry *e)
+{
+  memset(e, 0, sizeof(*e));
+  e->magic = JOURNAL_MAGIC;
+  prefsBandKey(bandIdx, e->band);
+  e->mode  = currentMode;
+  e->freq  = currentFrequency;
+  e->bfo   = currentBFO;
+  e->check = prefsJournalCheck(e);
+}
+
+//
+// Append journal entry, compacting the journal when it gets too long
+//
+static void prefsJournalAppend(const JournalEntry *e)
+{
+  File file = LittleFS.open(JOURNAL_FILE, "a");
+  if(!file) return;
+
+  diskCountWrite(file.write((const uint8_t *)e, sizeof(*e)));
+  size_t size = file.size();
+  file.close();
+
+  // Only the last entry matters, replace the journal with it
+  if(size >= JOURNAL_MAX * sizeof(*e))
+  {
+    file = LittleFS.open(JOURNAL_TEMP, "w");
+    if(!file) return;
+    size_t written = file.write((const uint8_t *)e, sizeof(*e));
+    file.close();
+    diskCountWrite(written);
+    if(written==sizeof(*e)) LittleFS.rename(JOURNAL_TEMP, JOURNAL_FILE);
+  }
+}
+
+//
+// Apply the last journaled tuning to bands, returns FALSE if there
+// is none. Call after loading bands and mounting the file system.
+//
+bool prefsLoadJournal()
+{
+  JournalEntry e, last;
+  bool found = false;
+
+  File file = LittleFS.open(JOURNAL_FILE, "r");
+  if(!file) return(false);
+
+  while(file.read((uint8_t *)&e, sizeof(e))==sizeof(e))
+  {
+    if(e.magic==JOURNAL_MAGIC && e.check==prefsJournalCheck(&e))
+    {
+      last  = e;
+      found = true;
+    }
+  }
+
+  file.close();
+
+  if(!found) return(false);
+
+  // Find the band by its key, it may have moved or gone away
+  char key[sizeof(last.band)];
+  int idx;
+  last.band[sizeof(last.band)-1] = '\0';
+  for(idx=0 ; idx<getTotalBands() ; idx++)
+  {
+    prefsBandKey(idx, key);
+    if(!strcmp(key, last.band)) break;
+  }
+
+  // Entry has to fit the band
+  if(idx>=getTotalBands()) return(false);
+  Band *band = getBand(idx);
+  if(((last.mode==FM) != (band->bandMode==FM)) || (last.mode>AM)) return(false);
+  if(last.freq<band->plan->minimumFreq || last.freq>band->plan->maximumFreq) return(false);
+  if(last.bfo>MAX_BFO || last.bfo<-MAX_BFO) return(false);
+
+  bandIdx           = idx;
+  band->bandMode    = last.mode;
+  band->currentFreq = last.freq;
+  band->currentBFO  = last.bfo;
+
+  // This tuning is journaled already
+  journalTune = last;
+  return(true);
+}
 
 // To store any change to preferences, we need at least STORE_TIME
 // milliseconds of inactivity.
 void prefsRequestSave(uint32_t what, bool now)
 {
+  // Requests made while a save is pending end up in the same save
+  prefsStats.requests++;
+  prefsStats.coalesced += !!itIsTimeToSave;
+
   // Underflow is ok here, see prefsTickTime()
   storeTime = millis() - (now? STORE_TIME : 0);
   itIsTimeToSave |= what;
@@ -26,10 +292,26 @@ void prefsRequestSave(uint32_t what, bool now)
 
 void prefsTickTime()
 {
+  JournalEntry tune;
+
+  // Journal tuning changes once tuning settles
+  prefsJournalEntry(&tune);
+  if(memcmp(&tune, &journalTune, sizeof(tune)))
+  {
+    journalTune  = tune;
+    journalTime  = millis();
+    journalDirty = true;
+  }
+  else if(journalDirty && ((millis() - journalTime) >= JOURNAL_TIME))
+  {
+    prefsQueue(SAVE_TUNE);
+    journalDirty = false;
+  }
+
   // Save configuration if requested
   if(itIsTimeToSave && ((millis() - storeTime) >= STORE_TIME))
   {
-    prefsSave(itIsTimeToSave);
+    prefsQueue(itIsTimeToSave);
     storeTime = millis();
     itIsTimeToSave = 0;
   }
@@ -49,6 +331,10 @@ void prefsInvalidate()
   static const char *sections[] =
   { "settings", "memories", "bands", "network", 0 };
 
+  // Pending writes would bring preferences back
+  itIsTimeToSave = 0;
+  prefsFlush();
+
   // Clear all applicable sections
   for(int j = 0 ; sections[j] ; ++j)
   {
@@ -56,179 +342,643 @@ void prefsInvalidate()
     prefs.clear();
     prefs.end();
   }
+
+  // Nothing is saved now
+  prefsShadowReset();
 }
 
-struct SavedBand
+//
+// Compose saved band value, padding included
+//
+static void prefsBandValue(uint8_t idx, SavedBand *value)
 {
-  uint8_t bandMode;       // Band mode (FM, AM, LSB, or USB)
-  uint16_t currentFreq;   // Current frequency
-  int8_t currentStepIdx;  // Current frequency step
-  int8_t bandwidthIdx;    // Index of the table bandwidthFM, bandwidthAM or bandwidthSSB;
-  int16_t usbCal;         // USB calibration value
-  int16_t lsbCal;         // LSB calibration value
-};
+  const Band *band = getBand(idx);
 
-void prefsSaveBand(uint8_t idx, bool openPrefs)
+  memset(value, 0, sizeof(*value));
+  value->currentFreq    = band->currentFreq;     // Frequency
+  value->bandMode       = band->bandMode;        // Modulation
+  value->currentStepIdx = band->currentStepIdx;  // Step
+  value->bandwidthIdx   = band->bandwidthIdx;    // Bandwidth
+  value->usbCal         = band->usbCal;          // USB Calibration
+  value->lsbCal         = band->lsbCal;          // LSB Calibration
+  value->currentBFO     = band->currentBFO;      // BFO
+}
+
+//
+// Apply saved band value to the band
+//
+static void prefsBandApply(uint8_t idx, const SavedBand *value)
 {
-  SavedBand value;
-  char name[32];
+  Band *band = getBand(idx);
 
-  // Will be saving to bands
-  if(openPrefs) prefs.begin("bands", false, STORAGE_PARTITION);
+  band->currentFreq    = value->currentFreq;    // Frequency
+  band->bandMode       = value->bandMode;       // Modulation
+  band->currentStepIdx = value->currentStepIdx; // Step
+  band->bandwidthIdx   = value->bandwidthIdx;   // Bandwidth
+  band->usbCal         = value->usbCal;         // USB Calibration
+  band->lsbCal         = value->lsbCal;         // LSB Calibration
+  band->currentBFO     = value->currentBFO;     // BFO
+}
 
-  // Compose preference name and value
-  sprintf(name, "Band-%d", idx);
-  value.currentFreq    = bands[idx].currentFreq;     // Frequency
-  value.bandMode       = bands[idx].bandMode;        // Modulation
-  value.currentStepIdx = bands[idx].currentStepIdx;  // Step
-  value.bandwidthIdx   = bands[idx].bandwidthIdx;    // Bandwidth
-  value.usbCal         = bands[idx].usbCal;          // USB Calibration
-  value.lsbCal         = bands[idx].lsbCal;          // LSB Calibration
+//
+// Compose band NVS key from the band name and lower limit, so that
+// records stay with their bands when the band plan changes
+//
+static void prefsBandKey(uint8_t idx, char *key)
+{
+  const BandPlan *plan = getBandPlan(idx);
+  sprintf(key, "%.9s-%u", plan->bandName, (unsigned)plan->minimumFreq);
+}
 
-  // Write a preference
-  prefs.putBytes(name, &value, sizeof(value));
+//
+// Check that band record fits the band, which may have changed
+//
+static bool prefsBandFits(uint8_t idx, const SavedBand *record)
+{
+  const BandPlan *plan = getBandPlan(idx);
 
-  // Done with band preferences
-  if(openPrefs) prefs.end();
+  if(record->currentFreq<plan->minimumFreq || record->currentFreq>plan->maximumFreq) return(false);
+  if((record->bandMode==FM) != (plan->bandMode==FM) || record->bandMode>AM) return(false);
+  return(true);
 }
 
-bool prefsLoadBand(uint8_t idx, bool openPrefs)
+//
+// Read band record, returns its size or 0 if there is no record
+// fitting the band, in which case the value has band plan defaults
+//
+static size_t prefsReadBand(Preferences *reader, uint8_t idx, SavedBand *value)
 {
+  const BandPlan *plan = getBandPlan(idx);
+  SavedBand record;
+  char key[16];
+
+  memset(value, 0, sizeof(*value));
+  value->currentFreq    = plan->currentFreq;
+  value->bandMode       = plan->bandMode;
+  value->currentStepIdx = plan->currentStepIdx;
+  value->bandwidthIdx   = plan->bandwidthIdx;
+
+  prefsBandKey(idx, key);
+  memset(&record, 0, sizeof(record));
+  size_t size = reader->isKey(key)? reader->getBytes(key, &record, sizeof(record)) : 0;
+
+  if(size<SAVED_BAND_OLD || !prefsBandFits(idx, &record)) return(0);
+
+  *value = record;
+  return(size);
+}
+
+//
+// Load band from NVS, or band plan defaults if it has not been saved.
+// Called by getBand() when the band is first used.
+//
+void prefsLoadBand(uint8_t idx)
+{
+  Preferences reader;
   SavedBand value;
-  char name[32];
 
-  // Will be loading from bands
-  if(openPrefs) prefs.begin("bands", true, STORAGE_PARTITION);
+  // Bands load whenever used, possibly with prefs open
+  reader.begin("bands", true, STORAGE_PARTITION);
+  size_t size = prefsReadBand(&reader, idx, &value);
+  reader.end();
+
+  prefsBandApply(idx, &value);
+
+  // Band in NVS is known now
+  if(prefsShadowBands())
+  {
+    savedBands[idx] = value;
+    savedBandsValid[idx] = size==sizeof(value);
+  }
+}
+
+//
+// Write loaded bands that have changed to the open "bands" section
+//
+static void prefsSaveBands(const SavedBand *list, const bool *loaded)
+{
+  bool shadow = prefsShadowBands();
+  char key[16];
+
+  for(int i=0 ; i<getTotalBands() ; i++)
+  {
+    // Bands that have not been used have not changed
+    if(!loaded[i]) continue;
+
+    // Skip unchanged bands
+    if(shadow && savedBandsValid[i] && !memcmp(&savedBands[i], &list[i], sizeof(list[i])))
+      continue;
+
+    prefsBandKey(i, key);
+    prefsWriter.putBytes(key, &list[i], sizeof(list[i]));
+    prefsStats.lastWrites++;
+
+    // Band is saved now
+    if(shadow)
+    {
+      savedBands[i] = list[i];
+      savedBandsValid[i] = true;
+    }
+  }
+
+  // Mark bands as saved by name, so that entries left in place for
+  // older firmware are not migrated again
+  if(!savedBandsByName)
+  {
+    prefsWriter.putUChar("ByName", 1);
+    prefsStats.lastWrites++;
+    savedBandsByName = true;
+  }
+}
+
+//
+// Read band from an individual entry, as written by older firmware
+//
+static bool prefsLoadLegacyBand(uint8_t idx, SavedBand *value)
+{
+  char name[32];
 
   // Compose preference name
   sprintf(name, "Band-%d", idx);
 
-  // Read preference
-  bool result = !!prefs.getBytes(name, &value, sizeof(value));
-  if(result)
+  // Read preference, older records have no BFO
+  prefsBandValue(idx, value);
+  return(prefs.getBytes(name, value, sizeof(*value))>=SAVED_BAND_OLD);
+}
+
+//
+// Migrate bands saved by older firmware from the open "bands" section,
+// either as a blob or as individual entries. These are indexed by band
+// position, so all bands are loaded and saved by name on the next save.
+// Otherwise, bands are loaded when first used. Older entries are left
+// in place, so that older firmware can still read them.
+//
+static void prefsLoadBands()
+{
+  int total = getTotalBands();
+  size_t size = prefs.getBytesLength("Bands");
+  int count = size % sizeof(SavedBand)? 0 : size / sizeof(SavedBand);
+  SavedBand *list = count? (SavedBand *)malloc(size) : 0;
+  bool blob = list && prefs.getBytes("Bands", list, size)==size;
+
+  // Allocate shadow copies before the storage task uses them
+  prefsShadowBands();
+
+  // Bands already saved by name
+  savedBandsByName = prefs.isKey("ByName");
+
+  if(!savedBandsByName && (blob || prefs.isKey("Band-0")))
   {
-    bands[idx].currentFreq    = value.currentFreq;    // Frequency
-    bands[idx].bandMode       = value.bandMode;       // Modulation
-    bands[idx].currentStepIdx = value.currentStepIdx; // Step
-    bands[idx].bandwidthIdx   = value.bandwidthIdx;   // Bandwidth
-    bands[idx].usbCal         = value.usbCal;         // USB Calibration
-    bands[idx].lsbCal         = value.lsbCal;         // LSB Calibration
+    for(int i=0 ; i<total ; i++)
+    {
+      SavedBand value;
+      if(blob? i<count : prefsLoadLegacyBand(i, &value))
+        prefsBandApply(i, blob? &list[i] : &value);
+
+      // Band has to be written by name
+      if(prefsShadowBands()) savedBandsValid[i] = false;
+    }
+
   }
 
-  // Done with band preferences
-  if(openPrefs) prefs.end();
+  free(list);
+}
+
+//
+// Write all memories to the open "memories" section as a single
+// blob, if any of them has changed
+//
+static void prefsSaveMemories(const Memory *list)
+{
+  int total = getTotalMemories();
+  bool changed = savedMemoriesLegacy;
 
-  // Done
-  return(result);
+  // Skip unchanged memories
+  for(int i=0 ; !changed && i<total ; i++)
+    changed = !savedMemoriesValid[i] || memcmp(&savedMemories[i], &list[i], sizeof(list[i]));
+  if(!changed) return;
+
+  prefsWriter.putBytes("Memories", list, total * sizeof(Memory));
+  prefsStats.lastWrites++;
+
+  // Memories are saved now. Individual entries written by older
+  // firmware are left in place, so that it can still read them.
+  savedMemoriesLegacy = false;
+  memcpy(savedMemories, list, total * sizeof(Memory));
+  memset(savedMemoriesValid, 1, sizeof(savedMemoriesValid));
 }
 
-void prefsSaveMemory(uint8_t idx, bool openPrefs)
+//
+// Read all memories from the open "memories" section, falling back
+// to individual entries
+//
+static void prefsLoadMemories()
 {
-  char name[32];
+  int total = getTotalMemories();
+  size_t size = prefs.getBytesLength("Memories");
+  int count = size % sizeof(Memory)? 0 : size / sizeof(Memory);
+  count = count > total? total : count;
 
-  // Will be saving to memories
-  if(openPrefs) prefs.begin("memories", false, STORAGE_PARTITION);
+  if(!count || prefs.getBytes("Memories", memories, count * sizeof(Memory))!=count * sizeof(Memory))
+  {
+    char name[32];
 
-  // Compose preference name
-  sprintf(name, "Memory-%d", idx);
+    // Migrate individual entries, the next save writes a blob
+    for(int i=0 ; i<total ; i++)
+    {
+      sprintf(name, "Memory-%d", i);
+      prefs.getBytes(name, &memories[i], sizeof(memories[i]));
+    }
 
-  // Write a preference
-  prefs.putBytes(name, &memories[idx], sizeof(memories[idx]));
+    count = 0;
+    savedMemoriesLegacy = true;
+  }
 
-  // Done with memory preferences
-  if(openPrefs) prefs.end();
+  // Memories in NVS are known now
+  memcpy(savedMemories, memories, sizeof(savedMemories));
+  for(int i=0 ; i<total ; i++) savedMemoriesValid[i] = i<count;
 }
 
-bool prefsLoadMemory(uint8_t idx, bool openPrefs)
+//
+// Get CRC of the settings record fields
+//
+static uint32_t prefsSettingsCrc(const SavedSettings *s)
 {
-  char name[32];
+  return(esp_rom_crc32_le(0, (const uint8_t *)s + SETTINGS_DATA, sizeof(*s) - SETTINGS_DATA));
+}
 
-  // Will be loading from memories
-  if(openPrefs) prefs.begin("memories", true, STORAGE_PARTITION);
+//
+// Compose settings record from the current settings
+//
+static void prefsSettingsRecord(SavedSettings *s)
+{
+  memset(s, 0, sizeof(*s));
+  s->version     = VER_SETTINGS;      // Settings version
+  s->app         = VER_APP;           // Application version
+  s->volume      = volume;            // Current volume
+  s->band        = bandIdx;           // Current band
+  s->wifiMode    = wifiModeIdx;       // WiFi connection mode
+  s->brightness  = currentBrt;        // Brightness
+  s->fmAgc       = FmAgcIdx;          // FM AGC/ATTN
+  s->amAgc       = AmAgcIdx;          // AM AGC/ATTN
+  s->ssbAgc      = SsbAgcIdx;         // SSB AGC/ATTN
+  s->amAvc       = AmAvcIdx;          // AM AVC
+  s->ssbAvc      = SsbAvcIdx;         // SSB AVC
+  s->amSoftMute  = AmSoftMuteIdx;     // AM soft mute
+  s->ssbSoftMute = SsbSoftMuteIdx;    // SSB soft mute
+  s->sleep       = currentSleep;      // Sleep delay
+  s->theme       = themeIdx;          // Color theme
+  s->rdsMode     = rdsModeIdx;        // RDS mode
+  s->sleepMode   = sleepModeIdx;      // Sleep mode
+  s->zoomMenu    = zoomMenu;          // TRUE: Zoom menu
+  s->scrollDir   = scrollDirection<0; // TRUE: Reverse scroll
+  s->utcOffset   = utcOffsetIdx;      // UTC Offset
+  s->squelch     = currentSquelch;    // Squelch
+  s->fmRegion    = FmRegionIdx;       // FM region
+  s->uiLayout    = uiLayoutIdx;       // UI Layout
+  s->bleMode     = bleModeIdx;        // Bluetooth mode
+}
 
-  // Compose preference name
-  sprintf(name, "Memory-%d", idx);
+//
+// Replace settings that are out of range with the current ones, so
+// that imported settings never index past their tables
+//
+static void prefsSettingsCheck(SavedSettings *s)
+{
+  SavedSettings cur;
+  prefsSettingsRecord(&cur);
 
-  // Write a preference
-  bool result = !!prefs.getBytes(name, &memories[idx], sizeof(memories[idx]));
+  if(s->volume>63)                                    s->volume      = cur.volume;
+  if(s->band>=getTotalBands())                        s->band        = cur.band;
+  if(s->wifiMode>=getTotalWiFiModes())                s->wifiMode    = cur.wifiMode;
+  if(s->brightness<10 || s->brightness>255)           s->brightness  = cur.brightness;
+  if(s->fmAgc>27)                                     s->fmAgc       = cur.fmAgc;
+  if(s->amAgc>37)                                     s->amAgc       = cur.amAgc;
+  if(s->ssbAgc>1)                                     s->ssbAgc      = cur.ssbAgc;
+  if(s->amAvc<12 || s->amAvc>90 || (s->amAvc & 1))    s->amAvc       = cur.amAvc;
+  if(s->ssbAvc<12 || s->ssbAvc>90 || (s->ssbAvc & 1)) s->ssbAvc      = cur.ssbAvc;
+  if(s->amSoftMute>32)                                s->amSoftMute  = cur.amSoftMute;
+  if(s->ssbSoftMute>32)                               s->ssbSoftMute = cur.ssbSoftMute;
+  if(s->sleep>255)                                    s->sleep       = cur.sleep;
+  if(s->theme>=getTotalThemes())                      s->theme       = cur.theme;
+  if(s->rdsMode>=getTotalRDSModes())                  s->rdsMode     = cur.rdsMode;
+  if(s->sleepMode>=getTotalSleepModes())              s->sleepMode   = cur.sleepMode;
+  if(s->zoomMenu>1)                                   s->zoomMenu    = cur.zoomMenu;
+  if(s->utcOffset>=getTotalUTCOffsets())              s->utcOffset   = cur.utcOffset;
+  if(s->squelch>127)                                  s->squelch     = cur.squelch;
+  if(s->fmRegion>=getTotalFmRegions())                s->fmRegion    = cur.fmRegion;
+  if(s->uiLayout>=getTotalUILayouts())                s->uiLayout    = cur.uiLayout;
+  if(s->bleMode>=getTotalBleModes())                  s->bleMode     = cur.bleMode;
+}
 
-  // Done with memory preferences
-  if(openPrefs) prefs.end();
+//
+// Apply settings record to the current settings
+//
+static void prefsSettingsApply(const SavedSettings *s)
+{
+  volume          = s->volume;
+  bandIdx         = s->band;
+  wifiModeIdx     = s->wifiMode;
+  currentBrt      = s->brightness;
+  FmAgcIdx        = s->fmAgc;
+  AmAgcIdx        = s->amAgc;
+  SsbAgcIdx       = s->ssbAgc;
+  AmAvcIdx        = s->amAvc;
+  SsbAvcIdx       = s->ssbAvc;
+  AmSoftMuteIdx   = s->amSoftMute;
+  SsbSoftMuteIdx  = s->ssbSoftMute;
+  currentSleep    = s->sleep;
+  themeIdx        = s->theme;
+  rdsModeIdx      = s->rdsMode;
+  sleepModeIdx    = s->sleepMode;
+  zoomMenu        = s->zoomMenu;
+  scrollDirection = s->scrollDir? -1 : 1;
+  utcOffsetIdx    = s->utcOffset;
+  currentSquelch  = s->squelch;
+  FmRegionIdx     = s->fmRegion;
+  uiLayoutIdx     = s->uiLayout;
+  bleModeIdx      = s->bleMode;
+}
 
-  // Done
-  return(result);
+//
+// Write settings record into the older slot, if settings have changed
+//
+static void prefsSaveSettings(const SavedSettings *record)
+{
+  SavedSettings s = *record;
+
+  // Skip unchanged settings
+  if(savedSettingsValid &&
+     !memcmp((uint8_t *)&s + SETTINGS_DATA, (uint8_t *)&savedSettings + SETTINGS_DATA, sizeof(s) - SETTINGS_DATA))
+    return;
+
+  uint8_t slot = savedSettingsSlot ^ 1;
+  s.seq = savedSettings.seq + 1;
+  s.crc = prefsSettingsCrc(&s);
+
+  prefsWriter.putBytes(settingsSlots[slot], &s, sizeof(s));
+  prefsStats.lastWrites++;
+
+  savedSettings      = s;
+  savedSettingsSlot  = slot;
+  savedSettingsValid = true;
 }
 
-void prefsSave(uint32_t items)
+//
+// Read current settings record, returns FALSE if there is none
+//
+static bool prefsLoadSettings(SavedSettings *s, uint8_t *slot)
+{
+  SavedSettings r[2];
+  bool valid[2];
+
+  for(int j=0 ; j<2 ; j++)
+    valid[j] =
+      (prefs.getBytes(settingsSlots[j], &r[j], sizeof(r[j]))==sizeof(r[j])) &&
+      (prefsSettingsCrc(&r[j])==r[j].crc);
+
+  // Pick the newer valid slot
+  if(!valid[0] && !valid[1]) return(false);
+  *slot = !valid[0] || (valid[1] && ((int32_t)(r[1].seq - r[0].seq) > 0));
+  *s = r[*slot];
+  return(true);
+}
+
+//
+// Write snapshot to NVS
+//
+static void prefsWrite(const PrefsSnapshot *snap)
 {
+  uint32_t items = snap->items;
+  uint32_t start = micros();
+
+  // Journaled tuning does not touch NVS, it is neither counted as
+  // a save nor shown by the save indicator
+  if(items == SAVE_TUNE)
+  {
+    prefsJournalAppend(&snap->tune);
+    return;
+  }
+
+  prefsStats.lastWrites = 0;
+
   if(items & SAVE_SETTINGS)
   {
+    uint32_t writes = prefsStats.lastWrites;
     // Will be saving to settings
-    prefs.begin("settings", false, STORAGE_PARTITION);
-
-    // Save main global settings
-    prefs.putUChar("Version",  VER_SETTINGS);      // Settings version
-    prefs.putUShort("App",     VER_APP);           // Application version
-    prefs.putUChar("Volume",   volume);            // Current volume
-    prefs.putUChar("Band",     bandIdx);           // Current band
-    prefs.putUChar("WiFiMode", wifiModeIdx);       // WiFi connection mode
-
-    // Save additional global settings
-    prefs.putUShort("Brightness", currentBrt);     // Brightness
-    prefs.putUChar("FmAGC",       FmAgcIdx);       // FM AGC/ATTN
-    prefs.putUChar("AmAGC",       AmAgcIdx);       // AM AGC/ATTN
-    prefs.putUChar("SsbAGC",      SsbAgcIdx);      // SSB AGC/ATTN
-    prefs.putUChar("AmAVC",       AmAvcIdx);       // AM AVC
-    prefs.putUChar("SsbAVC",      SsbAvcIdx);      // SSB AVC
-    prefs.putUChar("AmSoftMute",  AmSoftMuteIdx);  // AM soft mute
-    prefs.putUChar("SsbSoftMute", SsbSoftMuteIdx); // SSB soft mute
-    prefs.putUShort("Sleep",      currentSleep);   // Sleep delay
-    prefs.putUChar("Theme",       themeIdx);       // Color theme
-    prefs.putUChar("RDSMode",     rdsModeIdx);     // RDS mode
-    prefs.putUChar("SleepMode",   sleepModeIdx);   // Sleep mode
-    prefs.putUChar("ZoomMenu",    zoomMenu);       // TRUE: Zoom menu
-    prefs.putBool("ScrollDir", scrollDirection<0); // TRUE: Reverse scroll
-    prefs.putUChar("UTCOffset",   utcOffsetIdx);   // UTC Offset
-    prefs.putUChar("Squelch",     currentSquelch); // Squelch
-    prefs.putUChar("FmRegion",    FmRegionIdx);    // FM region
-    prefs.putUChar("UILayout",    uiLayoutIdx);    // UI Layout
-    prefs.putUChar("BLEMode",     bleModeIdx);     // Bluetooth mode
-
+    prefsWriter.begin("settings", false, STORAGE_PARTITION);
+    prefsSaveSettings(&snap->settings);
     // Done with global settings
-    prefs.end();
+    prefsWriter.end();
+    prefsStats.settingsWrites += prefsStats.lastWrites - writes;
   }
 
-  if(items & SAVE_BANDS)
+  if(items & (SAVE_BANDS|SAVE_CUR_BAND))
   {
+    uint32_t writes = prefsStats.lastWrites;
     // Will be saving to bands
-    prefs.begin("bands", false, STORAGE_PARTITION);
-    prefs.putUChar("Version", VER_BANDS);
-    // Save band settings
-    for(int i=0 ; i<getTotalBands() ; i++) prefsSaveBand(i, false);
+    prefsWriter.begin("bands", false, STORAGE_PARTITION);
+    if((items & SAVE_BANDS) && !savedBandsVersion)
+    {
+      prefsWriter.putUChar("Version", VER_BANDS);
+      prefsStats.lastWrites++;
+      savedBandsVersion = true;
+    }
+    // Save band settings that have changed
+    prefsSaveBands(snap->bands, snap->loaded);
     // Done with bands
-    prefs.end();
+    prefsWriter.end();
+    prefsStats.bandsWrites += prefsStats.lastWrites - writes;
   }
-  else if(items & SAVE_CUR_BAND)
+
+  if(items & SAVE_TUNE)
   {
-    // Save current band only
-    prefsSaveBand(bandIdx);
+    // Journal current tuning
+    prefsJournalAppend(&snap->tune);
   }
 
   if(items & SAVE_MEMORIES)
   {
+    uint32_t writes = prefsStats.lastWrites;
     // Will be saving to memories
-    prefs.begin("memories", false, STORAGE_PARTITION);
-    prefs.putUChar("Version", VER_MEMORIES);
+    prefsWriter.begin("memories", false, STORAGE_PARTITION);
+    if(!savedMemoriesVersion)
+    {
+      prefsWriter.putUChar("Version", VER_MEMORIES);
+      prefsStats.lastWrites++;
+      savedMemoriesVersion = true;
+    }
     // Save current memories
-    for(int i=0 ; i<getTotalMemories() ; i++) prefsSaveMemory(i, false);
+    prefsSaveMemories(snap->memories);
     // Done with memories
-    prefs.end();
+    prefsWriter.end();
+    prefsStats.memoriesWrites += prefsStats.lastWrites - writes;
   }
 
+  // Update statistics
+  prefsStats.saves++;
+  prefsStats.writes  += prefsStats.lastWrites;
+  prefsStats.lastTime = micros() - start;
+
   // Preferences have been saved
   savingPrefsFlag = true;
 }
 
+//
+// Copy current preferences into a snapshot
+//
+static void prefsSnapshotTake(PrefsSnapshot *snap, uint32_t items)
+{
+  // Cannot save bands without band storage
+  if(!snap->bands || !snap->loaded) items &= ~(SAVE_BANDS|SAVE_CUR_BAND);
+
+  snap->items   = items;
+  snap->bandIdx = bandIdx;
+  prefsJournalEntry(&snap->tune);
+  prefsSettingsRecord(&snap->settings);
+  for(int i=0 ; snap->bands && snap->loaded && i<getTotalBands() ; i++)
+    if((snap->loaded[i] = isBandLoaded(i))) prefsBandValue(i, &snap->bands[i]);
+  memcpy(snap->memories, memories, sizeof(snap->memories));
+}
+
+//
+// Storage task, writes snapshots queued by loop()
+//
+static void prefsTaskLoop(void *arg)
+{
+  for(;;)
+  {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    // Take the pending snapshot, leaving a spare one for loop().
+    // Snapshots are large, swap pointers rather than copying them.
+    xSemaphoreTake(prefsLock, portMAX_DELAY);
+    PrefsSnapshot *spare = prefsWriting;
+    prefsWriting = prefsPending;
+    prefsPending = spare;
+    prefsPending->items = 0;
+    uint32_t queued = prefsQueued;
+    xSemaphoreGive(prefsLock);
+
+    if(prefsWriting->items) prefsWrite(prefsWriting);
+    prefsWritten = queued;
+  }
+}
+
+//
+// Start storage task, returns FALSE if it cannot run
+//
+static bool prefsStart()
+{
+  if(prefsTask) return(true);
+
+  for(int j=0 ; j<ITEM_COUNT(prefsSnapshots) ; j++)
+  {
+    PrefsSnapshot *snap = &prefsSnapshots[j];
+    if(!snap->bands) snap->bands = (SavedBand *)calloc(getTotalBands(), sizeof(SavedBand));
+    if(!snap->loaded) snap->loaded = (bool *)calloc(getTotalBands(), sizeof(bool));
+    if(!snap->bands || !snap->loaded) return(false);
+  }
+
+  if(!prefsLock) prefsLock = xSemaphoreCreateMutex();
+  if(!prefsLock) return(false);
+
+  // Arduino loop() runs on core 1, write from core 0
+  if(xTaskCreatePinnedToCore(prefsTaskLoop, "storage", STORE_STACK, 0, STORE_PRIO, &prefsTask, 0)!=pdPASS)
+  {
+    prefsTask = 0;
+    return(false);
+  }
+
+  return(true);
+}
+
+//
+// Queue preferences for writing by the storage task
+//
+void prefsQueue(uint32_t items)
+{
+  // Without storage task, write right away
+  if(!prefsStart())
+  {
+    prefsSnapshotTake(prefsWriting, items);
+    prefsWrite(prefsWriting);
+    return;
+  }
+
+  // Replace pending snapshot, keeping its items
+  xSemaphoreTake(prefsLock, portMAX_DELAY);
+  prefsStats.coalesced += !!prefsPending->items;
+  prefsSnapshotTake(prefsPending, items | prefsPending->items);
+  prefsQueued++;
+  xSemaphoreGive(prefsLock);
+
+  xTaskNotifyGive(prefsTask);
+}
+
+//
+// Write requested and queued preferences, wait until done. Call
+// before sleeping or restarting.
+//
+void prefsFlush()
+{
+  // Journal tuning that has not settled yet
+  if(journalDirty)
+  {
+    itIsTimeToSave |= SAVE_TUNE;
+    journalDirty = false;
+  }
+
+  if(itIsTimeToSave)
+  {
+    prefsQueue(itIsTimeToSave);
+    storeTime = millis();
+    itIsTimeToSave = 0;
+  }
+
+  while(prefsTask && (prefsWritten!=prefsQueued)) delay(1);
+}
+
+void prefsSave(uint32_t items)
+{
+  prefsQueue(items);
+  prefsFlush();
+}
+
+//
+// Get storage statistics. NVS and LittleFS usage is cached, as
+// checking it walks both, and is refreshed every USAGE_TIME or
+// when requested.
+//
+const PrefsStats *prefsGetStats(bool refresh)
+{
+  if(refresh || !usageValid || (millis() - usageTime >= USAGE_TIME))
+  {
+    nvs_stats_t nvs;
+
+    if(nvs_get_stats(STORAGE_PARTITION, &nvs)==ESP_OK)
+    {
+      prefsStats.nvsUsed = nvs.used_entries;
+      prefsStats.nvsFree = nvs.free_entries;
+    }
+
+    prefsStats.fsUsed  = LittleFS.usedBytes();
+    prefsStats.fsTotal = LittleFS.totalBytes();
+    usageTime  = millis();
+    usageValid = true;
+  }
+
+  return(&prefsStats);
+}
+
+//
+// Account bytes written to LittleFS
+//
+void diskCountWrite(size_t bytes)
+{
+  prefsStats.fsWritten += bytes;
+}
+
 bool prefsLoad(uint32_t items)
 {
   if(items & SAVE_SETTINGS)
@@ -236,36 +986,61 @@ bool prefsLoad(uint32_t items)
     // Will be loading from settings
     prefs.begin("settings", true, STORAGE_PARTITION);
 
-    // Check currently saved version
-    if((items & SAVE_VERIFY) && (prefs.getUChar("Version", 0) != VER_SETTINGS))
+    SavedSettings record;
+    uint8_t slot;
+
+    if(prefsLoadSettings(&record, &slot))
     {
-      prefs.end();
-      return(false);
+      // Check currently saved version
+      if((items & SAVE_VERIFY) && (record.version != VER_SETTINGS))
+      {
+        prefs.end();
+        return(false);
+      }
+
+      // Settings record is what NVS has now
+      prefsSettingsApply(&record);
+      savedSettings      = record;
+      savedSettingsSlot  = slot;
+      savedSettingsValid = true;
     }
+    else
+    {
+      // Migrate settings saved as individual keys, the next save
+      // writes them as a record
+      savedSettingsValid = false;
 
-    // Load main global settings
-    volume         = prefs.getUChar("Volume", volume);          // Current volume
-    bandIdx        = prefs.getUChar("Band", bandIdx);           // Current band
-    wifiModeIdx    = prefs.getUChar("WiFiMode", wifiModeIdx);   // WiFi connection mode
-    currentBrt     = prefs.getUShort("Brightness", currentBrt); // Brightness
-    FmAgcIdx       = prefs.getUChar("FmAGC", FmAgcIdx);         // FM AGC/ATTN
-    AmAgcIdx       = prefs.getUChar("AmAGC", AmAgcIdx);         // AM AGC/ATTN
-    SsbAgcIdx      = prefs.getUChar("SsbAGC", SsbAgcIdx);       // SSB AGC/ATTN
-    AmAvcIdx       = prefs.getUChar("AmAVC", AmAvcIdx);         // AM AVC
-    SsbAvcIdx      = prefs.getUChar("SsbAVC", SsbAvcIdx);       // SSB AVC
-    AmSoftMuteIdx  = prefs.getUChar("AmSoftMute", AmSoftMuteIdx);   // AM soft mute
-    SsbSoftMuteIdx = prefs.getUChar("SsbSoftMute", SsbSoftMuteIdx); // SSB soft mute
-    currentSleep   = prefs.getUShort("Sleep", currentSleep);    // Sleep delay
-    themeIdx       = prefs.getUChar("Theme", themeIdx);         // Color theme
-    rdsModeIdx     = prefs.getUChar("RDSMode", rdsModeIdx);     // RDS mode
-    sleepModeIdx   = prefs.getUChar("SleepMode", sleepModeIdx); // Sleep mode
-    zoomMenu       = prefs.getUChar("ZoomMenu", zoomMenu);      // TRUE: Zoom menu
-    scrollDirection = prefs.getBool("ScrollDir", scrollDirection<0)? -1:1; // TRUE: Reverse scroll
-    utcOffsetIdx   = prefs.getUChar("UTCOffset", utcOffsetIdx); // UTC Offset
-    currentSquelch = prefs.getUChar("Squelch", currentSquelch); // Squelch
-    FmRegionIdx    = prefs.getUChar("FmRegion", FmRegionIdx);   // FM region
-    uiLayoutIdx    = prefs.getUChar("UILayout", uiLayoutIdx);   // UI Layout
-    bleModeIdx     = prefs.getUChar("BLEMode", bleModeIdx);     // Bluetooth mode
+      // Check currently saved version
+      if((items & SAVE_VERIFY) && (prefs.getUChar("Version", 0) != VER_SETTINGS))
+      {
+        prefs.end();
+        return(false);
+      }
+
+      // Load main global settings
+      volume         = prefs.getUChar("Volume", volume);          // Current volume
+      bandIdx        = prefs.getUChar("Band", bandIdx);           // Current band
+      wifiModeIdx    = prefs.getUChar("WiFiMode", wifiModeIdx);   // WiFi connection mode
+      currentBrt     = prefs.getUShort("Brightness", currentBrt); // Brightness
+      FmAgcIdx       = prefs.getUChar("FmAGC", FmAgcIdx);         // FM AGC/ATTN
+      AmAgcIdx       = prefs.getUChar("AmAGC", AmAgcIdx);         // AM AGC/ATTN
+      SsbAgcIdx      = prefs.getUChar("SsbAGC", SsbAgcIdx);       // SSB AGC/ATTN
+      AmAvcIdx       = prefs.getUChar("AmAVC", AmAvcIdx);         // AM AVC
+      SsbAvcIdx      = prefs.getUChar("SsbAVC", SsbAvcIdx);       // SSB AVC
+      AmSoftMuteIdx  = prefs.getUChar("AmSoftMute", AmSoftMuteIdx);   // AM soft mute
+      SsbSoftMuteIdx = prefs.getUChar("SsbSoftMute", SsbSoftMuteIdx); // SSB soft mute
+      currentSleep   = prefs.getUShort("Sleep", currentSleep);    // Sleep delay
+      themeIdx       = prefs.getUChar("Theme", themeIdx);         // Color theme
+      rdsModeIdx     = prefs.getUChar("RDSMode", rdsModeIdx);     // RDS mode
+      sleepModeIdx   = prefs.getUChar("SleepMode", sleepModeIdx); // Sleep mode
+      zoomMenu       = prefs.getUChar("ZoomMenu", zoomMenu);      // TRUE: Zoom menu
+      scrollDirection = prefs.getBool("ScrollDir", scrollDirection<0)? -1:1; // TRUE: Reverse scroll
+      utcOffsetIdx   = prefs.getUChar("UTCOffset", utcOffsetIdx); // UTC Offset
+      currentSquelch = prefs.getUChar("Squelch", currentSquelch); // Squelch
+      FmRegionIdx    = prefs.getUChar("FmRegion", FmRegionIdx);   // FM region
+      uiLayoutIdx    = prefs.getUChar("UILayout", uiLayoutIdx);   // UI Layout
+      bleModeIdx     = prefs.getUChar("BLEMode", bleModeIdx);     // Bluetooth mode
+    }
 
     // Done with global settings
     prefs.end();
@@ -277,23 +1052,19 @@ bool prefsLoad(uint32_t items)
     prefs.begin("bands", true, STORAGE_PARTITION);
 
     // Check currently saved version
-    if((items & SAVE_VERIFY) && (prefs.getUChar("Version", 0) != VER_BANDS))
+    savedBandsVersion = prefs.getUChar("Version", 0)==VER_BANDS;
+    if((items & SAVE_VERIFY) && !savedBandsVersion)
     {
       prefs.end();
       return(false);
     }
 
-    // Read band settings
-    for(int i=0 ; i<getTotalBands() ; i++) prefsLoadBand(i, false);
+    // Migrate band settings, others load as bands are used
+    prefsLoadBands();
 
     // Done with bands
     prefs.end();
   }
-  else if(items & SAVE_CUR_BAND)
-  {
-    // Load current band only
-    prefsLoadBand(bandIdx);
-  }
 
   if(items & SAVE_MEMORIES)
   {
@@ -301,14 +1072,15 @@ bool prefsLoad(uint32_t items)
     prefs.begin("memories", true, STORAGE_PARTITION);
 
     // Check currently saved version
-    if((items & SAVE_VERIFY) && (prefs.getUChar("Version", 0) != VER_MEMORIES))
+    savedMemoriesVersion = prefs.getUChar("Version", 0)==VER_MEMORIES;
+    if((items & SAVE_VERIFY) && !savedMemoriesVersion)
     {
       prefs.end();
       return(false);
     }
 
     // Read all memories
-    for(int i=0 ; i<getTotalMemories() ; i++) prefsLoadMemory(i, false);
+    prefsLoadMemories();
 
     // Done with memories
     prefs.end();
@@ -352,8 +1124,328 @@ bool diskInit(bool force)
 
 bool nvsErase()
 {
+  // Pending writes would bring preferences back
+  itIsTimeToSave = 0;
+  prefsFlush();
+
+  // Nothing is saved now
+  prefsShadowReset();
+
   return(nvs_flash_erase() == ESP_OK &&
          nvs_flash_init() == ESP_OK &&
          nvs_flash_erase_partition(STORAGE_PARTITION) == ESP_OK &&
          nvs_flash_init_partition(STORAGE_PARTITION) == ESP_OK);
 }
+
+//
+// Snapshot image, a versioned copy of everything saved in NVS, used
+// to back up and clone radios in one transfer. The header is followed
+// by sections of fixed-size records. Records from older firmware may
+// be shorter, missing fields keep their current values. Unknown
+// sections and records beyond what this firmware has are skipped,
+// known sections with unknown record versions are rejected.
+//
+#define SNAPSHOT_MAGIC   0x53535441  // "ATSS"
+#define SNAPSHOT_VERSION 2
+
+#define SNAP_SETTINGS    1
+#define SNAP_BANDS       2
+#define SNAP_MEMORIES    3
+#define SNAP_NETWORK     4
+
+struct __attribute__((packed)) SnapshotHeader
+{
+  uint32_t magic;         // SNAPSHOT_MAGIC
+  uint8_t version;        // SNAPSHOT_VERSION
+  uint8_t sections;       // Number of sections that follow
+  uint16_t app;           // Application version
+  uint32_t size;          // Image size, header included
+  uint32_t crc;           // CRC32 of the sections
+};
+
+struct __attribute__((packed)) SnapshotSection
+{
+  uint8_t type;           // SNAP_* section type
+  uint8_t version;        // VER_* of the records
+  uint16_t count;         // Number of records
+  uint16_t size;          // Size of each record
+};
+
+// Band record, keyed like in NVS
+struct __attribute__((packed)) SnapshotBand
+{
+  char key[16];
+  SavedBand value;
+};
+
+// Network setting, as a string
+struct __attribute__((packed)) SnapshotNetwork
+{
+  char key[16];
+  char value[64];
+};
+
+// Network settings included in snapshots
+static const char *snapshotNetworkKeys[] =
+{
+  "loginusername", "loginpassword",
+  "wifissid1", "wifipass1", "wifissid2", "wifipass2", "wifissid3", "wifipass3",
+};
+
+//
+// Add section header to the image, returns pointer to its records
+// or 0 if they do not fit
+//
+static uint8_t *prefsExportSection(uint8_t *buf, size_t size, size_t *pos, uint8_t type, uint8_t version, uint16_t count, uint16_t recSize)
+{
+  SnapshotSection sec = { type, version, count, recSize };
+
+  if(*pos + sizeof(sec) + count * recSize > size) return(0);
+
+  memcpy(buf + *pos, &sec, sizeof(sec));
+  *pos += sizeof(sec) + count * recSize;
+  ((SnapshotHeader *)buf)->sections++;
+  return(buf + *pos - count * recSize);
+}
+
+//
+// Compose snapshot image of the current preferences, returns its
+// size or 0 if it does not fit. Network settings hold passwords and
+// are only included for authorized callers.
+//
+size_t prefsExport(uint8_t *buf, size_t size, bool network)
+{
+  SnapshotHeader *hdr = (SnapshotHeader *)buf;
+  size_t pos = sizeof(*hdr);
+  uint8_t *p;
+
+  if(size < sizeof(*hdr)) return(0);
+  memset(hdr, 0, sizeof(*hdr));
+
+  // Settings record, without its slot sequence number and CRC
+  SavedSettings s;
+  prefsSettingsRecord(&s);
+  p = prefsExportSection(buf, size, &pos, SNAP_SETTINGS, VER_SETTINGS, 1, sizeof(s) - SETTINGS_DATA);
+  if(!p) return(0);
+  memcpy(p, (uint8_t *)&s + SETTINGS_DATA, sizeof(s) - SETTINGS_DATA);
+
+  // All bands, reading unused ones from NVS without loading them
+  p = prefsExportSection(buf, size, &pos, SNAP_BANDS, VER_BANDS, getTotalBands(), sizeof(SnapshotBand));
+  if(!p) return(0);
+
+  Preferences reader;
+  reader.begin("bands", true, STORAGE_PARTITION);
+  for(int i=0 ; i<getTotalBands() ; i++)
+  {
+    SnapshotBand *b = (SnapshotBand *)p + i;
+    SavedBand value;
+    memset(b, 0, sizeof(*b));
+    prefsBandKey(i, b->key);
+    if(isBandLoaded(i))
+      prefsBandValue(i, &value);
+    else
+      prefsReadBand(&reader, i, &value);
+    memcpy(&b->value, &value, sizeof(value));
+  }
+  reader.end();
+
+  // All memories
+  p = prefsExportSection(buf, size, &pos, SNAP_MEMORIES, VER_MEMORIES, getTotalMemories(), sizeof(Memory));
+  if(!p) return(0);
+  memcpy(p, memories, getTotalMemories() * sizeof(Memory));
+
+  // Network settings, with their own handle as the caller may not
+  // be running in loop()
+  if(network)
+  {
+    p = prefsExportSection(buf, size, &pos, SNAP_NETWORK, 0, ITEM_COUNT(snapshotNetworkKeys), sizeof(SnapshotNetwork));
+    if(!p) return(0);
+
+    Preferences net;
+    net.begin("network", true, STORAGE_PARTITION);
+    for(int j=0 ; j<ITEM_COUNT(snapshotNetworkKeys) ; j++)
+    {
+      SnapshotNetwork *n = (SnapshotNetwork *)p + j;
+      memset(n, 0, sizeof(*n));
+      strncpy(n->key, snapshotNetworkKeys[j], sizeof(n->key) - 1);
+      strncpy(n->value, net.getString(snapshotNetworkKeys[j], "").c_str(), sizeof(n->value) - 1);
+    }
+    net.end();
+  }
+
+  hdr->magic   = SNAPSHOT_MAGIC;
+  hdr->version = SNAPSHOT_VERSION;
+  hdr->app     = VER_APP;
+  hdr->size    = pos;
+  hdr->crc     = esp_rom_crc32_le(0, buf + sizeof(*hdr), pos - sizeof(*hdr));
+  return(pos);
+}
+
+//
+// Find the next section in the image, returns FALSE at the end
+//
+static bool prefsImportSection(const uint8_t *buf, size_t size, size_t *pos, SnapshotSection *sec, const uint8_t **data)
+{
+  if(*pos + sizeof(*sec) > size) return(false);
+  memcpy(sec, buf + *pos, sizeof(*sec));
+  *pos += sizeof(*sec);
+
+  size_t length = sec->count * sec->size;
+  if(*pos + length > size) return(false);
+  *data = buf + *pos;
+  *pos += length;
+  return(true);
+}
+
+//
+// Get record version this firmware expects for a section type,
+// returns -1 for unknown sections
+//
+static int prefsSectionVersion(uint8_t type)
+{
+  switch(type)
+  {
+    case SNAP_SETTINGS: return(VER_SETTINGS);
+    case SNAP_BANDS:    return(VER_BANDS);
+    case SNAP_MEMORIES: return(VER_MEMORIES);
+    case SNAP_NETWORK:  return(0);
+  }
+  return(-1);
+}
+
+//
+// Find band by its NVS key, returns -1 if there is no such band
+//
+static int prefsFindBand(const char *key)
+{
+  char name[16];
+
+  for(int i=0 ; i<getTotalBands() ; i++)
+  {
+    prefsBandKey(i, name);
+    if(!strncmp(key, name, sizeof(name))) return(i);
+  }
+  return(-1);
+}
+
+//
+// Replace preferences with a snapshot image and save them, returns
+// error message or 0 if successful. Nothing changes unless the image
+// is valid. Call from loop(), then restart to apply the preferences.
+// Network settings are only accepted from authorized callers.
+//
+const char *prefsImport(const uint8_t *buf, size_t size, bool network)
+{
+  const SnapshotHeader *hdr = (const SnapshotHeader *)buf;
+  SnapshotSection sec;
+  const uint8_t *data;
+  size_t pos;
+  int j;
+
+  // Check the header and the CRC
+  if(size < sizeof(*hdr) || hdr->magic != SNAPSHOT_MAGIC) return("Not a snapshot");
+  if(hdr->version != SNAPSHOT_VERSION) return("Unsupported snapshot version");
+  if(hdr->size != size) return("Invalid snapshot size");
+  if(hdr->crc != esp_rom_crc32_le(0, buf + sizeof(*hdr), size - sizeof(*hdr)))
+    return("Snapshot CRC mismatch");
+
+  // Check that all sections are in place
+  for(j=0, pos=sizeof(*hdr) ; j<hdr->sections ; j++)
+  {
+    if(!prefsImportSection(buf, size, &pos, &sec, &data))
+      return("Invalid snapshot section");
+    if(prefsSectionVersion(sec.type)>=0 && sec.version!=prefsSectionVersion(sec.type))
+      return("Unsupported snapshot section version");
+    if(sec.type==SNAP_SETTINGS && sec.count!=1)
+      return("Invalid snapshot settings");
+    if(sec.type==SNAP_BANDS && sec.size<offsetof(SnapshotBand, value) + SAVED_BAND_OLD)
+      return("Invalid snapshot bands");
+    if(sec.type==SNAP_MEMORIES && sec.size<offsetof(Memory, name))
+      return("Invalid snapshot memories");
+    if(sec.type==SNAP_NETWORK && !network)
+      return("Network settings not allowed here");
+    if(sec.type==SNAP_NETWORK && sec.size<sizeof(SnapshotNetwork))
+      return("Invalid snapshot network");
+  }
+
+  // Pending writes would overwrite the snapshot
+  itIsTimeToSave = 0;
+  prefsFlush();
+
+  for(j=0, pos=sizeof(*hdr) ; j<hdr->sections ; j++)
+  {
+    prefsImportSection(buf, size, &pos, &sec, &data);
+
+    if(sec.type==SNAP_SETTINGS)
+    {
+      SavedSettings s;
+      size_t n = sizeof(s) - SETTINGS_DATA;
+      prefsSettingsRecord(&s);
+      memcpy((uint8_t *)&s + SETTINGS_DATA, data, sec.size<n? sec.size : n);
+      prefsSettingsCheck(&s);
+      prefsSettingsApply(&s);
+    }
+    else if(sec.type==SNAP_BANDS)
+    {
+      size_t n = sec.size - offsetof(SnapshotBand, value);
+      if(n>sizeof(SavedBand)) n = sizeof(SavedBand);
+
+      for(int i=0 ; i<sec.count ; i++)
+      {
+        const SnapshotBand *b = (const SnapshotBand *)(data + i * sec.size);
+        SavedBand value;
+        char key[sizeof(b->key)];
+
+        // Match records to bands by name, skipping unknown bands
+        memcpy(key, b->key, sizeof(key));
+        key[sizeof(key) - 1] = '\0';
+        int idx = prefsFindBand(key);
+        if(idx<0) continue;
+
+        // Only apply records fitting the band
+        prefsBandValue(idx, &value);
+        memcpy(&value, &b->value, n);
+        if(prefsBandFits(idx, &value)) prefsBandApply(idx, &value);
+      }
+    }
+    else if(sec.type==SNAP_MEMORIES)
+    {
+      for(int i=0 ; i<getTotalMemories() ; i++)
+      {
+        Memory *mem = &memories[i];
+        memset(mem, 0, sizeof(*mem));
+        if(i<sec.count) memcpy(mem, data + i * sec.size, sec.size<sizeof(*mem)? sec.size : sizeof(*mem));
+        // Drop memories not fitting bands this firmware has
+        if(!mem->freq || mem->band>=getTotalBands() || mem->mode>=getTotalModes() ||
+           !isMemoryInBand(getBandPlan(mem->band), mem))
+          memset(mem, 0, sizeof(*mem));
+      }
+    }
+    else if(sec.type==SNAP_NETWORK)
+    {
+      prefs.begin("network", false, STORAGE_PARTITION);
+      for(int i=0 ; i<sec.count ; i++)
+      {
+        SnapshotNetwork n;
+        memcpy(&n, data + i * sec.size, sizeof(n));
+        n.key[sizeof(n.key) - 1] = '\0';
+        n.value[sizeof(n.value) - 1] = '\0';
+        // Only accept known settings
+        for(int k=0 ; k<ITEM_COUNT(snapshotNetworkKeys) ; k++)
+          if(!strcmp(n.key, snapshotNetworkKeys[k]))
+            prefs.putString(n.key, n.value);
+      }
+      prefs.end();
+    }
+  }
+
+  // Journaled tuning would override the imported bands
+  LittleFS.remove(JOURNAL_FILE);
+  prefsJournalEntry(&journalTune);
+  journalDirty = false;
+
+  // Write everything, as nothing imported is in NVS yet
+  prefsShadowReset();
+  prefsSave(SAVE_ALL);
+  return(0);
+}
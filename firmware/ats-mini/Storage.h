@@ -9,24 +9,51 @@
 #define SAVE_BANDS    0x02
 #define SAVE_MEMORIES 0x04
 #define SAVE_CUR_BAND 0x08
+#define SAVE_TUNE     0x10
 #define SAVE_VERIFY   0x80
 #define SAVE_ALL      (SAVE_SETTINGS|SAVE_BANDS|SAVE_MEMORIES|SAVE_VERIFY)
 
+// Maximum snapshot image size
+#define SNAPSHOT_MAX  8192
+
+// Storage statistics
+struct PrefsStats
+{
+  uint32_t saves;       // Number of snapshots written
+  uint32_t writes;      // Total NVS writes
+  uint32_t lastWrites;  // NVS writes by the last save
+  uint32_t lastTime;    // Last save time (us)
+  uint32_t settingsWrites; // NVS writes to "settings"
+  uint32_t bandsWrites;    // NVS writes to "bands"
+  uint32_t memoriesWrites; // NVS writes to "memories"
+  uint32_t requests;    // Number of prefsRequestSave() calls
+  uint32_t coalesced;   // Requests and snapshots merged into pending ones
+  uint32_t fsWritten;   // Bytes written to LittleFS
+  uint32_t nvsUsed;     // Used NVS entries
+  uint32_t nvsFree;     // Free NVS entries
+  uint32_t fsUsed;      // Used LittleFS bytes
+  uint32_t fsTotal;     // Total LittleFS bytes
+};
+
 extern Preferences prefs;
 
 void prefsTickTime();
+void prefsFlush();
 void prefsInvalidate();
 bool prefsAreWritten();
 bool nvsErase();
+const PrefsStats *prefsGetStats(bool refresh = false);
 
 bool diskInit(bool force = false);
+void diskCountWrite(size_t bytes);
 
 void prefsRequestSave(uint32_t what, bool now = false);
+void prefsQueue(uint32_t items = SAVE_ALL);
 void prefsSave(uint32_t items = SAVE_ALL);
 bool prefsLoad(uint32_t items = SAVE_ALL);
-void prefsSaveBand(uint8_t idx, bool openPrefs = true);
-bool prefsLoadBand(uint8_t idx, bool openPrefs = true);
-void prefsSaveMemory(uint8_t idx, bool openPrefs = true);
-bool prefsLoadMemory(uint8_t idx, bool openPrefs = true);
+bool prefsLoadJournal();
+void prefsLoadBand(uint8_t idx);
+size_t prefsExport(uint8_t *buf, size_t size, bool network = false);
+const char *prefsImport(const uint8_t *buf, size_t size, bool network = false);
 
 #endif // STORAGE_H
@@ -5,6 +5,7 @@
 #include "Utils.h"
 #include "Menu.h"
 #include "Draw.h"
+#include "Storage.h"
 
 // SSB patch for whole SSBRX initialization string
 #include "patch_init.h"
@@ -195,9 +196,14 @@ bool sleepOn(int x)
     sleep_on = true;
     ledcWrite(PIN_LCD_BL, 0);
     spr.fillSprite(TFT_BLACK);
-    spr.pushSprite(0, 0);
-    tft.writecommand(ST7789_DISPOFF);
-    tft.writecommand(ST7789_SLPIN);
+    displayPush();
+    drawInvalidate();
+    mirrorRequestFrame();
+    displayCommand(ST7789_DISPOFF);
+    displayCommand(ST7789_SLPIN);
+
+    // Write pending preferences, power may go away while sleeping
+    prefsFlush();
 
     // Wait till the button is released to prevent immediate wakeup
     while(pb1.update(digitalRead(ENCODER_PUSH_BUTTON) == LOW).isPressed)
@@ -249,9 +255,9 @@ bool sleepOn(int x)
   else if((x==0) && sleep_on)
   {
     sleep_on = false;
-    tft.writecommand(ST7789_SLPOUT);
+    displayCommand(ST7789_SLPOUT);
     delay(120);
-    tft.writecommand(ST7789_DISPON);
+    displayCommand(ST7789_DISPON);
     drawScreen();
     ledcWrite(PIN_LCD_BL, currentBrt);
     // Wait till the button is released to prevent the main loop clicks
@@ -367,7 +373,7 @@ bool clockTickTime()
 //
 // Check if given frequency belongs to given band
 //
-bool isFreqInBand(const Band *band, uint16_t freq)
+bool isFreqInBand(const BandPlan *band, uint16_t freq)
 {
   return((freq>=band->minimumFreq) && (freq<=band->maximumFreq));
 }
@@ -400,7 +406,7 @@ uint16_t bfoFromHz(uint32_t freq)
 //
 // Check if given memory entry belongs to given band
 //
-bool isMemoryInBand(const Band *band, const Memory *memory)
+bool isMemoryInBand(const BandPlan *band, const Memory *memory)
 {
   uint16_t freq = freqFromHz(memory->freq, memory->mode);
   if(freq<band->minimumFreq) return(false);
@@ -456,3 +462,61 @@ int getStrength(int rssi)
     return                 17; //>S9 +60
   }
 }
+
+//
+// Boot profiler. Phases may run on either core, each phase slot is
+// only written by the code running that phase.
+//
+#define BOOT_MAX_PHASES 12
+
+static BootPhase bootPhases[BOOT_MAX_PHASES];
+static uint8_t bootPhaseCount = 0;
+
+//
+// Start timing a boot phase, returns phase number
+//
+int bootStart(const char *name)
+{
+  if(bootPhaseCount>=BOOT_MAX_PHASES) return(-1);
+
+  bootPhases[bootPhaseCount].name  = name;
+  bootPhases[bootPhaseCount].start = micros();
+  bootPhases[bootPhaseCount].end   = 0;
+  return(bootPhaseCount++);
+}
+
+//
+// Finish timing a boot phase
+//
+void bootEnd(int phase)
+{
+  if(phase>=0 && phase<bootPhaseCount) bootPhases[phase].end = micros();
+}
+
+//
+// Get boot phase, returns 0 if no such phase
+//
+const BootPhase *bootGetPhase(int n)
+{
+  return(n>=0 && n<bootPhaseCount? &bootPhases[n] : 0);
+}
+
+//
+// Print boot phases to the given stream
+//
+void bootReport(Stream *stream)
+{
+  uint32_t total = 0;
+
+  for(int j=0 ; j<bootPhaseCount ; j++)
+  {
+    const BootPhase *p = &bootPhases[j];
+    stream->printf(
+      "Boot %-8s %8lu us +%8lu us\r\n",
+      p->name, p->start, p->end? p->end - p->start : 0
+    );
+    total = p->end > total? p->end : total;
+  }
+
+  stream->printf("Boot %-8s %8lu us\r\n", "total", total);
+}
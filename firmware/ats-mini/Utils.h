@@ -8,6 +8,20 @@
 #define MUTE_SQUELCH 3
 #define MUTE_TEMP    4
 
+// Boot phase, times in microseconds since reset
+typedef struct
+{
+  const char *name;
+  uint32_t start;
+  uint32_t end;   // 0 while the phase is running
+} BootPhase;
+
+// Boot profiler functions
+int bootStart(const char *name);
+void bootEnd(int phase);
+const BootPhase *bootGetPhase(int n);
+void bootReport(Stream *stream);
+
 // SSB patch functions
 void loadSSB(uint8_t bandwidth, bool draw = true);
 void unloadSSB();
@@ -35,7 +49,7 @@ bool clockTickTime();
 void clockRefreshTime();
 
 // Check if given memory entry belongs to a band
-bool isMemoryInBand(const Band *band, const Memory *memory);
+bool isMemoryInBand(const BandPlan *band, const Memory *memory);
 
 // Helpers to convert from/to Hz
 uint16_t freqFromHz(uint32_t freq, uint8_t mode);
@@ -43,6 +57,6 @@ uint16_t bfoFromHz(uint32_t freq);
 uint32_t freqToHz(uint16_t freq, uint8_t mode);
 
 // Check if given frequency belongs to a band
-bool isFreqInBand(const Band *band, uint16_t freq);
+bool isFreqInBand(const BandPlan *band, uint16_t freq);
 
 #endif // UTILS_H
@@ -12,11 +12,13 @@
 #include "Themes.h"
 #include "Utils.h"
 #include "EIBI.h"
-#include "splash_data.h"
+#include "Bank.h"
 
 // SI473/5 and UI
 #define MIN_ELAPSED_TIME         5  // 300
-#define MIN_ELAPSED_RSSI_TIME  200  // RSSI check uses IN_ELAPSED_RSSI_TIME * 6 = 1.2s
+#define MIN_ELAPSED_RSSI_TIME   50  // RSSI and SNR sampling period (ms), also used by squelch
+#define SIGNAL_AVG_SHIFT         2  // RSSI and SNR averaging, new sample weight = 1/(2^SHIFT)
+#define SIGNAL_PEAK_HOLD      1000  // Time to hold RSSI peak before it starts to decay (ms)
 #define ELAPSED_COMMAND      10000  // time to turn off the last command controlled by encoder. Time to goes back to the VFO control // G8PTN: Increased time and corrected comment
 #define DEFAULT_VOLUME          35  // change it for your favorite sound volume
 #define DEFAULT_SLEEP            0  // Default sleep interval, range = 0 (off) to 255 in steps of 5
@@ -25,6 +27,7 @@
 #define NTP_CHECK_TIME       60000  // NTP time refresh period (ms)
 #define SCHEDULE_CHECK_TIME   2000  // How often to identify the same frequency (ms)
 #define BACKGROUND_REFRESH_TIME 5000    // Background screen refresh time. Covers the situation where there are no other events causing a refresh
+#define SPLASH_TIME          2000  // Minimum splash screen time (ms)
 
 // =================================
 // CONSTANTS AND VARIABLES
@@ -76,6 +79,9 @@ int8_t scrollDirection = 1;             // Menu scroll direction
 // Background screen refresh
 uint32_t background_timer = millis();   // Background screen refresh timer.
 
+// Serial remote control
+static RemoteState serialRemote = { .bandwidth = 200000 };
+
 //
 // Current parameters
 //
@@ -85,6 +91,7 @@ int16_t  currentBFO  = 0;
 
 uint8_t  rssi = 0;
 uint8_t  snr  = 0;
+uint8_t  rssiPeak = 0;
 
 //
 // Devices
@@ -95,6 +102,34 @@ TFT_eSPI tft    = TFT_eSPI();
 TFT_eSprite spr = TFT_eSprite(&tft);
 SI4735_fixed rx;
 
+//
+// Show a line of text during startup, the display bus may belong to
+// the DMA display output already
+//
+static void drawBootMessage(const char *text, int line, uint16_t color)
+{
+  spr.setTextDatum(TL_DATUM);
+  spr.setTextColor(color, TH.bg);
+  spr.drawString(text, 0, line * 16, 2);
+  spr.setTextDatum(MC_DATUM);
+  displayPush();
+}
+
+//
+// Mount flash file system on the other core while the radio starts
+//
+static SemaphoreHandle_t diskDone;
+static int diskPhase;
+
+static void diskInitTask(void *arg)
+{
+  diskInit();
+  bankInit();
+  bootEnd(diskPhase);
+  xSemaphoreGive(diskDone);
+  vTaskDelete(0);
+}
+
 //
 // Hardware initialization and setup
 //
@@ -113,10 +148,10 @@ void setup()
   pinMode(PIN_AMP_EN, OUTPUT);
   digitalWrite(PIN_AMP_EN, LOW);
 
-  // Enable SI4732 VDD
+  // Enable SI4732 VDD, the display is set up while it powers up
   pinMode(PIN_POWER_ON, OUTPUT);
   digitalWrite(PIN_POWER_ON, HIGH);
-  delay(100);
+  uint32_t powerTime = millis();
 
   // The line below may be necessary to setup I2C pins on ESP32
   Wire.begin(ESP32_I2C_SDA, ESP32_I2C_SCL);
@@ -127,6 +162,7 @@ void setup()
   ledcWrite(PIN_LCD_BL, 0);          // Default value 0%
 
   // TFT display setup
+  int phase = bootStart("display");
   tft.begin();
   tft.setRotation(3);
 
@@ -151,28 +187,22 @@ void setup()
     tft.writedata(0xB1);    // High enhancement, UI mode
   }
 
-  // Show splash screen from PROGMEM
-  ledcWrite(PIN_LCD_BL, 255);  // Turn on backlight for splash
-  tft.fillScreen(TFT_BLACK);   // Clear screen to black first
-
-  // Display splash in lines to avoid large buffer in RAM
-  uint16_t lineBuffer[320];
-  for(int y = 0; y < SPLASH_HEIGHT; y++) {
-    // Copy one line from PROGMEM to RAM
-    for(int x = 0; x < SPLASH_WIDTH; x++) {
-      lineBuffer[x] = pgm_read_word(&splash_data[y * SPLASH_WIDTH + x]);
-    }
-    tft.pushImage(0, y, SPLASH_WIDTH, 1, lineBuffer);
-  }
-  delay(2000);  // Show splash for 2 seconds
-
-  tft.fillScreen(TH.bg);
+  // Set up screen buffer
   spr.createSprite(320, 170);
   spr.setTextDatum(MC_DATUM);
   spr.setSwapBytes(true);
   spr.setFreeFont(&Orbitron_Light_24);
   spr.setTextColor(TH.text, TH.bg);
 
+  // Set up display output (DMA, if enabled)
+  displayInit();
+
+  // Show splash screen while initializing the rest of the hardware
+  drawSplash();
+  ledcWrite(PIN_LCD_BL, 255);  // Turn on backlight for splash
+  uint32_t splashTime = millis();
+  bootEnd(phase);
+
   // Press and hold Encoder button to force an preferences reset
   // Note: preferences reset is recommended after firmware updates
   if(digitalRead(ENCODER_PUSH_BUTTON)==LOW)
@@ -181,20 +211,29 @@ void setup()
     diskInit(true);
 
     ledcWrite(PIN_LCD_BL, 255);       // Default value 255 = 100%
-    tft.setTextSize(2);
-    tft.setTextColor(TH.text, TH.bg);
-    tft.println(getVersion(true));
-    tft.println();
-    tft.setTextColor(TH.text_warn, TH.bg);
-    tft.print("Resetting Preferences");
+    spr.fillSprite(TH.bg);
+    drawBootMessage(getVersion(true), 0, TH.text);
+    drawBootMessage("Resetting Preferences", 2, TH.text_warn);
     while(digitalRead(ENCODER_PUSH_BUTTON) == LOW) delay(100);
   }
 
-  // Initialize flash file system
-  diskInit();
+  // Initialize flash file system on the other core
+  diskPhase = bootStart("disk");
+  diskDone  = xSemaphoreCreateBinary();
+  if(!diskDone || xTaskCreatePinnedToCore(diskInitTask, "disk", 8192, 0, 1, 0, 0)!=pdPASS)
+  {
+    diskInit();
+    bankInit();
+    bootEnd(diskPhase);
+    if(diskDone) xSemaphoreGive(diskDone);
+  }
+
+  // Let SI4732 power up
+  while(millis() - powerTime < 100) delay(1);
 
   // Check for SI4732 connected on I2C interface
   // If the SI4732 is not detected, then halt with no further processing
+  phase = bootStart("si4732");
   rx.setI2CFastModeCustom(800000UL);
 
   // Looks for the I2C bus address and set it.  Returns 0 if error
@@ -202,9 +241,8 @@ void setup()
   if(!si4735Addr)
   {
     ledcWrite(PIN_LCD_BL, 255);       // Default value 255 = 100%
-    tft.setTextSize(2);
-    tft.setTextColor(TH.text_warn, TH.bg);
-    tft.println("Si4732 not detected");
+    spr.fillSprite(TH.bg);
+    drawBootMessage("Si4732 not detected", 0, TH.text_warn);
     while(1);
   }
 
@@ -216,8 +254,10 @@ void setup()
 
   // Attached pin to allows SI4732 library to mute audio as required to minimise loud clicks
   rx.setAudioMuteMcuPin(AUDIO_MUTE);
+  bootEnd(phase);
 
   // If loading preferences fails...
+  phase = bootStart("settings");
   if(!prefsLoad(SAVE_SETTINGS|SAVE_VERIFY))
   {
     // Save default preferences
@@ -231,25 +271,52 @@ void setup()
     while(digitalRead(ENCODER_PUSH_BUTTON)==LOW) delay(100);
   }
 
+  bootEnd(phase);
+
   // If loading memories fails, save default memories
+  phase = bootStart("memories");
   if(!prefsLoad(SAVE_MEMORIES|SAVE_VERIFY)) prefsSave(SAVE_MEMORIES);
+  bootEnd(phase);
 
-  // If loading bands fails, save default bands
+  // If loading bands fails, bands start with their defaults, and
+  // each band loads from NVS when first used otherwise
+  phase = bootStart("bands");
   if(!prefsLoad(SAVE_BANDS|SAVE_VERIFY)) prefsSave(SAVE_BANDS);
+  bootEnd(phase);
+
+  // Station names may come from the file system
+  if(diskDone) xSemaphoreTake(diskDone, portMAX_DELAY);
+
+  // Last tuning may be newer than the saved bands
+  prefsLoadJournal();
 
   // Audio Amplifier Enable. G8PTN: Added
   // After the SI4732 has been setup, enable the audio amplifier
   digitalWrite(PIN_AMP_EN, HIGH);
 
   // SI4732 STARTUP!
+  phase = bootStart("band");
   selectBand(bandIdx, false);
   delay(50);
   rx.setVolume(volume);
   rx.setMaxSeekTime(SEEK_TIMEOUT);
+  bootEnd(phase);
+
+  // Start Bluetooth LE, if necessary, after the first audio
+  phase = bootStart("ble");
+  bleInit(bleModeIdx);
+  bootEnd(phase);
+
+  // Keep splash on screen for at least SPLASH_TIME
+  phase = bootStart("splash");
+  while(millis() - splashTime < SPLASH_TIME) delay(10);
+  bootEnd(phase);
 
   // Draw display for the first time
+  phase = bootStart("screen");
   drawScreen();
   ledcWrite(PIN_LCD_BL, currentBrt);
+  bootEnd(phase);
 
   // Interrupt actions for Rotary encoder
   // Note: Moved to end of setup to avoid inital interrupt actions
@@ -257,11 +324,13 @@ void setup()
   attachInterrupt(digitalPinToInterrupt(ENCODER_PIN_A), rotaryEncoder, CHANGE);
   attachInterrupt(digitalPinToInterrupt(ENCODER_PIN_B), rotaryEncoder, CHANGE);
 
-  // Connect WiFi, if necessary
+  // Connect WiFi, if necessary (reports status on the screen)
+  phase = bootStart("network");
   netInit(wifiModeIdx);
+  bootEnd(phase);
 
-  // Start Bluetooth LE, if necessary
-  bleInit(bleModeIdx);
+  // Report boot times
+  bootReport(&Serial);
 }
 
 
@@ -342,17 +411,22 @@ uint32_t consumeEncoderCounts()
 //
 void useBand(const Band *band)
 {
-  // Set current frequency and mode, reset BFO
+  // Set current frequency, mode, and BFO (SSB only)
   currentFrequency = band->currentFreq;
   currentMode = band->bandMode;
-  currentBFO = 0;
+  currentBFO = band->currentBFO;
+  if(!isSSB() && currentBFO)
+  {
+    currentFrequency += currentBFO / 1000;
+    currentBFO = 0;
+  }
 
   if(band->bandMode==FM)
   {
     // rx.setMaxDelaySetFrequency(60);
-    rx.setFM(band->minimumFreq, band->maximumFreq, band->currentFreq, getCurrentStep()->step);
+    rx.setFM(band->plan->minimumFreq, band->plan->maximumFreq, currentFrequency, getCurrentStep()->step);
     // rx.setTuneFrequencyAntennaCapacitor(0);
-    rx.setSeekFmLimits(band->minimumFreq, band->maximumFreq);
+    rx.setSeekFmLimits(band->plan->minimumFreq, band->plan->maximumFreq);
 
     // More sensitive seek thresholds
     // https://github.com/pu2clr/SI4735/issues/7#issuecomment-810963604
@@ -370,7 +444,7 @@ void useBand(const Band *band)
     // rx.setMaxDelaySetFrequency(80);
     if(band->bandMode==AM)
     {
-      rx.setAM(band->minimumFreq, band->maximumFreq, band->currentFreq, getCurrentStep()->step);
+      rx.setAM(band->plan->minimumFreq, band->plan->maximumFreq, currentFrequency, getCurrentStep()->step);
       // More sensitive seek thresholds
       // https://github.com/pu2clr/SI4735/issues/7#issuecomment-810963604
       rx.setSeekAmRssiThreshold(10); // default is 25
@@ -379,7 +453,7 @@ void useBand(const Band *band)
     else
     {
       // Configure SI4732 for SSB (SI4732 step not used, set to 0)
-      rx.setSSB(band->minimumFreq, band->maximumFreq, band->currentFreq, 0, currentMode);
+      rx.setSSB(band->plan->minimumFreq, band->plan->maximumFreq, currentFrequency, 0, currentMode);
       // G8PTN: Always enabled
       rx.setSSBAutomaticVolumeControl(1);
       // G8PTN: Commented out
@@ -394,14 +468,14 @@ void useBand(const Band *band)
     }
 
     // Set the tuning capacitor for SW or MW/LW
-    // rx.setTuneFrequencyAntennaCapacitor((band->bandType == MW_BAND_TYPE || band->bandType == LW_BAND_TYPE) ? 0 : 1);
+    // rx.setTuneFrequencyAntennaCapacitor((band->plan->bandType == MW_BAND_TYPE || band->plan->bandType == LW_BAND_TYPE) ? 0 : 1);
 
     // G8PTN: Enable GPIO1 as output
     rx.setGpioCtl(1, 0, 0);
     // G8PTN: Set GPIO1 = 1
     rx.setGpio(1, 0, 0);
     // Consider the range all defined current band
-    rx.setSeekAmLimits(band->minimumFreq, band->maximumFreq);
+    rx.setSeekAmLimits(band->plan->minimumFreq, band->plan->maximumFreq);
   }
 
   // Set step and spacing based on mode (FM, AM, SSB)
@@ -417,6 +491,9 @@ void useBand(const Band *band)
   // Clear signal strength readings
   rssi = 0;
   snr  = 0;
+  // Let remotes know about new band and mode
+  remoteEmit(TOPIC_FREQ);
+  remoteEmit(TOPIC_SIGNAL);
 }
 
 //
@@ -442,16 +519,16 @@ bool updateBFO(int newBFO, bool wrap)
 
   // Do not let new frequency exceed band limits
   int f = newFreq * 1000 + newBFO;
-  if(f < band->minimumFreq * 1000)
+  if(f < band->plan->minimumFreq * 1000)
   {
     if(!wrap) return false;
-    newFreq = band->maximumFreq;
+    newFreq = band->plan->maximumFreq;
     newBFO  = 0;
   }
-  else if(f > band->maximumFreq * 1000)
+  else if(f > band->plan->maximumFreq * 1000)
   {
     if(!wrap) return false;
-    newFreq = band->minimumFreq;
+    newFreq = band->plan->minimumFreq;
     newBFO  = 0;
   }
 
@@ -478,8 +555,10 @@ bool updateBFO(int newBFO, bool wrap)
   else
     rx.setSSBBfo(-currentBFO);  // No calibration if not USB/LSB
 
-  // Save current band frequency, w.r.t. new BFO value
-  band->currentFreq = currentFrequency + currentBFO / 1000;
+  // Save current band frequency and BFO
+  band->currentFreq = currentFrequency;
+  band->currentBFO  = currentBFO;
+  remoteEmit(TOPIC_FREQ);
   return true;
 }
 
@@ -491,13 +570,13 @@ bool updateFrequency(int newFreq, bool wrap)
   Band *band = getCurrentBand();
 
   // Do not let new frequency exceed band limits
-  if(newFreq < band->minimumFreq)
+  if(newFreq < band->plan->minimumFreq)
   {
-    if(!wrap) return false; else newFreq = band->maximumFreq;
+    if(!wrap) return false; else newFreq = band->plan->maximumFreq;
   }
-  else if(newFreq > band->maximumFreq)
+  else if(newFreq > band->plan->maximumFreq)
   {
-    if(!wrap) return false; else newFreq = band->minimumFreq;
+    if(!wrap) return false; else newFreq = band->plan->minimumFreq;
   }
 
   // Set new frequency
@@ -509,8 +588,10 @@ bool updateFrequency(int newFreq, bool wrap)
   // Update current frequency
   currentFrequency = rx.getFrequency();
 
-  // Save current band frequency
-  band->currentFreq = currentFrequency + currentBFO / 1000;
+  // Save current band frequency and BFO
+  band->currentFreq = currentFrequency;
+  band->currentBFO  = currentBFO;
+  remoteEmit(TOPIC_FREQ);
   return true;
 }
 
@@ -686,9 +767,25 @@ bool clickFreq(bool shortPress)
   return false;
 }
 
+//
+// Exponential moving average in 1/16 units, restarted from the new
+// sample if the shown value has been cleared elsewhere
+//
+static uint8_t signalAverage(uint16_t *avg, uint8_t shown, uint8_t sample)
+{
+  if(shown != ((*avg + 8) >> 4))
+    *avg = sample << 4;
+  else
+    *avg = *avg + (((sample << 4) - *avg) >> SIGNAL_AVG_SHIFT);
+
+  return((*avg + 8) >> 4);
+}
+
 bool processRssiSnr()
 {
-  static uint32_t updateCounter = 0;
+  static uint16_t rssiAvg = 0;
+  static uint16_t snrAvg = 0;
+  static uint32_t peakTime = 0;
   bool needRedraw = false;
 
   rx.getCurrentReceivedSignalQuality();
@@ -712,22 +809,38 @@ bool processRssiSnr()
     muteOn(MUTE_SQUELCH, false);
   }
 
-  // G8PTN: Based on 1.2s interval, update RSSI & SNR
-  if(!(updateCounter++ & 7))
+  // Peak follows the samples, held for a while, then decays
+  if(!rssi || newRSSI >= rssiPeak)
   {
-    // Show RSSI status only if this condition has changed
-    if(newRSSI != rssi)
-    {
-      rssi = newRSSI;
-      needRedraw = true;
-    }
-    // Show SNR status only if this condition has changed
-    if(newSNR != snr)
-    {
-      snr = newSNR;
-      needRedraw = true;
-    }
+    needRedraw |= newRSSI != rssiPeak;
+    rssiPeak = newRSSI;
+    peakTime = millis();
+  }
+  else if(millis() - peakTime > SIGNAL_PEAK_HOLD)
+  {
+    rssiPeak--;
+    needRedraw = true;
+  }
+
+  // Show averaged RSSI & SNR
+  uint8_t avgRSSI = signalAverage(&rssiAvg, rssi, newRSSI);
+  uint8_t avgSNR  = signalAverage(&snrAvg, snr, newSNR);
+
+  // Show RSSI status only if this condition has changed
+  if(avgRSSI != rssi)
+  {
+    rssi = avgRSSI;
+    needRedraw = true;
   }
+  // Show SNR status only if this condition has changed
+  if(avgSNR != snr)
+  {
+    snr = avgSNR;
+    needRedraw = true;
+  }
+  // Let remotes know about changes, they limit the rate themselves
+  if(needRedraw) remoteEmit(TOPIC_SIGNAL);
+
   return needRedraw;
 }
 
@@ -737,7 +850,8 @@ bool processRssiSnr()
 void loop()
 {
   uint32_t currentTime = millis();
-  bool needRedraw = false;
+  bool needRedraw = false;   // Screen must be redrawn as soon as possible
+  bool needRefresh = false;  // Screen may be redrawn a little later
 
   uint32_t encCounts = consumeEncoderCounts();
   int16_t encCount = (int16_t)(encCounts & 0xFFFF);
@@ -746,17 +860,23 @@ void loop()
   ButtonTracker::State pb1st = pb1.update(digitalRead(ENCODER_PUSH_BUTTON) == LOW);
 
   // Periodically print status to serial
-  remoteTickTime();
+  remoteTickTime(&Serial, &serialRemote);
 
   // Periodically print status to BLE
   bleTickTime();
 
+  // Send display changes to the remote mirror
+  mirrorTickTime();
+
+  // Send pending screen updates to the display
+  displayTickTime();
+
   // if(encCount && getCpuFrequencyMhz()!=240) setCpuFrequencyMhz(240);
 
   // Receive and execute serial command
-  if(Serial.available()>0)
+  int revent = remoteDoInput(&Serial, &serialRemote);
+  if(revent)
   {
-    int revent = remoteDoCommand(Serial.read());
     needRedraw |= !!(revent & REMOTE_CHANGED);
     pb1st.wasClicked |= !!(revent & REMOTE_CLICK);
     int direction = revent >> REMOTE_DIRECTION;
@@ -777,6 +897,18 @@ void loop()
     if(ble_event & REMOTE_PREFS) prefsRequestSave(SAVE_ALL);
   }
 
+  // Receive and execute WebSocket command
+  int net_event = netDoCommand();
+  if(net_event)
+  {
+    needRedraw |= !!(net_event & REMOTE_CHANGED);
+    pb1st.wasClicked |= !!(net_event & REMOTE_CLICK);
+    int direction = net_event >> REMOTE_DIRECTION;
+    encCount = direction? direction : encCount;
+    encCountAccel = direction? direction : encCountAccel;
+    if(net_event & REMOTE_PREFS) prefsRequestSave(SAVE_ALL);
+  }
+
   // Block encoder rotation when in the locked sleep mode
   if(encCount && sleepOn() && sleepModeIdx==SLEEP_LOCKED) encCount = encCountAccel = 0;
 
@@ -945,6 +1077,7 @@ void loop()
 
   if((currentTime - elapsedRSSI) > MIN_ELAPSED_RSSI_TIME)
   {
+    // Signal meters are redrawn partially, show changes right away
     needRedraw |= processRssiSnr();
     elapsedRSSI = currentTime;
   }
@@ -952,21 +1085,21 @@ void loop()
   // Periodically check received RDS information
   if((currentTime - lastRDSCheck) > RDS_CHECK_TIME)
   {
-    needRedraw |= (currentMode == FM) && (snr >= 12) && checkRds();
+    needRefresh |= (currentMode == FM) && (snr >= 12) && checkRds();
     lastRDSCheck = currentTime;
   }
 
   // Periodically check schedule
   if((currentTime - lastScheduleCheck) > SCHEDULE_CHECK_TIME)
   {
-    needRedraw |= identifyFrequency(currentFrequency + currentBFO / 1000, true);
+    needRefresh |= identifyFrequency(currentFrequency + currentBFO / 1000, true);
     lastScheduleCheck = currentTime;
   }
 
   // Periodically synchronize time via NTP
   if((currentTime - lastNTPCheck) > NTP_CHECK_TIME)
   {
-    needRedraw |= ntpSyncTime();
+    needRefresh |= ntpSyncTime();
     lastNTPCheck = currentTime;
   }
 
@@ -978,21 +1111,24 @@ void loop()
   netTickTime();
 
   // Run clock
-  needRedraw |= clockTickTime();
+  needRefresh |= clockTickTime();
 
   // Periodically refresh the main screen
   // This covers the case where there is nothing else triggering a refresh
-  if(needRedraw) background_timer = currentTime;
+  if(needRedraw || needRefresh) background_timer = currentTime;
   if((currentTime - background_timer) > BACKGROUND_REFRESH_TIME)
   {
-    if(currentCmd == CMD_NONE) needRedraw = true;
+    if(currentCmd == CMD_NONE) needRefresh = true;
     background_timer = currentTime;
   }
 
-  // Redraw screen if necessary
-  if(needRedraw) {
-    drawScreen();
-  }
+  // Request screen redraw if necessary, user input and frequency
+  // changes first, cosmetic changes may wait a little
+  if(needRedraw)  drawRequest(REDRAW_NOW);
+  if(needRefresh) drawRequest(REDRAW_LATER);
+
+  // Draw requested frames, limiting the frame rate
+  drawTickTime();
 
   // Yield to avoid watchdog issues and improve multitasking
   yield();
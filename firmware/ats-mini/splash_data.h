@@ -6,4542 +6,1497 @@
 const uint16_t SPLASH_WIDTH = 320;
 const uint16_t SPLASH_HEIGHT = 170;
 
-// RGB565 data with byte swap for TFT_eSPI
-const uint16_t splash_data[] PROGMEM = {
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0x1069, 0x1069, 0xF060, 0xF060,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF060, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0x1069, 0xF060, 0xF060, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF060, 0xF060, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF060, 0xF060, 0xF060, 0xF060, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF060, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0x1069, 0x1069, 0x1069, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0x1069, 0x1069, 0x1069, 0x1069, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF060,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF060, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0x1069, 0xF060, 0xF060, 0xF060,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF060, 0xF060, 0x1069, 0x1069, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF060, 0xF060, 0xF060, 0xF060, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF060, 0xF060,
-  0xF060, 0xF068, 0xF068, 0xF068, 0x1069, 0x1069, 0xF060, 0xF060, 0xF060, 0xF060, 0x1069, 0xF068,
-  0xF060, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF060, 0xF060, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF060, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF060, 0xF060, 0x1069, 0x1069, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068, 0xF068,
-  0xF068, 0xF068, 0xF068, 0xF068, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0x1069, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF068, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0x1061, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0x1061, 0xF171, 0xF171, 0xF171, 0xF171, 0xF171, 0xF171, 0xD171, 0x7069, 0xF060, 0xF060,
-  0x5069, 0xF171, 0xF171, 0xB171, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF171,
-  0xF171, 0xF171, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0x1061, 0xF171, 0xF171, 0xF171, 0xF171,
-  0xF171, 0xF171, 0xF171, 0xF171, 0xF171, 0xF171, 0x5069, 0xF060, 0xF060, 0xF060, 0x1061, 0xF171,
-  0xF171, 0xF171, 0x1061, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0x3069, 0xF171, 0xF171, 0xF171,
-  0xF171, 0xF171, 0xF171, 0xF171, 0xF171, 0xF060, 0xD171, 0xF171, 0xF171, 0xF171, 0xF171, 0xD171,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xD171, 0xF171, 0xF171, 0xF171, 0xF171,
-  0xF171, 0xF171, 0xF171, 0xF171, 0xD171, 0x7169, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0x7069, 0xD8BD, 0xD8BD,
-  0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0x17AD, 0x927A, 0x3069, 0x57B5, 0xD8BD, 0x98B5,
-  0x9169, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF382, 0xD8BD, 0xD8BD, 0xB493, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0x7069, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD,
-  0xD8BD, 0xD8BD, 0xD382, 0xF060, 0xF060, 0xF060, 0xD382, 0xD8BD, 0xD8BD, 0xD8BD, 0x927A, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0x9282, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD,
-  0xD8BD, 0xF060, 0x17AD, 0xD8BD, 0x17AD, 0xF6AC, 0xD8BD, 0xD8BD, 0x127A, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0x527A, 0xD8BD, 0xD8BD, 0x96A4, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD,
-  0xD8BD, 0xD8BD, 0x37AD, 0x338B, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0x7069, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD,
-  0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0x727A, 0x927A, 0xD8BD, 0xD8BD, 0x75A4, 0xF060, 0xF060, 0xF060,
-  0xF060, 0x5069, 0x77B5, 0xD8BD, 0x57B5, 0x3061, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0x7069,
-  0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD382, 0xF060,
-  0xF060, 0xF060, 0x96A4, 0xD8BD, 0xD8BD, 0xD8BD, 0x75A4, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0x548B, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xEF60, 0x17AD, 0xD8BD,
-  0x17AD, 0xF171, 0xB8BD, 0xD8BD, 0xF6AC, 0x1061, 0xF060, 0xF060, 0xF060, 0x1061, 0x17AD, 0xD8BD,
-  0x97B5, 0xF171, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD,
-  0xD493, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0x7069, 0xD8BD, 0xD8BD, 0xF493, 0x0F61, 0x0F61, 0x0F61, 0x4F61, 0x338B, 0xD8BD, 0xD8BD,
-  0xB6A4, 0xEF60, 0x759C, 0xD8BD, 0xD8BD, 0x727A, 0xF060, 0xF060, 0xF060, 0xF59B, 0xD8BD, 0xD8BD,
-  0x927A, 0xEF60, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0x7069, 0xD8BD, 0xD8BD, 0x559C, 0x1172,
-  0x1172, 0x1172, 0x1172, 0x1172, 0x1172, 0x1172, 0x5069, 0xF060, 0xF060, 0xB169, 0xD8BD, 0xD8BD,
-  0xB6A4, 0xD8BD, 0xB8BD, 0x7069, 0xF060, 0xF060, 0xF060, 0xF060, 0x159C, 0xD8BD, 0x16AD, 0x4F61,
-  0x5061, 0x5061, 0x5061, 0x5061, 0x5061, 0xEF60, 0x17AD, 0xD8BD, 0x17AD, 0xEF60, 0xD493, 0xD8BD,
-  0xD8BD, 0x138B, 0xF060, 0xF060, 0xF060, 0x548B, 0xD8BD, 0xD8BD, 0x338B, 0x7069, 0xD8BD, 0xD8BD,
-  0xF493, 0x0F61, 0xEF58, 0xEF58, 0x4F61, 0xB27A, 0x98B5, 0xD8BD, 0xD8BD, 0x9169, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0x7069, 0xD8BD, 0xD8BD,
-  0xD493, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF58, 0x16AD, 0xD8BD, 0x37AD, 0xEF60, 0x9069, 0x98B5,
-  0xD8BD, 0x37AD, 0x1061, 0xF060, 0xF171, 0xD8BD, 0xD8BD, 0x759C, 0xEF60, 0xEF60, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0x7069, 0xD8BD, 0xD8BD, 0xD493, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xF060, 0xF060, 0x748B, 0xD8BD, 0x97B5, 0x9069, 0xB8BD, 0xD8BD, 0x548B,
-  0xF060, 0xF060, 0xF060, 0xEF60, 0xF6AC, 0xD8BD, 0x359C, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0x17AD, 0xD8BD, 0x17AD, 0xEF60, 0x2F61, 0x57B5, 0xD8BD, 0x97B5, 0x7069, 0xF060,
-  0x7069, 0x98B5, 0xD8BD, 0xF6AC, 0xEF60, 0x7069, 0xD8BD, 0xD8BD, 0xD493, 0xEF60, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0x9493, 0xD8BD, 0xD8BD, 0x727A, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0x7069, 0xD8BD, 0xD8BD, 0xD493, 0xEF60, 0xF060, 0xF060,
-  0xF060, 0x1061, 0x57B5, 0xD8BD, 0x75A4, 0xEF60, 0xEF58, 0x3383, 0xD8BD, 0xD8BD, 0x748B, 0xF060,
-  0xB6A4, 0xD8BD, 0x98B5, 0x9069, 0xEF60, 0xD382, 0xB6A4, 0xB6A4, 0x927A, 0xF060, 0xF060, 0x7069,
-  0xD8BD, 0xD8BD, 0xD493, 0xEF60, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0x37AD, 0xD8BD, 0x159C, 0xEF58, 0x96A4, 0xD8BD, 0x37AD, 0xF060, 0xF060, 0xF060, 0xEF60,
-  0x98B5, 0xD8BD, 0x338B, 0x5069, 0x727A, 0x527A, 0x7069, 0xF060, 0xF060, 0xEF60, 0x17AD, 0xD8BD,
-  0x17AD, 0xEF60, 0xEF60, 0x927A, 0xD8BD, 0xD8BD, 0x159C, 0xF060, 0x359C, 0xD8BD, 0xD8BD, 0x1172,
-  0xEF60, 0x7069, 0xD8BD, 0xD8BD, 0xD493, 0xEF60, 0xF060, 0xF060, 0xF060, 0xEF60, 0x538B, 0xD8BD,
-  0xD8BD, 0x3172, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xEF60, 0xEF60, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xEF60,
-  0x4E71, 0xAC89, 0x0BA2, 0x2AAA, 0x69B2, 0x69BA, 0x88BA, 0x69BA, 0x49B2, 0x2AAA, 0xEB99, 0xAC89,
-  0x2E71, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0x7069, 0xD8BD, 0xD8BD, 0x759C, 0x527A, 0x527A, 0x527A, 0x927A, 0x559C, 0xD8BD, 0xB8B5,
-  0x1172, 0xEF60, 0xEF60, 0xEF58, 0xF6AC, 0xD8BD, 0xB8B5, 0x548B, 0xD8BD, 0xD8BD, 0x338B, 0xEF58,
-  0xF060, 0x548B, 0xD8BD, 0xD8BD, 0x1383, 0xF060, 0xF060, 0x7069, 0xD8BD, 0xD8BD, 0xB6A4, 0x1383,
-  0x1383, 0x1383, 0x1383, 0x1383, 0x1383, 0x527A, 0xF060, 0xF060, 0x527A, 0xD8BD, 0xD8BD, 0x527A,
-  0xEF58, 0xD282, 0xD8BD, 0xD8BD, 0x327A, 0xF060, 0xF060, 0x9069, 0xD8BD, 0xD8BD, 0x96A4, 0xB8B5,
-  0xD8BD, 0xD8BD, 0xD8BD, 0x559C, 0x5069, 0xEF60, 0x17AD, 0xD8BD, 0x17AD, 0xEF60, 0xEF60, 0xEF58,
-  0x559C, 0xD8BD, 0xD8BD, 0x338B, 0xD8BD, 0xD8BD, 0xD493, 0xEF58, 0xEF60, 0x7069, 0xD8BD, 0xD8BD,
-  0xD493, 0xEF60, 0xF060, 0xF060, 0xF060, 0x5061, 0x17AD, 0xD8BD, 0x57B5, 0x0F61, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xF060, 0xF060, 0xF060, 0xEF60, 0xEF60, 0x2E71, 0x64F3,
-  0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x64F3,
-  0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x06DB, 0xEF60, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0x0AA2, 0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x64F3,
-  0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x64F3,
-  0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x64F3,
-  0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x64F3, 0x64F3, 0xC7CA, 0xEF60, 0xEF60, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0x6D79, 0x4AAA, 0xE6DA, 0x84F3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x64F3, 0xE7D2, 0x2AAA,
-  0x4E79, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xF060, 0xF060,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xF060, 0xF060, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xF060, 0xF060, 0xF060, 0xF060, 0x7069, 0xD8BD, 0xD8BD,
-  0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0x1383, 0xCF58, 0xEF60, 0xEF60, 0xEF58,
-  0xF171, 0xB8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xF6AC, 0xEF58, 0xEF60, 0xF060, 0x548B, 0xD8BD, 0xD8BD,
-  0x1383, 0xEF60, 0xEF60, 0x7069, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD,
-  0xD8BD, 0x159C, 0xEF60, 0xEF60, 0x359C, 0xD8BD, 0x57B5, 0xEF60, 0xEF60, 0x3061, 0x98B5, 0xD8BD,
-  0x159C, 0xF060, 0xEF60, 0x527A, 0xD8BD, 0xD8BD, 0xD8BD, 0xF6AC, 0x559C, 0x37AD, 0xD8BD, 0xD8BD,
-  0xD6AC, 0x1061, 0x17AD, 0xD8BD, 0x17AD, 0xEF60, 0xF060, 0xEF60, 0x9069, 0x98B5, 0xD8BD, 0xD8BD,
-  0xD8BD, 0x57B5, 0x2F61, 0xEF60, 0xF060, 0x7069, 0xD8BD, 0xD8BD, 0x37AD, 0x559C, 0x559C, 0x559C,
-  0x76A4, 0x77B5, 0xD8BD, 0x57B5, 0xF171, 0xEF60, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060,
-  0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xF060, 0xEF60, 0xEF60, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF58, 0x2AA2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0x6D79, 0xEF58, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF58, 0x2AAA, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xE6D2, 0xEF58, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEB99, 0x25E3,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x06DB, 0xEB99, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0x7069, 0xD8BD, 0xD8BD, 0x77B5, 0x17AD, 0x17AD, 0x17AD,
-  0x37AD, 0xB8B5, 0xD8BD, 0xD8BD, 0x338B, 0xEF60, 0xEF60, 0xEF60, 0xCF58, 0xB493, 0xD8BD, 0xD8BD,
-  0xD8BD, 0x1172, 0xCF58, 0xEF60, 0xEF60, 0xCF58, 0xCE58, 0xCF58, 0xEF58, 0xEF60, 0xEF60, 0x5069,
-  0xD8BD, 0xD8BD, 0x97B5, 0x57AD, 0x57AD, 0x57AD, 0x57AD, 0x57AD, 0x57AD, 0xB493, 0xEF58, 0x3061,
-  0xB8B5, 0xD8BD, 0xB493, 0xEF58, 0xEF60, 0xEF58, 0x1594, 0xD8BD, 0xB8B5, 0x3061, 0xEF60, 0x1383,
-  0xD8BD, 0xD8BD, 0xD282, 0xCF58, 0xCF58, 0xEF58, 0xF493, 0xD8BD, 0xD8BD, 0xB282, 0x17AD, 0xD8BD,
-  0x17AD, 0xEF60, 0xEF60, 0xEF60, 0xEF58, 0x3383, 0xD8BD, 0xD8BD, 0xD8BD, 0xB27A, 0xCF58, 0xEF60,
-  0xEF60, 0x5069, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xB493,
-  0x0F61, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xF060, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60,
-  0xEF58, 0xEF58, 0x06DB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x49B2, 0xEF58, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xEF58, 0xEF58, 0x2AAA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xE6D2,
-  0xEF58, 0xEF58, 0xEF60, 0xEF60, 0x8C81, 0x25E3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x45EB, 0xCC91, 0xEF60, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60,
-  0xEF60, 0x5069, 0xD8BD, 0xD8BD, 0xD493, 0xCF58, 0xCF58, 0xCF58, 0xCE58, 0x2F61, 0x96A4, 0xD8BD,
-  0xD8BD, 0xB169, 0xEF60, 0xEF60, 0xEF58, 0x2F61, 0xD8BD, 0xD8BD, 0x75A4, 0xCF58, 0xEF60, 0xEF60,
-  0xEF60, 0xEF58, 0xCF58, 0xCF58, 0xEF58, 0xEF60, 0xEF60, 0x5069, 0xD8BD, 0xD8BD, 0xD493, 0xCE58,
-  0xCE58, 0xCE58, 0xCE58, 0xCE58, 0xCE58, 0xCF58, 0xEF58, 0xF382, 0xD8BD, 0xD8BD, 0xD493, 0xF382,
-  0xF382, 0xF382, 0xF593, 0xD8BD, 0xD8BD, 0xF382, 0xEF60, 0x0F61, 0x2F61, 0x2F61, 0xCF58, 0xCF58,
-  0xEF58, 0xCF58, 0x0F61, 0xB8B5, 0xD8BD, 0x159C, 0x17AD, 0xD8BD, 0x17AD, 0xEF58, 0xEF60, 0xEF60,
-  0xEF58, 0xEF58, 0x77B5, 0xD8BD, 0x17AD, 0xCF58, 0xEF58, 0xEF60, 0xEF60, 0x5069, 0xD8BD, 0xD8BD,
-  0xB6A4, 0x1383, 0x1383, 0x1383, 0x3383, 0xD6A4, 0xD8BD, 0xD8BD, 0xD593, 0xEF60, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF60, 0xEF60, 0xF060,
-  0xEF60, 0xEF60, 0xEF60, 0xCF58, 0xEF60, 0xEF60, 0xCF58, 0xCF58, 0xCF58, 0x2E71, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x45EB, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xEF58, 0x2AAA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xE6D2, 0xCF58, 0xCF58, 0xCF58, 0x2AAA,
-  0xA4FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA7CA, 0x0F69, 0xCF58, 0xEF60, 0xEF60, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xCF58, 0xCF58, 0xEF60, 0xEF60, 0xEF60, 0xCF58, 0xCF58,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xF060, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60,
-  0xCF58, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0x5069, 0xD8BD, 0xD8BD,
-  0xD493, 0xCF58, 0xEF58, 0xEF58, 0xEF58, 0xCF58, 0x927A, 0xD8BD, 0xD8BD, 0xF382, 0xEF60, 0xEF60,
-  0xEF60, 0xEF58, 0xD8BD, 0xD8BD, 0x359C, 0xEF58, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0x5069, 0xD8BD, 0xD8BD, 0xD493, 0xCF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58,
-  0xEF58, 0xEF58, 0xEF58, 0xD6A4, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD,
-  0xD8BD, 0xD6AC, 0xEF58, 0x1061, 0x1061, 0x1061, 0xEF58, 0xEF60, 0xEF60, 0xEF60, 0xCF58, 0x57B5,
-  0xD8BD, 0x759C, 0x17AD, 0xD8BD, 0x17AD, 0xEF58, 0xEF60, 0xEF60, 0xEF60, 0xCF58, 0x57AD, 0xD8BD,
-  0xD6A4, 0xCF58, 0xEF60, 0xEF60, 0xEF60, 0x5069, 0xD8BD, 0xD8BD, 0xD493, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0x0F59, 0x57AD, 0xD8BD, 0x77B5, 0xEF58, 0xEF60, 0xEF60, 0xEF60, 0xEF58, 0xEF58, 0xEF60,
-  0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xCF58, 0xCF58, 0xCF58, 0xD058,
-  0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xCF58, 0xD058, 0xD058, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0x2AAA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0x6D79, 0xCF58, 0xEF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0x29A2, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xE6D2, 0xCF58, 0xCF58, 0x2AAA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0x25E3, 0x2E71, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xCF58, 0xD058, 0xD058,
-  0xCF58, 0xCF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xD058, 0xF058,
-  0xCF58, 0xCF58, 0xCF58, 0xEF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xD058, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xEF58, 0xCF58, 0xEF60, 0xEF60,
-  0xD058, 0xCF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xF058, 0xF058, 0xEF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xEF60, 0xEF60, 0xEF60, 0xEF60, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58,
-  0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xF058, 0xCF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58,
-  0xCF58, 0xEF58, 0xEF58, 0xEF58, 0xCF58, 0x5061, 0xD8BD, 0xD8BD, 0xD493, 0xCF58, 0xEF58, 0xEF58,
-  0xEF58, 0xEF58, 0x1383, 0xD8BD, 0xD8BD, 0x1383, 0xCF58, 0xEF58, 0xF058, 0xEF60, 0xD8BD, 0xD8BD,
-  0x359C, 0xEF58, 0xCF58, 0xCF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xCF58, 0xCF58, 0xEF58, 0x5061,
-  0xD8BD, 0xD8BD, 0xD493, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xF058, 0xCF58, 0xEF58, 0xD171, 0xD8BD,
-  0xD8BD, 0x77B5, 0x37AD, 0x37AD, 0x37AD, 0x37AD, 0x37AD, 0x77B5, 0xD8BD, 0xD8BD, 0xD171, 0x76A4,
-  0xD8BD, 0x77B5, 0xF060, 0xEF58, 0xEF58, 0xEF58, 0x7069, 0xD8BD, 0xD8BD, 0xD493, 0x17AD, 0xD8BD,
-  0x17AD, 0xCF58, 0xCF58, 0xCF58, 0xEF58, 0xEF58, 0x57AD, 0xD8BD, 0xD6A4, 0xEF58, 0xEF58, 0xEF58,
-  0xEF58, 0x5061, 0xD8BD, 0xD8BD, 0xD493, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xCF58, 0x359C, 0xD8BD,
-  0xD8BD, 0x1061, 0xEF58, 0xF060, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xF058, 0xEF58, 0xEF58,
-  0xCF58, 0xCF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xF058, 0xEF58, 0xEF58, 0xEF58, 0xEF58,
-  0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xEF58, 0xEF58,
-  0xEF58, 0x06DB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x49B2, 0xEF58,
-  0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xCF58, 0x29A2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xE6D2,
-  0xCF58, 0xAC89, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x45EB,
-  0x2E69, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xF058, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58,
-  0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58,
-  0xEF58, 0xEF58, 0xEF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xEF58, 0xEF58, 0xF058, 0xEF58,
-  0xEF58, 0xEF58, 0xF058, 0xEF58, 0xEF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xEF58, 0xEF58,
-  0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58,
-  0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58,
-  0xEF58, 0x5061, 0xD8BD, 0xD8BD, 0x559C, 0x1172, 0x1272, 0x1272, 0x3272, 0x1383, 0x97B5, 0xD8BD,
-  0xD8BD, 0xD169, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xD8BD, 0xD8BD, 0x359C, 0xEF58, 0xEF58, 0xEF58,
-  0xEF58, 0xD382, 0xD6A4, 0xD6A4, 0x927A, 0xEF58, 0xEF58, 0x5061, 0xD8BD, 0xD8BD, 0xB6A4, 0xF382,
-  0xF382, 0xF382, 0xF382, 0xF382, 0xF382, 0xF382, 0x359C, 0xD8BD, 0xD8BD, 0x9061, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCE58, 0xD069, 0xD8BD, 0xD8BD, 0xD493, 0xF382, 0xD8BD, 0xD8BD, 0x159C, 0x3061,
-  0xEF58, 0x7061, 0x96A4, 0xD8BD, 0xD8BD, 0x5172, 0x17AD, 0xD8BD, 0x17AD, 0xEF58, 0xEF58, 0xEF58,
-  0xEF58, 0xEF58, 0x57AD, 0xD8BD, 0xD6A4, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0x5061, 0xD8BD, 0xD8BD,
-  0xD493, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xD493, 0xD8BD, 0xD8BD, 0x7061, 0xCF58, 0xD058,
-  0xCF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xF058, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58,
-  0xF058, 0xF058, 0xEF58, 0xEF58, 0xEF58, 0xF058, 0xF058, 0xF058, 0xF058, 0xEF58, 0xEF58, 0xEF58,
-  0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0x4D71, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x45EB, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58,
-  0xCF58, 0x2AA2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xE6D2, 0xEF58, 0x45EB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x06DB, 0xEF60, 0xEF58, 0xEF58,
-  0xEF58, 0xEF58, 0xF058, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58,
-  0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58,
-  0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xF058, 0xEF58, 0xEF58, 0xEF58, 0xF058, 0xF058,
-  0xF058, 0xF058, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58,
-  0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xF058, 0xF058,
-  0xF058, 0xF058, 0xF058, 0xF058, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58,
-  0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0x5061, 0xD8BD, 0xD8BD,
-  0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD493, 0xCF58, 0xEF58, 0xEF58,
-  0xEF58, 0xEF58, 0xD8BD, 0xD8BD, 0x359C, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0x538B, 0xD8BD, 0xD8BD,
-  0x1383, 0xEF58, 0xEF58, 0x5061, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD,
-  0xD8BD, 0xD8BD, 0xB8B5, 0xD8BD, 0xD6A4, 0xCF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xCF58,
-  0x16AD, 0xD8BD, 0x77B5, 0x2F61, 0xB6A4, 0xD8BD, 0xD8BD, 0xB8B5, 0x57B5, 0xD8BD, 0xD8BD, 0xD8BD,
-  0x359C, 0xCF58, 0x17AD, 0xD8BD, 0x17AD, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0x57AD, 0xD8BD,
-  0xD6A4, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0x5061, 0xD8BD, 0xD8BD, 0xD493, 0xEF58, 0xEF58, 0xEF58,
-  0xEF58, 0xEF58, 0x948B, 0xD8BD, 0xD8BD, 0xD169, 0xCF58, 0xF058, 0xF058, 0xEF58, 0xEF58, 0xEF58,
-  0xEF58, 0xF058, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xF058, 0xF058, 0xEF58, 0xEF58,
-  0xEF58, 0xF058, 0xF058, 0xF058, 0xF058, 0xD058, 0xEF58, 0xEF58, 0xF058, 0xCF58, 0xEF58, 0xEF58,
-  0xEF58, 0xEF58, 0xEF58, 0xEF58, 0x2AAA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0x6D81, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xCF58, 0x2AA2, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xE6D2, 0xCB91, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x2AAA, 0xEF58, 0xF058, 0xF058, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xEF58, 0xF058, 0xF058, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xF058, 0xF058, 0xF058, 0xF058,
-  0xEF58, 0xEF58, 0xF058, 0xEF58, 0xCF58, 0xEF58, 0xF058, 0xF058, 0xCF58, 0xEF58, 0xEF58, 0xEF58,
-  0xEF58, 0xF058, 0xF058, 0xF058, 0xF058, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58,
-  0xEF58, 0xEF58, 0xEF58, 0xF058, 0xEF58, 0xEF58, 0xF058, 0xF058, 0xF058, 0xF058, 0xF058, 0xF058,
-  0xEF58, 0xEF58, 0xEF58, 0xF058, 0xEF58, 0xEF58, 0xEF58, 0xCF58, 0xCF58, 0xEF58, 0xEF58, 0xEF58,
-  0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0x5061, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD,
-  0xD8BD, 0x77B5, 0x96A4, 0xB27A, 0xCF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xD8BD, 0xD8BD,
-  0x359C, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0x538B, 0xD8BD, 0xD8BD, 0x1383, 0xEF58, 0xEF58, 0x5061,
-  0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD, 0xD8BD,
-  0x1383, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xF058, 0xCF58, 0x538B, 0xD8BD, 0xD8BD, 0xB27A,
-  0x0F59, 0xD493, 0xB8B5, 0xD8BD, 0xD8BD, 0xD8BD, 0x97B5, 0x538B, 0xEF58, 0xEF58, 0x17AD, 0xD8BD,
-  0x17AD, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0x57AD, 0xD8BD, 0xD6A4, 0xEF58, 0xEF58, 0xEF58,
-  0xF058, 0x5061, 0xD8BD, 0xD8BD, 0xD493, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xEF58, 0xB27A, 0xD8BD,
-  0xD8BD, 0xD382, 0xEF58, 0xF058, 0xF058, 0xF058, 0xEF58, 0xEF58, 0xEF58, 0xF058, 0xEF58, 0xEF58,
-  0xEF58, 0xEF58, 0xEF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xEF58, 0xCF58, 0xCF58,
-  0x25E3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x69B2,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0x2AA2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xE6D2,
-  0xC7CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x84FB, 0x84F3, 0x84FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0x84FB, 0x2E69, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xEF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xEF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xEF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xEF58, 0xCF58, 0xCE58, 0xCE50, 0xCE50, 0xCE50, 0xCE50, 0xCE50, 0xCE50, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xEF58, 0xCF58, 0xCF58, 0xCF58, 0xCE58, 0xCE50, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCE50, 0xCE50, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCE58, 0xCE50, 0xCE50, 0xCE50,
-  0xCE50, 0xCE50, 0xCE50, 0xCE50, 0xCE50, 0xCE50, 0xCE50, 0xCE50, 0xCF58, 0xEF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCE58, 0xCE58, 0xCF58, 0xCF58, 0xCF58, 0x0F59, 0x1172,
-  0x5172, 0xF069, 0xEF58, 0xCF58, 0xCF58, 0xCF58, 0xCE58, 0xCE50, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCE58, 0xCE50, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCE58, 0xCE50,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCE50, 0xCE50, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0x4D71, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x06DB, 0x88BA, 0x88BA, 0x45EB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x45EB, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xAC89, 0x88BA, 0x88BA, 0x88BA, 0x88BA, 0x88BA, 0x88BA, 0x88BA, 0x88BA, 0x88BA, 0x88BA,
-  0x88BA, 0x88BA, 0x88BA, 0x88BA, 0x88BA, 0x64F3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA7C2, 0x88BA, 0x88BA, 0x88BA, 0x88BA, 0x88BA, 0x88BA, 0x88BA,
-  0x88BA, 0x88BA, 0x88BA, 0x88BA, 0x88BA, 0x88BA, 0x88BA, 0x09A2, 0x64F3, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x64F3, 0x68B2, 0xAB89, 0x2D69,
-  0xCE58, 0xCE50, 0xCE50, 0xCE50, 0xCE58, 0x0D69, 0x8B81, 0x29A2, 0x06DB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x69B2, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0x29AA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0x6C79, 0xCE50, 0xCE50, 0x29AA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x8C81, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF50,
-  0xCE50, 0xCE50, 0xCE50, 0xCE50, 0xCE50, 0xCE50, 0xCE50, 0xCE50, 0xCE50, 0xCE50, 0xCE50, 0xCE50,
-  0xCE50, 0x06DB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x0D69, 0xCE50, 0xCE50, 0xCE50, 0xCE50, 0xCE50, 0xCE50, 0xCE50, 0xCE50, 0xCE50, 0xCE50, 0xCE50,
-  0xCE50, 0xCE50, 0xCF50, 0x0E61, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA7C2, 0xEE58, 0xCE50, 0xCE50, 0xCE50, 0xCF50, 0xCF58, 0xCF58, 0xCF50,
-  0xCF50, 0xCE50, 0xCE50, 0xCE50, 0xCE50, 0x6C79, 0x06DB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x64F3, 0xEF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0x25E3,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x45EB, 0xCE50, 0xCE50,
-  0xCE50, 0x2D71, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x68BA, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCE50, 0xCE50, 0x06DB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x0D69, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCE50, 0xCE50, 0xCE50, 0xCF50, 0x2D71,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x64F3, 0xCE58,
-  0xCE50, 0xCF50, 0xCF50, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF50, 0xCF50,
-  0xCF50, 0xCE50, 0xCE58, 0xC7CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0x8C89, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0x4D71, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x68B2, 0xCF50, 0xCF50, 0xCF50, 0xCE50, 0x25E3, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x64EB, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF50, 0xCE50, 0x06DB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x0D69, 0xCF50, 0xCF50, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF50, 0x2D71, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xE6D2, 0xCE50, 0xCF50, 0xCF50, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF50, 0xCF50, 0xCE50, 0xEE60,
-  0x45EB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x49AA,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0x29AA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0x6C79, 0xCF50, 0xCF58, 0xCF58, 0xCF50, 0x29AA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x8C81, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF50, 0x06DB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x0D69, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0x0E61, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0x45EB, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF50, 0xCE50, 0x29A2, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xC7CA, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0x25E3, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x45EB, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0x4D71, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0x68BA, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0x06DB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x0D69, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0x64F3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x48B2,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF50, 0x4D71, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0x25E3, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0x4D71, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x68B2, 0xCF50, 0xCF58, 0xCF58, 0xCF58, 0xCF50, 0xCF50, 0x25E3,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x64F3, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF50, 0x06DB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x0D69, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF50, 0xC6D2, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x06DB, 0x8C81, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF50,
-  0xEE58, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x45EB,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0x49AA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x6C81, 0xCF50, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF50, 0x29AA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x8C81, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF50, 0x06DB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x0D69, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF50, 0xEA99, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x06E3, 0xEA99, 0xEE60, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF50, 0xCF50, 0xEA99, 0xEA99, 0xEA99,
-  0xEA99, 0xEA99, 0xEA99, 0xEA99, 0xEA99, 0xEA99, 0xEA99, 0xCA91, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF50, 0xCF50, 0xCF58, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0x25E3, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x64EB, 0xCE50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0x4C71, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0x88BA, 0xCF50, 0xCF50, 0xCF58, 0xCF50, 0xCF50, 0xCF58, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF58, 0xCF50, 0xCF50, 0xCF58, 0xCF50, 0xCF50, 0x06DB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x0D69, 0xCF50, 0xCF50, 0xCF50,
-  0xCF58, 0xCF50, 0xCF50, 0xCF58, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF58, 0xCF50, 0xCF50,
-  0xEE58, 0x64F3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x84FB, 0xA7CA, 0xAB89, 0xEF58, 0xCF50, 0xCF58, 0xCF50, 0xCF50,
-  0xCF58, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCE50, 0xCE50, 0xCE50, 0xCE50, 0xCE50, 0xCE50, 0xCE50,
-  0xCE50, 0xCE50, 0xCE50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF50, 0xCF50, 0xCF58, 0xCF50, 0xCF50, 0xCF58, 0xCF50, 0xCF50, 0xCF58, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF58, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF50, 0xCF50, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF50, 0xCF50,
-  0xCF50, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF50, 0xCF50, 0xCF58, 0xCF58, 0xCF50,
-  0xCF58, 0xCF50, 0xCF58, 0xCF58, 0xCF58, 0xCF50, 0xCF58, 0xCF58, 0xCF58, 0xCF50, 0xCF50, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF50, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF50, 0xCF50, 0xCF50, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF50, 0xCF50, 0xCF50, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF50, 0xCF50, 0xCF58, 0xCF50,
-  0xCF50, 0xCF50, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF50, 0xCF50,
-  0xCF50, 0xCF58, 0xCF58, 0xCF58, 0xCF50, 0xCF50, 0xCF50, 0xCF58, 0xCF58, 0xCF58, 0xCF58, 0xCF58,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0x4D71, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0x68B2, 0xCE50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCE50,
-  0x25E3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x64F3, 0xCF58,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0x06DB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x0D69, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCE50, 0xCA91, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0x84F3, 0xA7C2, 0xAB89, 0xEF58, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCE50, 0xCE50, 0xCE50, 0xCE50, 0xCE50, 0xCE50, 0xCE50, 0xCE50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF58, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0x49AA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x8B79,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCE50, 0x49AA, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x8B81, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0x06DB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x0D69, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCE50, 0x87BA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0x84F3, 0xA8C2, 0xAC89, 0xCF58, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0x45EB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x64F3, 0xCE50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0x4C71, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0x88BA, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0x06DB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x0D69, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCE50, 0xCE50, 0xA7C2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0x64F3, 0x68BA, 0x4D79, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0x4C71, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0x68BA, 0xAE50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xAF50,
-  0xAE50, 0x45E3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x64F3,
-  0xCE58, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xAE50, 0x06DB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x0D61, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xAE50, 0xAE50, 0xCE50,
-  0x28AA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x06DB, 0xEA91, 0xCE58, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0x49B2,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x8B81, 0xCE50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCE50, 0x48AA, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xAB89, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCE50, 0x06DB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x0D61, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCE50, 0xCE50, 0xAE50, 0x6C71, 0x06DB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x64F3, 0x29A2,
-  0xEE58, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0x45EB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x64F3, 0xCE50, 0xAE50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCE50, 0x4C71, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA7C2, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xAE50, 0x06DB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x0D61, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCE50, 0xCE50, 0xAE50, 0xCE50, 0xCA91, 0x45EB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x64F3, 0x29A2, 0xEE58, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0x6C79, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0x88BA, 0xAE50, 0xAE50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCE50, 0x45EB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x84F3, 0xCE58, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xAE50, 0x06DB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x0D61, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xAE50,
-  0xAE50, 0xAE50, 0xAE48, 0xAE48, 0xAE50, 0xAA89, 0x06DB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x45EB, 0x8B81, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0x48B2, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x8B81, 0xAE50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xAE50, 0xAE50, 0x48AA, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xAB89, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xAE50, 0x06DB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x0D61, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xAF50, 0xAE50, 0xAE50, 0xAE50,
-  0xAE48, 0xAE48, 0xAE48, 0x4C71, 0x48B2, 0x64F3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x68B2, 0xCE58, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xAF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xCF50, 0xCF50,
-  0xAF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0x45EB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x29A2, 0x29A2, 0x29A2, 0x29A2, 0x29A2, 0x29A2, 0x29A2,
-  0x29A2, 0x29A2, 0x29A2, 0x29A2, 0x29A2, 0x29A2, 0x87BA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA7C2, 0xCF50, 0xCF50, 0xCF50, 0xAF50, 0xAF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xAE50, 0x06DB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x0D61, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xAE50, 0xAE50, 0xAE50, 0xAE50, 0xAE48, 0xAE48,
-  0xAE48, 0xCE50, 0x8B81, 0x87BA, 0x84F3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xE6D2, 0xEE58, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xAF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50,
-  0xAF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0x6C79, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0x84F3, 0xCE50, 0xAF50, 0xAF50, 0xAF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCE50, 0xAE48, 0x06D3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x0D61, 0xCE50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xAF50, 0xCF50, 0xAE50, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xCD50, 0xAA81, 0xA7C2, 0x84F3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x06DB, 0xEE58,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xAF50,
-  0xAF50, 0xCF50, 0xCF50, 0xCF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xAF50, 0xAF50,
-  0xAF50, 0xAF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xAF50, 0xAF50, 0xAF50,
-  0xAF50, 0xAF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50,
-  0xAF50, 0xAF50, 0xAF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xAF50, 0xAF50, 0xAF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xCF50, 0xCF50, 0xCF50, 0xAF50, 0xAF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50,
-  0xAF50, 0xAF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xAF50, 0xAF50, 0xAF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCE50, 0x68B2, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xAB89, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCE50,
-  0xAE48, 0x06D3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x0D61, 0xCE50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCE50, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xCD50,
-  0xAA81, 0xA7C2, 0x84FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xC7CA, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xAF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xAF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xAF50, 0xAF50, 0xAF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCE50, 0x45EB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA7C2, 0xCE50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCE50, 0xAE48, 0x06D3, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x0D61, 0xCE50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0x2D69, 0x29A2, 0x29A2,
-  0x29A2, 0x29A2, 0x29A2, 0x29A2, 0x29A2, 0x29A2, 0x29A2, 0x29A2, 0x8B81, 0xCF50, 0xCF50, 0xCE50,
-  0xCE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xCD50, 0xCA89,
-  0xC6CA, 0xA4FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xCA91, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xAF50,
-  0xCF50, 0xCF50, 0xCF50, 0xAF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xAF50, 0xAF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAE48,
-  0x6C79, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0x84FB, 0xCE58, 0xAE50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50,
-  0xAF50, 0xAF50, 0xAE50, 0xAE48, 0xAE48, 0x06D3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x0D61, 0xAE48, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50,
-  0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAB81, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x88BA, 0xAE50, 0xAF50, 0xAF50, 0xAE50, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0x0C61, 0x48AA, 0x64F3,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x45EB, 0xCE50, 0xAE50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50,
-  0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50,
-  0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50,
-  0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50,
-  0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50,
-  0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50,
-  0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50,
-  0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50,
-  0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50,
-  0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50,
-  0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50,
-  0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50,
-  0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50,
-  0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50,
-  0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xCF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50,
-  0xAF50, 0xCF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF48, 0xAF48, 0xAF48, 0xAF48,
-  0xAF48, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF48, 0xAE48, 0xAE48, 0x68B2, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xCA89,
-  0xAE48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAE48, 0xAE48,
-  0xAE48, 0x06D3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x0D61, 0xAE48, 0xAE48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF50, 0xAF50, 0xAF50,
-  0xAE48, 0x8B79, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA7C2, 0xAE48, 0xAE50, 0xAF50, 0xAF50, 0xAF50, 0xAE50, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xED50, 0x48AA, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xAB89, 0xAE48, 0xAF50,
-  0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50,
-  0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50,
-  0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50,
-  0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50,
-  0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48,
-  0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50,
-  0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50,
-  0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50,
-  0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50,
-  0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50,
-  0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF48, 0xAF50,
-  0xAF50, 0xAF50, 0xAF48, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50,
-  0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50,
-  0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50,
-  0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAF50,
-  0xAF50, 0xAF50, 0xAF50, 0xAF50, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0x64EB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xC7CA, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAF48, 0xAF48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xE6D2, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x0D61, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0x2C69, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x25E3, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAF48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0x8B79, 0x84FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x88BA, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAE48,
-  0xAE48, 0xAE48, 0xAF48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAF48, 0xAF48, 0xAF48, 0xAF48,
-  0xAF48, 0xAE48, 0xAE48, 0xAE48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48,
-  0xAE48, 0xAE48, 0xAF48, 0xAE48, 0xAE48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48,
-  0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48,
-  0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48,
-  0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48,
-  0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48,
-  0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF50, 0xAF50, 0xAF48, 0xAF48,
-  0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48,
-  0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48,
-  0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48,
-  0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48, 0xAF48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0x6B79,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0x84FB, 0xCE50, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xE6D2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x0D61, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xCD50, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xED58, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xE991, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0x06DB, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0x1041, 0xB431, 0x7722, 0xF91A, 0x5B13, 0x9D0B, 0xDE03,
-  0xFE03, 0x1F04, 0xFE03, 0xDE03, 0x9C0B, 0x3B13, 0xF91A, 0x562A, 0xB339, 0xEF48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0x68B2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xCA89, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xE6D2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x0D61, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0x44EB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0x29A2, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xCD50, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x45EB, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0x5141, 0x9822,
-  0x9C0B, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x5C13, 0x7722, 0x1041, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0x64F3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xC6CA, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xE6D2, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x0D61, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xA7C2, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x84F3, 0xED58, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xCD50, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x45EB, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0x7239, 0x1A13, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xD91A, 0x3141, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0x6B79, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA7C2, 0xCD48, 0xCD48,
-  0xCD48, 0xCD48, 0xCD48, 0xCD48, 0xCD48, 0xCD48, 0xCD48, 0xCD48, 0xCD48, 0xCD48, 0xCD48, 0xCD48,
-  0xCD48, 0xCD48, 0xCD48, 0xCD48, 0xCD48, 0xCD48, 0x45E3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x84FB, 0xCD58, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xE6D2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xED58, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xE991, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x25E3, 0xED58, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xCA89, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0x05DB, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0x1041, 0xFA1A,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0xB822, 0xCF48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0x68B2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xAA81, 0xAD40, 0xAD40, 0xAD48, 0xAD48, 0xAD48, 0xAD48,
-  0xAD48, 0xAD48, 0xAD48, 0xAD48, 0xAD48, 0xAD48, 0xAD48, 0xAD48, 0xAD48, 0xAD48, 0xAD48, 0xAD40,
-  0xAD40, 0xAD40, 0x48AA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xCA91, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xE6D2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x0D59, 0xAE48, 0xAE48, 0xAE48, 0xAF48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xED58, 0x84FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0x64EB, 0xEA91, 0xCE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0x8B81, 0x84F3, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA7C2, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAF48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0x9239, 0xDE03, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x3F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x9C0B, 0x3141, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0x64F3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x84FB, 0xCD48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE40, 0xAD40, 0x4B69, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xC6CA, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xE6D2, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xED58, 0xAE48, 0xAE48, 0xAE48,
-  0xAF48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xA7C2,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0x64EB, 0x87BA, 0xCA89, 0x2C69, 0xCE50, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xCD50, 0x4C71, 0xE999, 0x06DB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xE999, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAF48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xD431, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x9FA6, 0x7F1C, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xDE03, 0x7239, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAF48, 0xAF48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0x8B79, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA7C2, 0xAD40, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAD40, 0x45EB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x84FB, 0xED58, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xE6D2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xED58, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0x4B69, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0x84F3, 0x45EB, 0x45E3, 0x25E3, 0x45E3, 0x44EB, 0x84F3, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0x0C61, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xD431, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x3FCF,
-  0x5FD7, 0x7F1C, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xDE03, 0x5239, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0x87BA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xAA81, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0x48AA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xCA91, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xE6D2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xED58, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE40, 0x87BA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xC6CA, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0x5139, 0xFF03, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x3FCF, 0xFFFF, 0x5FD7, 0x7F1C, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0xBD03, 0xF040, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0x64F3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x84FB,
-  0xCD50, 0x8E48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0x8E40, 0x4B69,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xE6D2, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE40, 0xE6D2, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xED58, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0x8E48,
-  0xCD50, 0x25E3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x4B69, 0x8E48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xCF40, 0x9D0B, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x3FCF, 0xFFFF, 0xFFFF, 0x5FD7, 0x7F14, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1A13, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0x8B79, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA7C2, 0x8E40, 0x8E40, 0xAE40, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE40, 0x8E40, 0x8E40, 0x45EB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x84FB, 0xED50, 0xAE40, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE40, 0x8E40, 0xE6D2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xED58, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0x8E40, 0x8E40, 0x2C61, 0x64F3, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x28A2,
-  0x8E40, 0x8E40, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0x981A, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x3FCF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0x5FD7, 0x7F14, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xF429, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x87BA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xAA81, 0x8E40, 0xAE40, 0xAE40, 0xAE48, 0xAE48, 0xAE48, 0xAE40, 0xAE40,
-  0xAE40, 0xAE40, 0xAE40, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0x8E40, 0x8E40, 0x8E40, 0xAE48, 0xAE48,
-  0xAE48, 0xAE40, 0xAE40, 0x8E40, 0x48AA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xEA91, 0xAE40, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0x8E40, 0xAE48, 0xAE40,
-  0x8E40, 0xE6D2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xED58, 0xAE40, 0xAE40, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0x8E40, 0x8E40, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE40, 0xAE40, 0x8E40, 0x8E40, 0x2C61, 0x44EB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x87BA, 0x8D40, 0x8E40, 0x8E40, 0xAE40, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE40, 0xAE40,
-  0xAE40, 0xAE40, 0xAE40, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0x8E40, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0x8E40, 0x8E40, 0x8E40, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0x3139, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x3FCF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0x5FD7, 0x7F14, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xBD03, 0xCF40, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE40,
-  0xAE40, 0xAE40, 0xAE40, 0xAE40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0xAE48,
-  0x64F3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x84FB, 0xAD48,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0xAE48, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0xAE48, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x4B69, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xE6D2,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0xE6D2, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xED58, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8D40, 0xCC50, 0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0x48AA, 0x8D40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0xAE48, 0xAE48, 0xAE48, 0xAE48, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0xAE48, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x1A13, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x3FCF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FD7, 0x7F14, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x5722, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0xAE48, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0xAE48, 0xAE48, 0xAE48, 0x8E40, 0x8E40, 0x8E40, 0xAE48, 0xAE48, 0xAE48, 0xAE48,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8B79, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA6C2, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x44EB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xED58, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0xE6D2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xED58, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8D40,
-  0x8D40, 0xAA81, 0x45EB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x25E3, 0x6A71, 0x8D40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x3139, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x3FCF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FD7, 0x7F14, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xDE03, 0xAF40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x87BA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xAA89, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x48AA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xE991, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0xE6D2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xEC58, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0xAE40, 0xAE40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8D40, 0x8D40, 0x8D40, 0xAA81,
-  0xE6D2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0x05DB, 0xC989, 0x8D40, 0x8D40, 0x8D40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0xB81A,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x3FCF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0x5FD7, 0x7F14, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xF529, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0xAE48, 0x84F3,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x64F3, 0x64EB,
-  0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0xCD50,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x4B71, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x84FB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x84FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x64F3, 0x64EB, 0x64EB, 0x64EB,
-  0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB,
-  0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64F3, 0x84FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x64F3, 0x64EB, 0x64EB, 0x64EB,
-  0x64EB, 0x64EB, 0x64EB, 0x099A, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0xE999, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB,
-  0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0xAA81, 0x8E40, 0x8E40, 0x8E40, 0x48AA, 0x64EB, 0x64EB,
-  0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB,
-  0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB,
-  0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0x64EB, 0xAE40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0xAE40, 0xFE03, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x3FCF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0x5FD7, 0x7F14, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x3B13, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8D40, 0xE991, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x4B71, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8D40, 0x8D40, 0x48AA,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xEC50, 0x8D40, 0x8D40,
-  0x8D40, 0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x64EB, 0x4B69, 0xA981,
-  0xE991, 0x48AA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x05DB,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x09A2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xCA89, 0x8E40, 0x8E40, 0x8E40, 0x68B2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xAE40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x9331, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x3FCF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FD7, 0x7F14, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0xF038, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8D40, 0xE991, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xE991, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8D40, 0x8D40, 0xE6D2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xEC50, 0x8D40, 0x8D40, 0x8D40, 0xC6CA, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x44EB, 0x8D40, 0x8D40, 0x8D40, 0xAD48, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xED58, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x099A, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xCA89, 0x8E40, 0x8E40,
-  0x8E40, 0x67B2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xAE40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0xB81A, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x3FCF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xDFF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FD7, 0x7F14, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xF529, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8D40, 0xC991, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x67B2,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8D40, 0x64F3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xEC50, 0x8D40, 0x8D40, 0x8D40, 0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0x44EB, 0x8D40, 0x8D40, 0x8D40, 0xAD48, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xE991, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x099A, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xCA89, 0x8E40, 0x8E40, 0x8E40, 0x67B2, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x8D40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0xBD0B, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x3FCF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F55, 0xBFEF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0x5FD7, 0x5F14, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xFA12, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8D40, 0xE991, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x05DB, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0xEC50, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xEC50, 0x8D40, 0x8D40,
-  0x8D40, 0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x44EB, 0x8D40, 0x8D40,
-  0x8D40, 0xAD48, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xE6D2, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x099A, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xCA89, 0x8E40, 0x8E40, 0x8E40, 0x67B2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0x8D40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0xF038, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0xFF7D, 0x3F0C, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x3FCF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBF24, 0xDF2C, 0xBFEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0x5FD7, 0x5F14, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0xDE03, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8D38, 0xE991, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0x84F3, 0x8D40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8A79, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xEC50, 0x8D38, 0x8D40, 0x8D38, 0xC6CA, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x44EB, 0x8D38, 0x8D38, 0x8D38, 0xAD48, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x84FB, 0xCD48, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x089A, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xCA89, 0x8E40, 0x8E40,
-  0x8E40, 0x67B2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x8D40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0xD429, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xBFAE, 0xFFFF, 0xFFBE, 0x3F0C,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x3FCF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xBF24, 0x1F04, 0xDF34, 0xBFEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FD7, 0x5F14, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1039, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8D38, 0xC991, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x0C59, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x099A, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xEC50, 0x8E40, 0x8E40, 0x8D38, 0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0x44EB, 0x8D38, 0x8D40, 0x8D40, 0xAD48, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xAA89, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8D38, 0x089A, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xC989, 0x8D40, 0x8E40, 0x8D38, 0x67B2, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x8D40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x971A, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x9FA6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0x3F0C, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x3FCF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBF24, 0x1F04, 0x1F04, 0xDF34,
-  0xBFEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FD7, 0x5F14, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xD429, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8D38, 0xC991, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xAA81, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x87BA, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xEC50, 0x8E40, 0x8E40,
-  0x8D38, 0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x44EB, 0x8D38, 0x8E40,
-  0x8E40, 0xAD48, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA6C2, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8D38, 0x089A, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xC989, 0x8D40, 0x8E40, 0x8D38, 0x67B2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0x8D40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x3A13, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x7F96, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0x3F0C, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x3FCF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBF24, 0x1F04, 0x1F04, 0x1F04, 0xDF34, 0xBFEF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0x3FCF, 0x5F14, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x571A, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8D38, 0xC991, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x28A2, 0x8E38, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8D38, 0x25E3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xEC50, 0x8E38, 0x8E38, 0x8D38, 0xC6CA, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x44EB, 0x8D38, 0x8D38, 0x8D38, 0xAD48, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x84FB, 0xAD48, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8D38, 0x089A, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xC989, 0x8D38, 0x8E40,
-  0x8D38, 0x67B2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x8D40, 0x8E38,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E38, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0xBD03, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x7F55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFBE, 0x3F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x3FCF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xBF24, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F86, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0x1F86, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xD912, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x8D38, 0xC991, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x05D3, 0x67B2, 0x64F3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xC6C2, 0x8D38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x8E38, 0xAD40, 0x84FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x05DB, 0x67B2, 0x64EB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xEC50, 0x8D38, 0x8D38, 0x8D38, 0xE991, 0x67B2, 0x67B2, 0x67B2, 0x67B2, 0x67B2, 0x67B2,
-  0x67B2, 0x67B2, 0x67B2, 0x67B2, 0x64F3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0x67B2, 0x67B2, 0x67B2, 0x67B2, 0x67B2, 0x67B2, 0x67B2, 0x67B2, 0x67B2,
-  0x67B2, 0x48AA, 0x8D38, 0x8D38, 0x8D38, 0xAD40, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x64F3, 0x67B2, 0x67B2, 0x87BA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x8A79, 0x8E38, 0x8E38, 0x8E38, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E38, 0x8E38, 0x8E38, 0x8D38, 0x089A, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xC989, 0x8D38, 0x8D38, 0x8D38, 0xA981, 0x67B2, 0x67B2,
-  0x67B2, 0x67B2, 0x67B2, 0x67B2, 0x67B2, 0x67B2, 0x67B2, 0x67B2, 0x44EB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA6BA, 0x67B2, 0x67B2, 0x67B2, 0x67B2,
-  0x67B2, 0x67B2, 0x67B2, 0x67B2, 0x67B2, 0x67B2, 0x8D38, 0x8D38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E40, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E40, 0x8E40,
-  0x8E40, 0x8E40, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x8E38, 0x8E38, 0x8E38, 0x8E38, 0xAE38, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x7F55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFB6, 0x3F04,
-  0x1F04, 0x1F04, 0x1F04, 0x3FCF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBF24, 0x1F04, 0x1F04, 0x1F04,
-  0x9F65, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9FA6, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x7C0B, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8D38, 0xC991, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xE891, 0x8D38, 0xA6C2, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x44EB, 0x8D38, 0x8E38, 0x8E38,
-  0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8D38, 0x2B61, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA981, 0x8D38, 0xE5D2, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xEC50, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x25E3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0xAD40, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x25DB, 0x8D38, 0x8D38, 0x8D38, 0x25E3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0x87BA, 0x8D38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x8E38, 0x8D38, 0x089A, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xC989, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0x0B59, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x3131, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x7F5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFB6, 0x3F04, 0x1F04, 0x1F04, 0x3FCF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBF24, 0x1F04, 0x1F04, 0x9F5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0x9FA6, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0xFE03, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x8E38, 0x8E38, 0x8E38, 0x8D38, 0x8D38, 0xC989, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xE891, 0x8D38, 0x089A, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xCD48, 0x8D38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x8E38, 0x8E38, 0x8E38, 0x8D38, 0x8D38, 0xC989, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x0B59, 0x8D38, 0xE5D2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xCC50, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x25E3, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0xAD40, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x25DB, 0x8D38, 0x8D38, 0x8D38,
-  0x28A2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x64F3, 0x8D40,
-  0x8D38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8D38, 0x8D38, 0x089A, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA989, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xEB58,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x9229, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x7F55, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFB6, 0x3F04, 0x1F04, 0x3FCF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xBF24, 0x1F04, 0x9F5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9FA6, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xAE38, 0x8E38,
-  0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8D38,
-  0x8D38, 0xC989, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xE891, 0x8D38, 0x6A71, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0x4B69, 0x8D38, 0x8D38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8D38,
-  0x8D38, 0x48AA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x84FB,
-  0x8D38, 0x8D38, 0xE5D2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xCC50, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x25E3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0xAD40, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x25DB, 0x8D38, 0x8D38, 0x8D38, 0x2B61, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x6B71, 0x8D38, 0x8E38, 0x8E38, 0x8E38,
-  0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8D38, 0x8D38, 0x089A, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA989, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xEB58, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x8E38, 0x8E38, 0x8E38, 0x8E38, 0xD421, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x7F55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xDFB6, 0x3F04, 0x3FCF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBF24, 0x9F5D, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9FA6, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xF030, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8D38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8D38, 0x8D38, 0x8E38, 0x8D38, 0x8D38, 0xC989, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xE891, 0x8D38, 0xCC50, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xE991, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8E38, 0x8E38, 0x8E38, 0x8D38, 0x8D38, 0xE6CA, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x05D3, 0x6D38, 0x6D38, 0xE6D2, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xCC50, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x25E3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0xAD40, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x25DB, 0x6D38, 0x8D38, 0x6D38, 0x8D38, 0x44EB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0x47AA, 0x8D38, 0x8D38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x8D38, 0x8D38, 0x089A, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA989, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xEC58, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8D38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8D38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8D38, 0x8E38, 0x8E38, 0x8E38, 0x8D38,
-  0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8D38, 0x8D38, 0x8E38, 0x8E38, 0x8E38, 0x8D38, 0x8E38, 0x8E38,
-  0x1522, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x7F5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFB6, 0x5FD7,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x1F86, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9FA6,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x5131, 0x8E38, 0x8E38, 0x8E38, 0x8D38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38,
-  0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8E38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0xC989, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xE891, 0x6D38, 0x6D38, 0x64F3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x67B2, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x64F3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0x67B2, 0x6D38, 0x6D38, 0xE6D2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xCC48, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x6D38, 0x25E3, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0xAD40, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x25DB, 0x6D38, 0x8D38, 0x8D38,
-  0x6D38, 0x47AA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x44EB,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x089A, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA981, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x6D38,
-  0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xEC50,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x571A, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x7F55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9FA6, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x9229, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0xC989, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xE891, 0x6D38, 0x6D38, 0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0x05DB, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0xEC50, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xC989,
-  0x6D38, 0x6D38, 0xE6D2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xCC48, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x6D38, 0x25E3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0xAD40, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x25DB, 0x6D38, 0x8D38, 0x8D38, 0x6D38, 0x4A69, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x2B61, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x089A, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA981, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xEC50, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x981A, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x7F5D, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0x9FA6, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xB421, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0xC989, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xE891, 0x6D38, 0x6D38, 0x28A2,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x84FB, 0x8D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6A71, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x2B61, 0x6D38, 0x6D38, 0xE5D2, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xCC48, 0x6D38, 0x8D38,
-  0x8D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x25E3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x8D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0xAC40, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x25DB, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x8D38, 0x64F3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x28A2, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x089A, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA981, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x8D38, 0x8D38, 0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xEB50, 0x6D38, 0x6D38, 0x6D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x8D38, 0x8D38, 0x6D38,
-  0x6D38, 0x6D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x8D38, 0x8D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x8D38, 0x8D38, 0x8D38,
-  0x981A, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x7F55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9FA6, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0xD421, 0x6D38, 0x6D38, 0x8D38, 0x8D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0xC989, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xE891, 0x6D38, 0x6D38, 0x8979, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x0B59, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x089A, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0x83FB, 0x8C40, 0x6D38, 0x6D38, 0xE6D2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xCC48, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x25E3, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x8D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x8C40, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x25DB, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x87B2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x25E3, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x089A, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA981, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xEB50,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0xB812, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x7F55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xBFAE, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xF521, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0xC989, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xE891, 0x6D38, 0x6D38, 0xEB58, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0x8A79, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x87BA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x25DB, 0x6D38,
-  0x6D38, 0x6D38, 0xE6D2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xCC48, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x25E3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0x8D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x8C40, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x25DB, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6A79, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xEB58, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x089A, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA981, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xEB50, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0xB812, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x7F55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBFAE, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1522, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x8D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D30, 0x8D38, 0xC989, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xE891, 0x6D30, 0x8D30, 0x8D38,
-  0x84F3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x28A2, 0x6D30,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D30, 0x25E3, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x87BA, 0x6D30, 0x6D30, 0x6D30, 0xE6D2, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xCC48, 0x6D30, 0x8D38,
-  0x8D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x8D38, 0x6D38, 0x6D38, 0x6D30, 0x6D30,
-  0x25E3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x8D38,
-  0x6D30, 0x8D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x6D38, 0x6D38,
-  0x6D30, 0xAC40, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x25DB, 0x8D30, 0x6D30, 0x6D38, 0x6D30, 0x6D30, 0x8C38, 0x84F3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x0892, 0x8D38, 0x8D38, 0x8D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x089A, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA981, 0x8D38, 0x8D38, 0x8D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x6D38, 0x6D38, 0x6D30, 0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xEB50, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x6D38, 0x6D38, 0x8D38, 0x8D38, 0x6D38, 0x6D38, 0x8D38, 0x8D38, 0x6D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x6D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38,
-  0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x8D38, 0x6D38, 0x6D38, 0x6D38, 0x8D38, 0x8D38, 0x6D38,
-  0xB812, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x7F55, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBFAE, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x361A, 0x8D38, 0x8D38, 0x8D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D30, 0x6D30, 0xC989, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xE891, 0x6D30, 0x6D30, 0x6D30, 0xE5D2, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xC6C2, 0x6D30, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D30, 0x8C38, 0x83FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xE891, 0x6D30, 0x6D30, 0x6D30, 0xE5D2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xCC48, 0x6D30, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D30, 0x6D30, 0x25E3, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x8D38, 0x6D30, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D30, 0x8C40, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x25DB, 0x6D30, 0x6D30, 0x6D38,
-  0x6D30, 0x6D30, 0x6D30, 0xA6C2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0x05D3, 0x6D30, 0x6D38, 0x6D38, 0x6D30, 0x6D38, 0x6D38, 0x6D30, 0x6D30, 0x089A, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA981, 0x6D30, 0x6D30,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D30, 0x6D30,
-  0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xEB50,
-  0x6D30, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D30, 0x6D38, 0x6D38, 0x6D30, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0xB812, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x7F55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xBFAE, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x361A, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D30,
-  0x6D30, 0xC989, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xE891, 0x6D30, 0x6D30, 0x6D30, 0x47AA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0x44EB, 0x6D30, 0x6D30, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D30, 0x2B61,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x4A69, 0x6D30,
-  0x6D30, 0x6D30, 0xE5D2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xCC48, 0x6D30, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D30, 0x6D30, 0x25E3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0x8D38, 0x6D30, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D30, 0x8C40, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x25DB, 0x6D30, 0x6D30, 0x6D38, 0x6D38, 0x6D30, 0x6D30, 0xA981,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xCC48, 0x6D30,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D30, 0x6D30, 0x089A, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA981, 0x6D30, 0x6D30, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D30, 0x6D30, 0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xEB50, 0x6D30, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D30, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x9812, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x7F55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBFAE, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x351A, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D30, 0x6D30, 0x6D38, 0x6D30, 0x8D30, 0x6D30, 0x6D30, 0x6D30, 0xC989, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xE891, 0x6D30, 0x6D30, 0x6D30,
-  0xA981, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xAC40,
-  0x6D30, 0x6D30, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D30, 0xA981, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xAC40, 0x6D30, 0x6D30, 0x6D30, 0xE5D2, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xCC48, 0x6D30, 0x6D38,
-  0x6D38, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D38, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x25E3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x8D38,
-  0x6D30, 0x6D30, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D38,
-  0x6D30, 0x8C40, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x25DB, 0x6D30, 0x6D30, 0x6D38, 0x6D38, 0x6D30, 0x6D30, 0xAC40, 0x84FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xC989, 0x6D30, 0x6D38, 0x6D30, 0x6D38, 0x6D30,
-  0x6D30, 0x6D30, 0x089A, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA981, 0x6D30, 0x6D30, 0x6D30, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D30, 0x6D30, 0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xEB50, 0x6D30, 0x6D38, 0x6D38, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D30, 0x6D30, 0x6D38, 0x6D38, 0x6D30, 0x6D30, 0x6D38, 0x6D30, 0x6D30,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D38, 0x6D38, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D38,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D30, 0x6D30, 0x6D30, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D30,
-  0x771A, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x7F55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9FA6, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x151A, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D38,
-  0x6D38, 0x6D38, 0x6D38, 0x6D38, 0x6D30, 0x6D30, 0x6D38, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0xC989, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xE891, 0x6D30, 0x6D30, 0x6D30, 0x0B59, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x4A69, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x47AA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0x44E3, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0xE5D2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xCC48, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x25E3, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x8D38, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x8C38, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x25DB, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xC6CA, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x089A, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA981, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xEB50,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x771A, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x7F55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9FA6, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xF421, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0xC989, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xE891, 0x6D30, 0x6D30, 0x6D30, 0x8C38, 0x84FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xC989, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0xE6CA,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA6C2, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0xE5D2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xCC48, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x25E3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0x8C30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x8C38, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x25DB, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0xC889, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x84FB, 0xAC40,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x089A, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA981, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xEB50, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x561A, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x7F5D, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0x9FA6, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xD421, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0xC989, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xE891, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x05DB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x67B2,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x64F3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x089A, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0xE5D2, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xCC48, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x25E3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x8C30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x8C38, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x25DB, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0xCB48, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA979, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x0892, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA981, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xEB50, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x151A, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x7F55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9FA6, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x9321, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0xC989, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xE891, 0x6D30, 0x6D30, 0x6D30, 0x6C30, 0x67B2, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x05DB, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0xCB48, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0x6A71, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0xE5D2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xCB48, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x25E3, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x6C30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x8C38, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x25DB, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6C30, 0x05D3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA6BA, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x0892, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA981, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xEB50,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0xD421, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x7F55,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0x1FC7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0x1F86, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9FA6, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x5129, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0xC989, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xE891, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0xC889, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0x84FB, 0x6C30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6A71, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xCB48, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0xE5D2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xCB48, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x25E3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0x6C30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x8C38, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x25DB, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6C30, 0x0892, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x84F3,
-  0x8C38, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x0892, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA981, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xEB50, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x7221, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x7F55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFBE, 0x3F0C, 0xDFB6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBF24, 0x7F5D, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7F9E, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1029, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0xC989, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xE889, 0x6C30, 0x6D30, 0x6D30,
-  0x6D30, 0x2A61, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xEB50, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0xE891, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x64F3, 0x6C30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0xE5D2, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xCB40, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x25E3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x6C30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x8C38, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x25DB, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6C30, 0xEB50, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x6A71, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x0892, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA981, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xEB50, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x3129, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x7F55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0x3F0C, 0x1F04, 0xDFB6,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBF24, 0x1F04, 0x9F5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0x7F9E, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0xAE30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0xC989, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xE889, 0x6C30, 0x6D30, 0x6D30, 0x6C30, 0x8C38, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x8979, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x86BA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xC6CA, 0x6C30, 0x6D30, 0x6D30, 0x6D30, 0x6C30, 0xE5D2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xCB40, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6C30, 0x25E3, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x6C30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x8C38, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x25DB, 0x6C30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6C30, 0x6C30, 0x25E3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x67B2, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6C30, 0x0892, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA981, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6C30,
-  0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xEB48,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0xCF28, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x7F5D, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0x3F0C, 0x1F04, 0x1F04, 0xDFB6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xBF24, 0x1F04, 0x1F04, 0x9F5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7F9E, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xFE03, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0xC989, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xE889, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6C30, 0x25E3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x289A, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x25E3, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x27A2, 0x6C30, 0x6D30, 0x6D30,
-  0x6D30, 0x6C30, 0xE5D2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xCB40, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6C30, 0x25E3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0x6C30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x8C38, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x25DB, 0x6C30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6C30, 0x27A2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x64F3, 0x6C30, 0x6D30, 0x6D30, 0x6D30, 0x6C30, 0x0892, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA981, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6C30, 0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xEB48, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0xFE03, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x7F55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0x3F0C,
-  0x1F04, 0x1F04, 0x1F04, 0xDFB6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBF24, 0x1F04, 0x1F04, 0x1F04,
-  0x9F65, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7F9E, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x7C0B, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6C30, 0xC889, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xE889, 0x6C30, 0x6D30, 0x6D30,
-  0x6C30, 0x6C28, 0x86BA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA6C2, 0x6C30, 0x6D30, 0x6D30, 0x6D30, 0x8C38, 0x83FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x8979, 0x6C28, 0x6C30, 0x6D30, 0x6D30, 0x6C30, 0xE5D2, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xAB40, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6C30,
-  0x25E3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x6C30,
-  0x6C30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x8C38, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x25DB, 0x6C30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6C30, 0x2A59, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x2A61, 0x6D30, 0x6D30,
-  0x6D30, 0x6C30, 0xE891, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA981, 0x6C30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6C30, 0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xEB48, 0x6C30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x7C0B, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x7F5D, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0x3F0C, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xDFB6,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBF24, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F86, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x3F86, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0xF90A, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x4D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6C30, 0xC889, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xE889, 0x6C30, 0x6D30, 0x6D30, 0x6C30, 0x6C28, 0xE891, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x44EB, 0x6C30, 0x6D30, 0x6D30,
-  0x6D30, 0x0B59, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xEB50, 0x6C30, 0x6D30, 0x6D30, 0x6D30, 0x6C30, 0xE5D2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xAB40, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6C30, 0x6C30, 0x25E3, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x6C30, 0x6C30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6C30, 0x8C38, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x25DB, 0x6C30, 0x6C30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6C30, 0x6C30, 0x6C30, 0x44EB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x47A2, 0x6D30, 0x6D30, 0x6D30, 0x6C30, 0xE891, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA981, 0x6C30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6C30,
-  0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xCB48,
-  0x6C30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x4D30, 0x4D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0xF90A, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x5F96, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFBE, 0x3F0C, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xDFB6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xBF24, 0x1F04, 0x1F04, 0x1F04, 0xDF34, 0xBFEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBFEF,
-  0xBF2C, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x5712, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6C30, 0xC889, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xE889, 0x6C28, 0x6D30, 0x6D30, 0x6C30, 0x6C28, 0x4969, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xAC40, 0x6D30, 0x6D30, 0x6D30, 0xA981, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x84F3, 0x6C30, 0x6C28, 0x6D30, 0x6D30,
-  0x6D30, 0x6C28, 0xE5D2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xAB40, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6C30, 0x6C30, 0x25E3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0x6C30, 0x6C30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6C30, 0x8C38, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x25DB, 0x6C30, 0x6C30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6C30, 0x6C28, 0x47AA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0x44EB, 0x6D30, 0x6D30, 0x6D30, 0x6C30, 0xE891, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA981, 0x6C30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6C30, 0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xCB48, 0x4C28, 0x4D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x4D30, 0x5612, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x9FA6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0x3F0C, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0xDFB6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBF24, 0x1F04, 0x1F04, 0xDF34,
-  0xBFEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBFEF, 0xBF2C, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xB319, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x6D30, 0x6D30, 0x6C30, 0x6C28, 0xC881, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xE889, 0x6C28, 0x6D28, 0x6D28,
-  0x6C28, 0x6C28, 0xAB40, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0x4A61, 0x6C28, 0x6C30, 0x6C28, 0x47A2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xE5D2, 0x6C28, 0x6C28, 0x6C28, 0x6C28, 0x6C28, 0x6C28, 0xE5D2, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xAB40, 0x6D28, 0x6D28,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D28, 0x6D28, 0x6C28, 0x6C28,
-  0x25E3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x6C30,
-  0x6C28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D30,
-  0x6C28, 0x8C38, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x25DB, 0x6C28, 0x4C28, 0x4C28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6C28, 0x6C28, 0x4969,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x0B59, 0x6D28,
-  0x6D28, 0x6C28, 0xE891, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA981, 0x6C28, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D28, 0x4D28, 0x6C28, 0x6C28, 0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xEB48, 0x6C28, 0x4C28, 0x4D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28,
-  0x6D30, 0x6D30, 0x6D30, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D30, 0x6D30,
-  0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x4D28, 0x6D30, 0x6D30, 0x6D30, 0x6D28, 0x6D28, 0x6D30, 0x4D30, 0x4D30, 0x4D28,
-  0x4D28, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x4D28, 0x4D28, 0x6D28, 0x6D30, 0x6D30,
-  0x6D30, 0x7221, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0xBFA6, 0xFFFF, 0xFFBE, 0x3F0C, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xDFB6,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBF24, 0x1F04, 0xDF34, 0xBFEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xBFEF, 0xBF2C, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0xEF28, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x4D28, 0x4D28, 0x6D30, 0x6D30, 0x6D30, 0x6D30,
-  0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D30, 0x6D28, 0x6D28, 0x6D28, 0x6D28,
-  0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6C28, 0xC881, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xE889, 0x6C28, 0x6C28, 0x6D28, 0x6D28, 0x6C28, 0x6C28, 0x44EB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xC889, 0x6C28, 0x6C28,
-  0x6C28, 0xE5CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x47AA,
-  0x6C28, 0x6C28, 0x6D28, 0x6C28, 0x6C28, 0x6C28, 0xE5D2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xAB40, 0x6C28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28,
-  0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6C28, 0x6D28, 0x6C28, 0x25E3, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x6C30, 0x6C28, 0x6C28, 0x6D28, 0x6D28,
-  0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6C28, 0x6C28, 0x8C38, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x25DB, 0x6C28, 0x6C28, 0x6C28,
-  0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6C28, 0x6C28, 0x6C28, 0x6C30, 0x64F3, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x089A, 0x6C28, 0x6D28, 0x6C28, 0xE891, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA981, 0x6C28, 0x6C28,
-  0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6C28, 0x6C28,
-  0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xCB48,
-  0x6C28, 0x6C28, 0x4C28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28,
-  0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28,
-  0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28,
-  0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28,
-  0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28,
-  0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0xAE28, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F7E, 0x3F0C, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xDFB6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xBF24, 0xDF2C, 0xBFEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9FEF, 0xBF2C, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xDD03, 0x6D28, 0x6D28, 0x6D28,
-  0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28,
-  0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28,
-  0x6D28, 0xC881, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xE889, 0x6D28, 0x6C28, 0x6D28, 0x6D28, 0x4C28, 0x6C28, 0xC6C2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x67B2, 0x6C28, 0x6C28, 0x6C28, 0x64F3, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA981, 0x6C28, 0x4C28, 0x6D28, 0x6D28,
-  0x6C28, 0x6C28, 0xE5D2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xAB40, 0x6C28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28,
-  0x6D28, 0x6D28, 0x6D28, 0x6C28, 0x25E3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0x6C30, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28,
-  0x6D28, 0x6D28, 0x6D28, 0x6C28, 0x6C28, 0x8C38, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x25DB, 0x6C28, 0x6C28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28,
-  0x6D28, 0x6C28, 0x6C28, 0x4C28, 0x86B2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0x05DB, 0x6C28, 0x6D28, 0x6C28, 0xE891, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA981, 0x6C28, 0x6C28, 0x6D28, 0x6D28, 0x6D28, 0x6D28,
-  0x6D28, 0x6D28, 0x6D28, 0x4D28, 0x4D28, 0x6D28, 0x6C28, 0x6C28, 0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xCB48, 0x6C28, 0x6C28, 0x6D28, 0x6D28,
-  0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28,
-  0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28,
-  0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28,
-  0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28,
-  0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28,
-  0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x7C03, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0xDFB6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F55, 0xBFEF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0x9FEF, 0xBF2C, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xF90A, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28,
-  0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28,
-  0x4C28, 0x4C28, 0x4D28, 0x6D28, 0x6D28, 0x4D28, 0x4D28, 0x4D28, 0x4C28, 0xC881, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xE889, 0x6D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4C28, 0x4C28, 0x079A, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0x05DB, 0x6C28, 0x6D28, 0xCB48, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0x0A59, 0x6C28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x6C28, 0xE5D2, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xAB40, 0x4C28, 0x4D28,
-  0x6D28, 0x6D28, 0x6D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x6D28, 0x6D28, 0x6C28,
-  0x25E3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x6C30,
-  0x6C28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6C28,
-  0x4C28, 0x8C30, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x25DB, 0x6C28, 0x6D28, 0x6D28, 0x4D28, 0x4D28, 0x6D28, 0x4D28, 0x4D28, 0x6D28, 0x6D28, 0x6C28,
-  0x6971, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xEB48,
-  0x6D28, 0x6C28, 0xE891, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA981, 0x6D28, 0x6C28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x4D28, 0x4D28,
-  0x4D28, 0x6D28, 0x6D28, 0x6C28, 0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xCB48, 0x6C28, 0x6C28, 0x4D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x4D28,
-  0x4D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28,
-  0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28,
-  0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x4D28, 0x4D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28,
-  0x6D28, 0x6D28, 0x6D28, 0x4D28, 0x4D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28,
-  0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28,
-  0x6D28, 0x6D28, 0x7712, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xDFB6,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBFEF, 0xBF2C,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0xD419, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x4C28, 0x4D28,
-  0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x6D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4C28, 0xC881, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xC889, 0x4C28, 0x4D28, 0x4D28, 0x4D28, 0x4C28, 0x4C28, 0x6971,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x84FB, 0x089A, 0x089A,
-  0x67B2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x84FB, 0x6C30,
-  0x4C28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4C28, 0xE5D2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xAB40, 0x4C28, 0x4D28, 0x4D28, 0x8979, 0x089A, 0x089A,
-  0x089A, 0x089A, 0x089A, 0x089A, 0x089A, 0x089A, 0x089A, 0x089A, 0x64F3, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x089A, 0x089A, 0x089A, 0x089A, 0x089A,
-  0x089A, 0x089A, 0x089A, 0x089A, 0x089A, 0xE889, 0x4D28, 0x4C28, 0x4C28, 0x8C30, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x25DB, 0x4C28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4C28, 0x4C28, 0x8C30, 0x84FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA6C2, 0x089A, 0x089A, 0xC6CA, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA979, 0x4C28, 0x6C28,
-  0x4D28, 0x6A69, 0x089A, 0x089A, 0x089A, 0x089A, 0x089A, 0x089A, 0x089A, 0x089A, 0x089A, 0x089A,
-  0x24E3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x47AA,
-  0x089A, 0x089A, 0x089A, 0x089A, 0x089A, 0x089A, 0x089A, 0x089A, 0x089A, 0x089A, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x3121, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xDFB6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBFEF, 0xBF2C, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xAE28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28,
-  0x4C28, 0xC881, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xC889, 0x4C28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4C28, 0xCB48, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x05DB, 0x4C28, 0x4C28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4C28, 0xE5CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xAB40, 0x4C28, 0x4D28, 0x4D28, 0xC6CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0x44EB, 0x4D28, 0x4C28, 0x4C28, 0x8C30, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x25DB, 0x4C28, 0x4C28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4C28, 0x4C28, 0xA6C2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA979, 0x4C28, 0x4C28, 0x4D28, 0x47AA, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x6C30, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0xBD03, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0xDFB6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0x9FE7, 0xBF2C, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1A0B, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4C28, 0x4C28, 0xA881, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xC889, 0x4C28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4C28, 0x4C28, 0x64F3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0x67B2, 0x4C28, 0x4C28, 0x4C28, 0x4D28, 0x4D28, 0x4C28, 0x4C28, 0xE5CA, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xAB40, 0x4C28, 0x4D28,
-  0x4D28, 0xC6C2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x44EB, 0x4C28, 0x4C28,
-  0x4C28, 0x6C30, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x25DB, 0x4C28, 0x4C28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4C28,
-  0x4C28, 0xA979, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA979, 0x4C28, 0x4C28, 0x4C28, 0x47AA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0x6C30, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x5612, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xDFB6,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9FE7, 0xBF2C, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xB319,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4C28, 0x4C28, 0xA881, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xC889, 0x4C28, 0x4C28, 0x4D28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0xE5CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xC889, 0x4C28,
-  0x4C28, 0x4C28, 0x4D28, 0x4D28, 0x4C28, 0x4C28, 0xE5CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xAB40, 0x4C28, 0x4C28, 0x4C28, 0xC6C2, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x44EB, 0x4C28, 0x4C28, 0x4C28, 0x6C30, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x25DB, 0x4C28, 0x4C28, 0x4C28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4C28, 0x4C28, 0x4C28, 0x8B38, 0x83FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA979, 0x4C28, 0x4C28,
-  0x4C28, 0x47AA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x4C28, 0x4C28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4D28, 0x4C28, 0x4D28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0xAE20,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xDFB6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0x9FE7, 0xBF2C, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xDE03, 0x6D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28,
-  0x4C28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4C28,
-  0x4C28, 0xA881, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xC889, 0x4C28, 0x4C28, 0x4D28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x27A2, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x2A61, 0x4C28, 0x4C28, 0x4C28, 0x4D28, 0x4D28,
-  0x4C28, 0x4C28, 0xE5CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xAB40, 0x4C28, 0x4C28, 0x4C28, 0xC6C2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0x44EB, 0x4C28, 0x4C28, 0x4C28, 0x6C30, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x25DB, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4C28, 0x4C28, 0x4C28, 0xE5CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA979, 0x4C28, 0x4C28, 0x4C28, 0x47AA, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x4C28, 0x4C28, 0x4C28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4D28, 0x4C28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4C28, 0x4C28,
-  0x4C28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4C28, 0xB812, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0xDFB6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9FE7, 0xBF2C, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x5612, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4C28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0xA881, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xC889, 0x4C28, 0x4C28, 0x4D28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x8979, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0x8C38, 0x4C28, 0x4C28, 0x4C28, 0x4D28, 0x4D28, 0x4C28, 0x4C28, 0xE5CA, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xAB40, 0x4C28, 0x4C28,
-  0x4C28, 0xC6C2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x44EB, 0x4C28, 0x4C28,
-  0x4C28, 0x6C30, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x25DB, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4C28,
-  0x4C28, 0x4C28, 0xC889, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA979, 0x4C28, 0x4C28, 0x4C28, 0x47AA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0x4C28, 0x4C28, 0x4C28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4C28,
-  0x4C28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4C28, 0x4C28, 0x4C28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4C28, 0xCF20, 0xFE03, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xDFB6,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9FE7, 0xBF2C, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xDD03, 0x8D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4C28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28,
-  0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4D28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0xA881, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xC889, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0xEA50, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x24E3, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0xE5CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xAB40, 0x4C28, 0x4C28, 0x4C28, 0xC6C2, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x44EB, 0x4C28, 0x4C28, 0x4C28, 0x6C30, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x05DB, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0xCB40, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x8979, 0x4C28, 0x4C28,
-  0x4C28, 0x47AA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x3612, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xDFB6, 0xFFFF, 0xFFFF, 0xFFFF, 0x9FE7,
-  0xBF24, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xD419, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4D28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0xA881, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xC889, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x6C28, 0x84FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x86BA, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0xE5CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xAB40, 0x4C28, 0x4C28, 0x4C28, 0xC6C2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0x44EB, 0x4C28, 0x4C28, 0x4C28, 0x6C30, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x05DB, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x05DB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x8979, 0x4C28, 0x4C28, 0x4C28, 0x47AA, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x6D28, 0x5B0B, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0xDFB6, 0xFFFF, 0xFFFF, 0x9FE7, 0xBF24, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1A0B, 0x4D28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0xA881, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xC889, 0x4C20, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C20, 0x05D3, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xE891, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0xE5CA, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xAB38, 0x4C28, 0x4C28,
-  0x4C28, 0xC6C2, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x44EB, 0x4C28, 0x4C28,
-  0x4C28, 0x6C30, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0x25DB, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C20, 0xE891, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA979, 0x4C28, 0x4C28, 0x4C28, 0x47AA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0xEF20, 0xFE03, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xDFB6,
-  0xFFFF, 0x9FE7, 0xBF24, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xDE03, 0xAE20, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C20, 0xA881, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xC889, 0x4C20, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x67AA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x4969, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0xE5CA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xAB38, 0x4C28, 0x4C28, 0x4C28, 0xC6C2, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x44EB, 0x4C28, 0x4C28, 0x4C28, 0x6C30, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x25DB, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0xEA50,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA979, 0x4C28, 0x4C28,
-  0x4C28, 0x47AA, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB,
-  0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0xA3FB, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x5119, 0xFF03, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xDFB6, 0x9FE7, 0xBF24, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0xFE03, 0x3119, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4B20,
-  0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20,
-  0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4C20, 0x4C20, 0x4C20, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C28, 0x4C20, 0x4C20, 0x4C20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20,
-  0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20,
-  0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20,
-  0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4C20, 0x4C20, 0x4C20, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4B20, 0x4B20, 0x4B20,
-  0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20,
-  0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4C20, 0x4C20, 0x4C20, 0x4C28, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20,
-  0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20,
-  0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x7219, 0xFE03, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x7F9E, 0xBF24, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xFE03, 0x3119, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4B20, 0x4B20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C28,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4B20, 0x4B20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C28,
-  0x4C20, 0x4C20, 0x4C20, 0x4B20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4B20,
-  0x4C20, 0x4C20, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C28, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4B20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x1021, 0x9D03, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x3F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x9C03, 0xF020, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C28, 0x4C28, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C28, 0x4C28, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C28, 0x4C20, 0x4C20, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C20, 0x4C20, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C20, 0x4C20, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x8E20, 0xB80A, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x9812,
-  0x8D20, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C28,
-  0x4C28, 0x4C28, 0x4C28, 0x4C28, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x3119, 0x1A0B, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0xD90A, 0xEF20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0xCF20, 0x3512, 0x7C03, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04,
-  0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x1F04, 0x5B03, 0x5612,
-  0xCF20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0xAE20, 0x9319, 0x5612, 0xD90A, 0x3B0B, 0x9C03, 0xDE03, 0xFE03, 0x1F04, 0x1F04, 0x1F04,
-  0xFE03, 0x7C03, 0xD90A, 0x3512, 0x7219, 0x8E20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xAD28, 0x4F41, 0x4F41, 0x4F41, 0x4F41, 0x4F41, 0xAD30,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xAD30, 0x4F41, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x6C28, 0x4F41, 0x8D28, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xEE30, 0x4F41,
-  0x4F41, 0x4F41, 0x4F41, 0x4F41, 0x8D28, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xCD30, 0x4F41,
-  0x4F41, 0x4F41, 0x4F41, 0x4F41, 0x4F41, 0x4F41, 0x4F41, 0x4F41, 0x4F41, 0x6D28, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x0E39, 0x4F41, 0x4F41, 0x4F41, 0x4F41, 0x4E41, 0x6C28, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x2E39, 0x2E39, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x0E39, 0x2E41, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xEE30, 0x4F41, 0x4F41, 0x4F41,
-  0x4F41, 0x4F41, 0x4F41, 0x4F41, 0x4F41, 0x4F41, 0x0E39, 0x4C20, 0x4C20, 0x4C20, 0x8D28, 0x4F41,
-  0x4F41, 0x4F41, 0x4F41, 0x4F41, 0x4F41, 0x4F41, 0x4F41, 0x4F41, 0x2E39, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4F41, 0x4F41, 0x4F41, 0x4F41, 0x4F41, 0x4F41, 0x4F41, 0x4F41, 0x8D28, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0xEE38, 0x4F41, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0xEE38, 0x4F41, 0x4C20, 0x4C20, 0x4C20, 0x0E39, 0xCE30, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0xAD30, 0x2E39, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xEE38,
-  0x4F41, 0x4F41, 0x4F41, 0x0E39, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xAD30, 0x4F41,
-  0x4F41, 0x4F41, 0x4F41, 0x4F41, 0x4F41, 0x4F41, 0x0E39, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x0E39, 0x4F41, 0x4F41, 0x4F41, 0x4F41, 0x4F41, 0x4F41, 0x4F41, 0x4F41, 0x4F41, 0xCD30,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x6C28,
-  0xF8AC, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0x79B5, 0xAD30, 0x4C20, 0x4C20,
-  0x4C20, 0xB7A4, 0xFFFF, 0xCD30, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x115A, 0xFFFF,
-  0x747B, 0x4C20, 0x4C20, 0x4C20, 0x0E39, 0x1BCE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xBFF7, 0x158C, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x99BD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9262, 0x4C20, 0x4C20, 0x4C20, 0x8F49, 0x9CD6, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7EEF, 0x547B, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x5EEF,
-  0xFFFF, 0x337B, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x9262, 0xFFFF, 0xFFFF, 0x8D28, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x1AC6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0x9CD6, 0x4C20, 0x4C20, 0x4C20, 0x547B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0x4C20, 0x4C20, 0x4C20, 0xB049, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBFF7, 0x158C, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x9CD6,
-  0xFFFF, 0x3694, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xB049, 0xDFFF, 0xFFFF, 0xAF49, 0x4C20,
-  0x4C20, 0xFDE6, 0x1BCE, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x79B5,
-  0xDFFF, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xCD30, 0x9EF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF,
-  0x2E39, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x979C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xDCDE, 0xF051, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xFDE6, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB9BD, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x5694, 0xFFFF, 0x1AC6, 0x5694, 0x3694,
-  0x3694, 0x3694, 0x3694, 0xB9BD, 0xFFFF, 0x38AD, 0x4C20, 0x4C20, 0x4C20, 0xD7A4, 0xFFFF, 0xCD30,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x315A, 0xFFFF, 0x9483, 0x4C20, 0x4C20, 0x4C20,
-  0x5BD6, 0xFFFF, 0x38B5, 0x3694, 0x3694, 0x3694, 0x3694, 0x5694, 0x9CD6, 0xFFFF, 0x3373, 0x4C20,
-  0x4C20, 0x4C20, 0xD26A, 0x3694, 0x3694, 0x3694, 0x3694, 0xFFFF, 0xBCDE, 0x3694, 0x3694, 0x3694,
-  0x3694, 0x4E41, 0x4C20, 0x4C20, 0x6C28, 0xFDE6, 0xBFFF, 0xF7A4, 0x3694, 0x3694, 0x3694, 0x3694,
-  0x769C, 0xFDE6, 0xFFFF, 0x315A, 0x4C20, 0x4C20, 0x4C20, 0x7EEF, 0xFFFF, 0x9EF7, 0x2E39, 0x4C20,
-  0x4C20, 0x4C20, 0xCD30, 0x3DEF, 0xFFFF, 0xFFFF, 0xAD28, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x1ACE, 0x9EF7, 0x3694, 0x3694, 0x3694, 0x3694, 0x3694, 0x3694, 0x3694, 0x3694, 0x547B, 0x4C20,
-  0x4C20, 0x4C20, 0xAF49, 0x3694, 0x3694, 0x3694, 0x3694, 0xFFFF, 0xBCDE, 0x3694, 0x3694, 0x3694,
-  0x158C, 0x4C20, 0x4C20, 0x4C20, 0xD049, 0xFFFF, 0xFAC5, 0x3694, 0x3694, 0x3694, 0x3694, 0x3694,
-  0x5694, 0x9CD6, 0xFFFF, 0x3373, 0x4C20, 0x4C20, 0x4C20, 0x9CD6, 0xFFFF, 0xDFFF, 0xD051, 0x4C20,
-  0x4C20, 0x4C20, 0x6C28, 0x9CD6, 0xFFFF, 0xFFFF, 0xAF49, 0x4C20, 0x4C20, 0x7CD6, 0xBCDE, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x1AC6, 0x5EEF, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x9483, 0xFFFF, 0x58B5, 0x3694, 0xF7A4, 0xFFFF, 0x1694, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x979C, 0xFFFF, 0x969C, 0x3694, 0x3694, 0x3694, 0x3694, 0x3694, 0xB7A4, 0x9EF7,
-  0x7EEF, 0xCD30, 0x4C20, 0x4C20, 0x4C20, 0xFDE6, 0x3DE7, 0x3694, 0x3694, 0x3694, 0x3694, 0x3694,
-  0x3694, 0x3694, 0x3694, 0xD26A, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0xFDE6, 0xBCDE, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x1BCE, 0xBFFF, 0x4C20, 0x4C20, 0x4C20, 0xD7A4, 0xFFFF, 0xCD30, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x315A, 0xFFFF, 0x947B, 0x4C20, 0x4C20, 0x6F41, 0xFFFF, 0xD7A4, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xAD28, 0x9EF7, 0x1AC6, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0xFFFF, 0x58B5, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x315A, 0xFFFF, 0xD58B, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x2E39, 0xFFFF, 0x18AD,
-  0x4C20, 0x4C20, 0x4C20, 0x7EEF, 0x3BCE, 0x5EEF, 0xDAC5, 0x4C20, 0x4C20, 0x4C20, 0x18AD, 0xBEF7,
-  0xDAC5, 0xFFFF, 0xAD28, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x1ACE, 0x3DE7, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0xFFFF, 0x58B5, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0xD049, 0xFFFF, 0xB483, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xAD28, 0x9EF7, 0x1AC6,
-  0x4C20, 0x4C20, 0x4C20, 0x9CD6, 0xDCDE, 0xBCDE, 0xBCDE, 0x6D28, 0x4C20, 0x4C20, 0x3694, 0xFFFF,
-  0x99BD, 0xFFFF, 0xAF49, 0x4C20, 0x4C20, 0xFAC5, 0x3DEF, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x9CD6, 0xBCDE, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x9CDE, 0x7EEF,
-  0x8C28, 0x4C20, 0x4C20, 0xFDE6, 0x1DE7, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x979C, 0xFFFF,
-  0xCD30, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x3373, 0xFFFF, 0x1373, 0x4C20, 0x4C20,
-  0x4C20, 0xFDE6, 0x5BCE, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x7EEF,
-  0xDABD, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xF8AC, 0xFFFF, 0xAD28, 0x4C20,
-  0x4C20, 0xD7A4, 0xFFFF, 0xED30, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x315A, 0xFFFF,
-  0x947B, 0x4C20, 0x4C20, 0xF051, 0xFFFF, 0xB483, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0xFDDE, 0x7CD6, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xFFFF,
-  0x58B5, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xB26A, 0xFFFF, 0xD26A, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xBFFF, 0x99BD, 0x4C20, 0x4C20, 0x4C20, 0x7EEF,
-  0xDABD, 0x3373, 0xFFFF, 0x747B, 0x4C20, 0x9262, 0xFFFF, 0xD58B, 0x18AD, 0xFFFF, 0xAD28, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x1AC6, 0x3DE7, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xFFFF,
-  0x58B5, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xD049, 0xFFFF, 0xB483, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xFDDE, 0x9CD6, 0x4C20, 0x4C20, 0x4C20, 0x9CD6,
-  0xBCDE, 0x3052, 0xFFFF, 0x5694, 0x4C20, 0xD049, 0xDFFF, 0xD7A4, 0xF58B, 0xFFFF, 0xAF49, 0x4C20,
-  0x4C20, 0x59B5, 0xDFFF, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x1DE7,
-  0x3BCE, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x1052, 0xFFFF, 0xB79C, 0x4C20, 0x4C20, 0x4C20, 0xF58B,
-  0xFFFF, 0x9262, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x979C, 0xFFFF, 0xED30, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x3052, 0xFFFF, 0x947B, 0x4C20, 0x4C20, 0x4C20, 0xFDE6, 0x5BCE, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x2C20, 0x4C20, 0x7EEF, 0xDABD, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x8F41, 0x9162, 0x4C20, 0x4C20, 0x4C20, 0xD7A4, 0xFFFF, 0xCD30,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x3052, 0xFFFF, 0x947B, 0x4C20, 0x4C20, 0xF051,
-  0xFFFF, 0xB483, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x1052, 0xF051, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xFFFF, 0x38B5, 0x2C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xB262, 0xFFFF, 0xD26A, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0xBFFF, 0x99BD, 0x4C20, 0x4C20, 0x4C20, 0x7EEF, 0xDABD, 0x4C20, 0x1ACE, 0x9EF7,
-  0xD049, 0x3DEF, 0xBCDE, 0x6C20, 0xF8AC, 0xFFFF, 0xAD28, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x2C20, 0x2C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x1AC6, 0x3DE7, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xFFFF, 0x58B5, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xD049, 0xFFFF, 0xB483, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0xFDDE, 0x7CD6, 0x4C20, 0x4C20, 0x4C20, 0x9CD6, 0xBCDE, 0x4C20, 0x18AD, 0xDFFF,
-  0x1052, 0x9CD6, 0x5EEF, 0xCD30, 0xF58B, 0xFFFF, 0xAF49, 0x4C20, 0x4C20, 0x979C, 0xFFFF, 0xAD28,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x9EF7, 0x99BD, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x18AD, 0xFFFF, 0x8F49, 0x4C20, 0x4C20, 0x4C20, 0x0E31, 0xDFFF, 0xBABD, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x979C, 0xFFFF, 0xCD30, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x3052,
-  0xFFFF, 0x747B, 0x4C20, 0x4C20, 0x4C20, 0xFDE6, 0x5BCE, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x2C20, 0x2C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x7EEF, 0xDABD, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xD7A4, 0xFFFF, 0xCD30, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x3052, 0xFFFF, 0x947B, 0x4C20, 0x4C20, 0x4E39, 0xFFFF, 0x38AD, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0xFFFF, 0x58B5, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0xB262, 0xFFFF, 0xD26A, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xBFFF, 0x99BD,
-  0x4C20, 0x4C20, 0x4C20, 0x7EEF, 0xDABD, 0x4C20, 0x8F41, 0xDFFF, 0xBFF7, 0xFFFF, 0x1052, 0x4C20,
-  0xF8AC, 0xFFFF, 0xAD28, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x1AC6, 0x3DE7, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0xFFFF, 0x58B5, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0xD049, 0xFFFF, 0xB483, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xED30, 0xBFF7, 0xFAC5,
-  0x4C20, 0x4C20, 0x4C20, 0x9CD6, 0xBCDE, 0x4C20, 0xED30, 0x7EEF, 0xBFF7, 0xFFFF, 0x1373, 0x4C20,
-  0xF58B, 0xFFFF, 0xAF49, 0x4C20, 0x4C20, 0xD58B, 0xFFFF, 0x6F41, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x6C28, 0xFFFF, 0xF8A4, 0x4C20, 0x4C20, 0x4C20, 0xAD30, 0xBFF7, 0x3BCE, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x79B5, 0xDFFF, 0x2E39, 0x4C20, 0x4C20, 0x4C20, 0x979C, 0xFFFF,
-  0xCD30, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x947B, 0xFFFF, 0xF26A, 0x4C20, 0x4C20,
-  0x4C20, 0xFDE6, 0x5BCE, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x7EEF,
-  0xDABD, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0xD7A4, 0xFFFF, 0xCD30, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x3052, 0xFFFF,
-  0x947B, 0x4C20, 0x4C20, 0x4C20, 0xFAC5, 0xFFFF, 0x1BCE, 0x58B5, 0x58B5, 0x58B5, 0x58B5, 0x38AD,
-  0x158C, 0xEE30, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xFFFF,
-  0x58B5, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xB262, 0xFFFF, 0xD26A, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xBFFF, 0x99BD, 0x4C20, 0x4C20, 0x4C20, 0x7EEF,
-  0xDABD, 0x4C20, 0x4C20, 0x5694, 0xFFFF, 0x18AD, 0x4C20, 0x4C20, 0xF8AC, 0xFFFF, 0xAD28, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x1AC6, 0xBFF7, 0x58B5, 0x58B5, 0x58B5, 0x58B5, 0x58B5, 0x58B5,
-  0x58B5, 0x38AD, 0x8D28, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xFFFF,
-  0x58B5, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xD049, 0xFFFF, 0x7BD6, 0x58B5,
-  0x58B5, 0x58B5, 0x58B5, 0x58B5, 0x59B5, 0x1DE7, 0xFFFF, 0xB26A, 0x4C20, 0x4C20, 0x4C20, 0x9CD6,
-  0xBCDE, 0x4C20, 0x4C20, 0x537B, 0xFFFF, 0xFAC5, 0x4C20, 0x4C20, 0xF58B, 0xFFFF, 0xAF49, 0x4C20,
-  0x4C20, 0x547B, 0xFFFF, 0x1052, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x2E39, 0xFFFF,
-  0x3694, 0x4C20, 0x4C20, 0x4C20, 0x747B, 0xFFFF, 0x1373, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x715A, 0xFFFF, 0x158C, 0x4C20, 0x4C20, 0x4C20, 0x979C, 0xFFFF, 0x79B5, 0x58B5, 0x58B5, 0x58B5,
-  0x58B5, 0x58B5, 0xB9BD, 0xDFFF, 0x3DE7, 0xAD28, 0x4C20, 0x4C20, 0x4C20, 0xFDE6, 0x5EEF, 0x58B5,
-  0x58B5, 0x58B5, 0x58B5, 0x58B5, 0x58B5, 0x58B5, 0xB262, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x7EEF, 0xDABD, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xD7A4, 0xFFFF, 0xCD30,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x3052, 0xFFFF, 0x947B, 0x4C20, 0x4C20, 0x4C20,
-  0xCD30, 0x58B5, 0xBFF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x3DEF, 0x2E39, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x2C20, 0x2C20, 0xFFFF, 0x58B5, 0x2C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xB262, 0xFFFF, 0xD26A, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x2C20, 0xBFFF, 0x99BD, 0x2C20, 0x4C20, 0x4C20, 0x7EEF, 0xDABD, 0x4C20, 0x4C20, 0x6C20,
-  0xF051, 0x8C28, 0x4C20, 0x4C20, 0xF8AC, 0xFFFF, 0xAD28, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x2C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x1AC6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xED30, 0x4C20,
-  0x2C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xFFFF, 0x58B5, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xCF49, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0x1DE7, 0x537B, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x9CD6, 0xBCDE, 0x4C20, 0x4C20, 0x4C20,
-  0xCF49, 0xAD28, 0x4C20, 0x4C20, 0xF58B, 0xFFFF, 0xAF49, 0x4C20, 0x4C20, 0xD26A, 0xFFFF, 0x9262,
-  0x4C20, 0x4C20, 0xD26A, 0x3373, 0x4C20, 0x4C20, 0xD049, 0xFFFF, 0x9483, 0x4C20, 0x4C20, 0x4C20,
-  0x9CD6, 0x7EEF, 0x8C28, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xFDE6, 0x1DE7, 0x4C20,
-  0x4C20, 0x4C20, 0x979C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x1AC6,
-  0x6E41, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0xFDE6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0x3694, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x2C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x4C20, 0x2B20, 0x7EEF, 0xBABD, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0xD7A4, 0xFFFF, 0xCD30, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x1052, 0xFFFF, 0x747B, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2B20, 0x2B20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x6C20, 0x1373, 0xFFFF, 0xF8AC, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0xFFFF, 0x38B5, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x4C20,
-  0xB262, 0xFFFF, 0xD26A, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0xBFFF, 0x99BD,
-  0x2B20, 0x2C20, 0x2B20, 0x7EEF, 0xBABD, 0x2C20, 0x4C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x4C20,
-  0xF8AC, 0xFFFF, 0xAC28, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2B20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x4C20, 0x4C20, 0x1AC6, 0x3DE7, 0x4B20, 0x4B20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4B20, 0x2B20, 0x2C20, 0x2C20, 0x4C20, 0x4C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0xFFFF, 0x38B5, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0xCF49, 0xFFFF, 0xB483, 0x6C20, 0x4C20, 0x4C20, 0x4B20, 0x9CD6, 0xBEF7, 0xAC28, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x9CD6, 0xBCDE, 0x2C20, 0x2C20, 0x2C20, 0x4C20, 0x2C20, 0x2C20, 0x2C20,
-  0xD58B, 0xFFFF, 0xAF49, 0x2C20, 0x2C20, 0x315A, 0xFFFF, 0x1373, 0x2C20, 0xF051, 0xFFFF, 0xFFFF,
-  0xD26A, 0x4C20, 0x515A, 0xFFFF, 0x1373, 0x2C20, 0x2C20, 0x4C20, 0x9EF7, 0x9CD6, 0x1373, 0x1373,
-  0x1373, 0x1373, 0x1373, 0x1373, 0x1373, 0x1ACE, 0xFFFF, 0x4C20, 0x2C20, 0x2C20, 0x979C, 0xFFFF,
-  0xED30, 0x4C20, 0x4C20, 0x4B20, 0xCF49, 0xFFFF, 0x38B5, 0x4C20, 0x4C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0xFDE6, 0x5BCE, 0x4B20, 0x4B20, 0x6C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x2C20,
-  0x2C20, 0x4C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x4C20, 0x4C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x4C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x4C20, 0x4C20, 0x4C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x7EEF,
-  0xBABD, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2B20, 0xD7A4, 0xFFFF, 0xCD30, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x1052, 0xFFFF,
-  0x747B, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2B20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2B20, 0x1DE7, 0x7BD6, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0xFFFF,
-  0x38B5, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x4C20, 0xB262, 0xFFFF, 0xD26A, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0xBFFF, 0x99BD, 0x2C20, 0x2C20, 0x2C20, 0x7EEF,
-  0xBABD, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2B20, 0xF8AC, 0xFFFF, 0x8C28, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x4C20, 0x1AC6, 0x3DE7, 0x2B20, 0x2B20, 0x2B20, 0x2B20, 0x2B20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0xFFFF,
-  0x38B5, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0xAF49, 0xFFFF, 0xB483, 0x2C20,
-  0x2C20, 0x2C20, 0x2B20, 0x1373, 0xFFFF, 0xB483, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x9CD6,
-  0xBCDE, 0x2B20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0xD58B, 0xFFFF, 0xAF49, 0x2C20,
-  0x2C20, 0x8F49, 0xFFFF, 0xB483, 0x2C20, 0x3BCE, 0xBFF7, 0x5EEF, 0xFDE6, 0x6C20, 0xD26A, 0xFFFF,
-  0x7162, 0x2C20, 0x2C20, 0x2B20, 0x9EF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0x4C20, 0x2C20, 0x2C20, 0x979C, 0xFFFF, 0xCD30, 0x2C20, 0x2C20, 0x2B20,
-  0x2B20, 0x1AC6, 0xDFFF, 0x0E31, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0xFDE6, 0x5BCE, 0x2B20,
-  0x2B20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x7EEF, 0xBABD, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x5694, 0x1DE7, 0x6C20, 0x2C20, 0x2B20, 0xD7A4, 0xFFFF, 0xCD30,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x1052, 0xFFFF, 0x747B, 0x2C20, 0x2C20, 0x8F41,
-  0x3DEF, 0x3373, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2B20, 0xFDDE, 0x9CD6, 0x2B20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2B20, 0xFFFF, 0x38B5, 0x2B20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x4C20, 0xB262, 0xFFFF, 0xD26A, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2B20, 0xBFFF, 0x99BD, 0x2C20, 0x2C20, 0x2C20, 0x7EEF, 0xBABD, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2B20, 0xF8AC, 0xFFFF, 0x8C28, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x4B20,
-  0x1AC6, 0x3DE7, 0x4B18, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2B20, 0xFFFF, 0x38B5, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0xAF49, 0xFFFF, 0xB483, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x6C20,
-  0x3DEF, 0x1DE7, 0x4C20, 0x2C20, 0x2C20, 0x2C20, 0x2B20, 0x9CD6, 0xBCDE, 0x2B20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0xD58B, 0xFFFF, 0xAF49, 0x2C20, 0x2C20, 0xED30, 0xFFFF, 0x3694,
-  0xD26A, 0xFFFF, 0x158C, 0x3373, 0xFFFF, 0xB483, 0x737B, 0xFFFF, 0xF051, 0x2C20, 0x2C20, 0x2B20,
-  0x9EF7, 0x5BD6, 0x9162, 0x9162, 0x9162, 0x9162, 0x9162, 0x9162, 0x9162, 0xDAC5, 0xFFFF, 0x4C20,
-  0x2C20, 0x2C20, 0x979C, 0xFFFF, 0xCD30, 0x2C20, 0x2C20, 0x2C20, 0x2B20, 0x9162, 0xFFFF, 0x3694,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0xFDE6, 0x5BCE, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2B20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x2C20, 0x2C18, 0x5EEF, 0x1AC6, 0x2B20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4B20,
-  0x58B5, 0xFFFF, 0x6C20, 0x4C20, 0x4B20, 0x979C, 0xFFFF, 0x2E39, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x715A, 0xFFFF, 0x537B, 0x4C20, 0x4C20, 0xCF49, 0xFFFF, 0xF58B, 0x4B20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4B18, 0x1DE7, 0x5BD6, 0x4B20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4B18, 0xFFFF, 0x58B5, 0x4B20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x9162, 0xFFFF, 0x1373, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x6C20, 0xDFFF, 0x79B5,
-  0x4B20, 0x4C20, 0x4B18, 0x7EEF, 0xDABD, 0x4B20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4B20,
-  0xF8AC, 0xFFFF, 0xAC28, 0x4C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x2C20, 0x4C20, 0x1AC6, 0x3DE7, 0x4B18, 0x2C18,
-  0x2C18, 0x4C20, 0x4C20, 0x4C20, 0x2C20, 0x4C20, 0x4C20, 0x4C20, 0x2C20, 0x2C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4B18, 0xFFFF, 0x58B5, 0x4B20, 0x4C20, 0x4C20, 0x4C20, 0x2C20, 0x2C20, 0x2C20,
-  0xCF49, 0xFFFF, 0xB483, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x2B20, 0xF58B, 0xFFFF, 0xD26A, 0x4C20,
-  0x4C20, 0x4C20, 0x4B20, 0x9CD6, 0xBCDE, 0x4B20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0xF58B, 0xFFFF, 0xAF49, 0x4C20, 0x4C20, 0x4B20, 0xDFFF, 0x18AD, 0xFDE6, 0xFDE6, 0x8C20, 0x4B20,
-  0x5BCE, 0x7EF7, 0x969C, 0xFFFF, 0x4E39, 0x4C20, 0x4C20, 0x4B18, 0x9EF7, 0xDABD, 0x4B18, 0x4B20,
-  0x4B20, 0x4B20, 0x4B20, 0x4B20, 0x4B18, 0xF8AC, 0xFFFF, 0x6C20, 0x4C20, 0x4B20, 0x979C, 0xFFFF,
-  0xCD30, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4B20, 0xDCDE, 0x5EEF, 0x8C28, 0x4C20, 0x4C20, 0x4C20,
-  0x2B18, 0xFDE6, 0x5BCE, 0x2C20, 0x2C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x2C20, 0x2C20,
-  0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4B20, 0x4B20, 0x2C20, 0x2C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x2C20, 0x2C20, 0x2C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x2C20, 0x2C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x2C20, 0x2C20, 0x2C20, 0x2C20, 0x2B20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x2B18, 0x2B18, 0x4C20, 0x2B18, 0x2B18, 0x4C18, 0x4C18, 0x4C18, 0x4C18, 0x4C20, 0x4B18, 0xDABD,
-  0xDFFF, 0x1373, 0x6E41, 0x4E39, 0x6E41, 0x6E41, 0x6E41, 0xB262, 0x9EF7, 0x9CD6, 0x4B18, 0x4C18,
-  0x4B18, 0x126B, 0xFFFF, 0x38AD, 0x8F41, 0x6E41, 0x6E41, 0x6E41, 0x6E41, 0xCF49, 0x1AC6, 0xFFFF,
-  0xCF49, 0x2B18, 0x2B18, 0x8C20, 0x9EF7, 0x1DE7, 0x305A, 0x6E41, 0x6E41, 0x6E41, 0x6E41, 0x6F41,
-  0xF58B, 0xFFFF, 0xB79C, 0x4B20, 0x4C20, 0x4C18, 0x4C18, 0x4C18, 0x4C18, 0x4C18, 0x4B18, 0xFFFF,
-  0x58AD, 0x4B18, 0x4C18, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x0D31, 0xDFFF, 0x9CD6, 0xF051,
-  0x6E41, 0x6E41, 0x6E41, 0x6E41, 0x8F41, 0xB79C, 0xFFFF, 0xB483, 0x2B18, 0x2B18, 0x4B18, 0x7EEF,
-  0xDABD, 0x4B20, 0x2B18, 0x2B18, 0x4C20, 0x4B20, 0x4C20, 0x4B20, 0xF8AC, 0xFFFF, 0xAC28, 0x4C20,
-  0x4C20, 0x2C20, 0x4B20, 0x4B20, 0x4C20, 0x4C20, 0x4C18, 0x4C18, 0x4C18, 0x4C18, 0x4C18, 0x4C18,
-  0x4C18, 0x4C18, 0x2C18, 0x2B18, 0x1AC6, 0x3DE7, 0x4B18, 0x2C18, 0x2C18, 0x2B18, 0x4C20, 0x4C20,
-  0x4C18, 0x4C18, 0x4C18, 0x4C18, 0x4C18, 0x4C18, 0x8C20, 0x6E41, 0x6E41, 0x6E41, 0x6E39, 0xFFFF,
-  0x99BD, 0x6E41, 0x6E41, 0x6E41, 0x2E39, 0x4C20, 0x2C20, 0x4C20, 0xCF49, 0xFFFF, 0xB483, 0x2B18,
-  0x2B18, 0x4C20, 0x4C18, 0x4C18, 0xCD28, 0xBFF7, 0x5BCE, 0x2B18, 0x4C18, 0x4C18, 0x4B18, 0x9CD6,
-  0xBCDE, 0x4B20, 0x4C20, 0x4C20, 0x2B18, 0x2B18, 0x4C20, 0x4C20, 0xF58B, 0xFFFF, 0xAF49, 0x4C20,
-  0x4C20, 0x4B18, 0x7EEF, 0xBFF7, 0xFFFF, 0xB162, 0x4B18, 0x4B18, 0xEF49, 0xFFFF, 0xBFF7, 0xFFFF,
-  0x8C28, 0x4C20, 0x4C20, 0x4B18, 0x9EF7, 0xDABD, 0x4B20, 0x4C20, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x4B20, 0xF8AC, 0xFFFF, 0x4C20, 0x4C20, 0x4B20, 0x979C, 0xFFFF, 0xCD30, 0x4C18, 0x4C18, 0x4C18,
-  0x4C18, 0x4B20, 0x737B, 0xFFFF, 0x537B, 0x4C18, 0x4C18, 0x4C18, 0x4B18, 0xFDE6, 0x7BD6, 0x4F41,
-  0x6E41, 0x6E41, 0x4E41, 0x6E41, 0x6E41, 0x4E41, 0x4E41, 0xCD30, 0x2C20, 0x2C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C18, 0x4C18, 0x4C18, 0x4C18, 0x4B18, 0x4B18, 0x4B18, 0x4C18, 0x4C18,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C18, 0x4B18, 0x4B18,
-  0x4C18, 0x4C18, 0x4C20, 0x4C20, 0x4C20, 0x4B18, 0x4C18, 0x4C18, 0x4C18, 0x2B18, 0x2B18, 0x4C20,
-  0x4C20, 0x4C20, 0x4C18, 0x4C18, 0x4C18, 0x4C18, 0x4C18, 0x4C18, 0x4C20, 0x4C20, 0x4C20, 0x2C20,
-  0x2C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x2C20, 0x2C20, 0x4C20, 0x4C20,
-  0x2B18, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20,
-  0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x4C20, 0x2C20, 0x2C20, 0x4C20, 0x2C20,
-  0x2C20, 0x4C20, 0x4C20, 0x2B18, 0x2B18, 0x4C18, 0x4C18, 0x4C18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x8E41, 0x5EEF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9EF7, 0xF051, 0x2B18, 0x2B18, 0x2B18, 0x4C20, 0xB9BD, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x969C, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x1273, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDCDE, 0xED30, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xFFFF, 0x38AD, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xD583, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0x3BCE, 0x8C20, 0x2B18, 0x2B18, 0x2B18, 0x7EEF, 0xBABD, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xF8AC, 0xFFFF, 0x8C28, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x1AC6, 0x3DE7, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x537B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xDFFF, 0x2B18, 0x2B18, 0x2B18, 0xAF49, 0xFFFF, 0xB483, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0xD7A4, 0xFFFF, 0x1052, 0x2B18, 0x2B18, 0x2B18, 0x9CD6, 0xBCDE, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xD583, 0xFFFF, 0xAF49, 0x4C20, 0x4C20, 0x2B18, 0xDCDE, 0xFFFF,
-  0xDAC5, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x18AD, 0xFFFF, 0x9EF7, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x9EF7, 0xBABD, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xF8AC, 0xFFFF, 0x4C20,
-  0x2B18, 0x2B18, 0x969C, 0xFFFF, 0xCD30, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x8C20, 0x7EEF,
-  0xDCDE, 0x4B20, 0x2B18, 0x2B18, 0x2B18, 0xFDE6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0x99BD, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x4C20, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x4C20, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x4C20, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x4C20, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xED30, 0x737B, 0x158C, 0x158C, 0x158C, 0x158C, 0x158C, 0x947B,
-  0x0D31, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x4B20, 0xB162, 0x158C, 0x158C, 0x158C, 0x158C,
-  0x158C, 0xF58B, 0x3052, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x8E41, 0xD483, 0x158C,
-  0x158C, 0x158C, 0x158C, 0x158C, 0x3373, 0x8C28, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0xF58B, 0x9162, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0xEF49, 0xF583, 0x158C, 0x158C, 0x158C, 0x158C, 0x158C, 0xF26A, 0x6C20, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0xB483, 0xD26A, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x715A, 0x158C, 0x4C20, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xF26A, 0x947B, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xAF49, 0x158C,
-  0x158C, 0x158C, 0x158C, 0x158C, 0x158C, 0x158C, 0x158C, 0x158C, 0xF58B, 0x2B18, 0x2B18, 0x2B18,
-  0xCD30, 0x158C, 0xCF49, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x0D31, 0x158C, 0x3052,
-  0x2B18, 0x2B18, 0x2B18, 0x3373, 0x5373, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0xEF49, 0x158C, 0xCD28, 0x2B18, 0x2B18, 0x2B18, 0x3373, 0x158C, 0x2E39, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0xCD30, 0x158C, 0x947B, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xB483, 0xD26A, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x715A, 0xF58B, 0x2B18, 0x2B18, 0x2B18, 0x305A, 0x158C,
-  0x6C20, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x9162, 0x158C, 0xCD28, 0x2B18, 0x2B18,
-  0x2B18, 0x737B, 0x158C, 0x158C, 0x158C, 0x158C, 0x158C, 0x158C, 0x158C, 0x158C, 0x158C, 0xD26A,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xAC28, 0x4E39, 0x4E39, 0x4E39, 0x4E39,
-  0x4E39, 0x4E39, 0x4E39, 0x4E39, 0x4E39, 0x0D31, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x4C20,
-  0x2E39, 0x4E39, 0x4E39, 0x4E39, 0x4E39, 0x0D31, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x4B18,
-  0x2E39, 0x4E39, 0x4E39, 0x4E39, 0x4E39, 0x4E39, 0x4E39, 0x2E39, 0x6C20, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xED30, 0x4E39, 0x4E39, 0x4E39, 0x4E39,
-  0x2E39, 0x4C20, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x8C28, 0x4E39, 0x4E39,
-  0x4E39, 0x4E39, 0x4E39, 0xAC28, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xAC28, 0x4E39, 0x6C20,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x8C28, 0x4E39, 0x6C20, 0x2B18, 0x2B18, 0x2B18,
-  0x2E39, 0x4E39, 0x4E39, 0x4E39, 0x4E39, 0x4E39, 0x4E39, 0x2E39, 0x8C20, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x8C28, 0x4E39, 0x4E39, 0x4E39, 0x2E39, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x4B18, 0x2E39, 0x0D31, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0xED30, 0xED30, 0x2B18, 0x2B18, 0x2B18, 0x8C28, 0x4E39, 0x4E39, 0x4E39, 0x4E39,
-  0x4E39, 0x4E39, 0x4E39, 0x4E39, 0x4E39, 0xED30, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x0D31, 0x4E39, 0x4E39, 0x4E39, 0x4E39, 0x0E39, 0x4B20, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x0D31, 0x2E39, 0x4C20, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xAC28, 0x2E39, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2E39, 0x4E39, 0x4E39, 0x4E39,
-  0xAC28, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xED30, 0x4E39, 0x4E39, 0x4E39, 0x4E39,
-  0x4E39, 0x4E39, 0x4E39, 0xCD28, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x4C20, 0x4E39, 0x4E39,
-  0x4E39, 0x4E39, 0x4E39, 0x4E39, 0x4E39, 0x2E39, 0x4C20, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0xF8AC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0x7EEF, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xB26A, 0x3DEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xDCDE, 0xF049, 0x2B18, 0x2B18, 0x2B18, 0xAF49, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBEF7, 0x158C, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x6F41, 0x9CD6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7EEF, 0x5373, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x6C20, 0xF7A4, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF,
-  0x58B5, 0x8C28, 0x2B18, 0x2B18, 0x2B18, 0x769C, 0xFFFF, 0x1AC6, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x8C28, 0xFDE6, 0xFFFF, 0x747B, 0x2B18, 0x2B18, 0xCD28, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0xB7A4, 0x4C20, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x3BCE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD26A, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0xCF49, 0xFFFF, 0xFFFF, 0xD7A4, 0x4C20, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xDCDE, 0x7BD6,
-  0x2B18, 0x2B18, 0x2B18, 0x3694, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFDE6, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x1052, 0xFDDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0x3DE7, 0x9162, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x9EF7, 0xFFFF, 0x3BCE, 0xED30,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xF7A4, 0xFFFF, 0x8C20, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x515A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBCDE, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0xBCDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFAC5, 0xED30, 0x2B18, 0x2B18, 0x2B18, 0xD26A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0x7EEF, 0x5373, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x18AD,
-  0xFFFF, 0x3594, 0x3594, 0x3594, 0x3594, 0x3594, 0x3594, 0x3594, 0x3594, 0xD483, 0x2B18, 0x2B18,
-  0x2B18, 0x8F41, 0xDFFF, 0x3DE7, 0x769C, 0x3594, 0x3594, 0x3594, 0x3594, 0xB79C, 0x9EF7, 0x7EEF,
-  0xCD28, 0x2B18, 0x2B18, 0xAF49, 0xFFFF, 0xDAC5, 0x3594, 0x3594, 0x3594, 0x3594, 0x3594, 0x5694,
-  0x9CD6, 0xFFFF, 0x3373, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x6C20, 0xFDE6, 0xBFF7, 0xF7A4,
-  0x3594, 0x3594, 0x3594, 0x3594, 0x7694, 0xFDE6, 0xFFFF, 0x3052, 0x2B18, 0x2B18, 0x2B18, 0x5694,
-  0xFFFF, 0x1AC6, 0x3594, 0x3594, 0x3594, 0x3594, 0x3594, 0xB9BD, 0xFFFF, 0x18AD, 0x2B18, 0x2B18,
-  0x2B18, 0x969C, 0xFFFF, 0xFFFF, 0x947B, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xB7A4, 0xFFFF, 0xFFFF,
-  0x747B, 0x2B18, 0x2B18, 0xCD30, 0xFFFF, 0x5BCE, 0x3594, 0x3594, 0x3594, 0x3594, 0x3594, 0x5594,
-  0x1ACE, 0xFFFF, 0x158C, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x8F41, 0xFFFF, 0x1ACE, 0x3594,
-  0x3594, 0xBFF7, 0x1AC6, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xF049, 0xFFFF, 0x9EF7, 0xFFFF,
-  0x1AC6, 0xCD28, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xFCDE, 0x7BD6, 0x2B18, 0x2B18, 0x2B18, 0x1052,
-  0x3594, 0x3594, 0x3594, 0xD7A4, 0xFFFF, 0x1AC6, 0x3594, 0x3594, 0x3594, 0x947B, 0x2B18, 0x2B18,
-  0x2B18, 0xCD30, 0x7EF7, 0x7EF7, 0xB69C, 0x3594, 0x3594, 0x3594, 0x3594, 0x969C, 0x5DEF, 0xDFFF,
-  0x6E41, 0x2B18, 0x2B18, 0x2B18, 0x9EF7, 0xBEF7, 0xFFFF, 0x1DE7, 0xAF41, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0xF8A4, 0xFFFF, 0x8C20, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x79B5,
-  0xFFFF, 0x5694, 0x3594, 0xD9BD, 0xFFFF, 0x3052, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xBCDE,
-  0x5EEF, 0x3594, 0x3594, 0x3594, 0x3594, 0x3594, 0x3594, 0x58B5, 0xFFFF, 0x1AC6, 0x2B18, 0x2B18,
-  0x2B18, 0xD26A, 0xFFFF, 0x79B5, 0x3594, 0x3594, 0x3594, 0x3594, 0x3594, 0x7694, 0xFDE6, 0xFFFF,
-  0x3052, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x18AD, 0xFFFF, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xF58B, 0xFFFF, 0xEF49,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x3373, 0xFFFF, 0xF26A, 0x2B18, 0x2B18, 0xAF49,
-  0xFFFF, 0xB483, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x8C28, 0x9EF7, 0xFAC5, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x3052, 0xFFFF, 0xD483, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2E39, 0xFFFF, 0xF8AC, 0x2B18, 0x2B18, 0x2B18, 0xFDE6, 0xBCDE, 0x4B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x1AC6, 0xBFF7, 0x4B18, 0x2B18, 0x2B18, 0x969C, 0xFFFF, 0x79B5,
-  0xBFF7, 0x4E39, 0x2B18, 0x2B18, 0x3052, 0xFFFF, 0x99B5, 0xFFFF, 0x747B, 0x2B18, 0x2B18, 0xCD30,
-  0xFFFF, 0xB79C, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x4B18, 0xFDDE, 0xFDDE, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xB79C, 0xFFFF, 0xEF49, 0x2B18, 0x2B18, 0x18AD, 0xFFFF, 0x6E41,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xF049, 0xFFFF, 0xD483, 0xF7A4, 0xFFFF, 0xFDE6, 0x6F41, 0x2B18,
-  0x2B18, 0x2B18, 0xFCDE, 0x7BD6, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x6E39,
-  0xFFFF, 0x158C, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x1373, 0xFFFF, 0xF26A,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x3052, 0xFFFF, 0xF58B, 0x2B18, 0x2B18, 0x2B18,
-  0x9EF7, 0xB9BD, 0x737B, 0xDFFF, 0xBEF7, 0xD262, 0x2B18, 0x2B18, 0x2B18, 0xF8A4, 0xFFFF, 0x8C20,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xED30, 0xDFFF, 0xDAC5, 0x2B18, 0x2B18, 0x4E39,
-  0xFFFF, 0x58B5, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xBCDE, 0xBCDE, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x18AD, 0xFFFF, 0x0E31, 0x2B18, 0x2B18, 0xD26A, 0xFFFF, 0xD262,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2D39, 0xFFFF, 0xF8AC, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x18AD, 0xFFFF, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x969C, 0xFFFF, 0xCD28, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x1052, 0xFFFF, 0x747B, 0x2B18, 0x2B18, 0xAF49, 0xFFFF, 0x947B, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xDCDE, 0x7BD6, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0xB162, 0xFFFF, 0xD262, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xBFF7, 0x99B5,
-  0x2B18, 0x2B18, 0x2B18, 0x7EEF, 0xB9BD, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0xF7A4, 0xFFFF, 0x8C20, 0x2B18, 0x2B18, 0x969C, 0xFFFF, 0x6E39, 0x5EEF, 0x3BCE, 0x2B18, 0x8C28,
-  0xFDE6, 0x9CD6, 0x3052, 0xFFFF, 0x747B, 0x2B18, 0x2B18, 0xCD28, 0xFFFF, 0xB79C, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xFAC5, 0x5EEF, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x6C20,
-  0x7EEF, 0x9CD6, 0x2B18, 0x2B18, 0x2B18, 0xF051, 0xFFFF, 0x769C, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0xEF49, 0xFFFF, 0x947B, 0x2B18, 0xB483, 0xDFFF, 0x9EF7, 0x9162, 0x2B18, 0x2B18, 0xDCDE, 0x7BD6,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x6E39, 0xFFFF, 0x158C, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x947B, 0xFFFF, 0xCF49, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x0D31, 0xFFFF, 0x769C, 0x2B18, 0x2B18, 0x2B18, 0x9EF7, 0xB9BD, 0x2B18, 0x3052,
-  0x7EEF, 0xFFFF, 0x158C, 0x2B18, 0x2B18, 0xF7A4, 0xFFFF, 0x8C20, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0xD583, 0xFFFF, 0xB162, 0x2B18, 0x2B18, 0x2B18, 0xDAC5, 0xBFFF, 0xCD28, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0xBCDE, 0xBCDE, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0xD583, 0xFFFF, 0xAF41, 0x2B18, 0x2B18, 0xD26A, 0xFFFF, 0xD262, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0xBFFF, 0x99BD, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x18AD,
-  0xFFFF, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x969C, 0xFFFF, 0xCD28, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x1052, 0xFFFF,
-  0x747B, 0x2B18, 0x2B18, 0xAF49, 0xFFFF, 0x947B, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0xDCDE, 0x7BD6, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xB162, 0xFFFF, 0xD262, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x505A, 0x8F41, 0x2B18, 0x2B18, 0x2B18, 0x7EEF,
-  0xB9BD, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xF7A4, 0xFFFF, 0x8C20, 0x2B18,
-  0x2B18, 0x969C, 0xFFFF, 0xCD28, 0x3373, 0xFFFF, 0xB483, 0xD7A4, 0xFFFF, 0xF049, 0x1052, 0xFFFF,
-  0x747B, 0x2B18, 0x2B18, 0xCD28, 0xFFFF, 0xB79C, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0xFAC5, 0x5EEF, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x1373, 0xFFFF, 0x737B, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x9CD6, 0x5EEF, 0x6C20, 0x2B18, 0x2B18, 0x2B18, 0xEF49, 0xFFFF, 0x947B, 0x2B18,
-  0x2B18, 0x505A, 0x7EF7, 0xFFFF, 0xD583, 0x2B18, 0xDCDE, 0x7BD6, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x6E39, 0xFFFF, 0x158C, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x947B, 0xFFFF, 0xCF49, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x0D31, 0xFFFF,
-  0x769C, 0x2B18, 0x2B18, 0x2B18, 0x9EF7, 0xB9BD, 0x2B18, 0x2B18, 0x2D39, 0xBCDE, 0xFFFF, 0x59B5,
-  0x6C20, 0xF7A4, 0xFFFF, 0x8C20, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xFDE6, 0x3DE7,
-  0x4B18, 0x2B18, 0x2B18, 0x2B18, 0xB162, 0xFFFF, 0xB483, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xBCDE,
-  0xBCDE, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xD583, 0xFFFF, 0x8F41, 0x2B18,
-  0x2B18, 0xD26A, 0xFFFF, 0xD262, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xBFFF,
-  0x99B5, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x18AD, 0xFFFF, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x969C, 0xFFFF, 0xCC28,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x1052, 0xFFFF, 0x747B, 0x2B18, 0x2B18, 0xAF41,
-  0xFFFF, 0xB47B, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xCD28, 0xBFF7, 0xFAC5, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xB162, 0xFFFF, 0xD262, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x7EEF, 0xB9BD, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xF7A4, 0xFFFF, 0x8C20, 0x2B18, 0x2B18, 0x969C, 0xFFFF, 0xCC28,
-  0x2B18, 0x1AC6, 0xBFF7, 0xFFFF, 0xF7A4, 0x2B18, 0x1052, 0xFFFF, 0x747B, 0x2B18, 0x2B18, 0xCD28,
-  0xFFFF, 0xB79C, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x6C20, 0x1DE7, 0xBCDE, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x3BCE, 0x9EF7, 0xAC20, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x747B, 0xFFFF,
-  0xF26A, 0x2B18, 0x2B18, 0x2B18, 0xEF49, 0xFFFF, 0xB47B, 0x2B18, 0x2B18, 0x2B18, 0x6E39, 0xDCDE,
-  0xFFFF, 0x38AD, 0x1DE7, 0x7BD6, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x6E39,
-  0xFFFF, 0x158C, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x947B, 0xFFFF, 0xCF49,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x0D31, 0xFFFF, 0x7694, 0x2B18, 0x2B18, 0x2B18,
-  0x9EF7, 0xB9BD, 0x2B18, 0x2B18, 0x2B18, 0xAC20, 0xB9BD, 0xFFFF, 0x7BD6, 0xB9BD, 0xFFFF, 0x8C20,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x515A, 0xFFFF, 0x358C, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x4B18, 0x3DEF, 0xDCDE, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xBCDE, 0xBCDE, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x79B5, 0xFFFF, 0xED30, 0x2B18, 0x2B18, 0xD262, 0xFFFF, 0xD262,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x6E41, 0xFFFF, 0xD7A4, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x18AD, 0xFFFF, 0x38AD, 0x38AD, 0x38AD, 0x38AD, 0x38AD, 0x38AD, 0x38AD,
-  0x38AD, 0x0D31, 0x2B18, 0x2B18, 0x2B18, 0x969C, 0xFFFF, 0xCC28, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x1052, 0xFFFF, 0x737B, 0x2B18, 0x2B18, 0xAF41, 0xFFFF, 0x7BD6, 0x38AD, 0x38AD,
-  0x38AD, 0x38AD, 0x38AD, 0x58B5, 0x1DE7, 0xFFFF, 0xB162, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0xB162, 0xFFFF, 0xD262, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x7EEF, 0xB9BD, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0xF7A4, 0xFFFF, 0x8C20, 0x2B18, 0x2B18, 0x969C, 0xFFFF, 0xCC28, 0x2B18, 0x8E41, 0xDFFF, 0x5EEF,
-  0xCC28, 0x2B18, 0x1052, 0xFFFF, 0x737B, 0x2B18, 0x2B18, 0xCD28, 0xFFFF, 0xDCDE, 0x38AD, 0x38AD,
-  0x38AD, 0x38AD, 0x38AD, 0x58AD, 0xDCDE, 0xFFFF, 0xB483, 0x2B18, 0x2B18, 0x2B18, 0x8E41, 0xFFFF,
-  0xF7A4, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xAC28, 0xBFF7, 0x1AC6, 0x2B18, 0x2B18, 0x2B18,
-  0xEF49, 0xFFFF, 0xB47B, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xAC28, 0xDAC5, 0xFFFF, 0xFFFF, 0x7BD6,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x6E39, 0xFFFF, 0x158C, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x947B, 0xFFFF, 0xCF49, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x0D31, 0xFFFF, 0x7694, 0x2B18, 0x2B18, 0x2B18, 0x9EF7, 0xB9BD, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x4B18, 0x5694, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C20, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x79B5, 0xFFFF, 0x2D31, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x5594, 0xFFFF, 0x3052,
-  0x2B18, 0x2B18, 0x2B18, 0xBCDE, 0x7EF7, 0x38AD, 0x38AD, 0x38AD, 0x38AD, 0x38AD, 0x38AD, 0x3BCE,
-  0xFFFF, 0xB9BD, 0x2B18, 0x2B18, 0x2B18, 0xD262, 0xFFFF, 0x1AC6, 0x38AD, 0x38AD, 0x38AD, 0x38AD,
-  0x38AD, 0x79B5, 0x5EEF, 0xDFFF, 0xEF49, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x18AD,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCF49, 0x2B18, 0x2B18,
-  0x2B18, 0x969C, 0xFFFF, 0xCC28, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x1052, 0xFFFF,
-  0x737B, 0x2B18, 0x2B18, 0xAF41, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0x1DE7, 0x5373, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xB162, 0xFFFF, 0xD262, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x7EEF,
-  0xB9BD, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xF7A4, 0xFFFF, 0x8C20, 0x2B18,
-  0x2B18, 0x969C, 0xFFFF, 0xCC28, 0x2B18, 0x2B18, 0x6E39, 0x0D31, 0x2B18, 0x2B18, 0x1052, 0xFFFF,
-  0x737B, 0x2B18, 0x2B18, 0xCD28, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0x5EEF, 0xF58B, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x969C, 0xFFFF, 0xEF49, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x18AD, 0xFFFF, 0x4E39, 0x2B18, 0x2B18, 0xEF49, 0xFFFF, 0xB47B, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x4B18, 0x969C, 0xFFFF, 0x7BD6, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x6E39, 0xFFFF, 0x158C, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x947B, 0xFFFF, 0xCF49, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x0D31, 0xFFFF,
-  0x7694, 0x2B18, 0x2B18, 0x2B18, 0x9EF7, 0xB9BD, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x126B, 0xBFF7, 0xFFFF, 0x8C20, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xCC28, 0xDFFF, 0xD9BD, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2D39, 0xFFFF, 0x38AD, 0x2B18, 0x2B18, 0x2B18, 0xBCDE,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBFF7, 0x38AD, 0xAC28, 0x2B18, 0x2B18,
-  0x2B18, 0xD262, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDCDE, 0xB162,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x18A5, 0xFFFF, 0x4B18, 0x4B18, 0x4B18,
-  0x4B18, 0x4B18, 0x4B18, 0x4B18, 0x4B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x969C, 0xFFFF, 0xCC28,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x1052, 0xFFFF, 0x737B, 0x2B18, 0x2B18, 0xAF41,
-  0xFFFF, 0xB47B, 0x4B18, 0x4B18, 0x4B18, 0x4B18, 0x9BD6, 0xBEF7, 0xAC20, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xB162, 0xFFFF, 0xD162, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x7EEF, 0xB9BD, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xF7A4, 0xFFFF, 0x8C20, 0x2B18, 0x2B18, 0x969C, 0xFFFF, 0xCC28,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x1052, 0xFFFF, 0x737B, 0x2B18, 0x2B18, 0xCC28,
-  0xFFFF, 0xB79C, 0x4B18, 0x4B18, 0x4B18, 0x4B18, 0x4B18, 0x4B18, 0x2A18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0xD9BD, 0xBFF7, 0xF26A, 0xF26A, 0xF26A, 0xF26A, 0xF26A, 0xF26A, 0xF26A, 0xD7A4,
-  0xFFFF, 0x715A, 0x2B18, 0x2B18, 0xEF49, 0xFFFF, 0x947B, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0xFCDE, 0x7BD6, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x6E39,
-  0xFFFF, 0x158C, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x937B, 0xFFFF, 0xCF49,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x0D31, 0xFFFF, 0x7694, 0x2B18, 0x2B18, 0x2B18,
-  0x9EF7, 0xB9BD, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xF7A4, 0xFFFF, 0x8C20,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xCF49, 0xFFFF, 0x38AD, 0xF26A, 0xF26A, 0xF26A, 0xF26A, 0xF26A,
-  0xF26A, 0xF26A, 0x5EEF, 0x5BCE, 0x2B18, 0x2B18, 0x2B18, 0xBCDE, 0xBCDE, 0x4B18, 0x4B18, 0x4B18,
-  0x4B18, 0x4B18, 0x4B18, 0x2A18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xD262, 0xFFFF, 0xD162,
-  0x4B18, 0x4B18, 0x4B18, 0x4B18, 0x4B18, 0x2A18, 0x2A18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x18A5, 0xFFFF, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x969C, 0xFFFF, 0xCC28, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x1052, 0xFFFF, 0x737B, 0x2B18, 0x2B18, 0xAF41, 0xFFFF, 0x947B, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x126B, 0xFFFF, 0xB47B, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0xB162, 0xFFFF, 0xD162, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x7EEF, 0xB9BD, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0xF7A4, 0xFFFF, 0x8C20, 0x2B18, 0x2B18, 0x969C, 0xFFFF, 0xCC28, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x1052, 0xFFFF, 0x737B, 0x2B18, 0x2B18, 0xCC28, 0xFFFF, 0xB79C, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xDABD, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x715A, 0x2B18, 0x2B18,
-  0xEF49, 0xFFFF, 0x947B, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xDCDE, 0x7BD6,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x6E39, 0xFFFF, 0x158C, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x937B, 0xFFFF, 0xCF49, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x0D31, 0xFFFF, 0x7694, 0x2B18, 0x2B18, 0x2B18, 0x9EF7, 0xB9BD, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xF7A4, 0xFFFF, 0x8C20, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0xEF49, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BCE,
-  0x2B18, 0x2B18, 0x2B18, 0xBCDE, 0xBCDE, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xD262, 0xFFFF, 0xD162, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x17A5,
-  0xFFFF, 0x2B10, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x969C, 0xFFFF, 0xCC28, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x1052, 0xFFFF,
-  0x737B, 0x2B18, 0x2B18, 0xAF41, 0xFFFF, 0xB47B, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x6B18, 0x3DE7,
-  0x1DE7, 0x4B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xB162, 0xFFFF, 0xD162, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xDCDE, 0xD7A4, 0x2B18, 0x2B18, 0x2B18, 0x7EEF,
-  0xB9BD, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xF7A4, 0xFFFF, 0x8C20, 0x2B18,
-  0x2B18, 0x969C, 0xFFFF, 0xCC28, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x1052, 0xFFFF,
-  0x737B, 0x2B18, 0x2B18, 0xCC28, 0xFFFF, 0xB79C, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xDABD, 0xBEF7, 0x705A, 0x705A, 0x705A, 0x705A,
-  0x705A, 0x705A, 0x705A, 0x7694, 0xFFFF, 0x705A, 0x2B18, 0x2B18, 0xEF49, 0xFFFF, 0x947B, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xFCDE, 0x7BD6, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x6E39, 0xFFFF, 0x158C, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x937B, 0xFFFF, 0xCF49, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x0D31, 0xFFFF,
-  0x7694, 0x2B18, 0x2B18, 0x2B18, 0x9EF7, 0xB9BD, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0xF7A4, 0xFFFF, 0x8C20, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xEF49, 0xFFFF, 0xF7A4, 0x705A,
-  0x715A, 0x715A, 0x715A, 0x715A, 0x715A, 0x705A, 0x3DE7, 0x5BCE, 0x2B18, 0x2B18, 0x2B18, 0xBCDE,
-  0xBCDE, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0xD262, 0xFFFF, 0xD162, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2A18, 0x17A5, 0xFFFF, 0x2A10, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2A18, 0x5694, 0xFFFF, 0x0D31,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x5052, 0xFFFF, 0x5373, 0x2B18, 0x2B18, 0xAE41,
-  0xFFFF, 0xB47B, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2A18, 0xF483, 0xFFFF, 0xD262, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x915A, 0xFFFF, 0x126B, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x6B18, 0xDFFF, 0x78B5, 0x2A18, 0x2B18, 0x2B18, 0x5EEF, 0xFAC5, 0x2A18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2A18, 0x58AD, 0xFFFF, 0x6B18, 0x2B18, 0x2B18, 0x969C, 0xFFFF, 0xCC28,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x0F52, 0xFFFF, 0x737B, 0x2B18, 0x2B18, 0xCC28,
-  0xFFFF, 0xB79C, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0xD9BD, 0x9EF7, 0x2A10, 0x2A18, 0x2A18, 0x2A18, 0x2A18, 0x2B18, 0x2B18, 0xF26A,
-  0xFFFF, 0x705A, 0x2B18, 0x2B18, 0xEF49, 0xFFFF, 0xB47B, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0xFCDE, 0x7BD6, 0x2A18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x6E39,
-  0xFFFF, 0x158C, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x7373, 0xFFFF, 0x1052,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x4E39, 0xFFFF, 0x5594, 0x2B18, 0x2B18, 0x2B18,
-  0x9EF7, 0xB9BD, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xF7A4, 0xFFFF, 0x8C20,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xEF49, 0xFFFF, 0xB47B, 0x2B18, 0x2B18, 0x2B18, 0x2A18, 0x2A18,
-  0x2A18, 0x2A10, 0xFCDE, 0x5BCE, 0x2B18, 0x2B18, 0x2B18, 0xBCDE, 0xBCDE, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xD262, 0xFFFF, 0xD162,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2A18, 0x17A5, 0xFFFF, 0x2A10, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xD162, 0xFFFF, 0x38AD, 0x8E41, 0x4E39, 0x4E39, 0x4E39,
-  0x4E39, 0xAF41, 0x1AC6, 0xFFFF, 0xCF41, 0x2B18, 0x2B18, 0xAE41, 0xFFFF, 0xB47B, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0xCC28, 0xBEF7, 0x5BCE, 0x2A18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x0D31, 0xDFFF, 0x9BD6, 0xEF49, 0x4E39, 0x4E39, 0x4E39, 0x4E39, 0x6E39, 0x969C, 0xFFFF, 0xB47B,
-  0x2A18, 0x2B18, 0x2A18, 0xD9BD, 0xDFFF, 0x126B, 0x4E39, 0x4E39, 0x4E39, 0x4E39, 0x4E39, 0xB162,
-  0x9EF7, 0x9CD6, 0x2A18, 0x2B18, 0x2A18, 0x969C, 0xFFFF, 0xCC28, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x0F52, 0xFFFF, 0x737B, 0x2B18, 0x2B18, 0xCC28, 0xFFFF, 0xB79C, 0x2A18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2A18, 0xD9BD, 0x9EF7,
-  0x2A18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xF26A, 0xFFFF, 0x705A, 0x2B18, 0x2B18,
-  0xEF49, 0xFFFF, 0xB47B, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2A18, 0xFCDE, 0x7BD6,
-  0x2A18, 0x2B18, 0x2B18, 0x8C20, 0x4E39, 0x4E39, 0x4E39, 0x5052, 0xFFFF, 0x969C, 0x4D39, 0x4E39,
-  0x4E39, 0x0D31, 0x2B18, 0x2B18, 0x2B18, 0xEF49, 0xFFFF, 0xFAC5, 0xAE41, 0x4E39, 0x4E39, 0x4E39,
-  0x4E39, 0x8E41, 0x58B5, 0xFFFF, 0xB162, 0x2B18, 0x2B18, 0x2A18, 0x9EF7, 0xB9BD, 0x2A18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2A18, 0xF7A4, 0xFFFF, 0x8B20, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0xEF49, 0xFFFF, 0xB47B, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2A18, 0xFCDE, 0x5BCE,
-  0x2A18, 0x2B18, 0x2A18, 0xBCDE, 0xBCDE, 0x2A18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xD162, 0xFFFF, 0xD162, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2A18, 0x17A5,
-  0xFFFF, 0x2A10, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x4B18, 0xB9BD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x969C,
-  0x2A10, 0x2B18, 0x2B18, 0xAE41, 0xFFFF, 0xB47B, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2A18,
-  0xD79C, 0xFFFF, 0xEF49, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2A18, 0xD483, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x3ACE, 0x6B20, 0x2B18, 0x2B18, 0x2A18, 0x6E39,
-  0x5EEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9EF7, 0x0F4A, 0x2A18, 0x2A10,
-  0x2A18, 0x969C, 0xFFFF, 0xCC28, 0x2B18, 0x2B18, 0x2B18, 0x2A10, 0x2A10, 0x2B18, 0x0F52, 0xFFFF,
-  0x737B, 0x2B18, 0x2B18, 0xCC28, 0xFFFF, 0xB79C, 0x2A18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2A18, 0xD9BD, 0x9EF7, 0x2A18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0xF26A, 0xFFFF, 0x705A, 0x2B18, 0x2B18, 0xEF49, 0xFFFF, 0xB47B, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2A18, 0xFCDE, 0x7BD6, 0x2A10, 0x2A10, 0x2B18, 0x3594,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDE6, 0x2A18, 0x2B18,
-  0x2B18, 0x2A10, 0xB79C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x78B5,
-  0x4A18, 0x2B18, 0x2B18, 0x2A18, 0x9EF7, 0xB9BD, 0x2A18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2A18, 0xF7A4, 0xFFFF, 0x8B20, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0xEF49, 0xFFFF, 0xB47B, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2A10, 0x2A10, 0xDCDE, 0x5BCE, 0x2A10, 0x2A10, 0x2A18, 0xBCDE,
-  0xBCDE, 0x2A18, 0x2A10, 0x2B18, 0x2A10, 0x2A10, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2A10, 0xD162, 0xFFFF, 0xD162, 0x2A10, 0x2B18, 0x2B18, 0x2A10, 0x2A10, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2A10, 0x2A10, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2A10, 0x2B18, 0x2A10, 0x2A10, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2A10, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x705A, 0xF483, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A18, 0xB15A,
-  0xF483, 0x158C, 0x158C, 0x158C, 0x158C, 0xF483, 0x2F52, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0xCC28,
-  0x158C, 0xAE41, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x0D31, 0x158C, 0x0F52, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0xCF49, 0xD483, 0x158C, 0x158C, 0x158C, 0x158C,
-  0x148C, 0xD162, 0x4B18, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0xCC28, 0x7373, 0x158C, 0x158C,
-  0x158C, 0x158C, 0x158C, 0x937B, 0x0C31, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x3052, 0x158C, 0x4B18,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0xEC28, 0x158C, 0xAE41, 0x2A10, 0x2A10, 0x4B18,
-  0xF48B, 0x3052, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0xD162, 0xB47B, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x6E39,
-  0x158C, 0x0D31, 0x2A10, 0x2A10, 0xCC28, 0x158C, 0xAE41, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x5373, 0x326B, 0x2A10, 0x2A10, 0x2A10, 0x0F4A, 0x158C, 0x158C, 0x158C, 0x158C,
-  0x158C, 0x158C, 0x158C, 0x158C, 0x158C, 0x7373, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x5052,
-  0xF483, 0x158C, 0x158C, 0x158C, 0x158C, 0xF483, 0x905A, 0x2A18, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0xB47B, 0xD162, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x705A, 0xF483, 0x4B18,
-  0x2A10, 0x2B18, 0x2B18, 0x2A10, 0x2B18, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2B18, 0x2A10, 0x2A10, 0xCC28, 0x158C, 0xAE41, 0x2A10, 0x2A10, 0x2A10, 0x2B18, 0x2A10,
-  0x2A10, 0x2A10, 0x5373, 0x126B, 0x2A10, 0x2A10, 0x2A18, 0x3273, 0x3273, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2B18, 0x2B18, 0x2B18, 0x2A10, 0x4D39, 0x158C, 0x4D39,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2B18, 0x2B18, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2B18, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18,
-  0x2A10, 0x2A10, 0x2A10, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2A10, 0x2A10,
-  0x2B18, 0x2B18, 0x2B18, 0x2B18, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2B10, 0x2A10, 0x2A10, 0x2B10, 0x2B10,
-  0x2B10, 0x2B10, 0x2B10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2B10, 0x2B10, 0x2B10, 0x2B10, 0x2B10, 0x2B10, 0x2B10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2B10, 0x2B10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2B10, 0x2B10, 0x2B10, 0x2B10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2B10, 0x2B10, 0x2B10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2B10, 0x2B10, 0x2B10, 0x2B10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2B10,
-  0x2B10, 0x2B10, 0x2B10, 0x2B10, 0x2B10, 0x2B10, 0x2B10, 0x2B10, 0x2B10, 0x2B10, 0x2B10, 0x2B10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A18, 0x2A18, 0x2A18, 0x2A18,
-  0x2A18, 0x2A18, 0x2A18, 0x2A18, 0x2A18, 0x2A18, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A18, 0x2A18, 0x2A18, 0x2A18, 0x2A18, 0x2A18, 0x2A18, 0x2A18, 0x2A18, 0x2A18,
-  0x2A18, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A18, 0x2A18, 0x2A18, 0x2A18,
-  0x2A18, 0x2A18, 0x2A18, 0x2A18, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A18, 0x2A18, 0x2A18, 0x2A18, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A18, 0x2A18, 0x2A18, 0x2A18, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10, 0x2A10,
-  0x2A10, 0x2A10, 0x2A10, 0x2A10
+// Run-length compressed RGB565 data with byte swap for TFT_eSPI,
+// generated from data/splash.rgb. Each packet starts with a header
+// byte N: for N < 0x80, N+1 literal pixels follow; for N >= 0x80, a
+// single pixel follows, repeated N-0x80+2 times. Pixels are stored
+// low byte first.
+const uint8_t splash_data[] PROGMEM = {
+  0xFF, 0x68, 0xF0, 0xFF, 0x68, 0xF0, 0xBC, 0x68, 0xF0, 0x80, 0x69, 0x10, 0x80, 0x60, 0xF0, 0x93,
+  0x68, 0xF0, 0x00, 0x60, 0xF0, 0x8C, 0x68, 0xF0, 0x00, 0x69, 0x10, 0x80, 0x60, 0xF0, 0x84, 0x68,
+  0xF0, 0x82, 0x60, 0xF0, 0x84, 0x68, 0xF0, 0x80, 0x60, 0xF0, 0x84, 0x68, 0xF0, 0x82, 0x60, 0xF0,
+  0x8A, 0x68, 0xF0, 0x00, 0x60, 0xF0, 0x83, 0x68, 0xF0, 0x81, 0x69, 0x10, 0x8D, 0x68, 0xF0, 0x82,
+  0x69, 0x10, 0x8A, 0x68, 0xF0, 0x00, 0x60, 0xF0, 0x97, 0x68, 0xF0, 0x00, 0x60, 0xF0, 0x84, 0x68,
+  0xF0, 0x00, 0x69, 0x10, 0x81, 0x60, 0xF0, 0x83, 0x68, 0xF0, 0x80, 0x60, 0xF0, 0x80, 0x69, 0x10,
+  0x87, 0x68, 0xF0, 0x82, 0x60, 0xF0, 0x8A, 0x68, 0xF0, 0x81, 0x60, 0xF0, 0x81, 0x68, 0xF0, 0x80,
+  0x69, 0x10, 0x82, 0x60, 0xF0, 0x02, 0x69, 0x10, 0x68, 0xF0, 0x60, 0xF0, 0x92, 0x68, 0xF0, 0x80,
+  0x60, 0xF0, 0x8C, 0x68, 0xF0, 0x00, 0x60, 0xF0, 0x8A, 0x68, 0xF0, 0x80, 0x60, 0xF0, 0x80, 0x69,
+  0x10, 0xB8, 0x68, 0xF0, 0xFF, 0x60, 0xF0, 0xFE, 0x60, 0xF0, 0x00, 0x69, 0x10, 0x93, 0x60, 0xF0,
+  0x00, 0x68, 0xF0, 0xFF, 0x60, 0xF0, 0xFF, 0x60, 0xF0, 0xB9, 0x60, 0xF0, 0x00, 0x61, 0x10, 0xFF,
+  0x60, 0xF0, 0xFF, 0x60, 0xF0, 0xFF, 0x60, 0xF0, 0xFF, 0x60, 0xF0, 0xFF, 0x60, 0xF0, 0xFF, 0x60,
+  0xF0, 0xFF, 0x60, 0xF0, 0xFF, 0x60, 0xF0, 0xFF, 0x60, 0xF0, 0xFF, 0x60, 0xF0, 0xFF, 0x60, 0xF0,
+  0xFF, 0x60, 0xF0, 0xFF, 0x60, 0xF0, 0xFF, 0x60, 0xF0, 0xFF, 0x60, 0xF0, 0xFF, 0x60, 0xF0, 0xFF,
+  0x60, 0xF0, 0xFF, 0x60, 0xF0, 0xFF, 0x60, 0xF0, 0xAA, 0x60, 0xF0, 0x00, 0x61, 0x10, 0x84, 0x71,
+  0xF1, 0x01, 0x71, 0xD1, 0x69, 0x70, 0x80, 0x60, 0xF0, 0x00, 0x69, 0x50, 0x80, 0x71, 0xF1, 0x00,
+  0x71, 0xB1, 0x85, 0x60, 0xF0, 0x81, 0x71, 0xF1, 0x83, 0x60, 0xF0, 0x00, 0x61, 0x10, 0x88, 0x71,
+  0xF1, 0x00, 0x69, 0x50, 0x81, 0x60, 0xF0, 0x00, 0x61, 0x10, 0x81, 0x71, 0xF1, 0x00, 0x61, 0x10,
+  0x83, 0x60, 0xF0, 0x00, 0x69, 0x30, 0x86, 0x71, 0xF1, 0x01, 0x60, 0xF0, 0x71, 0xD1, 0x82, 0x71,
+  0xF1, 0x00, 0x71, 0xD1, 0x85, 0x60, 0xF0, 0x00, 0x71, 0xD1, 0x86, 0x71, 0xF1, 0x01, 0x71, 0xD1,
+  0x69, 0x71, 0xFF, 0x60, 0xF0, 0xE4, 0x60, 0xF0, 0x00, 0x69, 0x70, 0x86, 0xBD, 0xD8, 0x06, 0xAD,
+  0x17, 0x7A, 0x92, 0x69, 0x30, 0xB5, 0x57, 0xBD, 0xD8, 0xB5, 0x98, 0x69, 0x91, 0x83, 0x60, 0xF0,
+  0x00, 0x82, 0xF3, 0x80, 0xBD, 0xD8, 0x00, 0x93, 0xB4, 0x83, 0x60, 0xF0, 0x00, 0x69, 0x70, 0x88,
+  0xBD, 0xD8, 0x00, 0x82, 0xD3, 0x81, 0x60, 0xF0, 0x00, 0x82, 0xD3, 0x81, 0xBD, 0xD8, 0x00, 0x7A,
+  0x92, 0x83, 0x60, 0xF0, 0x00, 0x82, 0x92, 0x86, 0xBD, 0xD8, 0x04, 0x60, 0xF0, 0xAD, 0x17, 0xBD,
+  0xD8, 0xAD, 0x17, 0xAC, 0xF6, 0x80, 0xBD, 0xD8, 0x00, 0x7A, 0x12, 0x83, 0x60, 0xF0, 0x00, 0x7A,
+  0x52, 0x80, 0xBD, 0xD8, 0x00, 0xA4, 0x96, 0x86, 0xBD, 0xD8, 0x01, 0xAD, 0x37, 0x8B, 0x33, 0xFF,
+  0x60, 0xF0, 0xE2, 0x60, 0xF0, 0x00, 0x69, 0x70, 0x88, 0xBD, 0xD8, 0x01, 0x7A, 0x72, 0x7A, 0x92,
+  0x80, 0xBD, 0xD8, 0x00, 0xA4, 0x75, 0x82, 0x60, 0xF0, 0x04, 0x69, 0x50, 0xB5, 0x77, 0xBD, 0xD8,
+  0xB5, 0x57, 0x61, 0x30, 0x83, 0x60, 0xF0, 0x00, 0x69, 0x70, 0x88, 0xBD, 0xD8, 0x00, 0x82, 0xD3,
+  0x81, 0x60, 0xF0, 0x00, 0xA4, 0x96, 0x81, 0xBD, 0xD8, 0x00, 0xA4, 0x75, 0x83, 0x60, 0xF0, 0x00,
+  0x8B, 0x54, 0x86, 0xBD, 0xD8, 0x08, 0x60, 0xEF, 0xAD, 0x17, 0xBD, 0xD8, 0xAD, 0x17, 0x71, 0xF1,
+  0xBD, 0xB8, 0xBD, 0xD8, 0xAC, 0xF6, 0x61, 0x10, 0x81, 0x60, 0xF0, 0x04, 0x61, 0x10, 0xAD, 0x17,
+  0xBD, 0xD8, 0xB5, 0x97, 0x71, 0xF1, 0x88, 0xBD, 0xD8, 0x00, 0x93, 0xD4, 0xFF, 0x60, 0xF0, 0xE1,
+  0x60, 0xF0, 0x00, 0x69, 0x70, 0x80, 0xBD, 0xD8, 0x00, 0x93, 0xF4, 0x81, 0x61, 0x0F, 0x01, 0x61,
+  0x4F, 0x8B, 0x33, 0x80, 0xBD, 0xD8, 0x02, 0xA4, 0xB6, 0x60, 0xEF, 0x9C, 0x75, 0x80, 0xBD, 0xD8,
+  0x00, 0x7A, 0x72, 0x81, 0x60, 0xF0, 0x00, 0x9B, 0xF5, 0x80, 0xBD, 0xD8, 0x01, 0x7A, 0x92, 0x60,
+  0xEF, 0x83, 0x60, 0xF0, 0x00, 0x69, 0x70, 0x80, 0xBD, 0xD8, 0x00, 0x9C, 0x55, 0x85, 0x72, 0x11,
+  0x00, 0x69, 0x50, 0x80, 0x60, 0xF0, 0x00, 0x69, 0xB1, 0x80, 0xBD, 0xD8, 0x03, 0xA4, 0xB6, 0xBD,
+  0xD8, 0xBD, 0xB8, 0x69, 0x70, 0x82, 0x60, 0xF0, 0x03, 0x9C, 0x15, 0xBD, 0xD8, 0xAD, 0x16, 0x61,
+  0x4F, 0x83, 0x61, 0x50, 0x05, 0x60, 0xEF, 0xAD, 0x17, 0xBD, 0xD8, 0xAD, 0x17, 0x60, 0xEF, 0x93,
+  0xD4, 0x80, 0xBD, 0xD8, 0x00, 0x8B, 0x13, 0x81, 0x60, 0xF0, 0x00, 0x8B, 0x54, 0x80, 0xBD, 0xD8,
+  0x01, 0x8B, 0x33, 0x69, 0x70, 0x80, 0xBD, 0xD8, 0x01, 0x93, 0xF4, 0x61, 0x0F, 0x80, 0x58, 0xEF,
+  0x02, 0x61, 0x4F, 0x7A, 0xB2, 0xB5, 0x98, 0x80, 0xBD, 0xD8, 0x00, 0x69, 0x91, 0xFF, 0x60, 0xF0,
+  0xE0, 0x60, 0xF0, 0x00, 0x69, 0x70, 0x80, 0xBD, 0xD8, 0x00, 0x93, 0xD4, 0x82, 0x60, 0xEF, 0x0B,
+  0x58, 0xEF, 0xAD, 0x16, 0xBD, 0xD8, 0xAD, 0x37, 0x60, 0xEF, 0x69, 0x90, 0xB5, 0x98, 0xBD, 0xD8,
+  0xAD, 0x37, 0x61, 0x10, 0x60, 0xF0, 0x71, 0xF1, 0x80, 0xBD, 0xD8, 0x00, 0x9C, 0x75, 0x80, 0x60,
+  0xEF, 0x83, 0x60, 0xF0, 0x00, 0x69, 0x70, 0x80, 0xBD, 0xD8, 0x00, 0x93, 0xD4, 0x86, 0x60, 0xEF,
+  0x80, 0x60, 0xF0, 0x06, 0x8B, 0x74, 0xBD, 0xD8, 0xB5, 0x97, 0x69, 0x90, 0xBD, 0xB8, 0xBD, 0xD8,
+  0x8B, 0x54, 0x81, 0x60, 0xF0, 0x03, 0x60, 0xEF, 0xAC, 0xF6, 0xBD, 0xD8, 0x9C, 0x35, 0x85, 0x60,
+  0xEF, 0x0F, 0xAD, 0x17, 0xBD, 0xD8, 0xAD, 0x17, 0x60, 0xEF, 0x61, 0x2F, 0xB5, 0x57, 0xBD, 0xD8,
+  0xB5, 0x97, 0x69, 0x70, 0x60, 0xF0, 0x69, 0x70, 0xB5, 0x98, 0xBD, 0xD8, 0xAC, 0xF6, 0x60, 0xEF,
+  0x69, 0x70, 0x80, 0xBD, 0xD8, 0x00, 0x93, 0xD4, 0x83, 0x60, 0xEF, 0x00, 0x93, 0x94, 0x80, 0xBD,
+  0xD8, 0x00, 0x7A, 0x72, 0xFF, 0x60, 0xF0, 0xE0, 0x60, 0xF0, 0x00, 0x69, 0x70, 0x80, 0xBD, 0xD8,
+  0x01, 0x93, 0xD4, 0x60, 0xEF, 0x81, 0x60, 0xF0, 0x06, 0x61, 0x10, 0xB5, 0x57, 0xBD, 0xD8, 0xA4,
+  0x75, 0x60, 0xEF, 0x58, 0xEF, 0x83, 0x33, 0x80, 0xBD, 0xD8, 0x07, 0x8B, 0x74, 0x60, 0xF0, 0xA4,
+  0xB6, 0xBD, 0xD8, 0xB5, 0x98, 0x69, 0x90, 0x60, 0xEF, 0x82, 0xD3, 0x80, 0xA4, 0xB6, 0x00, 0x7A,
+  0x92, 0x80, 0x60, 0xF0, 0x00, 0x69, 0x70, 0x80, 0xBD, 0xD8, 0x01, 0x93, 0xD4, 0x60, 0xEF, 0x87,
+  0x60, 0xF0, 0x06, 0xAD, 0x37, 0xBD, 0xD8, 0x9C, 0x15, 0x58, 0xEF, 0xA4, 0x96, 0xBD, 0xD8, 0xAD,
+  0x37, 0x81, 0x60, 0xF0, 0x07, 0x60, 0xEF, 0xB5, 0x98, 0xBD, 0xD8, 0x8B, 0x33, 0x69, 0x50, 0x7A,
+  0x72, 0x7A, 0x52, 0x69, 0x70, 0x80, 0x60, 0xF0, 0x03, 0x60, 0xEF, 0xAD, 0x17, 0xBD, 0xD8, 0xAD,
+  0x17, 0x80, 0x60, 0xEF, 0x00, 0x7A, 0x92, 0x80, 0xBD, 0xD8, 0x02, 0x9C, 0x15, 0x60, 0xF0, 0x9C,
+  0x35, 0x80, 0xBD, 0xD8, 0x02, 0x72, 0x11, 0x60, 0xEF, 0x69, 0x70, 0x80, 0xBD, 0xD8, 0x01, 0x93,
+  0xD4, 0x60, 0xEF, 0x81, 0x60, 0xF0, 0x01, 0x60, 0xEF, 0x8B, 0x53, 0x80, 0xBD, 0xD8, 0x00, 0x72,
+  0x31, 0xA2, 0x60, 0xF0, 0x80, 0x60, 0xEF, 0xCD, 0x60, 0xF0, 0x0D, 0x60, 0xEF, 0x71, 0x4E, 0x89,
+  0xAC, 0xA2, 0x0B, 0xAA, 0x2A, 0xB2, 0x69, 0xBA, 0x69, 0xBA, 0x88, 0xBA, 0x69, 0xB2, 0x49, 0xAA,
+  0x2A, 0x99, 0xEB, 0x89, 0xAC, 0x71, 0x2E, 0xDE, 0x60, 0xF0, 0x00, 0x69, 0x70, 0x80, 0xBD, 0xD8,
+  0x00, 0x9C, 0x75, 0x81, 0x7A, 0x52, 0x04, 0x7A, 0x92, 0x9C, 0x55, 0xBD, 0xD8, 0xB5, 0xB8, 0x72,
+  0x11, 0x80, 0x60, 0xEF, 0x04, 0x58, 0xEF, 0xAC, 0xF6, 0xBD, 0xD8, 0xB5, 0xB8, 0x8B, 0x54, 0x80,
+  0xBD, 0xD8, 0x03, 0x8B, 0x33, 0x58, 0xEF, 0x60, 0xF0, 0x8B, 0x54, 0x80, 0xBD, 0xD8, 0x00, 0x83,
+  0x13, 0x80, 0x60, 0xF0, 0x00, 0x69, 0x70, 0x80, 0xBD, 0xD8, 0x00, 0xA4, 0xB6, 0x84, 0x83, 0x13,
+  0x00, 0x7A, 0x52, 0x80, 0x60, 0xF0, 0x00, 0x7A, 0x52, 0x80, 0xBD, 0xD8, 0x02, 0x7A, 0x52, 0x58,
+  0xEF, 0x82, 0xD2, 0x80, 0xBD, 0xD8, 0x00, 0x7A, 0x32, 0x80, 0x60, 0xF0, 0x00, 0x69, 0x90, 0x80,
+  0xBD, 0xD8, 0x01, 0xA4, 0x96, 0xB5, 0xB8, 0x81, 0xBD, 0xD8, 0x05, 0x9C, 0x55, 0x69, 0x50, 0x60,
+  0xEF, 0xAD, 0x17, 0xBD, 0xD8, 0xAD, 0x17, 0x80, 0x60, 0xEF, 0x01, 0x58, 0xEF, 0x9C, 0x55, 0x80,
+  0xBD, 0xD8, 0x00, 0x8B, 0x33, 0x80, 0xBD, 0xD8, 0x03, 0x93, 0xD4, 0x58, 0xEF, 0x60, 0xEF, 0x69,
+  0x70, 0x80, 0xBD, 0xD8, 0x01, 0x93, 0xD4, 0x60, 0xEF, 0x81, 0x60, 0xF0, 0x04, 0x61, 0x50, 0xAD,
+  0x17, 0xBD, 0xD8, 0xB5, 0x57, 0x61, 0x0F, 0x90, 0x60, 0xF0, 0x8B, 0x60, 0xEF, 0x81, 0x60, 0xF0,
+  0x80, 0x60, 0xEF, 0x00, 0x71, 0x2E, 0x8F, 0xF3, 0x64, 0x01, 0xDB, 0x06, 0x60, 0xEF, 0x85, 0x60,
+  0xF0, 0x00, 0xA2, 0x0A, 0xA7, 0xF3, 0x64, 0x00, 0xCA, 0xC7, 0x86, 0x60, 0xEF, 0x03, 0x79, 0x6D,
+  0xAA, 0x4A, 0xDA, 0xE6, 0xF3, 0x84, 0x8B, 0xFB, 0xA3, 0x03, 0xF3, 0x64, 0xD2, 0xE7, 0xAA, 0x2A,
+  0x79, 0x4E, 0x93, 0x60, 0xEF, 0x80, 0x60, 0xF0, 0x93, 0x60, 0xEF, 0x82, 0x60, 0xF0, 0x85, 0x60,
+  0xEF, 0x80, 0x60, 0xF0, 0x83, 0x60, 0xEF, 0x86, 0x60, 0xF0, 0x83, 0x60, 0xEF, 0x86, 0x60, 0xF0,
+  0x83, 0x60, 0xEF, 0x82, 0x60, 0xF0, 0x00, 0x69, 0x70, 0x87, 0xBD, 0xD8, 0x01, 0x83, 0x13, 0x58,
+  0xCF, 0x80, 0x60, 0xEF, 0x02, 0x58, 0xEF, 0x71, 0xF1, 0xBD, 0xB8, 0x81, 0xBD, 0xD8, 0x04, 0xAC,
+  0xF6, 0x58, 0xEF, 0x60, 0xEF, 0x60, 0xF0, 0x8B, 0x54, 0x80, 0xBD, 0xD8, 0x00, 0x83, 0x13, 0x80,
+  0x60, 0xEF, 0x00, 0x69, 0x70, 0x87, 0xBD, 0xD8, 0x00, 0x9C, 0x15, 0x80, 0x60, 0xEF, 0x02, 0x9C,
+  0x35, 0xBD, 0xD8, 0xB5, 0x57, 0x80, 0x60, 0xEF, 0x06, 0x61, 0x30, 0xB5, 0x98, 0xBD, 0xD8, 0x9C,
+  0x15, 0x60, 0xF0, 0x60, 0xEF, 0x7A, 0x52, 0x81, 0xBD, 0xD8, 0x02, 0xAC, 0xF6, 0x9C, 0x55, 0xAD,
+  0x37, 0x80, 0xBD, 0xD8, 0x09, 0xAC, 0xD6, 0x61, 0x10, 0xAD, 0x17, 0xBD, 0xD8, 0xAD, 0x17, 0x60,
+  0xEF, 0x60, 0xF0, 0x60, 0xEF, 0x69, 0x90, 0xB5, 0x98, 0x81, 0xBD, 0xD8, 0x04, 0xB5, 0x57, 0x61,
+  0x2F, 0x60, 0xEF, 0x60, 0xF0, 0x69, 0x70, 0x80, 0xBD, 0xD8, 0x00, 0xAD, 0x37, 0x81, 0x9C, 0x55,
+  0x05, 0xA4, 0x76, 0xB5, 0x77, 0xBD, 0xD8, 0xB5, 0x57, 0x71, 0xF1, 0x60, 0xEF, 0x8C, 0x60, 0xF0,
+  0x93, 0x60, 0xEF, 0x01, 0x58, 0xEF, 0xA2, 0x2A, 0x90, 0xFB, 0xA3, 0x01, 0x79, 0x6D, 0x58, 0xEF,
+  0x83, 0x60, 0xEF, 0x01, 0x58, 0xEF, 0xAA, 0x2A, 0xA7, 0xFB, 0xA3, 0x01, 0xD2, 0xE6, 0x58, 0xEF,
+  0x83, 0x60, 0xEF, 0x01, 0x99, 0xEB, 0xE3, 0x25, 0x93, 0xFB, 0xA3, 0x01, 0xDB, 0x06, 0x99, 0xEB,
+  0xD8, 0x60, 0xEF, 0x00, 0x69, 0x70, 0x80, 0xBD, 0xD8, 0x00, 0xB5, 0x77, 0x81, 0xAD, 0x17, 0x01,
+  0xAD, 0x37, 0xB5, 0xB8, 0x80, 0xBD, 0xD8, 0x00, 0x8B, 0x33, 0x81, 0x60, 0xEF, 0x01, 0x58, 0xCF,
+  0x93, 0xB4, 0x81, 0xBD, 0xD8, 0x01, 0x72, 0x11, 0x58, 0xCF, 0x80, 0x60, 0xEF, 0x03, 0x58, 0xCF,
+  0x58, 0xCE, 0x58, 0xCF, 0x58, 0xEF, 0x80, 0x60, 0xEF, 0x00, 0x69, 0x50, 0x80, 0xBD, 0xD8, 0x00,
+  0xB5, 0x97, 0x84, 0xAD, 0x57, 0x0E, 0x93, 0xB4, 0x58, 0xEF, 0x61, 0x30, 0xB5, 0xB8, 0xBD, 0xD8,
+  0x93, 0xB4, 0x58, 0xEF, 0x60, 0xEF, 0x58, 0xEF, 0x94, 0x15, 0xBD, 0xD8, 0xB5, 0xB8, 0x61, 0x30,
+  0x60, 0xEF, 0x83, 0x13, 0x80, 0xBD, 0xD8, 0x00, 0x82, 0xD2, 0x80, 0x58, 0xCF, 0x01, 0x58, 0xEF,
+  0x93, 0xF4, 0x80, 0xBD, 0xD8, 0x03, 0x82, 0xB2, 0xAD, 0x17, 0xBD, 0xD8, 0xAD, 0x17, 0x81, 0x60,
+  0xEF, 0x01, 0x58, 0xEF, 0x83, 0x33, 0x81, 0xBD, 0xD8, 0x01, 0x7A, 0xB2, 0x58, 0xCF, 0x80, 0x60,
+  0xEF, 0x00, 0x69, 0x50, 0x87, 0xBD, 0xD8, 0x01, 0x93, 0xB4, 0x61, 0x0F, 0x8C, 0x60, 0xEF, 0x00,
+  0x60, 0xF0, 0x92, 0x60, 0xEF, 0x80, 0x58, 0xEF, 0x00, 0xDB, 0x06, 0x90, 0xFB, 0xA3, 0x01, 0xB2,
+  0x49, 0x58, 0xEF, 0x82, 0x60, 0xEF, 0x80, 0x58, 0xEF, 0x00, 0xAA, 0x2A, 0xA7, 0xFB, 0xA3, 0x00,
+  0xD2, 0xE6, 0x80, 0x58, 0xEF, 0x80, 0x60, 0xEF, 0x01, 0x81, 0x8C, 0xE3, 0x25, 0x97, 0xFB, 0xA3,
+  0x01, 0xEB, 0x45, 0x91, 0xCC, 0xD6, 0x60, 0xEF, 0x00, 0x69, 0x50, 0x80, 0xBD, 0xD8, 0x00, 0x93,
+  0xD4, 0x81, 0x58, 0xCF, 0x02, 0x58, 0xCE, 0x61, 0x2F, 0xA4, 0x96, 0x80, 0xBD, 0xD8, 0x00, 0x69,
+  0xB1, 0x80, 0x60, 0xEF, 0x01, 0x58, 0xEF, 0x61, 0x2F, 0x80, 0xBD, 0xD8, 0x01, 0xA4, 0x75, 0x58,
+  0xCF, 0x81, 0x60, 0xEF, 0x00, 0x58, 0xEF, 0x80, 0x58, 0xCF, 0x00, 0x58, 0xEF, 0x80, 0x60, 0xEF,
+  0x00, 0x69, 0x50, 0x80, 0xBD, 0xD8, 0x00, 0x93, 0xD4, 0x84, 0x58, 0xCE, 0x02, 0x58, 0xCF, 0x58,
+  0xEF, 0x82, 0xF3, 0x80, 0xBD, 0xD8, 0x00, 0x93, 0xD4, 0x81, 0x82, 0xF3, 0x00, 0x93, 0xF5, 0x80,
+  0xBD, 0xD8, 0x02, 0x82, 0xF3, 0x60, 0xEF, 0x61, 0x0F, 0x80, 0x61, 0x2F, 0x80, 0x58, 0xCF, 0x09,
+  0x58, 0xEF, 0x58, 0xCF, 0x61, 0x0F, 0xB5, 0xB8, 0xBD, 0xD8, 0x9C, 0x15, 0xAD, 0x17, 0xBD, 0xD8,
+  0xAD, 0x17, 0x58, 0xEF, 0x80, 0x60, 0xEF, 0x80, 0x58, 0xEF, 0x04, 0xB5, 0x77, 0xBD, 0xD8, 0xAD,
+  0x17, 0x58, 0xCF, 0x58, 0xEF, 0x80, 0x60, 0xEF, 0x00, 0x69, 0x50, 0x80, 0xBD, 0xD8, 0x00, 0xA4,
+  0xB6, 0x81, 0x83, 0x13, 0x01, 0x83, 0x33, 0xA4, 0xD6, 0x80, 0xBD, 0xD8, 0x00, 0x93, 0xD5, 0x91,
+  0x60, 0xEF, 0x83, 0x58, 0xEF, 0x80, 0x60, 0xEF, 0x00, 0x60, 0xF0, 0x81, 0x60, 0xEF, 0x00, 0x58,
+  0xCF, 0x80, 0x60, 0xEF, 0x81, 0x58, 0xCF, 0x00, 0x71, 0x2E, 0x91, 0xFB, 0xA3, 0x00, 0xEB, 0x45,
+  0x84, 0x58, 0xCF, 0x01, 0x58, 0xEF, 0xAA, 0x2A, 0xA7, 0xFB, 0xA3, 0x00, 0xD2, 0xE6, 0x81, 0x58,
+  0xCF, 0x01, 0xAA, 0x2A, 0xFB, 0xA4, 0x9A, 0xFB, 0xA3, 0x02, 0xCA, 0xA7, 0x69, 0x0F, 0x58, 0xCF,
+  0x93, 0x60, 0xEF, 0x80, 0x58, 0xCF, 0x81, 0x60, 0xEF, 0x80, 0x58, 0xCF, 0x84, 0x60, 0xEF, 0x82,
+  0x58, 0xCF, 0x84, 0x60, 0xEF, 0x00, 0x60, 0xF0, 0x85, 0x60, 0xEF, 0x00, 0x58, 0xCF, 0x9E, 0x60,
+  0xEF, 0x00, 0x69, 0x50, 0x80, 0xBD, 0xD8, 0x01, 0x93, 0xD4, 0x58, 0xCF, 0x81, 0x58, 0xEF, 0x01,
+  0x58, 0xCF, 0x7A, 0x92, 0x80, 0xBD, 0xD8, 0x00, 0x82, 0xF3, 0x81, 0x60, 0xEF, 0x00, 0x58, 0xEF,
+  0x80, 0xBD, 0xD8, 0x01, 0x9C, 0x35, 0x58, 0xEF, 0x87, 0x60, 0xEF, 0x00, 0x69, 0x50, 0x80, 0xBD,
+  0xD8, 0x01, 0x93, 0xD4, 0x58, 0xCF, 0x85, 0x58, 0xEF, 0x00, 0xA4, 0xD6, 0x87, 0xBD, 0xD8, 0x01,
+  0xAC, 0xD6, 0x58, 0xEF, 0x81, 0x61, 0x10, 0x00, 0x58, 0xEF, 0x81, 0x60, 0xEF, 0x07, 0x58, 0xCF,
+  0xB5, 0x57, 0xBD, 0xD8, 0x9C, 0x75, 0xAD, 0x17, 0xBD, 0xD8, 0xAD, 0x17, 0x58, 0xEF, 0x81, 0x60,
+  0xEF, 0x04, 0x58, 0xCF, 0xAD, 0x57, 0xBD, 0xD8, 0xA4, 0xD6, 0x58, 0xCF, 0x81, 0x60, 0xEF, 0x00,
+  0x69, 0x50, 0x80, 0xBD, 0xD8, 0x00, 0x93, 0xD4, 0x82, 0x58, 0xCF, 0x04, 0x59, 0x0F, 0xAD, 0x57,
+  0xBD, 0xD8, 0xB5, 0x77, 0x58, 0xEF, 0x81, 0x60, 0xEF, 0x80, 0x58, 0xEF, 0x87, 0x60, 0xEF, 0x81,
+  0x58, 0xCF, 0x00, 0x58, 0xD0, 0x83, 0x58, 0xEF, 0x00, 0x58, 0xCF, 0x80, 0x58, 0xD0, 0x87, 0x58,
+  0xCF, 0x00, 0xAA, 0x2A, 0x92, 0xFB, 0xA3, 0x02, 0x79, 0x6D, 0x58, 0xCF, 0x58, 0xEF, 0x82, 0x58,
+  0xCF, 0x00, 0xA2, 0x29, 0xA7, 0xFB, 0xA3, 0x00, 0xD2, 0xE6, 0x80, 0x58, 0xCF, 0x00, 0xAA, 0x2A,
+  0x9D, 0xFB, 0xA3, 0x01, 0xE3, 0x25, 0x71, 0x2E, 0x83, 0x58, 0xEF, 0x00, 0x58, 0xCF, 0x80, 0x58,
+  0xD0, 0x80, 0x58, 0xCF, 0x82, 0x58, 0xEF, 0x82, 0x58, 0xCF, 0x01, 0x58, 0xD0, 0x58, 0xF0, 0x81,
+  0x58, 0xCF, 0x00, 0x58, 0xEF, 0x88, 0x58, 0xCF, 0x00, 0x58, 0xD0, 0x83, 0x58, 0xCF, 0x01, 0x58,
+  0xEF, 0x58, 0xCF, 0x80, 0x60, 0xEF, 0x01, 0x58, 0xD0, 0x58, 0xCF, 0x83, 0x58, 0xEF, 0x80, 0x58,
+  0xF0, 0x00, 0x58, 0xEF, 0x83, 0x58, 0xCF, 0x82, 0x60, 0xEF, 0x89, 0x58, 0xEF, 0x01, 0x58, 0xF0,
+  0x58, 0xCF, 0x82, 0x58, 0xEF, 0x00, 0x58, 0xCF, 0x81, 0x58, 0xEF, 0x01, 0x58, 0xCF, 0x61, 0x50,
+  0x80, 0xBD, 0xD8, 0x01, 0x93, 0xD4, 0x58, 0xCF, 0x82, 0x58, 0xEF, 0x00, 0x83, 0x13, 0x80, 0xBD,
+  0xD8, 0x04, 0x83, 0x13, 0x58, 0xCF, 0x58, 0xEF, 0x58, 0xF0, 0x60, 0xEF, 0x80, 0xBD, 0xD8, 0x01,
+  0x9C, 0x35, 0x58, 0xEF, 0x80, 0x58, 0xCF, 0x82, 0x58, 0xEF, 0x80, 0x58, 0xCF, 0x01, 0x58, 0xEF,
+  0x61, 0x50, 0x80, 0xBD, 0xD8, 0x00, 0x93, 0xD4, 0x82, 0x58, 0xEF, 0x03, 0x58, 0xF0, 0x58, 0xCF,
+  0x58, 0xEF, 0x71, 0xD1, 0x80, 0xBD, 0xD8, 0x00, 0xB5, 0x77, 0x83, 0xAD, 0x37, 0x00, 0xB5, 0x77,
+  0x80, 0xBD, 0xD8, 0x04, 0x71, 0xD1, 0xA4, 0x76, 0xBD, 0xD8, 0xB5, 0x77, 0x60, 0xF0, 0x81, 0x58,
+  0xEF, 0x00, 0x69, 0x70, 0x80, 0xBD, 0xD8, 0x03, 0x93, 0xD4, 0xAD, 0x17, 0xBD, 0xD8, 0xAD, 0x17,
+  0x81, 0x58, 0xCF, 0x80, 0x58, 0xEF, 0x02, 0xAD, 0x57, 0xBD, 0xD8, 0xA4, 0xD6, 0x82, 0x58, 0xEF,
+  0x00, 0x61, 0x50, 0x80, 0xBD, 0xD8, 0x00, 0x93, 0xD4, 0x82, 0x58, 0xEF, 0x01, 0x58, 0xCF, 0x9C,
+  0x35, 0x80, 0xBD, 0xD8, 0x02, 0x61, 0x10, 0x58, 0xEF, 0x60, 0xF0, 0x83, 0x58, 0xEF, 0x00, 0x58,
+  0xF0, 0x80, 0x58, 0xEF, 0x80, 0x58, 0xCF, 0x83, 0x58, 0xEF, 0x00, 0x58, 0xF0, 0x87, 0x58, 0xEF,
+  0x83, 0x58, 0xCF, 0x81, 0x58, 0xEF, 0x00, 0xDB, 0x06, 0x92, 0xFB, 0xA3, 0x00, 0xB2, 0x49, 0x83,
+  0x58, 0xEF, 0x01, 0x58, 0xCF, 0xA2, 0x29, 0xA7, 0xFB, 0xA3, 0x02, 0xD2, 0xE6, 0x58, 0xCF, 0x89,
+  0xAC, 0x9F, 0xFB, 0xA3, 0x01, 0xEB, 0x45, 0x69, 0x2E, 0x83, 0x58, 0xEF, 0x00, 0x58, 0xF0, 0x92,
+  0x58, 0xEF, 0x83, 0x58, 0xCF, 0x80, 0x58, 0xEF, 0x00, 0x58, 0xF0, 0x81, 0x58, 0xEF, 0x00, 0x58,
+  0xF0, 0x80, 0x58, 0xEF, 0x83, 0x58, 0xCF, 0x8B, 0x58, 0xEF, 0x82, 0x58, 0xCF, 0x94, 0x58, 0xEF,
+  0x00, 0x61, 0x50, 0x80, 0xBD, 0xD8, 0x01, 0x9C, 0x55, 0x72, 0x11, 0x80, 0x72, 0x12, 0x02, 0x72,
+  0x32, 0x83, 0x13, 0xB5, 0x97, 0x80, 0xBD, 0xD8, 0x00, 0x69, 0xD1, 0x82, 0x58, 0xEF, 0x80, 0xBD,
+  0xD8, 0x00, 0x9C, 0x35, 0x82, 0x58, 0xEF, 0x00, 0x82, 0xD3, 0x80, 0xA4, 0xD6, 0x00, 0x7A, 0x92,
+  0x80, 0x58, 0xEF, 0x00, 0x61, 0x50, 0x80, 0xBD, 0xD8, 0x00, 0xA4, 0xB6, 0x85, 0x82, 0xF3, 0x00,
+  0x9C, 0x35, 0x80, 0xBD, 0xD8, 0x00, 0x61, 0x90, 0x82, 0x58, 0xCF, 0x01, 0x58, 0xCE, 0x69, 0xD0,
+  0x80, 0xBD, 0xD8, 0x01, 0x93, 0xD4, 0x82, 0xF3, 0x80, 0xBD, 0xD8, 0x04, 0x9C, 0x15, 0x61, 0x30,
+  0x58, 0xEF, 0x61, 0x70, 0xA4, 0x96, 0x80, 0xBD, 0xD8, 0x03, 0x72, 0x51, 0xAD, 0x17, 0xBD, 0xD8,
+  0xAD, 0x17, 0x83, 0x58, 0xEF, 0x02, 0xAD, 0x57, 0xBD, 0xD8, 0xA4, 0xD6, 0x82, 0x58, 0xEF, 0x00,
+  0x61, 0x50, 0x80, 0xBD, 0xD8, 0x00, 0x93, 0xD4, 0x83, 0x58, 0xEF, 0x00, 0x93, 0xD4, 0x80, 0xBD,
+  0xD8, 0x03, 0x61, 0x70, 0x58, 0xCF, 0x58, 0xD0, 0x58, 0xCF, 0x82, 0x58, 0xEF, 0x00, 0x58, 0xF0,
+  0x84, 0x58, 0xEF, 0x80, 0x58, 0xF0, 0x81, 0x58, 0xEF, 0x82, 0x58, 0xF0, 0x89, 0x58, 0xEF, 0x00,
+  0x71, 0x4D, 0x93, 0xFB, 0xA3, 0x00, 0xEB, 0x45, 0x83, 0x58, 0xEF, 0x01, 0x58, 0xCF, 0xA2, 0x2A,
+  0xA7, 0xFB, 0xA3, 0x02, 0xD2, 0xE6, 0x58, 0xEF, 0xEB, 0x45, 0xA0, 0xFB, 0xA3, 0x01, 0xDB, 0x06,
+  0x60, 0xEF, 0x82, 0x58, 0xEF, 0x00, 0x58, 0xF0, 0x99, 0x58, 0xEF, 0x00, 0x58, 0xF0, 0x81, 0x58,
+  0xEF, 0x82, 0x58, 0xF0, 0x92, 0x58, 0xEF, 0x84, 0x58, 0xF0, 0x8F, 0x58, 0xEF, 0x00, 0x61, 0x50,
+  0x88, 0xBD, 0xD8, 0x01, 0x93, 0xD4, 0x58, 0xCF, 0x82, 0x58, 0xEF, 0x80, 0xBD, 0xD8, 0x00, 0x9C,
+  0x35, 0x82, 0x58, 0xEF, 0x00, 0x8B, 0x53, 0x80, 0xBD, 0xD8, 0x00, 0x83, 0x13, 0x80, 0x58, 0xEF,
+  0x00, 0x61, 0x50, 0x88, 0xBD, 0xD8, 0x03, 0xB5, 0xB8, 0xBD, 0xD8, 0xA4, 0xD6, 0x58, 0xCF, 0x83,
+  0x58, 0xEF, 0x05, 0x58, 0xCF, 0xAD, 0x16, 0xBD, 0xD8, 0xB5, 0x77, 0x61, 0x2F, 0xA4, 0xB6, 0x80,
+  0xBD, 0xD8, 0x01, 0xB5, 0xB8, 0xB5, 0x57, 0x81, 0xBD, 0xD8, 0x04, 0x9C, 0x35, 0x58, 0xCF, 0xAD,
+  0x17, 0xBD, 0xD8, 0xAD, 0x17, 0x83, 0x58, 0xEF, 0x02, 0xAD, 0x57, 0xBD, 0xD8, 0xA4, 0xD6, 0x82,
+  0x58, 0xEF, 0x00, 0x61, 0x50, 0x80, 0xBD, 0xD8, 0x00, 0x93, 0xD4, 0x83, 0x58, 0xEF, 0x00, 0x8B,
+  0x94, 0x80, 0xBD, 0xD8, 0x01, 0x69, 0xD1, 0x58, 0xCF, 0x80, 0x58, 0xF0, 0x82, 0x58, 0xEF, 0x00,
+  0x58, 0xF0, 0x84, 0x58, 0xEF, 0x80, 0x58, 0xF0, 0x81, 0x58, 0xEF, 0x82, 0x58, 0xF0, 0x00, 0x58,
+  0xD0, 0x80, 0x58, 0xEF, 0x01, 0x58, 0xF0, 0x58, 0xCF, 0x84, 0x58, 0xEF, 0x00, 0xAA, 0x2A, 0x94,
+  0xFB, 0xA3, 0x00, 0x81, 0x6D, 0x82, 0x58, 0xEF, 0x01, 0x58, 0xCF, 0xA2, 0x2A, 0xA7, 0xFB, 0xA3,
+  0x01, 0xD2, 0xE6, 0x91, 0xCB, 0xA2, 0xFB, 0xA3, 0x01, 0xAA, 0x2A, 0x58, 0xEF, 0x80, 0x58, 0xF0,
+  0x83, 0x58, 0xCF, 0x00, 0x58, 0xEF, 0x80, 0x58, 0xF0, 0x85, 0x58, 0xEF, 0x82, 0x58, 0xCF, 0x82,
+  0x58, 0xEF, 0x82, 0x58, 0xF0, 0x80, 0x58, 0xEF, 0x03, 0x58, 0xF0, 0x58, 0xEF, 0x58, 0xCF, 0x58,
+  0xEF, 0x80, 0x58, 0xF0, 0x00, 0x58, 0xCF, 0x82, 0x58, 0xEF, 0x82, 0x58, 0xF0, 0x88, 0x58, 0xEF,
+  0x00, 0x58, 0xF0, 0x80, 0x58, 0xEF, 0x84, 0x58, 0xF0, 0x81, 0x58, 0xEF, 0x00, 0x58, 0xF0, 0x81,
+  0x58, 0xEF, 0x80, 0x58, 0xCF, 0x86, 0x58, 0xEF, 0x00, 0x61, 0x50, 0x85, 0xBD, 0xD8, 0x03, 0xB5,
+  0x77, 0xA4, 0x96, 0x7A, 0xB2, 0x58, 0xCF, 0x83, 0x58, 0xEF, 0x80, 0xBD, 0xD8, 0x00, 0x9C, 0x35,
+  0x82, 0x58, 0xEF, 0x00, 0x8B, 0x53, 0x80, 0xBD, 0xD8, 0x00, 0x83, 0x13, 0x80, 0x58, 0xEF, 0x00,
+  0x61, 0x50, 0x8A, 0xBD, 0xD8, 0x00, 0x83, 0x13, 0x83, 0x58, 0xEF, 0x02, 0x58, 0xF0, 0x58, 0xCF,
+  0x8B, 0x53, 0x80, 0xBD, 0xD8, 0x03, 0x7A, 0xB2, 0x59, 0x0F, 0x93, 0xD4, 0xB5, 0xB8, 0x81, 0xBD,
+  0xD8, 0x01, 0xB5, 0x97, 0x8B, 0x53, 0x80, 0x58, 0xEF, 0x02, 0xAD, 0x17, 0xBD, 0xD8, 0xAD, 0x17,
+  0x83, 0x58, 0xEF, 0x02, 0xAD, 0x57, 0xBD, 0xD8, 0xA4, 0xD6, 0x81, 0x58, 0xEF, 0x01, 0x58, 0xF0,
+  0x61, 0x50, 0x80, 0xBD, 0xD8, 0x00, 0x93, 0xD4, 0x83, 0x58, 0xEF, 0x00, 0x7A, 0xB2, 0x80, 0xBD,
+  0xD8, 0x01, 0x82, 0xD3, 0x58, 0xEF, 0x81, 0x58, 0xF0, 0x81, 0x58, 0xEF, 0x00, 0x58, 0xF0, 0x83,
+  0x58, 0xEF, 0x90, 0x58, 0xCF, 0x00, 0x58, 0xEF, 0x80, 0x58, 0xCF, 0x00, 0xE3, 0x25, 0x94, 0xFB,
+  0xA3, 0x00, 0xB2, 0x69, 0x83, 0x58, 0xCF, 0x00, 0xA2, 0x2A, 0xA7, 0xFB, 0xA3, 0x01, 0xD2, 0xE6,
+  0xCA, 0xC7, 0x8E, 0xFB, 0xA3, 0x02, 0xFB, 0x84, 0xF3, 0x84, 0xFB, 0x84, 0x8F, 0xFB, 0xA3, 0x01,
+  0xFB, 0x84, 0x69, 0x2E, 0xA1, 0x58, 0xCF, 0x00, 0x58, 0xEF, 0x88, 0x58, 0xCF, 0x00, 0x58, 0xEF,
+  0x8D, 0x58, 0xCF, 0x00, 0x58, 0xEF, 0x90, 0x58, 0xCF, 0x02, 0x58, 0xEF, 0x58, 0xCF, 0x58, 0xCE,
+  0x84, 0x50, 0xCE, 0x83, 0x58, 0xCF, 0x00, 0x58, 0xEF, 0x81, 0x58, 0xCF, 0x01, 0x58, 0xCE, 0x50,
+  0xCE, 0x84, 0x58, 0xCF, 0x80, 0x50, 0xCE, 0x82, 0x58, 0xCF, 0x00, 0x58, 0xCE, 0x89, 0x50, 0xCE,
+  0x01, 0x58, 0xCF, 0x58, 0xEF, 0x85, 0x58, 0xCF, 0x80, 0x58, 0xCE, 0x81, 0x58, 0xCF, 0x04, 0x59,
+  0x0F, 0x72, 0x11, 0x72, 0x51, 0x69, 0xF0, 0x58, 0xEF, 0x81, 0x58, 0xCF, 0x01, 0x58, 0xCE, 0x50,
+  0xCE, 0x84, 0x58, 0xCF, 0x01, 0x58, 0xCE, 0x50, 0xCE, 0x84, 0x58, 0xCF, 0x01, 0x58, 0xCE, 0x50,
+  0xCE, 0x85, 0x58, 0xCF, 0x80, 0x50, 0xCE, 0xA0, 0x58, 0xCF, 0x00, 0x71, 0x4D, 0x88, 0xFB, 0xA3,
+  0x00, 0xDB, 0x06, 0x80, 0xBA, 0x88, 0x00, 0xEB, 0x45, 0x87, 0xFB, 0xA3, 0x00, 0xEB, 0x45, 0x83,
+  0x58, 0xCF, 0x00, 0x89, 0xAC, 0x8D, 0xBA, 0x88, 0x00, 0xF3, 0x64, 0x88, 0xFB, 0xA3, 0x00, 0xC2,
+  0xA7, 0x8C, 0xBA, 0x88, 0x01, 0xA2, 0x09, 0xF3, 0x64, 0x89, 0xFB, 0xA3, 0x04, 0xF3, 0x64, 0xB2,
+  0x68, 0x89, 0xAB, 0x69, 0x2D, 0x58, 0xCE, 0x81, 0x50, 0xCE, 0x04, 0x58, 0xCE, 0x69, 0x0D, 0x81,
+  0x8B, 0xA2, 0x29, 0xDB, 0x06, 0x8B, 0xFB, 0xA3, 0x00, 0xB2, 0x69, 0xFF, 0x58, 0xCF, 0xCD, 0x58,
+  0xCF, 0x00, 0xAA, 0x29, 0x88, 0xFB, 0xA3, 0x00, 0x79, 0x6C, 0x80, 0x50, 0xCE, 0x00, 0xAA, 0x29,
+  0x88, 0xFB, 0xA3, 0x00, 0x81, 0x8C, 0x84, 0x58, 0xCF, 0x00, 0x50, 0xCF, 0x8B, 0x50, 0xCE, 0x00,
+  0xDB, 0x06, 0x88, 0xFB, 0xA3, 0x00, 0x69, 0x0D, 0x8B, 0x50, 0xCE, 0x01, 0x50, 0xCF, 0x61, 0x0E,
+  0x89, 0xFB, 0xA3, 0x01, 0xC2, 0xA7, 0x58, 0xEE, 0x81, 0x50, 0xCE, 0x00, 0x50, 0xCF, 0x80, 0x58,
+  0xCF, 0x80, 0x50, 0xCF, 0x82, 0x50, 0xCE, 0x01, 0x79, 0x6C, 0xDB, 0x06, 0x89, 0xFB, 0xA3, 0x01,
+  0xF3, 0x64, 0x58, 0xEF, 0xFF, 0x58, 0xCF, 0xCC, 0x58, 0xCF, 0x00, 0xE3, 0x25, 0x87, 0xFB, 0xA3,
+  0x00, 0xEB, 0x45, 0x81, 0x50, 0xCE, 0x00, 0x71, 0x2D, 0x88, 0xFB, 0xA3, 0x00, 0xBA, 0x68, 0x85,
+  0x58, 0xCF, 0x89, 0x50, 0xCF, 0x80, 0x50, 0xCE, 0x00, 0xDB, 0x06, 0x88, 0xFB, 0xA3, 0x00, 0x69,
+  0x0D, 0x88, 0x50, 0xCF, 0x81, 0x50, 0xCE, 0x01, 0x50, 0xCF, 0x71, 0x2D, 0x88, 0xFB, 0xA3, 0x02,
+  0xF3, 0x64, 0x58, 0xCE, 0x50, 0xCE, 0x80, 0x50, 0xCF, 0x85, 0x58, 0xCF, 0x81, 0x50, 0xCF, 0x02,
+  0x50, 0xCE, 0x58, 0xCE, 0xCA, 0xC7, 0x89, 0xFB, 0xA3, 0x00, 0x89, 0x8C, 0xFF, 0x58, 0xCF, 0xCB,
+  0x58, 0xCF, 0x00, 0x71, 0x4D, 0x88, 0xFB, 0xA3, 0x00, 0xB2, 0x68, 0x81, 0x50, 0xCF, 0x01, 0x50,
+  0xCE, 0xE3, 0x25, 0x87, 0xFB, 0xA3, 0x00, 0xEB, 0x64, 0x90, 0x58, 0xCF, 0x02, 0x50, 0xCF, 0x50,
+  0xCE, 0xDB, 0x06, 0x88, 0xFB, 0xA3, 0x00, 0x69, 0x0D, 0x80, 0x50, 0xCF, 0x89, 0x58, 0xCF, 0x01,
+  0x50, 0xCF, 0x71, 0x2D, 0x88, 0xFB, 0xA3, 0x01, 0xD2, 0xE6, 0x50, 0xCE, 0x80, 0x50, 0xCF, 0x88,
+  0x58, 0xCF, 0x80, 0x50, 0xCF, 0x02, 0x50, 0xCE, 0x60, 0xEE, 0xEB, 0x45, 0x88, 0xFB, 0xA3, 0x00,
+  0xAA, 0x49, 0xFF, 0x58, 0xCF, 0xCB, 0x58, 0xCF, 0x00, 0xAA, 0x29, 0x88, 0xFB, 0xA3, 0x01, 0x79,
+  0x6C, 0x50, 0xCF, 0x80, 0x58, 0xCF, 0x01, 0x50, 0xCF, 0xAA, 0x29, 0x88, 0xFB, 0xA3, 0x00, 0x81,
+  0x8C, 0x90, 0x58, 0xCF, 0x01, 0x50, 0xCF, 0xDB, 0x06, 0x88, 0xFB, 0xA3, 0x00, 0x69, 0x0D, 0x8C,
+  0x58, 0xCF, 0x00, 0x61, 0x0E, 0x88, 0xFB, 0xA3, 0x00, 0xEB, 0x45, 0x8D, 0x58, 0xCF, 0x02, 0x50,
+  0xCF, 0x50, 0xCE, 0xA2, 0x29, 0x88, 0xFB, 0xA3, 0x00, 0xCA, 0xC7, 0xFF, 0x58, 0xCF, 0xCB, 0x58,
+  0xCF, 0x00, 0xE3, 0x25, 0x87, 0xFB, 0xA3, 0x00, 0xEB, 0x45, 0x83, 0x58, 0xCF, 0x00, 0x71, 0x4D,
+  0x88, 0xFB, 0xA3, 0x00, 0xBA, 0x68, 0x91, 0x58, 0xCF, 0x00, 0xDB, 0x06, 0x88, 0xFB, 0xA3, 0x00,
+  0x69, 0x0D, 0x8D, 0x58, 0xCF, 0x00, 0xF3, 0x64, 0x88, 0xFB, 0xA3, 0x00, 0xB2, 0x48, 0x8D, 0x58,
+  0xCF, 0x01, 0x50, 0xCF, 0x71, 0x4D, 0x88, 0xFB, 0xA3, 0x00, 0xE3, 0x25, 0xFF, 0x58, 0xCF, 0xCA,
+  0x58, 0xCF, 0x00, 0x71, 0x4D, 0x88, 0xFB, 0xA3, 0x01, 0xB2, 0x68, 0x50, 0xCF, 0x81, 0x58, 0xCF,
+  0x80, 0x50, 0xCF, 0x00, 0xE3, 0x25, 0x87, 0xFB, 0xA3, 0x00, 0xF3, 0x64, 0x90, 0x58, 0xCF, 0x01,
+  0x50, 0xCF, 0xDB, 0x06, 0x88, 0xFB, 0xA3, 0x00, 0x69, 0x0D, 0x8C, 0x58, 0xCF, 0x01, 0x50, 0xCF,
+  0xD2, 0xC6, 0x89, 0xFB, 0xA3, 0x01, 0xDB, 0x06, 0x81, 0x8C, 0x8B, 0x58, 0xCF, 0x01, 0x50, 0xCF,
+  0x58, 0xEE, 0x88, 0xFB, 0xA3, 0x00, 0xEB, 0x45, 0xFF, 0x58, 0xCF, 0xCA, 0x58, 0xCF, 0x00, 0xAA,
+  0x49, 0x88, 0xFB, 0xA3, 0x01, 0x81, 0x6C, 0x50, 0xCF, 0x82, 0x58, 0xCF, 0x01, 0x50, 0xCF, 0xAA,
+  0x29, 0x88, 0xFB, 0xA3, 0x00, 0x81, 0x8C, 0x8F, 0x58, 0xCF, 0x01, 0x50, 0xCF, 0xDB, 0x06, 0x88,
+  0xFB, 0xA3, 0x00, 0x69, 0x0D, 0x8C, 0x58, 0xCF, 0x01, 0x50, 0xCF, 0x99, 0xEA, 0x8B, 0xFB, 0xA3,
+  0x02, 0xE3, 0x06, 0x99, 0xEA, 0x60, 0xEE, 0x88, 0x58, 0xCF, 0x80, 0x50, 0xCF, 0x88, 0x99, 0xEA,
+  0x00, 0x91, 0xCA, 0xFF, 0x58, 0xCF, 0xB9, 0x58, 0xCF, 0x80, 0x50, 0xCF, 0x00, 0x58, 0xCF, 0x8C,
+  0x50, 0xCF, 0x00, 0xE3, 0x25, 0x87, 0xFB, 0xA3, 0x01, 0xEB, 0x64, 0x50, 0xCE, 0x84, 0x50, 0xCF,
+  0x00, 0x71, 0x4C, 0x88, 0xFB, 0xA3, 0x00, 0xBA, 0x88, 0x80, 0x50, 0xCF, 0x00, 0x58, 0xCF, 0x80,
+  0x50, 0xCF, 0x00, 0x58, 0xCF, 0x84, 0x50, 0xCF, 0x00, 0x58, 0xCF, 0x80, 0x50, 0xCF, 0x00, 0x58,
+  0xCF, 0x80, 0x50, 0xCF, 0x00, 0xDB, 0x06, 0x88, 0xFB, 0xA3, 0x00, 0x69, 0x0D, 0x81, 0x50, 0xCF,
+  0x00, 0x58, 0xCF, 0x80, 0x50, 0xCF, 0x00, 0x58, 0xCF, 0x83, 0x50, 0xCF, 0x00, 0x58, 0xCF, 0x80,
+  0x50, 0xCF, 0x01, 0x58, 0xEE, 0xF3, 0x64, 0x8C, 0xFB, 0xA3, 0x05, 0xFB, 0x84, 0xCA, 0xA7, 0x89,
+  0xAB, 0x58, 0xEF, 0x50, 0xCF, 0x58, 0xCF, 0x80, 0x50, 0xCF, 0x00, 0x58, 0xCF, 0x82, 0x50, 0xCF,
+  0x88, 0x50, 0xCE, 0x85, 0x50, 0xCF, 0x82, 0x58, 0xCF, 0x80, 0x50, 0xCF, 0x00, 0x58, 0xCF, 0x80,
+  0x50, 0xCF, 0x00, 0x58, 0xCF, 0x80, 0x50, 0xCF, 0x00, 0x58, 0xCF, 0x82, 0x50, 0xCF, 0x00, 0x58,
+  0xCF, 0x8B, 0x50, 0xCF, 0x85, 0x58, 0xCF, 0x80, 0x50, 0xCF, 0x86, 0x58, 0xCF, 0x81, 0x50, 0xCF,
+  0x84, 0x58, 0xCF, 0x80, 0x50, 0xCF, 0x80, 0x58, 0xCF, 0x02, 0x50, 0xCF, 0x58, 0xCF, 0x50, 0xCF,
+  0x81, 0x58, 0xCF, 0x00, 0x50, 0xCF, 0x81, 0x58, 0xCF, 0x80, 0x50, 0xCF, 0x8F, 0x58, 0xCF, 0x00,
+  0x50, 0xCF, 0x82, 0x58, 0xCF, 0x85, 0x50, 0xCF, 0x89, 0x58, 0xCF, 0x81, 0x50, 0xCF, 0x94, 0x58,
+  0xCF, 0x81, 0x50, 0xCF, 0x8B, 0x58, 0xCF, 0x80, 0x50, 0xCF, 0x00, 0x58, 0xCF, 0x81, 0x50, 0xCF,
+  0x86, 0x58, 0xCF, 0x81, 0x50, 0xCF, 0x81, 0x58, 0xCF, 0x81, 0x50, 0xCF, 0x83, 0x58, 0xCF, 0x8E,
+  0x50, 0xCF, 0x00, 0x71, 0x4D, 0x88, 0xFB, 0xA3, 0x01, 0xB2, 0x68, 0x50, 0xCE, 0x84, 0x50, 0xCF,
+  0x01, 0x50, 0xCE, 0xE3, 0x25, 0x87, 0xFB, 0xA3, 0x01, 0xF3, 0x64, 0x58, 0xCF, 0x8F, 0x50, 0xCF,
+  0x00, 0xDB, 0x06, 0x88, 0xFB, 0xA3, 0x00, 0x69, 0x0D, 0x8D, 0x50, 0xCF, 0x01, 0x50, 0xCE, 0x91,
+  0xCA, 0x8F, 0xFB, 0xA3, 0x03, 0xF3, 0x84, 0xC2, 0xA7, 0x89, 0xAB, 0x58, 0xEF, 0x85, 0x50, 0xCF,
+  0x86, 0x50, 0xCE, 0xFF, 0x50, 0xCF, 0xA2, 0x50, 0xCF, 0x00, 0x58, 0xCF, 0xA6, 0x50, 0xCF, 0x00,
+  0xAA, 0x49, 0x88, 0xFB, 0xA3, 0x00, 0x79, 0x8B, 0x85, 0x50, 0xCF, 0x01, 0x50, 0xCE, 0xAA, 0x49,
+  0x88, 0xFB, 0xA3, 0x00, 0x81, 0x8B, 0x8F, 0x50, 0xCF, 0x00, 0xDB, 0x06, 0x88, 0xFB, 0xA3, 0x00,
+  0x69, 0x0D, 0x8E, 0x50, 0xCF, 0x01, 0x50, 0xCE, 0xBA, 0x87, 0x91, 0xFB, 0xA3, 0x03, 0xF3, 0x84,
+  0xC2, 0xA8, 0x89, 0xAC, 0x58, 0xCF, 0xFF, 0x50, 0xCF, 0xD7, 0x50, 0xCF, 0x00, 0xEB, 0x45, 0x87,
+  0xFB, 0xA3, 0x01, 0xF3, 0x64, 0x50, 0xCE, 0x86, 0x50, 0xCF, 0x00, 0x71, 0x4C, 0x88, 0xFB, 0xA3,
+  0x00, 0xBA, 0x88, 0x8F, 0x50, 0xCF, 0x00, 0xDB, 0x06, 0x88, 0xFB, 0xA3, 0x00, 0x69, 0x0D, 0x8E,
+  0x50, 0xCF, 0x80, 0x50, 0xCE, 0x00, 0xC2, 0xA7, 0x93, 0xFB, 0xA3, 0x02, 0xF3, 0x64, 0xBA, 0x68,
+  0x79, 0x4D, 0xFF, 0x50, 0xCF, 0xD4, 0x50, 0xCF, 0x00, 0x71, 0x4C, 0x88, 0xFB, 0xA3, 0x01, 0xBA,
+  0x68, 0x50, 0xAE, 0x85, 0x50, 0xCF, 0x02, 0x50, 0xAF, 0x50, 0xAE, 0xE3, 0x45, 0x87, 0xFB, 0xA3,
+  0x01, 0xF3, 0x64, 0x58, 0xCE, 0x8D, 0x50, 0xCF, 0x01, 0x50, 0xAE, 0xDB, 0x06, 0x88, 0xFB, 0xA3,
+  0x00, 0x61, 0x0D, 0x8E, 0x50, 0xCF, 0x80, 0x50, 0xAE, 0x01, 0x50, 0xCE, 0xAA, 0x28, 0x95, 0xFB,
+  0xA3, 0x02, 0xDB, 0x06, 0x91, 0xEA, 0x58, 0xCE, 0xFF, 0x50, 0xCF, 0xD1, 0x50, 0xCF, 0x00, 0xB2,
+  0x49, 0x88, 0xFB, 0xA3, 0x01, 0x81, 0x8B, 0x50, 0xCE, 0x86, 0x50, 0xCF, 0x01, 0x50, 0xCE, 0xAA,
+  0x48, 0x88, 0xFB, 0xA3, 0x00, 0x89, 0xAB, 0x8D, 0x50, 0xCF, 0x01, 0x50, 0xCE, 0xDB, 0x06, 0x88,
+  0xFB, 0xA3, 0x00, 0x61, 0x0D, 0x8F, 0x50, 0xCF, 0x80, 0x50, 0xCE, 0x02, 0x50, 0xAE, 0x71, 0x6C,
+  0xDB, 0x06, 0x95, 0xFB, 0xA3, 0x02, 0xF3, 0x64, 0xA2, 0x29, 0x58, 0xEE, 0xFF, 0x50, 0xCF, 0xCF,
+  0x50, 0xCF, 0x00, 0xEB, 0x45, 0x87, 0xFB, 0xA3, 0x02, 0xF3, 0x64, 0x50, 0xCE, 0x50, 0xAE, 0x86,
+  0x50, 0xCF, 0x01, 0x50, 0xCE, 0x71, 0x4C, 0x88, 0xFB, 0xA3, 0x00, 0xC2, 0xA7, 0x8D, 0x50, 0xCF,
+  0x01, 0x50, 0xAE, 0xDB, 0x06, 0x88, 0xFB, 0xA3, 0x00, 0x61, 0x0D, 0x90, 0x50, 0xCF, 0x80, 0x50,
+  0xCE, 0x03, 0x50, 0xAE, 0x50, 0xCE, 0x91, 0xCA, 0xEB, 0x45, 0x95, 0xFB, 0xA3, 0x02, 0xF3, 0x64,
+  0xA2, 0x29, 0x58, 0xEE, 0xFF, 0x50, 0xCF, 0xCC, 0x50, 0xCF, 0x00, 0x79, 0x6C, 0x88, 0xFB, 0xA3,
+  0x00, 0xBA, 0x88, 0x80, 0x50, 0xAE, 0x87, 0x50, 0xCF, 0x01, 0x50, 0xCE, 0xEB, 0x45, 0x87, 0xFB,
+  0xA3, 0x01, 0xF3, 0x84, 0x58, 0xCE, 0x8C, 0x50, 0xCF, 0x01, 0x50, 0xAE, 0xDB, 0x06, 0x88, 0xFB,
+  0xA3, 0x00, 0x61, 0x0D, 0x90, 0x50, 0xCF, 0x81, 0x50, 0xAE, 0x80, 0x48, 0xAE, 0x02, 0x50, 0xAE,
+  0x89, 0xAA, 0xDB, 0x06, 0x95, 0xFB, 0xA3, 0x01, 0xEB, 0x45, 0x81, 0x8B, 0xFF, 0x50, 0xCF, 0xCB,
+  0x50, 0xCF, 0x00, 0xB2, 0x48, 0x88, 0xFB, 0xA3, 0x01, 0x81, 0x8B, 0x50, 0xAE, 0x87, 0x50, 0xCF,
+  0x80, 0x50, 0xAE, 0x00, 0xAA, 0x48, 0x88, 0xFB, 0xA3, 0x00, 0x89, 0xAB, 0x8C, 0x50, 0xCF, 0x01,
+  0x50, 0xAE, 0xDB, 0x06, 0x88, 0xFB, 0xA3, 0x00, 0x61, 0x0D, 0x91, 0x50, 0xCF, 0x00, 0x50, 0xAF,
+  0x81, 0x50, 0xAE, 0x81, 0x48, 0xAE, 0x02, 0x71, 0x4C, 0xB2, 0x48, 0xF3, 0x64, 0x94, 0xFB, 0xA3,
+  0x01, 0xB2, 0x68, 0x58, 0xCE, 0xFF, 0x50, 0xCF, 0xA2, 0x50, 0xCF, 0x00, 0x50, 0xAF, 0x97, 0x50,
+  0xCF, 0x83, 0x50, 0xAF, 0x80, 0x50, 0xCF, 0x00, 0x50, 0xAF, 0x83, 0x50, 0xCF, 0x00, 0xEB, 0x45,
+  0x88, 0xFB, 0xA3, 0x8B, 0xA2, 0x29, 0x00, 0xBA, 0x87, 0x88, 0xFB, 0xA3, 0x00, 0xC2, 0xA7, 0x81,
+  0x50, 0xCF, 0x80, 0x50, 0xAF, 0x87, 0x50, 0xCF, 0x01, 0x50, 0xAE, 0xDB, 0x06, 0x88, 0xFB, 0xA3,
+  0x00, 0x61, 0x0D, 0x93, 0x50, 0xCF, 0x82, 0x50, 0xAE, 0x81, 0x48, 0xAE, 0x03, 0x50, 0xCE, 0x81,
+  0x8B, 0xBA, 0x87, 0xF3, 0x84, 0x92, 0xFB, 0xA3, 0x01, 0xD2, 0xE6, 0x58, 0xEE, 0xDB, 0x50, 0xCF,
+  0x00, 0x50, 0xAF, 0x91, 0x50, 0xCF, 0x83, 0x50, 0xAF, 0xD2, 0x50, 0xCF, 0x00, 0x79, 0x6C, 0xA1,
+  0xFB, 0xA3, 0x01, 0xF3, 0x84, 0x50, 0xCE, 0x81, 0x50, 0xAF, 0x87, 0x50, 0xCF, 0x02, 0x50, 0xCE,
+  0x48, 0xAE, 0xD3, 0x06, 0x88, 0xFB, 0xA3, 0x01, 0x61, 0x0D, 0x50, 0xCE, 0x92, 0x50, 0xCF, 0x02,
+  0x50, 0xAF, 0x50, 0xCF, 0x50, 0xAE, 0x85, 0x48, 0xAE, 0x03, 0x50, 0xCD, 0x81, 0xAA, 0xC2, 0xA7,
+  0xF3, 0x84, 0x90, 0xFB, 0xA3, 0x01, 0xDB, 0x06, 0x58, 0xEE, 0x95, 0x50, 0xCF, 0x80, 0x50, 0xAF,
+  0x81, 0x50, 0xCF, 0x83, 0x50, 0xAF, 0x8B, 0x50, 0xCF, 0x82, 0x50, 0xAF, 0x9D, 0x50, 0xCF, 0x83,
+  0x50, 0xAF, 0x84, 0x50, 0xCF, 0x85, 0x50, 0xAF, 0x84, 0x50, 0xCF, 0x81, 0x50, 0xAF, 0x82, 0x50,
+  0xCF, 0x83, 0x50, 0xAF, 0x82, 0x50, 0xCF, 0x82, 0x50, 0xAF, 0x81, 0x50, 0xCF, 0x80, 0x50, 0xAF,
+  0x8C, 0x50, 0xCF, 0x82, 0x50, 0xAF, 0x87, 0x50, 0xCF, 0x8B, 0x50, 0xAF, 0x88, 0x50, 0xCF, 0x81,
+  0x50, 0xAF, 0x8F, 0x50, 0xCF, 0x01, 0x50, 0xCE, 0xB2, 0x68, 0xA2, 0xFB, 0xA3, 0x00, 0x89, 0xAB,
+  0x8A, 0x50, 0xCF, 0x02, 0x50, 0xCE, 0x48, 0xAE, 0xD3, 0x06, 0x88, 0xFB, 0xA3, 0x01, 0x61, 0x0D,
+  0x50, 0xCE, 0x95, 0x50, 0xCF, 0x00, 0x50, 0xCE, 0x87, 0x48, 0xAE, 0x03, 0x50, 0xCD, 0x81, 0xAA,
+  0xC2, 0xA7, 0xFB, 0x84, 0x8E, 0xFB, 0xA3, 0x00, 0xCA, 0xC7, 0xB9, 0x50, 0xCF, 0x00, 0x50, 0xAF,
+  0xCC, 0x50, 0xCF, 0x00, 0x50, 0xAF, 0xB3, 0x50, 0xCF, 0x81, 0x50, 0xAF, 0x83, 0x50, 0xCF, 0x01,
+  0x50, 0xCE, 0xEB, 0x45, 0xA2, 0xFB, 0xA3, 0x01, 0xC2, 0xA7, 0x50, 0xCE, 0x89, 0x50, 0xCF, 0x02,
+  0x50, 0xCE, 0x48, 0xAE, 0xD3, 0x06, 0x88, 0xFB, 0xA3, 0x01, 0x61, 0x0D, 0x50, 0xCE, 0x89, 0x50,
+  0xCF, 0x00, 0x69, 0x2D, 0x88, 0xA2, 0x29, 0x00, 0x81, 0x8B, 0x80, 0x50, 0xCF, 0x01, 0x50, 0xCE,
+  0x48, 0xCE, 0x87, 0x48, 0xAE, 0x03, 0x50, 0xCD, 0x89, 0xCA, 0xCA, 0xC6, 0xFB, 0xA4, 0x8C, 0xFB,
+  0xA3, 0x00, 0x91, 0xCA, 0x90, 0x50, 0xCF, 0x00, 0x50, 0xAF, 0x81, 0x50, 0xCF, 0x00, 0x50, 0xAF,
+  0x82, 0x50, 0xCF, 0x80, 0x50, 0xAF, 0xFF, 0x50, 0xCF, 0x9B, 0x50, 0xCF, 0x89, 0x50, 0xAF, 0x01,
+  0x48, 0xAE, 0x79, 0x6C, 0xA3, 0xFB, 0xA3, 0x02, 0xFB, 0x84, 0x58, 0xCE, 0x50, 0xAE, 0x87, 0x50,
+  0xAF, 0x00, 0x50, 0xAE, 0x80, 0x48, 0xAE, 0x00, 0xD3, 0x06, 0x88, 0xFB, 0xA3, 0x01, 0x61, 0x0D,
+  0x48, 0xAE, 0x89, 0x50, 0xAF, 0x00, 0x81, 0xAB, 0x88, 0xFB, 0xA3, 0x01, 0xBA, 0x88, 0x50, 0xAE,
+  0x80, 0x50, 0xAF, 0x00, 0x50, 0xAE, 0x8A, 0x48, 0xAE, 0x02, 0x61, 0x0C, 0xAA, 0x48, 0xF3, 0x64,
+  0x8A, 0xFB, 0xA3, 0x02, 0xEB, 0x45, 0x50, 0xCE, 0x50, 0xAE, 0xFF, 0x50, 0xAF, 0x9C, 0x50, 0xAF,
+  0x8A, 0x50, 0xCF, 0x85, 0x50, 0xAF, 0x00, 0x50, 0xCF, 0x84, 0x50, 0xAF, 0x83, 0x48, 0xAF, 0x82,
+  0x50, 0xAF, 0x00, 0x48, 0xAF, 0x80, 0x48, 0xAE, 0x00, 0xB2, 0x68, 0xA4, 0xFB, 0xA3, 0x01, 0x89,
+  0xCA, 0x48, 0xAE, 0x83, 0x48, 0xAF, 0x82, 0x50, 0xAF, 0x81, 0x48, 0xAE, 0x00, 0xD3, 0x06, 0x88,
+  0xFB, 0xA3, 0x00, 0x61, 0x0D, 0x80, 0x48, 0xAE, 0x84, 0x48, 0xAF, 0x81, 0x50, 0xAF, 0x01, 0x48,
+  0xAE, 0x79, 0x8B, 0x88, 0xFB, 0xA3, 0x02, 0xC2, 0xA7, 0x48, 0xAE, 0x50, 0xAE, 0x81, 0x50, 0xAF,
+  0x00, 0x50, 0xAE, 0x8A, 0x48, 0xAE, 0x01, 0x50, 0xED, 0xAA, 0x48, 0x8A, 0xFB, 0xA3, 0x01, 0x89,
+  0xAB, 0x48, 0xAE, 0xB6, 0x50, 0xAF, 0x83, 0x48, 0xAF, 0xC4, 0x50, 0xAF, 0x00, 0x48, 0xAF, 0x81,
+  0x50, 0xAF, 0x00, 0x48, 0xAF, 0xAF, 0x50, 0xAF, 0x8A, 0x48, 0xAE, 0x00, 0xEB, 0x64, 0xA4, 0xFB,
+  0xA3, 0x00, 0xCA, 0xC7, 0x82, 0x48, 0xAE, 0x80, 0x48, 0xAF, 0x85, 0x48, 0xAE, 0x00, 0xD2, 0xE6,
+  0x88, 0xFB, 0xA3, 0x00, 0x61, 0x0D, 0x8A, 0x48, 0xAE, 0x00, 0x69, 0x2C, 0x88, 0xFB, 0xA3, 0x00,
+  0xE3, 0x25, 0x84, 0x48, 0xAE, 0x00, 0x48, 0xAF, 0x8B, 0x48, 0xAE, 0x01, 0x79, 0x8B, 0xFB, 0x84,
+  0x88, 0xFB, 0xA3, 0x00, 0xBA, 0x88, 0x86, 0x48, 0xAE, 0x87, 0x48, 0xAF, 0x81, 0x48, 0xAE, 0x00,
+  0x48, 0xAF, 0x83, 0x48, 0xAE, 0x83, 0x48, 0xAF, 0x81, 0x48, 0xAE, 0x86, 0x48, 0xAF, 0x80, 0x48,
+  0xAE, 0x00, 0x48, 0xAF, 0x80, 0x48, 0xAE, 0x91, 0x48, 0xAF, 0x90, 0x48, 0xAE, 0xB0, 0x48, 0xAF,
+  0x80, 0x50, 0xAF, 0xB0, 0x48, 0xAF, 0x89, 0x48, 0xAE, 0x00, 0x79, 0x6B, 0xA5, 0xFB, 0xA3, 0x01,
+  0xFB, 0x84, 0x50, 0xCE, 0x8A, 0x48, 0xAE, 0x00, 0xD2, 0xE6, 0x88, 0xFB, 0xA3, 0x00, 0x61, 0x0D,
+  0x8A, 0x48, 0xAE, 0x00, 0x50, 0xCD, 0x89, 0xFB, 0xA3, 0x00, 0x58, 0xED, 0x92, 0x48, 0xAE, 0x00,
+  0x91, 0xE9, 0x88, 0xFB, 0xA3, 0x00, 0xDB, 0x06, 0xFF, 0x48, 0xAE, 0x84, 0x48, 0xAE, 0x10, 0x41,
+  0x10, 0x31, 0xB4, 0x22, 0x77, 0x1A, 0xF9, 0x13, 0x5B, 0x0B, 0x9D, 0x03, 0xDE, 0x03, 0xFE, 0x04,
+  0x1F, 0x03, 0xFE, 0x03, 0xDE, 0x0B, 0x9C, 0x13, 0x3B, 0x1A, 0xF9, 0x2A, 0x56, 0x39, 0xB3, 0x48,
+  0xEF, 0xAB, 0x48, 0xAE, 0x00, 0xB2, 0x68, 0xA6, 0xFB, 0xA3, 0x00, 0x89, 0xCA, 0x8A, 0x48, 0xAE,
+  0x00, 0xD2, 0xE6, 0x88, 0xFB, 0xA3, 0x00, 0x61, 0x0D, 0x8B, 0x48, 0xAE, 0x00, 0xEB, 0x44, 0x88,
+  0xFB, 0xA3, 0x00, 0xA2, 0x29, 0x92, 0x48, 0xAE, 0x00, 0x50, 0xCD, 0x88, 0xFB, 0xA3, 0x00, 0xEB,
+  0x45, 0xFF, 0x48, 0xAE, 0x81, 0x48, 0xAE, 0x02, 0x41, 0x51, 0x22, 0x98, 0x0B, 0x9C, 0x8F, 0x04,
+  0x1F, 0x02, 0x13, 0x5C, 0x22, 0x77, 0x41, 0x10, 0xA8, 0x48, 0xAE, 0x00, 0xF3, 0x64, 0xA6, 0xFB,
+  0xA3, 0x00, 0xCA, 0xC6, 0x8A, 0x48, 0xAE, 0x00, 0xD2, 0xE6, 0x88, 0xFB, 0xA3, 0x00, 0x61, 0x0D,
+  0x8B, 0x48, 0xAE, 0x00, 0xC2, 0xA7, 0x88, 0xFB, 0xA3, 0x01, 0xF3, 0x84, 0x58, 0xED, 0x91, 0x48,
+  0xAE, 0x00, 0x50, 0xCD, 0x88, 0xFB, 0xA3, 0x00, 0xEB, 0x45, 0xFF, 0x48, 0xAE, 0x02, 0x48, 0xAE,
+  0x39, 0x72, 0x13, 0x1A, 0x95, 0x04, 0x1F, 0x01, 0x1A, 0xD9, 0x41, 0x31, 0xA5, 0x48, 0xAE, 0x00,
+  0x79, 0x6B, 0x88, 0xFB, 0xA3, 0x00, 0xC2, 0xA7, 0x92, 0x48, 0xCD, 0x00, 0xE3, 0x45, 0x87, 0xFB,
+  0xA3, 0x01, 0xFB, 0x84, 0x58, 0xCD, 0x89, 0x48, 0xAE, 0x00, 0xD2, 0xE6, 0x88, 0xFB, 0xA3, 0x00,
+  0x58, 0xED, 0x8B, 0x48, 0xAE, 0x00, 0x91, 0xE9, 0x89, 0xFB, 0xA3, 0x01, 0xE3, 0x25, 0x58, 0xED,
+  0x90, 0x48, 0xAE, 0x00, 0x89, 0xCA, 0x88, 0xFB, 0xA3, 0x00, 0xDB, 0x05, 0xFE, 0x48, 0xAE, 0x01,
+  0x41, 0x10, 0x1A, 0xFA, 0x99, 0x04, 0x1F, 0x01, 0x22, 0xB8, 0x48, 0xCF, 0xA3, 0x48, 0xAE, 0x00,
+  0xB2, 0x68, 0x88, 0xFB, 0xA3, 0x00, 0x81, 0xAA, 0x80, 0x40, 0xAD, 0x8D, 0x48, 0xAD, 0x81, 0x40,
+  0xAD, 0x00, 0xAA, 0x48, 0x88, 0xFB, 0xA3, 0x00, 0x91, 0xCA, 0x89, 0x48, 0xAE, 0x00, 0xD2, 0xE6,
+  0x88, 0xFB, 0xA3, 0x00, 0x59, 0x0D, 0x81, 0x48, 0xAE, 0x00, 0x48, 0xAF, 0x87, 0x48, 0xAE, 0x01,
+  0x58, 0xED, 0xFB, 0x84, 0x89, 0xFB, 0xA3, 0x02, 0xEB, 0x64, 0x91, 0xEA, 0x48, 0xCE, 0x8D, 0x48,
+  0xAE, 0x01, 0x81, 0x8B, 0xF3, 0x84, 0x88, 0xFB, 0xA3, 0x00, 0xC2, 0xA7, 0x85, 0x48, 0xAE, 0x00,
+  0x48, 0xAF, 0xF5, 0x48, 0xAE, 0x01, 0x39, 0x92, 0x03, 0xDE, 0x8A, 0x04, 0x1F, 0x00, 0x04, 0x3F,
+  0x8E, 0x04, 0x1F, 0x01, 0x0B, 0x9C, 0x41, 0x31, 0xA2, 0x48, 0xAE, 0x00, 0xF3, 0x64, 0x87, 0xFB,
+  0xA3, 0x01, 0xFB, 0x84, 0x48, 0xCD, 0x90, 0x48, 0xAE, 0x02, 0x40, 0xAE, 0x40, 0xAD, 0x69, 0x4B,
+  0x88, 0xFB, 0xA3, 0x00, 0xCA, 0xC6, 0x89, 0x48, 0xAE, 0x00, 0xD2, 0xE6, 0x88, 0xFB, 0xA3, 0x00,
+  0x58, 0xED, 0x81, 0x48, 0xAE, 0x00, 0x48, 0xAF, 0x88, 0x48, 0xAE, 0x00, 0xC2, 0xA7, 0x8B, 0xFB,
+  0xA3, 0x04, 0xEB, 0x64, 0xBA, 0x87, 0x89, 0xCA, 0x69, 0x2C, 0x50, 0xCE, 0x85, 0x48, 0xAE, 0x03,
+  0x50, 0xCD, 0x71, 0x4C, 0x99, 0xE9, 0xDB, 0x06, 0x8A, 0xFB, 0xA3, 0x00, 0x99, 0xE9, 0xB3, 0x48,
+  0xAE, 0x00, 0x48, 0xAF, 0xC6, 0x48, 0xAE, 0x00, 0x31, 0xD4, 0x8C, 0x04, 0x1F, 0x01, 0xA6, 0x9F,
+  0x1C, 0x7F, 0x8E, 0x04, 0x1F, 0x01, 0x03, 0xDE, 0x39, 0x72, 0x93, 0x48, 0xAE, 0x80, 0x48, 0xAF,
+  0x89, 0x48, 0xAE, 0x00, 0x79, 0x8B, 0x88, 0xFB, 0xA3, 0x01, 0xC2, 0xA7, 0x40, 0xAD, 0x92, 0x48,
+  0xAE, 0x01, 0x40, 0xAD, 0xEB, 0x45, 0x87, 0xFB, 0xA3, 0x01, 0xFB, 0x84, 0x58, 0xED, 0x88, 0x48,
+  0xAE, 0x00, 0xD2, 0xE6, 0x88, 0xFB, 0xA3, 0x00, 0x58, 0xED, 0x8C, 0x48, 0xAE, 0x00, 0x69, 0x4B,
+  0x90, 0xFB, 0xA3, 0x06, 0xF3, 0x84, 0xEB, 0x45, 0xE3, 0x45, 0xE3, 0x25, 0xE3, 0x45, 0xEB, 0x44,
+  0xF3, 0x84, 0x8E, 0xFB, 0xA3, 0x00, 0x61, 0x0C, 0xFB, 0x48, 0xAE, 0x00, 0x31, 0xD4, 0x8D, 0x04,
+  0x1F, 0x02, 0xCF, 0x3F, 0xD7, 0x5F, 0x1C, 0x7F, 0x8E, 0x04, 0x1F, 0x01, 0x03, 0xDE, 0x39, 0x52,
+  0x9F, 0x48, 0xAE, 0x00, 0xBA, 0x87, 0x88, 0xFB, 0xA3, 0x00, 0x81, 0xAA, 0x94, 0x48, 0xAE, 0x00,
+  0xAA, 0x48, 0x88, 0xFB, 0xA3, 0x00, 0x91, 0xCA, 0x88, 0x48, 0xAE, 0x00, 0xD2, 0xE6, 0x88, 0xFB,
+  0xA3, 0x00, 0x58, 0xED, 0x8C, 0x48, 0xAE, 0x01, 0x40, 0xAE, 0xBA, 0x87, 0xA5, 0xFB, 0xA3, 0x00,
+  0xCA, 0xC6, 0xFB, 0x48, 0xAE, 0x01, 0x39, 0x51, 0x03, 0xFF, 0x8D, 0x04, 0x1F, 0x03, 0xCF, 0x3F,
+  0xFF, 0xFF, 0xD7, 0x5F, 0x1C, 0x7F, 0x8E, 0x04, 0x1F, 0x01, 0x03, 0xBD, 0x40, 0xF0, 0x9E, 0x48,
+  0xAE, 0x00, 0xF3, 0x64, 0x87, 0xFB, 0xA3, 0x02, 0xFB, 0x84, 0x50, 0xCD, 0x48, 0x8E, 0x92, 0x48,
+  0xAE, 0x01, 0x40, 0x8E, 0x69, 0x4B, 0x88, 0xFB, 0xA3, 0x00, 0xD2, 0xE6, 0x87, 0x48, 0xAE, 0x01,
+  0x40, 0xAE, 0xD2, 0xE6, 0x88, 0xFB, 0xA3, 0x00, 0x58, 0xED, 0x8C, 0x48, 0xAE, 0x02, 0x48, 0x8E,
+  0x50, 0xCD, 0xE3, 0x25, 0xA4, 0xFB, 0xA3, 0x01, 0x69, 0x4B, 0x48, 0x8E, 0xF9, 0x48, 0xAE, 0x01,
+  0x40, 0xCF, 0x0B, 0x9D, 0x8E, 0x04, 0x1F, 0x00, 0xCF, 0x3F, 0x80, 0xFF, 0xFF, 0x01, 0xD7, 0x5F,
+  0x14, 0x7F, 0x8E, 0x04, 0x1F, 0x00, 0x13, 0x1A, 0x9D, 0x48, 0xAE, 0x00, 0x79, 0x8B, 0x88, 0xFB,
+  0xA3, 0x00, 0xC2, 0xA7, 0x80, 0x40, 0x8E, 0x00, 0x40, 0xAE, 0x90, 0x48, 0xAE, 0x00, 0x40, 0xAE,
+  0x80, 0x40, 0x8E, 0x00, 0xEB, 0x45, 0x87, 0xFB, 0xA3, 0x02, 0xFB, 0x84, 0x50, 0xED, 0x40, 0xAE,
+  0x84, 0x48, 0xAE, 0x02, 0x40, 0xAE, 0x40, 0x8E, 0xD2, 0xE6, 0x88, 0xFB, 0xA3, 0x00, 0x58, 0xED,
+  0x8C, 0x48, 0xAE, 0x80, 0x40, 0x8E, 0x01, 0x61, 0x2C, 0xF3, 0x64, 0xA2, 0xFB, 0xA3, 0x00, 0xA2,
+  0x28, 0x80, 0x40, 0x8E, 0xF9, 0x48, 0xAE, 0x00, 0x1A, 0x98, 0x8F, 0x04, 0x1F, 0x00, 0xCF, 0x3F,
+  0x81, 0xFF, 0xFF, 0x01, 0xD7, 0x5F, 0x14, 0x7F, 0x8E, 0x04, 0x1F, 0x00, 0x29, 0xF4, 0x94, 0x48,
+  0xAE, 0x86, 0x40, 0x8E, 0x00, 0xBA, 0x87, 0x88, 0xFB, 0xA3, 0x01, 0x81, 0xAA, 0x40, 0x8E, 0x80,
+  0x40, 0xAE, 0x81, 0x48, 0xAE, 0x83, 0x40, 0xAE, 0x82, 0x48, 0xAE, 0x81, 0x40, 0x8E, 0x81, 0x48,
+  0xAE, 0x80, 0x40, 0xAE, 0x01, 0x40, 0x8E, 0xAA, 0x48, 0x88, 0xFB, 0xA3, 0x01, 0x91, 0xEA, 0x40,
+  0xAE, 0x82, 0x48, 0xAE, 0x04, 0x40, 0x8E, 0x48, 0xAE, 0x40, 0xAE, 0x40, 0x8E, 0xD2, 0xE6, 0x88,
+  0xFB, 0xA3, 0x00, 0x58, 0xED, 0x80, 0x40, 0xAE, 0x82, 0x48, 0xAE, 0x80, 0x40, 0x8E, 0x83, 0x48,
+  0xAE, 0x80, 0x40, 0xAE, 0x80, 0x40, 0x8E, 0x01, 0x61, 0x2C, 0xEB, 0x44, 0xA0, 0xFB, 0xA3, 0x01,
+  0xBA, 0x87, 0x40, 0x8D, 0x80, 0x40, 0x8E, 0x00, 0x40, 0xAE, 0xAD, 0x48, 0xAE, 0x83, 0x40, 0xAE,
+  0xB3, 0x48, 0xAE, 0x00, 0x40, 0x8E, 0x82, 0x48, 0xAE, 0x81, 0x40, 0x8E, 0x86, 0x48, 0xAE, 0x00,
+  0x39, 0x31, 0x90, 0x04, 0x1F, 0x00, 0xCF, 0x3F, 0x82, 0xFF, 0xFF, 0x01, 0xD7, 0x5F, 0x14, 0x7F,
+  0x8D, 0x04, 0x1F, 0x01, 0x03, 0xBD, 0x40, 0xCF, 0x8E, 0x48, 0xAE, 0x83, 0x40, 0xAE, 0x85, 0x40,
+  0x8E, 0x01, 0x48, 0xAE, 0xF3, 0x64, 0x87, 0xFB, 0xA3, 0x01, 0xFB, 0x84, 0x48, 0xAD, 0x88, 0x40,
+  0x8E, 0x00, 0x48, 0xAE, 0x86, 0x40, 0x8E, 0x00, 0x48, 0xAE, 0x82, 0x40, 0x8E, 0x00, 0x69, 0x4B,
+  0x88, 0xFB, 0xA3, 0x00, 0xD2, 0xE6, 0x87, 0x40, 0x8E, 0x00, 0xD2, 0xE6, 0x88, 0xFB, 0xA3, 0x00,
+  0x58, 0xED, 0x8F, 0x40, 0x8E, 0x02, 0x40, 0x8D, 0x50, 0xCC, 0xCA, 0xC6, 0x9E, 0xFB, 0xA3, 0x01,
+  0xAA, 0x48, 0x40, 0x8D, 0xC3, 0x40, 0x8E, 0x82, 0x48, 0xAE, 0x90, 0x40, 0x8E, 0x00, 0x48, 0xAE,
+  0x9F, 0x40, 0x8E, 0x00, 0x13, 0x1A, 0x90, 0x04, 0x1F, 0x00, 0xCF, 0x3F, 0x83, 0xFF, 0xFF, 0x01,
+  0xD7, 0x5F, 0x14, 0x7F, 0x8D, 0x04, 0x1F, 0x00, 0x22, 0x57, 0x84, 0x48, 0xAE, 0x83, 0x40, 0x8E,
+  0x81, 0x48, 0xAE, 0x81, 0x40, 0x8E, 0x82, 0x48, 0xAE, 0x85, 0x40, 0x8E, 0x00, 0x79, 0x8B, 0x88,
+  0xFB, 0xA3, 0x00, 0xC2, 0xA6, 0x98, 0x40, 0x8E, 0x00, 0xEB, 0x44, 0x88, 0xFB, 0xA3, 0x00, 0x58,
+  0xED, 0x86, 0x40, 0x8E, 0x00, 0xD2, 0xE6, 0x88, 0xFB, 0xA3, 0x00, 0x58, 0xED, 0x90, 0x40, 0x8E,
+  0x80, 0x40, 0x8D, 0x01, 0x81, 0xAA, 0xEB, 0x45, 0x9A, 0xFB, 0xA3, 0x02, 0xE3, 0x25, 0x71, 0x6A,
+  0x40, 0x8D, 0xFB, 0x40, 0x8E, 0x00, 0x39, 0x31, 0x91, 0x04, 0x1F, 0x00, 0xCF, 0x3F, 0x84, 0xFF,
+  0xFF, 0x01, 0xD7, 0x5F, 0x14, 0x7F, 0x8C, 0x04, 0x1F, 0x01, 0x03, 0xDE, 0x40, 0xAF, 0x99, 0x40,
+  0x8E, 0x00, 0xBA, 0x87, 0x88, 0xFB, 0xA3, 0x00, 0x89, 0xAA, 0x98, 0x40, 0x8E, 0x00, 0xAA, 0x48,
+  0x88, 0xFB, 0xA3, 0x00, 0x91, 0xE9, 0x86, 0x40, 0x8E, 0x00, 0xD2, 0xE6, 0x88, 0xFB, 0xA3, 0x00,
+  0x58, 0xEC, 0x83, 0x40, 0x8E, 0x80, 0x40, 0xAE, 0x8A, 0x40, 0x8E, 0x81, 0x40, 0x8D, 0x01, 0x81,
+  0xAA, 0xD2, 0xE6, 0x96, 0xFB, 0xA3, 0x01, 0xDB, 0x05, 0x89, 0xC9, 0x81, 0x40, 0x8D, 0xFB, 0x40,
+  0x8E, 0x00, 0x1A, 0xB8, 0x91, 0x04, 0x1F, 0x00, 0xCF, 0x3F, 0x85, 0xFF, 0xFF, 0x01, 0xD7, 0x5F,
+  0x14, 0x7F, 0x8C, 0x04, 0x1F, 0x00, 0x29, 0xF5, 0x98, 0x40, 0x8E, 0x01, 0x48, 0xAE, 0xF3, 0x84,
+  0x88, 0xFB, 0xA3, 0x00, 0xF3, 0x64, 0x8A, 0xEB, 0x64, 0x00, 0x50, 0xCD, 0x8B, 0x40, 0x8E, 0x00,
+  0x71, 0x4B, 0x88, 0xFB, 0xA3, 0x00, 0xFB, 0x84, 0x86, 0xEB, 0x64, 0x00, 0xFB, 0x84, 0x88, 0xFB,
+  0xA3, 0x00, 0xF3, 0x64, 0x96, 0xEB, 0x64, 0x01, 0xF3, 0x64, 0xFB, 0x84, 0x93, 0xFB, 0xA3, 0x00,
+  0xF3, 0x64, 0x84, 0xEB, 0x64, 0x00, 0x9A, 0x09, 0x8C, 0x40, 0x8E, 0x00, 0x99, 0xE9, 0x88, 0xEB,
+  0x64, 0x00, 0x81, 0xAA, 0x81, 0x40, 0x8E, 0x00, 0xAA, 0x48, 0x9E, 0xEB, 0x64, 0x00, 0x40, 0xAE,
+  0xB9, 0x40, 0x8E, 0x01, 0x40, 0xAE, 0x03, 0xFE, 0x91, 0x04, 0x1F, 0x00, 0xCF, 0x3F, 0x86, 0xFF,
+  0xFF, 0x01, 0xD7, 0x5F, 0x14, 0x7F, 0x8B, 0x04, 0x1F, 0x00, 0x13, 0x3B, 0x9A, 0x40, 0x8E, 0x01,
+  0x40, 0x8D, 0x91, 0xE9, 0x93, 0xFB, 0xA3, 0x00, 0x71, 0x4B, 0x8B, 0x40, 0x8E, 0x80, 0x40, 0x8D,
+  0x00, 0xAA, 0x48, 0x93, 0xFB, 0xA3, 0x00, 0x50, 0xEC, 0x81, 0x40, 0x8D, 0x00, 0xCA, 0xC6, 0x9D,
+  0xFB, 0xA3, 0x04, 0xEB, 0x64, 0x69, 0x4B, 0x81, 0xA9, 0x91, 0xE9, 0xAA, 0x48, 0x93, 0xFB, 0xA3,
+  0x00, 0xDB, 0x05, 0x8C, 0x40, 0x8E, 0x00, 0xA2, 0x09, 0x88, 0xFB, 0xA3, 0x00, 0x89, 0xCA, 0x81,
+  0x40, 0x8E, 0x00, 0xB2, 0x68, 0x9E, 0xFB, 0xA3, 0x00, 0x40, 0xAE, 0xB9, 0x40, 0x8E, 0x00, 0x31,
+  0x93, 0x92, 0x04, 0x1F, 0x00, 0xCF, 0x3F, 0x87, 0xFF, 0xFF, 0x01, 0xD7, 0x5F, 0x14, 0x7F, 0x8B,
+  0x04, 0x1F, 0x00, 0x38, 0xF0, 0x99, 0x40, 0x8E, 0x01, 0x40, 0x8D, 0x91, 0xE9, 0x93, 0xFB, 0xA3,
+  0x00, 0x91, 0xE9, 0x8B, 0x40, 0x8E, 0x80, 0x40, 0x8D, 0x00, 0xD2, 0xE6, 0x93, 0xFB, 0xA3, 0x00,
+  0x50, 0xEC, 0x81, 0x40, 0x8D, 0x00, 0xCA, 0xC6, 0x9D, 0xFB, 0xA3, 0x00, 0xEB, 0x44, 0x81, 0x40,
+  0x8D, 0x00, 0x48, 0xAD, 0x94, 0xFB, 0xA3, 0x00, 0x58, 0xED, 0x8B, 0x40, 0x8E, 0x00, 0x9A, 0x09,
+  0x88, 0xFB, 0xA3, 0x00, 0x89, 0xCA, 0x81, 0x40, 0x8E, 0x00, 0xB2, 0x67, 0x9E, 0xFB, 0xA3, 0x00,
+  0x40, 0xAE, 0xB9, 0x40, 0x8E, 0x00, 0x1A, 0xB8, 0x92, 0x04, 0x1F, 0x00, 0xCF, 0x3F, 0x82, 0xFF,
+  0xFF, 0x00, 0xF7, 0xDF, 0x83, 0xFF, 0xFF, 0x01, 0xD7, 0x5F, 0x14, 0x7F, 0x8A, 0x04, 0x1F, 0x00,
+  0x29, 0xF5, 0x99, 0x40, 0x8E, 0x01, 0x40, 0x8D, 0x91, 0xC9, 0x93, 0xFB, 0xA3, 0x00, 0xB2, 0x67,
+  0x8C, 0x40, 0x8E, 0x01, 0x40, 0x8D, 0xF3, 0x64, 0x93, 0xFB, 0xA3, 0x00, 0x50, 0xEC, 0x81, 0x40,
+  0x8D, 0x00, 0xCA, 0xC6, 0x9D, 0xFB, 0xA3, 0x00, 0xEB, 0x44, 0x81, 0x40, 0x8D, 0x00, 0x48, 0xAD,
+  0x94, 0xFB, 0xA3, 0x00, 0x91, 0xE9, 0x8B, 0x40, 0x8E, 0x00, 0x9A, 0x09, 0x88, 0xFB, 0xA3, 0x00,
+  0x89, 0xCA, 0x81, 0x40, 0x8E, 0x00, 0xB2, 0x67, 0x9E, 0xFB, 0xA3, 0x00, 0x40, 0x8D, 0xB9, 0x40,
+  0x8E, 0x00, 0x0B, 0xBD, 0x92, 0x04, 0x1F, 0x00, 0xCF, 0x3F, 0x82, 0xFF, 0xFF, 0x01, 0x55, 0x5F,
+  0xEF, 0xBF, 0x83, 0xFF, 0xFF, 0x01, 0xD7, 0x5F, 0x14, 0x5F, 0x89, 0x04, 0x1F, 0x00, 0x12, 0xFA,
+  0x99, 0x40, 0x8E, 0x01, 0x40, 0x8D, 0x91, 0xE9, 0x93, 0xFB, 0xA3, 0x00, 0xDB, 0x05, 0x8C, 0x40,
+  0x8E, 0x00, 0x50, 0xEC, 0x94, 0xFB, 0xA3, 0x00, 0x50, 0xEC, 0x81, 0x40, 0x8D, 0x00, 0xCA, 0xC6,
+  0x9D, 0xFB, 0xA3, 0x00, 0xEB, 0x44, 0x81, 0x40, 0x8D, 0x00, 0x48, 0xAD, 0x94, 0xFB, 0xA3, 0x00,
+  0xD2, 0xE6, 0x8B, 0x40, 0x8E, 0x00, 0x9A, 0x09, 0x88, 0xFB, 0xA3, 0x00, 0x89, 0xCA, 0x81, 0x40,
+  0x8E, 0x00, 0xB2, 0x67, 0x9E, 0xFB, 0xA3, 0x00, 0x40, 0x8D, 0xB8, 0x40, 0x8E, 0x00, 0x38, 0xF0,
+  0x89, 0x04, 0x1F, 0x01, 0x7D, 0xFF, 0x0C, 0x3F, 0x86, 0x04, 0x1F, 0x00, 0xCF, 0x3F, 0x82, 0xFF,
+  0xFF, 0x02, 0x24, 0xBF, 0x2C, 0xDF, 0xEF, 0xBF, 0x83, 0xFF, 0xFF, 0x01, 0xD7, 0x5F, 0x14, 0x5F,
+  0x88, 0x04, 0x1F, 0x00, 0x03, 0xDE, 0x99, 0x40, 0x8E, 0x01, 0x38, 0x8D, 0x91, 0xE9, 0x93, 0xFB,
+  0xA3, 0x01, 0xF3, 0x84, 0x40, 0x8D, 0x8B, 0x40, 0x8E, 0x00, 0x79, 0x8A, 0x94, 0xFB, 0xA3, 0x04,
+  0x50, 0xEC, 0x38, 0x8D, 0x40, 0x8D, 0x38, 0x8D, 0xCA, 0xC6, 0x9D, 0xFB, 0xA3, 0x00, 0xEB, 0x44,
+  0x81, 0x38, 0x8D, 0x00, 0x48, 0xAD, 0x94, 0xFB, 0xA3, 0x01, 0xFB, 0x84, 0x48, 0xCD, 0x8A, 0x40,
+  0x8E, 0x00, 0x9A, 0x08, 0x88, 0xFB, 0xA3, 0x00, 0x89, 0xCA, 0x81, 0x40, 0x8E, 0x00, 0xB2, 0x67,
+  0x9E, 0xFB, 0xA3, 0x00, 0x40, 0x8D, 0xB8, 0x40, 0x8E, 0x00, 0x29, 0xD4, 0x88, 0x04, 0x1F, 0x03,
+  0xAE, 0xBF, 0xFF, 0xFF, 0xBE, 0xFF, 0x0C, 0x3F, 0x85, 0x04, 0x1F, 0x00, 0xCF, 0x3F, 0x82, 0xFF,
+  0xFF, 0x03, 0x24, 0xBF, 0x04, 0x1F, 0x34, 0xDF, 0xEF, 0xBF, 0x83, 0xFF, 0xFF, 0x01, 0xD7, 0x5F,
+  0x14, 0x5F, 0x88, 0x04, 0x1F, 0x00, 0x39, 0x10, 0x98, 0x40, 0x8E, 0x01, 0x38, 0x8D, 0x91, 0xC9,
+  0x94, 0xFB, 0xA3, 0x00, 0x59, 0x0C, 0x8B, 0x40, 0x8E, 0x00, 0x9A, 0x09, 0x94, 0xFB, 0xA3, 0x00,
+  0x50, 0xEC, 0x80, 0x40, 0x8E, 0x01, 0x38, 0x8D, 0xCA, 0xC6, 0x9D, 0xFB, 0xA3, 0x01, 0xEB, 0x44,
+  0x38, 0x8D, 0x80, 0x40, 0x8D, 0x00, 0x48, 0xAD, 0x95, 0xFB, 0xA3, 0x00, 0x89, 0xAA, 0x89, 0x40,
+  0x8E, 0x01, 0x38, 0x8D, 0x9A, 0x08, 0x88, 0xFB, 0xA3, 0x04, 0x89, 0xC9, 0x40, 0x8D, 0x40, 0x8E,
+  0x38, 0x8D, 0xB2, 0x67, 0x9E, 0xFB, 0xA3, 0x00, 0x40, 0x8D, 0xB8, 0x40, 0x8E, 0x00, 0x1A, 0x97,
+  0x87, 0x04, 0x1F, 0x00, 0xA6, 0x9F, 0x81, 0xFF, 0xFF, 0x01, 0xBE, 0xFF, 0x0C, 0x3F, 0x84, 0x04,
+  0x1F, 0x00, 0xCF, 0x3F, 0x82, 0xFF, 0xFF, 0x00, 0x24, 0xBF, 0x80, 0x04, 0x1F, 0x01, 0x34, 0xDF,
+  0xEF, 0xBF, 0x83, 0xFF, 0xFF, 0x01, 0xD7, 0x5F, 0x14, 0x5F, 0x87, 0x04, 0x1F, 0x00, 0x29, 0xD4,
+  0x98, 0x40, 0x8E, 0x01, 0x38, 0x8D, 0x91, 0xC9, 0x94, 0xFB, 0xA3, 0x00, 0x81, 0xAA, 0x8B, 0x40,
+  0x8E, 0x00, 0xBA, 0x87, 0x94, 0xFB, 0xA3, 0x00, 0x50, 0xEC, 0x80, 0x40, 0x8E, 0x01, 0x38, 0x8D,
+  0xCA, 0xC6, 0x9D, 0xFB, 0xA3, 0x01, 0xEB, 0x44, 0x38, 0x8D, 0x80, 0x40, 0x8E, 0x00, 0x48, 0xAD,
+  0x95, 0xFB, 0xA3, 0x00, 0xC2, 0xA6, 0x89, 0x40, 0x8E, 0x01, 0x38, 0x8D, 0x9A, 0x08, 0x88, 0xFB,
+  0xA3, 0x04, 0x89, 0xC9, 0x40, 0x8D, 0x40, 0x8E, 0x38, 0x8D, 0xB2, 0x67, 0x9E, 0xFB, 0xA3, 0x00,
+  0x40, 0x8D, 0xB8, 0x40, 0x8E, 0x00, 0x13, 0x3A, 0x86, 0x04, 0x1F, 0x00, 0x96, 0x7F, 0x83, 0xFF,
+  0xFF, 0x01, 0xBE, 0xFF, 0x0C, 0x3F, 0x83, 0x04, 0x1F, 0x00, 0xCF, 0x3F, 0x82, 0xFF, 0xFF, 0x00,
+  0x24, 0xBF, 0x81, 0x04, 0x1F, 0x01, 0x34, 0xDF, 0xEF, 0xBF, 0x83, 0xFF, 0xFF, 0x01, 0xCF, 0x3F,
+  0x14, 0x5F, 0x86, 0x04, 0x1F, 0x00, 0x1A, 0x57, 0x98, 0x40, 0x8E, 0x01, 0x38, 0x8D, 0x91, 0xC9,
+  0x94, 0xFB, 0xA3, 0x01, 0xA2, 0x28, 0x38, 0x8E, 0x89, 0x40, 0x8E, 0x01, 0x38, 0x8D, 0xE3, 0x25,
+  0x94, 0xFB, 0xA3, 0x00, 0x50, 0xEC, 0x80, 0x38, 0x8E, 0x01, 0x38, 0x8D, 0xCA, 0xC6, 0x9D, 0xFB,
+  0xA3, 0x00, 0xEB, 0x44, 0x81, 0x38, 0x8D, 0x00, 0x48, 0xAD, 0x95, 0xFB, 0xA3, 0x01, 0xFB, 0x84,
+  0x48, 0xAD, 0x88, 0x40, 0x8E, 0x01, 0x38, 0x8D, 0x9A, 0x08, 0x88, 0xFB, 0xA3, 0x04, 0x89, 0xC9,
+  0x38, 0x8D, 0x40, 0x8E, 0x38, 0x8D, 0xB2, 0x67, 0x9E, 0xFB, 0xA3, 0x01, 0x40, 0x8D, 0x38, 0x8E,
+  0xA0, 0x40, 0x8E, 0x00, 0x38, 0x8E, 0x94, 0x40, 0x8E, 0x00, 0x03, 0xBD, 0x86, 0x04, 0x1F, 0x00,
+  0x55, 0x7F, 0x84, 0xFF, 0xFF, 0x01, 0xBE, 0xFF, 0x04, 0x3F, 0x82, 0x04, 0x1F, 0x00, 0xCF, 0x3F,
+  0x82, 0xFF, 0xFF, 0x00, 0x24, 0xBF, 0x82, 0x04, 0x1F, 0x00, 0x86, 0x1F, 0x84, 0xFF, 0xFF, 0x00,
+  0x86, 0x1F, 0x86, 0x04, 0x1F, 0x00, 0x12, 0xD9, 0x90, 0x40, 0x8E, 0x86, 0x38, 0x8E, 0x01, 0x38,
+  0x8D, 0x91, 0xC9, 0x88, 0xFB, 0xA3, 0x02, 0xD3, 0x05, 0xB2, 0x67, 0xF3, 0x64, 0x87, 0xFB, 0xA3,
+  0x01, 0xC2, 0xC6, 0x38, 0x8D, 0x89, 0x38, 0x8E, 0x01, 0x40, 0xAD, 0xFB, 0x84, 0x87, 0xFB, 0xA3,
+  0x02, 0xDB, 0x05, 0xB2, 0x67, 0xEB, 0x64, 0x88, 0xFB, 0xA3, 0x00, 0x50, 0xEC, 0x81, 0x38, 0x8D,
+  0x00, 0x91, 0xE9, 0x88, 0xB2, 0x67, 0x00, 0xF3, 0x64, 0x88, 0xFB, 0xA3, 0x88, 0xB2, 0x67, 0x00,
+  0xAA, 0x48, 0x81, 0x38, 0x8D, 0x00, 0x40, 0xAD, 0x88, 0xFB, 0xA3, 0x00, 0xF3, 0x64, 0x80, 0xB2,
+  0x67, 0x00, 0xBA, 0x87, 0x88, 0xFB, 0xA3, 0x00, 0x79, 0x8A, 0x81, 0x38, 0x8E, 0x82, 0x40, 0x8E,
+  0x81, 0x38, 0x8E, 0x01, 0x38, 0x8D, 0x9A, 0x08, 0x88, 0xFB, 0xA3, 0x00, 0x89, 0xC9, 0x81, 0x38,
+  0x8D, 0x00, 0x81, 0xA9, 0x88, 0xB2, 0x67, 0x00, 0xEB, 0x44, 0x88, 0xFB, 0xA3, 0x00, 0xBA, 0xA6,
+  0x88, 0xB2, 0x67, 0x80, 0x38, 0x8D, 0x86, 0x38, 0x8E, 0x00, 0x40, 0x8E, 0x8F, 0x38, 0x8E, 0x82,
+  0x40, 0x8E, 0x98, 0x38, 0x8E, 0x00, 0x38, 0xAE, 0x88, 0x04, 0x1F, 0x00, 0x55, 0x7F, 0x84, 0xFF,
+  0xFF, 0x01, 0xB6, 0xDF, 0x04, 0x3F, 0x81, 0x04, 0x1F, 0x00, 0xCF, 0x3F, 0x82, 0xFF, 0xFF, 0x00,
+  0x24, 0xBF, 0x81, 0x04, 0x1F, 0x00, 0x65, 0x9F, 0x84, 0xFF, 0xFF, 0x00, 0xA6, 0x9F, 0x87, 0x04,
+  0x1F, 0x00, 0x0B, 0x7C, 0x98, 0x38, 0x8E, 0x01, 0x38, 0x8D, 0x91, 0xC9, 0x88, 0xFB, 0xA3, 0x02,
+  0x91, 0xE8, 0x38, 0x8D, 0xC2, 0xA6, 0x87, 0xFB, 0xA3, 0x01, 0xEB, 0x44, 0x38, 0x8D, 0x88, 0x38,
+  0x8E, 0x01, 0x38, 0x8D, 0x61, 0x2B, 0x88, 0xFB, 0xA3, 0x02, 0x81, 0xA9, 0x38, 0x8D, 0xD2, 0xE5,
+  0x88, 0xFB, 0xA3, 0x00, 0x50, 0xEC, 0x8C, 0x38, 0x8D, 0x00, 0xE3, 0x25, 0x88, 0xFB, 0xA3, 0x8C,
+  0x38, 0x8D, 0x00, 0x40, 0xAD, 0x88, 0xFB, 0xA3, 0x00, 0xDB, 0x25, 0x81, 0x38, 0x8D, 0x00, 0xE3,
+  0x25, 0x87, 0xFB, 0xA3, 0x01, 0xBA, 0x87, 0x38, 0x8D, 0x87, 0x38, 0x8E, 0x01, 0x38, 0x8D, 0x9A,
+  0x08, 0x88, 0xFB, 0xA3, 0x00, 0x89, 0xC9, 0x8C, 0x38, 0x8D, 0x00, 0xCA, 0xC6, 0x88, 0xFB, 0xA3,
+  0x00, 0x59, 0x0B, 0x8A, 0x38, 0x8D, 0xB6, 0x38, 0x8E, 0x00, 0x31, 0x31, 0x89, 0x04, 0x1F, 0x00,
+  0x5D, 0x7F, 0x84, 0xFF, 0xFF, 0x01, 0xB6, 0xDF, 0x04, 0x3F, 0x80, 0x04, 0x1F, 0x00, 0xCF, 0x3F,
+  0x82, 0xFF, 0xFF, 0x00, 0x24, 0xBF, 0x80, 0x04, 0x1F, 0x00, 0x5D, 0x9F, 0x84, 0xFF, 0xFF, 0x00,
+  0xA6, 0x9F, 0x88, 0x04, 0x1F, 0x00, 0x03, 0xFE, 0x97, 0x38, 0x8E, 0x80, 0x38, 0x8D, 0x00, 0x89,
+  0xC9, 0x88, 0xFB, 0xA3, 0x02, 0x91, 0xE8, 0x38, 0x8D, 0x9A, 0x08, 0x88, 0xFB, 0xA3, 0x01, 0x48,
+  0xCD, 0x38, 0x8D, 0x86, 0x38, 0x8E, 0x80, 0x38, 0x8D, 0x00, 0x89, 0xC9, 0x88, 0xFB, 0xA3, 0x02,
+  0x59, 0x0B, 0x38, 0x8D, 0xD2, 0xE5, 0x88, 0xFB, 0xA3, 0x00, 0x50, 0xCC, 0x8C, 0x38, 0x8D, 0x00,
+  0xE3, 0x25, 0x88, 0xFB, 0xA3, 0x8C, 0x38, 0x8D, 0x00, 0x40, 0xAD, 0x88, 0xFB, 0xA3, 0x00, 0xDB,
+  0x25, 0x81, 0x38, 0x8D, 0x00, 0xA2, 0x28, 0x87, 0xFB, 0xA3, 0x02, 0xF3, 0x64, 0x40, 0x8D, 0x38,
+  0x8D, 0x85, 0x38, 0x8E, 0x80, 0x38, 0x8D, 0x00, 0x9A, 0x08, 0x88, 0xFB, 0xA3, 0x00, 0x89, 0xA9,
+  0x8C, 0x38, 0x8D, 0x00, 0xCA, 0xC6, 0x88, 0xFB, 0xA3, 0x00, 0x58, 0xEB, 0x8A, 0x38, 0x8D, 0xB6,
+  0x38, 0x8E, 0x00, 0x29, 0x92, 0x8A, 0x04, 0x1F, 0x00, 0x55, 0x7F, 0x84, 0xFF, 0xFF, 0x03, 0xB6,
+  0xDF, 0x04, 0x3F, 0x04, 0x1F, 0xCF, 0x3F, 0x82, 0xFF, 0xFF, 0x02, 0x24, 0xBF, 0x04, 0x1F, 0x5D,
+  0x9F, 0x84, 0xFF, 0xFF, 0x00, 0xA6, 0x9F, 0x8A, 0x04, 0x1F, 0x00, 0x38, 0xAE, 0x96, 0x38, 0x8E,
+  0x80, 0x38, 0x8D, 0x00, 0x89, 0xC9, 0x88, 0xFB, 0xA3, 0x02, 0x91, 0xE8, 0x38, 0x8D, 0x71, 0x6A,
+  0x88, 0xFB, 0xA3, 0x00, 0x69, 0x4B, 0x80, 0x38, 0x8D, 0x85, 0x38, 0x8E, 0x80, 0x38, 0x8D, 0x00,
+  0xAA, 0x48, 0x87, 0xFB, 0xA3, 0x00, 0xFB, 0x84, 0x80, 0x38, 0x8D, 0x00, 0xD2, 0xE5, 0x88, 0xFB,
+  0xA3, 0x00, 0x50, 0xCC, 0x8C, 0x38, 0x8D, 0x00, 0xE3, 0x25, 0x88, 0xFB, 0xA3, 0x8C, 0x38, 0x8D,
+  0x00, 0x40, 0xAD, 0x88, 0xFB, 0xA3, 0x00, 0xDB, 0x25, 0x81, 0x38, 0x8D, 0x00, 0x61, 0x2B, 0x88,
+  0xFB, 0xA3, 0x01, 0x71, 0x6B, 0x38, 0x8D, 0x85, 0x38, 0x8E, 0x80, 0x38, 0x8D, 0x00, 0x9A, 0x08,
+  0x88, 0xFB, 0xA3, 0x00, 0x89, 0xA9, 0x8C, 0x38, 0x8D, 0x00, 0xCA, 0xC6, 0x88, 0xFB, 0xA3, 0x00,
+  0x58, 0xEB, 0x8A, 0x38, 0x8D, 0xB6, 0x38, 0x8E, 0x00, 0x21, 0xD4, 0x8B, 0x04, 0x1F, 0x00, 0x55,
+  0x7F, 0x84, 0xFF, 0xFF, 0x02, 0xB6, 0xDF, 0x04, 0x3F, 0xCF, 0x3F, 0x82, 0xFF, 0xFF, 0x01, 0x24,
+  0xBF, 0x5D, 0x9F, 0x84, 0xFF, 0xFF, 0x00, 0xA6, 0x9F, 0x8B, 0x04, 0x1F, 0x00, 0x30, 0xF0, 0x8A,
+  0x38, 0x8E, 0x00, 0x38, 0x8D, 0x86, 0x38, 0x8E, 0x80, 0x38, 0x8D, 0x00, 0x38, 0x8E, 0x80, 0x38,
+  0x8D, 0x00, 0x89, 0xC9, 0x88, 0xFB, 0xA3, 0x02, 0x91, 0xE8, 0x38, 0x8D, 0x50, 0xCC, 0x88, 0xFB,
+  0xA3, 0x00, 0x91, 0xE9, 0x84, 0x38, 0x8D, 0x81, 0x38, 0x8E, 0x80, 0x38, 0x8D, 0x00, 0xCA, 0xE6,
+  0x87, 0xFB, 0xA3, 0x00, 0xD3, 0x05, 0x80, 0x38, 0x6D, 0x00, 0xD2, 0xE6, 0x88, 0xFB, 0xA3, 0x00,
+  0x50, 0xCC, 0x8C, 0x38, 0x8D, 0x00, 0xE3, 0x25, 0x88, 0xFB, 0xA3, 0x8C, 0x38, 0x8D, 0x00, 0x40,
+  0xAD, 0x88, 0xFB, 0xA3, 0x05, 0xDB, 0x25, 0x38, 0x6D, 0x38, 0x8D, 0x38, 0x6D, 0x38, 0x8D, 0xEB,
+  0x44, 0x87, 0xFB, 0xA3, 0x00, 0xAA, 0x47, 0x80, 0x38, 0x8D, 0x84, 0x38, 0x8E, 0x80, 0x38, 0x8D,
+  0x00, 0x9A, 0x08, 0x88, 0xFB, 0xA3, 0x00, 0x89, 0xA9, 0x8C, 0x38, 0x8D, 0x00, 0xCA, 0xC6, 0x88,
+  0xFB, 0xA3, 0x00, 0x58, 0xEC, 0x89, 0x38, 0x8D, 0x8C, 0x38, 0x8E, 0x00, 0x38, 0x8D, 0x89, 0x38,
+  0x8E, 0x00, 0x38, 0x8D, 0x8B, 0x38, 0x8E, 0x00, 0x38, 0x8D, 0x81, 0x38, 0x8E, 0x00, 0x38, 0x8D,
+  0x82, 0x38, 0x8E, 0x80, 0x38, 0x8D, 0x81, 0x38, 0x8E, 0x00, 0x38, 0x8D, 0x80, 0x38, 0x8E, 0x00,
+  0x22, 0x15, 0x8C, 0x04, 0x1F, 0x00, 0x5D, 0x7F, 0x84, 0xFF, 0xFF, 0x01, 0xB6, 0xDF, 0xD7, 0x5F,
+  0x82, 0xFF, 0xFF, 0x00, 0x86, 0x1F, 0x84, 0xFF, 0xFF, 0x00, 0xA6, 0x9F, 0x8C, 0x04, 0x1F, 0x00,
+  0x31, 0x51, 0x81, 0x38, 0x8E, 0x00, 0x38, 0x8D, 0x8B, 0x38, 0x8E, 0x87, 0x38, 0x8D, 0x00, 0x89,
+  0xC9, 0x88, 0xFB, 0xA3, 0x00, 0x91, 0xE8, 0x80, 0x38, 0x6D, 0x00, 0xF3, 0x64, 0x87, 0xFB, 0xA3,
+  0x00, 0xB2, 0x67, 0x89, 0x38, 0x8D, 0x00, 0xF3, 0x64, 0x87, 0xFB, 0xA3, 0x00, 0xB2, 0x67, 0x80,
+  0x38, 0x6D, 0x00, 0xD2, 0xE6, 0x88, 0xFB, 0xA3, 0x00, 0x48, 0xCC, 0x8B, 0x38, 0x8D, 0x01, 0x38,
+  0x6D, 0xE3, 0x25, 0x88, 0xFB, 0xA3, 0x8C, 0x38, 0x8D, 0x00, 0x40, 0xAD, 0x88, 0xFB, 0xA3, 0x01,
+  0xDB, 0x25, 0x38, 0x6D, 0x80, 0x38, 0x8D, 0x01, 0x38, 0x6D, 0xAA, 0x47, 0x87, 0xFB, 0xA3, 0x00,
+  0xEB, 0x44, 0x88, 0x38, 0x8D, 0x00, 0x9A, 0x08, 0x88, 0xFB, 0xA3, 0x00, 0x81, 0xA9, 0x8B, 0x38,
+  0x8D, 0x01, 0x38, 0x6D, 0xCA, 0xC6, 0x88, 0xFB, 0xA3, 0x00, 0x50, 0xEC, 0xC2, 0x38, 0x8D, 0x00,
+  0x1A, 0x57, 0x8D, 0x04, 0x1F, 0x00, 0x55, 0x7F, 0x8F, 0xFF, 0xFF, 0x00, 0xA6, 0x9F, 0x8D, 0x04,
+  0x1F, 0x00, 0x29, 0x92, 0x98, 0x38, 0x8D, 0x00, 0x89, 0xC9, 0x88, 0xFB, 0xA3, 0x00, 0x91, 0xE8,
+  0x80, 0x38, 0x6D, 0x00, 0xCA, 0xC6, 0x87, 0xFB, 0xA3, 0x00, 0xDB, 0x05, 0x88, 0x38, 0x8D, 0x00,
+  0x50, 0xEC, 0x88, 0xFB, 0xA3, 0x00, 0x89, 0xC9, 0x80, 0x38, 0x6D, 0x00, 0xD2, 0xE6, 0x88, 0xFB,
+  0xA3, 0x00, 0x48, 0xCC, 0x8B, 0x38, 0x8D, 0x01, 0x38, 0x6D, 0xE3, 0x25, 0x88, 0xFB, 0xA3, 0x8C,
+  0x38, 0x8D, 0x00, 0x40, 0xAD, 0x88, 0xFB, 0xA3, 0x01, 0xDB, 0x25, 0x38, 0x6D, 0x80, 0x38, 0x8D,
+  0x01, 0x38, 0x6D, 0x69, 0x4A, 0x88, 0xFB, 0xA3, 0x00, 0x61, 0x2B, 0x87, 0x38, 0x8D, 0x00, 0x9A,
+  0x08, 0x88, 0xFB, 0xA3, 0x00, 0x81, 0xA9, 0x8C, 0x38, 0x8D, 0x00, 0xCA, 0xC6, 0x88, 0xFB, 0xA3,
+  0x00, 0x50, 0xEC, 0xC2, 0x38, 0x8D, 0x00, 0x1A, 0x98, 0x8E, 0x04, 0x1F, 0x00, 0x5D, 0x7F, 0x8D,
+  0xFF, 0xFF, 0x00, 0xA6, 0x9F, 0x8E, 0x04, 0x1F, 0x00, 0x21, 0xB4, 0x8F, 0x38, 0x8D, 0x87, 0x38,
+  0x6D, 0x00, 0x89, 0xC9, 0x88, 0xFB, 0xA3, 0x00, 0x91, 0xE8, 0x80, 0x38, 0x6D, 0x00, 0xA2, 0x28,
+  0x87, 0xFB, 0xA3, 0x01, 0xFB, 0x84, 0x38, 0x8D, 0x87, 0x38, 0x6D, 0x00, 0x71, 0x6A, 0x88, 0xFB,
+  0xA3, 0x00, 0x61, 0x2B, 0x80, 0x38, 0x6D, 0x00, 0xD2, 0xE5, 0x88, 0xFB, 0xA3, 0x01, 0x48, 0xCC,
+  0x38, 0x6D, 0x80, 0x38, 0x8D, 0x89, 0x38, 0x6D, 0x00, 0xE3, 0x25, 0x88, 0xFB, 0xA3, 0x00, 0x38,
+  0x8D, 0x8B, 0x38, 0x6D, 0x00, 0x40, 0xAC, 0x88, 0xFB, 0xA3, 0x00, 0xDB, 0x25, 0x82, 0x38, 0x6D,
+  0x01, 0x38, 0x8D, 0xF3, 0x64, 0x87, 0xFB, 0xA3, 0x00, 0xA2, 0x28, 0x87, 0x38, 0x6D, 0x00, 0x9A,
+  0x08, 0x88, 0xFB, 0xA3, 0x00, 0x81, 0xA9, 0x8A, 0x38, 0x6D, 0x80, 0x38, 0x8D, 0x00, 0xCA, 0xC6,
+  0x88, 0xFB, 0xA3, 0x00, 0x50, 0xEB, 0x81, 0x38, 0x6D, 0x82, 0x38, 0x8D, 0x94, 0x38, 0x6D, 0x80,
+  0x38, 0x8D, 0x81, 0x38, 0x6D, 0x87, 0x38, 0x8D, 0x82, 0x38, 0x6D, 0x80, 0x38, 0x8D, 0x8E, 0x38,
+  0x6D, 0x81, 0x38, 0x8D, 0x00, 0x1A, 0x98, 0x8F, 0x04, 0x1F, 0x00, 0x55, 0x7F, 0x8B, 0xFF, 0xFF,
+  0x00, 0xA6, 0x9F, 0x8F, 0x04, 0x1F, 0x00, 0x21, 0xD4, 0x80, 0x38, 0x6D, 0x80, 0x38, 0x8D, 0x94,
+  0x38, 0x6D, 0x00, 0x89, 0xC9, 0x88, 0xFB, 0xA3, 0x00, 0x91, 0xE8, 0x80, 0x38, 0x6D, 0x00, 0x79,
+  0x89, 0x88, 0xFB, 0xA3, 0x00, 0x59, 0x0B, 0x87, 0x38, 0x6D, 0x00, 0x9A, 0x08, 0x87, 0xFB, 0xA3,
+  0x01, 0xFB, 0x83, 0x40, 0x8C, 0x80, 0x38, 0x6D, 0x00, 0xD2, 0xE6, 0x88, 0xFB, 0xA3, 0x00, 0x48,
+  0xCC, 0x8C, 0x38, 0x6D, 0x00, 0xE3, 0x25, 0x88, 0xFB, 0xA3, 0x00, 0x38, 0x8D, 0x8B, 0x38, 0x6D,
+  0x00, 0x40, 0x8C, 0x88, 0xFB, 0xA3, 0x00, 0xDB, 0x25, 0x83, 0x38, 0x6D, 0x00, 0xB2, 0x87, 0x87,
+  0xFB, 0xA3, 0x00, 0xE3, 0x25, 0x87, 0x38, 0x6D, 0x00, 0x9A, 0x08, 0x88, 0xFB, 0xA3, 0x00, 0x81,
+  0xA9, 0x8C, 0x38, 0x6D, 0x00, 0xCA, 0xC6, 0x88, 0xFB, 0xA3, 0x00, 0x50, 0xEB, 0xA0, 0x38, 0x6D,
+  0x82, 0x38, 0x8D, 0x9C, 0x38, 0x6D, 0x00, 0x12, 0xB8, 0x90, 0x04, 0x1F, 0x00, 0x55, 0x7F, 0x89,
+  0xFF, 0xFF, 0x00, 0xAE, 0xBF, 0x90, 0x04, 0x1F, 0x00, 0x21, 0xF5, 0x98, 0x38, 0x6D, 0x00, 0x89,
+  0xC9, 0x88, 0xFB, 0xA3, 0x00, 0x91, 0xE8, 0x80, 0x38, 0x6D, 0x00, 0x58, 0xEB, 0x88, 0xFB, 0xA3,
+  0x00, 0x79, 0x8A, 0x87, 0x38, 0x6D, 0x00, 0xBA, 0x87, 0x87, 0xFB, 0xA3, 0x00, 0xDB, 0x25, 0x81,
+  0x38, 0x6D, 0x00, 0xD2, 0xE6, 0x88, 0xFB, 0xA3, 0x00, 0x48, 0xCC, 0x8C, 0x38, 0x6D, 0x00, 0xE3,
+  0x25, 0x88, 0xFB, 0xA3, 0x00, 0x38, 0x8D, 0x8B, 0x38, 0x6D, 0x00, 0x40, 0x8C, 0x88, 0xFB, 0xA3,
+  0x00, 0xDB, 0x25, 0x83, 0x38, 0x6D, 0x00, 0x79, 0x6A, 0x88, 0xFB, 0xA3, 0x00, 0x58, 0xEB, 0x86,
+  0x38, 0x6D, 0x00, 0x9A, 0x08, 0x88, 0xFB, 0xA3, 0x00, 0x81, 0xA9, 0x8C, 0x38, 0x6D, 0x00, 0xCA,
+  0xC6, 0x88, 0xFB, 0xA3, 0x00, 0x50, 0xEB, 0xC2, 0x38, 0x6D, 0x00, 0x12, 0xB8, 0x91, 0x04, 0x1F,
+  0x00, 0x55, 0x7F, 0x87, 0xFF, 0xFF, 0x00, 0xAE, 0xBF, 0x91, 0x04, 0x1F, 0x00, 0x22, 0x15, 0x91,
+  0x38, 0x6D, 0x00, 0x38, 0x8D, 0x82, 0x38, 0x6D, 0x02, 0x30, 0x6D, 0x38, 0x8D, 0x89, 0xC9, 0x88,
+  0xFB, 0xA3, 0x04, 0x91, 0xE8, 0x30, 0x6D, 0x30, 0x8D, 0x38, 0x8D, 0xF3, 0x84, 0x87, 0xFB, 0xA3,
+  0x01, 0xA2, 0x28, 0x30, 0x6D, 0x85, 0x38, 0x6D, 0x01, 0x30, 0x6D, 0xE3, 0x25, 0x87, 0xFB, 0xA3,
+  0x00, 0xBA, 0x87, 0x81, 0x30, 0x6D, 0x00, 0xD2, 0xE6, 0x88, 0xFB, 0xA3, 0x01, 0x48, 0xCC, 0x30,
+  0x6D, 0x80, 0x38, 0x8D, 0x84, 0x38, 0x6D, 0x00, 0x38, 0x8D, 0x80, 0x38, 0x6D, 0x80, 0x30, 0x6D,
+  0x00, 0xE3, 0x25, 0x88, 0xFB, 0xA3, 0x02, 0x38, 0x8D, 0x30, 0x6D, 0x38, 0x8D, 0x82, 0x38, 0x6D,
+  0x82, 0x38, 0x8D, 0x80, 0x38, 0x6D, 0x01, 0x30, 0x6D, 0x40, 0xAC, 0x88, 0xFB, 0xA3, 0x03, 0xDB,
+  0x25, 0x30, 0x8D, 0x30, 0x6D, 0x38, 0x6D, 0x80, 0x30, 0x6D, 0x01, 0x38, 0x8C, 0xF3, 0x84, 0x87,
+  0xFB, 0xA3, 0x00, 0x92, 0x08, 0x81, 0x38, 0x8D, 0x83, 0x38, 0x6D, 0x00, 0x9A, 0x08, 0x88, 0xFB,
+  0xA3, 0x00, 0x81, 0xA9, 0x81, 0x38, 0x8D, 0x82, 0x38, 0x6D, 0x82, 0x38, 0x8D, 0x80, 0x38, 0x6D,
+  0x01, 0x30, 0x6D, 0xCA, 0xC6, 0x88, 0xFB, 0xA3, 0x00, 0x50, 0xEB, 0x89, 0x38, 0x8D, 0x80, 0x38,
+  0x6D, 0x80, 0x38, 0x8D, 0x80, 0x38, 0x6D, 0x80, 0x38, 0x8D, 0x00, 0x38, 0x6D, 0x8F, 0x38, 0x8D,
+  0x00, 0x38, 0x6D, 0x85, 0x38, 0x8D, 0x85, 0x38, 0x6D, 0x88, 0x38, 0x8D, 0x81, 0x38, 0x6D, 0x80,
+  0x38, 0x8D, 0x01, 0x38, 0x6D, 0x12, 0xB8, 0x92, 0x04, 0x1F, 0x00, 0x55, 0x7F, 0x85, 0xFF, 0xFF,
+  0x00, 0xAE, 0xBF, 0x92, 0x04, 0x1F, 0x00, 0x1A, 0x36, 0x81, 0x38, 0x8D, 0x93, 0x38, 0x6D, 0x80,
+  0x30, 0x6D, 0x00, 0x89, 0xC9, 0x88, 0xFB, 0xA3, 0x00, 0x91, 0xE8, 0x81, 0x30, 0x6D, 0x00, 0xD2,
+  0xE5, 0x87, 0xFB, 0xA3, 0x01, 0xC2, 0xC6, 0x30, 0x6D, 0x84, 0x38, 0x6D, 0x02, 0x30, 0x6D, 0x38,
+  0x8C, 0xFB, 0x83, 0x87, 0xFB, 0xA3, 0x00, 0x91, 0xE8, 0x81, 0x30, 0x6D, 0x00, 0xD2, 0xE5, 0x88,
+  0xFB, 0xA3, 0x01, 0x48, 0xCC, 0x30, 0x6D, 0x89, 0x38, 0x6D, 0x80, 0x30, 0x6D, 0x00, 0xE3, 0x25,
+  0x88, 0xFB, 0xA3, 0x01, 0x38, 0x8D, 0x30, 0x6D, 0x89, 0x38, 0x6D, 0x01, 0x30, 0x6D, 0x40, 0x8C,
+  0x88, 0xFB, 0xA3, 0x00, 0xDB, 0x25, 0x80, 0x30, 0x6D, 0x00, 0x38, 0x6D, 0x81, 0x30, 0x6D, 0x00,
+  0xC2, 0xA6, 0x87, 0xFB, 0xA3, 0x01, 0xD3, 0x05, 0x30, 0x6D, 0x80, 0x38, 0x6D, 0x00, 0x30, 0x6D,
+  0x80, 0x38, 0x6D, 0x80, 0x30, 0x6D, 0x00, 0x9A, 0x08, 0x88, 0xFB, 0xA3, 0x00, 0x81, 0xA9, 0x80,
+  0x30, 0x6D, 0x88, 0x38, 0x6D, 0x80, 0x30, 0x6D, 0x00, 0xCA, 0xC6, 0x88, 0xFB, 0xA3, 0x01, 0x50,
+  0xEB, 0x30, 0x6D, 0x8D, 0x38, 0x6D, 0x00, 0x30, 0x6D, 0x80, 0x38, 0x6D, 0x00, 0x30, 0x6D, 0xAE,
+  0x38, 0x6D, 0x00, 0x12, 0xB8, 0x92, 0x04, 0x1F, 0x00, 0x55, 0x7F, 0x85, 0xFF, 0xFF, 0x00, 0xAE,
+  0xBF, 0x92, 0x04, 0x1F, 0x00, 0x1A, 0x36, 0x96, 0x38, 0x6D, 0x80, 0x30, 0x6D, 0x00, 0x89, 0xC9,
+  0x88, 0xFB, 0xA3, 0x00, 0x91, 0xE8, 0x81, 0x30, 0x6D, 0x00, 0xAA, 0x47, 0x87, 0xFB, 0xA3, 0x00,
+  0xEB, 0x44, 0x80, 0x30, 0x6D, 0x83, 0x38, 0x6D, 0x01, 0x30, 0x6D, 0x61, 0x2B, 0x88, 0xFB, 0xA3,
+  0x00, 0x69, 0x4A, 0x81, 0x30, 0x6D, 0x00, 0xD2, 0xE5, 0x88, 0xFB, 0xA3, 0x01, 0x48, 0xCC, 0x30,
+  0x6D, 0x89, 0x38, 0x6D, 0x80, 0x30, 0x6D, 0x00, 0xE3, 0x25, 0x88, 0xFB, 0xA3, 0x01, 0x38, 0x8D,
+  0x30, 0x6D, 0x89, 0x38, 0x6D, 0x01, 0x30, 0x6D, 0x40, 0x8C, 0x88, 0xFB, 0xA3, 0x00, 0xDB, 0x25,
+  0x80, 0x30, 0x6D, 0x80, 0x38, 0x6D, 0x80, 0x30, 0x6D, 0x00, 0x81, 0xA9, 0x88, 0xFB, 0xA3, 0x01,
+  0x48, 0xCC, 0x30, 0x6D, 0x82, 0x38, 0x6D, 0x80, 0x30, 0x6D, 0x00, 0x9A, 0x08, 0x88, 0xFB, 0xA3,
+  0x00, 0x81, 0xA9, 0x80, 0x30, 0x6D, 0x88, 0x38, 0x6D, 0x80, 0x30, 0x6D, 0x00, 0xCA, 0xC6, 0x88,
+  0xFB, 0xA3, 0x01, 0x50, 0xEB, 0x30, 0x6D, 0xA2, 0x38, 0x6D, 0x00, 0x30, 0x6D, 0x9C, 0x38, 0x6D,
+  0x00, 0x12, 0x98, 0x91, 0x04, 0x1F, 0x00, 0x55, 0x7F, 0x87, 0xFF, 0xFF, 0x00, 0xAE, 0xBF, 0x91,
+  0x04, 0x1F, 0x00, 0x1A, 0x35, 0x90, 0x38, 0x6D, 0x80, 0x30, 0x6D, 0x02, 0x38, 0x6D, 0x30, 0x6D,
+  0x30, 0x8D, 0x81, 0x30, 0x6D, 0x00, 0x89, 0xC9, 0x88, 0xFB, 0xA3, 0x00, 0x91, 0xE8, 0x81, 0x30,
+  0x6D, 0x00, 0x81, 0xA9, 0x88, 0xFB, 0xA3, 0x00, 0x40, 0xAC, 0x80, 0x30, 0x6D, 0x82, 0x38, 0x6D,
+  0x01, 0x30, 0x6D, 0x81, 0xA9, 0x88, 0xFB, 0xA3, 0x00, 0x40, 0xAC, 0x81, 0x30, 0x6D, 0x00, 0xD2,
+  0xE5, 0x88, 0xFB, 0xA3, 0x01, 0x48, 0xCC, 0x30, 0x6D, 0x80, 0x38, 0x6D, 0x82, 0x30, 0x6D, 0x00,
+  0x38, 0x6D, 0x84, 0x30, 0x6D, 0x00, 0xE3, 0x25, 0x88, 0xFB, 0xA3, 0x00, 0x38, 0x8D, 0x80, 0x30,
+  0x6D, 0x82, 0x38, 0x6D, 0x83, 0x30, 0x6D, 0x02, 0x38, 0x6D, 0x30, 0x6D, 0x40, 0x8C, 0x88, 0xFB,
+  0xA3, 0x00, 0xDB, 0x25, 0x80, 0x30, 0x6D, 0x80, 0x38, 0x6D, 0x80, 0x30, 0x6D, 0x01, 0x40, 0xAC,
+  0xFB, 0x84, 0x87, 0xFB, 0xA3, 0x04, 0x89, 0xC9, 0x30, 0x6D, 0x38, 0x6D, 0x30, 0x6D, 0x38, 0x6D,
+  0x81, 0x30, 0x6D, 0x00, 0x9A, 0x08, 0x88, 0xFB, 0xA3, 0x00, 0x81, 0xA9, 0x81, 0x30, 0x6D, 0x87,
+  0x38, 0x6D, 0x80, 0x30, 0x6D, 0x00, 0xCA, 0xC6, 0x88, 0xFB, 0xA3, 0x01, 0x50, 0xEB, 0x30, 0x6D,
+  0x80, 0x38, 0x6D, 0x82, 0x30, 0x6D, 0x82, 0x38, 0x6D, 0x80, 0x30, 0x6D, 0x80, 0x38, 0x6D, 0x80,
+  0x30, 0x6D, 0x00, 0x38, 0x6D, 0x80, 0x30, 0x6D, 0x87, 0x38, 0x6D, 0x83, 0x30, 0x6D, 0x80, 0x38,
+  0x6D, 0x85, 0x30, 0x6D, 0x00, 0x38, 0x6D, 0x85, 0x30, 0x6D, 0x87, 0x38, 0x6D, 0x81, 0x30, 0x6D,
+  0x82, 0x38, 0x6D, 0x01, 0x30, 0x6D, 0x1A, 0x77, 0x90, 0x04, 0x1F, 0x00, 0x55, 0x7F, 0x89, 0xFF,
+  0xFF, 0x00, 0xA6, 0x9F, 0x90, 0x04, 0x1F, 0x00, 0x1A, 0x15, 0x8B, 0x38, 0x6D, 0x80, 0x30, 0x6D,
+  0x00, 0x38, 0x6D, 0x88, 0x30, 0x6D, 0x00, 0x89, 0xC9, 0x88, 0xFB, 0xA3, 0x00, 0x91, 0xE8, 0x81,
+  0x30, 0x6D, 0x00, 0x59, 0x0B, 0x88, 0xFB, 0xA3, 0x00, 0x69, 0x4A, 0x85, 0x30, 0x6D, 0x00, 0xAA,
+  0x47, 0x87, 0xFB, 0xA3, 0x00, 0xE3, 0x44, 0x82, 0x30, 0x6D, 0x00, 0xD2, 0xE5, 0x88, 0xFB, 0xA3,
+  0x00, 0x48, 0xCC, 0x8C, 0x30, 0x6D, 0x00, 0xE3, 0x25, 0x88, 0xFB, 0xA3, 0x00, 0x38, 0x8D, 0x8B,
+  0x30, 0x6D, 0x00, 0x38, 0x8C, 0x88, 0xFB, 0xA3, 0x00, 0xDB, 0x25, 0x85, 0x30, 0x6D, 0x00, 0xCA,
+  0xC6, 0x87, 0xFB, 0xA3, 0x00, 0xCA, 0xC6, 0x85, 0x30, 0x6D, 0x00, 0x9A, 0x08, 0x88, 0xFB, 0xA3,
+  0x00, 0x81, 0xA9, 0x8C, 0x30, 0x6D, 0x00, 0xCA, 0xC6, 0x88, 0xFB, 0xA3, 0x00, 0x50, 0xEB, 0xC2,
+  0x30, 0x6D, 0x00, 0x1A, 0x77, 0x8F, 0x04, 0x1F, 0x00, 0x55, 0x7F, 0x8B, 0xFF, 0xFF, 0x00, 0xA6,
+  0x9F, 0x8F, 0x04, 0x1F, 0x00, 0x21, 0xF4, 0x98, 0x30, 0x6D, 0x00, 0x89, 0xC9, 0x88, 0xFB, 0xA3,
+  0x00, 0x91, 0xE8, 0x81, 0x30, 0x6D, 0x01, 0x38, 0x8C, 0xFB, 0x84, 0x87, 0xFB, 0xA3, 0x00, 0x89,
+  0xC9, 0x85, 0x30, 0x6D, 0x00, 0xCA, 0xE6, 0x87, 0xFB, 0xA3, 0x00, 0xC2, 0xA6, 0x82, 0x30, 0x6D,
+  0x00, 0xD2, 0xE5, 0x88, 0xFB, 0xA3, 0x00, 0x48, 0xCC, 0x8C, 0x30, 0x6D, 0x00, 0xE3, 0x25, 0x88,
+  0xFB, 0xA3, 0x00, 0x30, 0x8C, 0x8B, 0x30, 0x6D, 0x00, 0x38, 0x8C, 0x88, 0xFB, 0xA3, 0x00, 0xDB,
+  0x25, 0x85, 0x30, 0x6D, 0x00, 0x89, 0xC8, 0x87, 0xFB, 0xA3, 0x01, 0xFB, 0x84, 0x40, 0xAC, 0x84,
+  0x30, 0x6D, 0x00, 0x9A, 0x08, 0x88, 0xFB, 0xA3, 0x00, 0x81, 0xA9, 0x8C, 0x30, 0x6D, 0x00, 0xCA,
+  0xC6, 0x88, 0xFB, 0xA3, 0x00, 0x50, 0xEB, 0xC2, 0x30, 0x6D, 0x00, 0x1A, 0x56, 0x8E, 0x04, 0x1F,
+  0x00, 0x5D, 0x7F, 0x8D, 0xFF, 0xFF, 0x00, 0xA6, 0x9F, 0x8E, 0x04, 0x1F, 0x00, 0x21, 0xD4, 0x98,
+  0x30, 0x6D, 0x00, 0x89, 0xC9, 0x88, 0xFB, 0xA3, 0x00, 0x91, 0xE8, 0x82, 0x30, 0x6D, 0x00, 0xDB,
+  0x05, 0x87, 0xFB, 0xA3, 0x00, 0xB2, 0x67, 0x85, 0x30, 0x6D, 0x00, 0xF3, 0x64, 0x87, 0xFB, 0xA3,
+  0x00, 0x9A, 0x08, 0x82, 0x30, 0x6D, 0x00, 0xD2, 0xE5, 0x88, 0xFB, 0xA3, 0x00, 0x48, 0xCC, 0x8C,
+  0x30, 0x6D, 0x00, 0xE3, 0x25, 0x88, 0xFB, 0xA3, 0x00, 0x30, 0x8C, 0x8B, 0x30, 0x6D, 0x00, 0x38,
+  0x8C, 0x88, 0xFB, 0xA3, 0x00, 0xDB, 0x25, 0x85, 0x30, 0x6D, 0x00, 0x48, 0xCB, 0x88, 0xFB, 0xA3,
+  0x00, 0x79, 0xA9, 0x84, 0x30, 0x6D, 0x00, 0x92, 0x08, 0x88, 0xFB, 0xA3, 0x00, 0x81, 0xA9, 0x8C,
+  0x30, 0x6D, 0x00, 0xCA, 0xC6, 0x88, 0xFB, 0xA3, 0x00, 0x50, 0xEB, 0xC2, 0x30, 0x6D, 0x00, 0x1A,
+  0x15, 0x8D, 0x04, 0x1F, 0x00, 0x55, 0x7F, 0x8F, 0xFF, 0xFF, 0x00, 0xA6, 0x9F, 0x8D, 0x04, 0x1F,
+  0x00, 0x21, 0x93, 0x98, 0x30, 0x6D, 0x00, 0x89, 0xC9, 0x88, 0xFB, 0xA3, 0x00, 0x91, 0xE8, 0x81,
+  0x30, 0x6D, 0x01, 0x30, 0x6C, 0xB2, 0x67, 0x87, 0xFB, 0xA3, 0x00, 0xDB, 0x05, 0x84, 0x30, 0x6D,
+  0x00, 0x48, 0xCB, 0x88, 0xFB, 0xA3, 0x00, 0x71, 0x6A, 0x82, 0x30, 0x6D, 0x00, 0xD2, 0xE5, 0x88,
+  0xFB, 0xA3, 0x00, 0x48, 0xCB, 0x8C, 0x30, 0x6D, 0x00, 0xE3, 0x25, 0x88, 0xFB, 0xA3, 0x00, 0x30,
+  0x6C, 0x8B, 0x30, 0x6D, 0x00, 0x38, 0x8C, 0x88, 0xFB, 0xA3, 0x00, 0xDB, 0x25, 0x85, 0x30, 0x6D,
+  0x01, 0x30, 0x6C, 0xD3, 0x05, 0x87, 0xFB, 0xA3, 0x00, 0xBA, 0xA6, 0x84, 0x30, 0x6D, 0x00, 0x92,
+  0x08, 0x88, 0xFB, 0xA3, 0x00, 0x81, 0xA9, 0x8C, 0x30, 0x6D, 0x00, 0xCA, 0xC6, 0x88, 0xFB, 0xA3,
+  0x00, 0x50, 0xEB, 0xC2, 0x30, 0x6D, 0x00, 0x21, 0xD4, 0x8C, 0x04, 0x1F, 0x00, 0x55, 0x7F, 0x84,
+  0xFF, 0xFF, 0x01, 0xBE, 0xFF, 0xC7, 0x1F, 0x82, 0xFF, 0xFF, 0x00, 0x86, 0x1F, 0x84, 0xFF, 0xFF,
+  0x00, 0xA6, 0x9F, 0x8C, 0x04, 0x1F, 0x00, 0x29, 0x51, 0x98, 0x30, 0x6D, 0x00, 0x89, 0xC9, 0x88,
+  0xFB, 0xA3, 0x00, 0x91, 0xE8, 0x82, 0x30, 0x6D, 0x00, 0x89, 0xC8, 0x87, 0xFB, 0xA3, 0x01, 0xFB,
+  0x84, 0x30, 0x6C, 0x83, 0x30, 0x6D, 0x00, 0x71, 0x6A, 0x88, 0xFB, 0xA3, 0x00, 0x48, 0xCB, 0x82,
+  0x30, 0x6D, 0x00, 0xD2, 0xE5, 0x88, 0xFB, 0xA3, 0x00, 0x48, 0xCB, 0x8C, 0x30, 0x6D, 0x00, 0xE3,
+  0x25, 0x88, 0xFB, 0xA3, 0x00, 0x30, 0x6C, 0x8B, 0x30, 0x6D, 0x00, 0x38, 0x8C, 0x88, 0xFB, 0xA3,
+  0x00, 0xDB, 0x25, 0x85, 0x30, 0x6D, 0x01, 0x30, 0x6C, 0x92, 0x08, 0x87, 0xFB, 0xA3, 0x01, 0xF3,
+  0x84, 0x38, 0x8C, 0x83, 0x30, 0x6D, 0x00, 0x92, 0x08, 0x88, 0xFB, 0xA3, 0x00, 0x81, 0xA9, 0x8C,
+  0x30, 0x6D, 0x00, 0xCA, 0xC6, 0x88, 0xFB, 0xA3, 0x00, 0x50, 0xEB, 0xC2, 0x30, 0x6D, 0x00, 0x21,
+  0x72, 0x8B, 0x04, 0x1F, 0x00, 0x55, 0x7F, 0x84, 0xFF, 0xFF, 0x02, 0xBE, 0xFF, 0x0C, 0x3F, 0xB6,
+  0xDF, 0x82, 0xFF, 0xFF, 0x01, 0x24, 0xBF, 0x5D, 0x7F, 0x84, 0xFF, 0xFF, 0x00, 0x9E, 0x7F, 0x8B,
+  0x04, 0x1F, 0x00, 0x29, 0x10, 0x98, 0x30, 0x6D, 0x00, 0x89, 0xC9, 0x88, 0xFB, 0xA3, 0x01, 0x89,
+  0xE8, 0x30, 0x6C, 0x81, 0x30, 0x6D, 0x00, 0x61, 0x2A, 0x88, 0xFB, 0xA3, 0x00, 0x50, 0xEB, 0x83,
+  0x30, 0x6D, 0x00, 0x91, 0xE8, 0x87, 0xFB, 0xA3, 0x01, 0xF3, 0x64, 0x30, 0x6C, 0x82, 0x30, 0x6D,
+  0x00, 0xD2, 0xE5, 0x88, 0xFB, 0xA3, 0x00, 0x40, 0xCB, 0x8C, 0x30, 0x6D, 0x00, 0xE3, 0x25, 0x88,
+  0xFB, 0xA3, 0x00, 0x30, 0x6C, 0x8B, 0x30, 0x6D, 0x00, 0x38, 0x8C, 0x88, 0xFB, 0xA3, 0x00, 0xDB,
+  0x25, 0x85, 0x30, 0x6D, 0x01, 0x30, 0x6C, 0x50, 0xEB, 0x88, 0xFB, 0xA3, 0x00, 0x71, 0x6A, 0x83,
+  0x30, 0x6D, 0x00, 0x92, 0x08, 0x88, 0xFB, 0xA3, 0x00, 0x81, 0xA9, 0x8C, 0x30, 0x6D, 0x00, 0xCA,
+  0xC6, 0x88, 0xFB, 0xA3, 0x00, 0x50, 0xEB, 0xC2, 0x30, 0x6D, 0x00, 0x29, 0x31, 0x8A, 0x04, 0x1F,
+  0x00, 0x55, 0x7F, 0x84, 0xFF, 0xFF, 0x03, 0xBE, 0xFF, 0x0C, 0x3F, 0x04, 0x1F, 0xB6, 0xDF, 0x82,
+  0xFF, 0xFF, 0x02, 0x24, 0xBF, 0x04, 0x1F, 0x5D, 0x9F, 0x84, 0xFF, 0xFF, 0x00, 0x9E, 0x7F, 0x8A,
+  0x04, 0x1F, 0x00, 0x30, 0xAE, 0x98, 0x30, 0x6D, 0x00, 0x89, 0xC9, 0x88, 0xFB, 0xA3, 0x01, 0x89,
+  0xE8, 0x30, 0x6C, 0x80, 0x30, 0x6D, 0x01, 0x30, 0x6C, 0x38, 0x8C, 0x88, 0xFB, 0xA3, 0x00, 0x79,
+  0x89, 0x83, 0x30, 0x6D, 0x00, 0xBA, 0x86, 0x87, 0xFB, 0xA3, 0x01, 0xCA, 0xC6, 0x30, 0x6C, 0x81,
+  0x30, 0x6D, 0x01, 0x30, 0x6C, 0xD2, 0xE5, 0x88, 0xFB, 0xA3, 0x00, 0x40, 0xCB, 0x8B, 0x30, 0x6D,
+  0x01, 0x30, 0x6C, 0xE3, 0x25, 0x88, 0xFB, 0xA3, 0x00, 0x30, 0x6C, 0x8B, 0x30, 0x6D, 0x00, 0x38,
+  0x8C, 0x88, 0xFB, 0xA3, 0x01, 0xDB, 0x25, 0x30, 0x6C, 0x84, 0x30, 0x6D, 0x80, 0x30, 0x6C, 0x00,
+  0xE3, 0x25, 0x87, 0xFB, 0xA3, 0x00, 0xB2, 0x67, 0x82, 0x30, 0x6D, 0x01, 0x30, 0x6C, 0x92, 0x08,
+  0x88, 0xFB, 0xA3, 0x00, 0x81, 0xA9, 0x8B, 0x30, 0x6D, 0x01, 0x30, 0x6C, 0xCA, 0xC6, 0x88, 0xFB,
+  0xA3, 0x00, 0x48, 0xEB, 0xC2, 0x30, 0x6D, 0x00, 0x28, 0xCF, 0x89, 0x04, 0x1F, 0x00, 0x5D, 0x7F,
+  0x84, 0xFF, 0xFF, 0x01, 0xBE, 0xFF, 0x0C, 0x3F, 0x80, 0x04, 0x1F, 0x00, 0xB6, 0xDF, 0x82, 0xFF,
+  0xFF, 0x00, 0x24, 0xBF, 0x80, 0x04, 0x1F, 0x00, 0x5D, 0x9F, 0x84, 0xFF, 0xFF, 0x00, 0x9E, 0x7F,
+  0x88, 0x04, 0x1F, 0x00, 0x03, 0xFE, 0x99, 0x30, 0x6D, 0x00, 0x89, 0xC9, 0x88, 0xFB, 0xA3, 0x00,
+  0x89, 0xE8, 0x82, 0x30, 0x6D, 0x01, 0x30, 0x6C, 0xE3, 0x25, 0x87, 0xFB, 0xA3, 0x00, 0x9A, 0x28,
+  0x83, 0x30, 0x6D, 0x00, 0xE3, 0x25, 0x87, 0xFB, 0xA3, 0x01, 0xA2, 0x27, 0x30, 0x6C, 0x81, 0x30,
+  0x6D, 0x01, 0x30, 0x6C, 0xD2, 0xE5, 0x88, 0xFB, 0xA3, 0x00, 0x40, 0xCB, 0x8B, 0x30, 0x6D, 0x01,
+  0x30, 0x6C, 0xE3, 0x25, 0x88, 0xFB, 0xA3, 0x00, 0x30, 0x6C, 0x8B, 0x30, 0x6D, 0x00, 0x38, 0x8C,
+  0x88, 0xFB, 0xA3, 0x01, 0xDB, 0x25, 0x30, 0x6C, 0x85, 0x30, 0x6D, 0x01, 0x30, 0x6C, 0xA2, 0x27,
+  0x87, 0xFB, 0xA3, 0x01, 0xF3, 0x64, 0x30, 0x6C, 0x81, 0x30, 0x6D, 0x01, 0x30, 0x6C, 0x92, 0x08,
+  0x88, 0xFB, 0xA3, 0x00, 0x81, 0xA9, 0x8B, 0x30, 0x6D, 0x01, 0x30, 0x6C, 0xCA, 0xC6, 0x88, 0xFB,
+  0xA3, 0x00, 0x48, 0xEB, 0xC3, 0x30, 0x6D, 0x00, 0x03, 0xFE, 0x87, 0x04, 0x1F, 0x00, 0x55, 0x7F,
+  0x84, 0xFF, 0xFF, 0x01, 0xBE, 0xFF, 0x0C, 0x3F, 0x81, 0x04, 0x1F, 0x00, 0xB6, 0xDF, 0x82, 0xFF,
+  0xFF, 0x00, 0x24, 0xBF, 0x81, 0x04, 0x1F, 0x00, 0x65, 0x9F, 0x84, 0xFF, 0xFF, 0x00, 0x9E, 0x7F,
+  0x87, 0x04, 0x1F, 0x00, 0x0B, 0x7C, 0x98, 0x30, 0x6D, 0x01, 0x30, 0x6C, 0x89, 0xC8, 0x88, 0xFB,
+  0xA3, 0x01, 0x89, 0xE8, 0x30, 0x6C, 0x80, 0x30, 0x6D, 0x02, 0x30, 0x6C, 0x28, 0x6C, 0xBA, 0x86,
+  0x87, 0xFB, 0xA3, 0x01, 0xC2, 0xA6, 0x30, 0x6C, 0x81, 0x30, 0x6D, 0x01, 0x38, 0x8C, 0xFB, 0x83,
+  0x87, 0xFB, 0xA3, 0x02, 0x79, 0x89, 0x28, 0x6C, 0x30, 0x6C, 0x80, 0x30, 0x6D, 0x01, 0x30, 0x6C,
+  0xD2, 0xE5, 0x88, 0xFB, 0xA3, 0x00, 0x40, 0xAB, 0x8B, 0x30, 0x6D, 0x01, 0x30, 0x6C, 0xE3, 0x25,
+  0x88, 0xFB, 0xA3, 0x80, 0x30, 0x6C, 0x8A, 0x30, 0x6D, 0x00, 0x38, 0x8C, 0x88, 0xFB, 0xA3, 0x01,
+  0xDB, 0x25, 0x30, 0x6C, 0x85, 0x30, 0x6D, 0x01, 0x30, 0x6C, 0x59, 0x2A, 0x88, 0xFB, 0xA3, 0x00,
+  0x61, 0x2A, 0x81, 0x30, 0x6D, 0x01, 0x30, 0x6C, 0x91, 0xE8, 0x88, 0xFB, 0xA3, 0x01, 0x81, 0xA9,
+  0x30, 0x6C, 0x8A, 0x30, 0x6D, 0x01, 0x30, 0x6C, 0xCA, 0xC6, 0x88, 0xFB, 0xA3, 0x01, 0x48, 0xEB,
+  0x30, 0x6C, 0xC2, 0x30, 0x6D, 0x00, 0x0B, 0x7C, 0x86, 0x04, 0x1F, 0x00, 0x5D, 0x7F, 0x84, 0xFF,
+  0xFF, 0x01, 0xBE, 0xFF, 0x0C, 0x3F, 0x82, 0x04, 0x1F, 0x00, 0xB6, 0xDF, 0x82, 0xFF, 0xFF, 0x00,
+  0x24, 0xBF, 0x82, 0x04, 0x1F, 0x00, 0x86, 0x1F, 0x84, 0xFF, 0xFF, 0x00, 0x86, 0x3F, 0x86, 0x04,
+  0x1F, 0x00, 0x0A, 0xF9, 0x8F, 0x30, 0x6D, 0x00, 0x30, 0x4D, 0x86, 0x30, 0x6D, 0x01, 0x30, 0x6C,
+  0x89, 0xC8, 0x88, 0xFB, 0xA3, 0x01, 0x89, 0xE8, 0x30, 0x6C, 0x80, 0x30, 0x6D, 0x02, 0x30, 0x6C,
+  0x28, 0x6C, 0x91, 0xE8, 0x87, 0xFB, 0xA3, 0x01, 0xEB, 0x44, 0x30, 0x6C, 0x81, 0x30, 0x6D, 0x00,
+  0x59, 0x0B, 0x88, 0xFB, 0xA3, 0x01, 0x50, 0xEB, 0x30, 0x6C, 0x81, 0x30, 0x6D, 0x01, 0x30, 0x6C,
+  0xD2, 0xE5, 0x88, 0xFB, 0xA3, 0x00, 0x40, 0xAB, 0x8A, 0x30, 0x6D, 0x80, 0x30, 0x6C, 0x00, 0xE3,
+  0x25, 0x88, 0xFB, 0xA3, 0x80, 0x30, 0x6C, 0x89, 0x30, 0x6D, 0x01, 0x30, 0x6C, 0x38, 0x8C, 0x88,
+  0xFB, 0xA3, 0x00, 0xDB, 0x25, 0x80, 0x30, 0x6C, 0x83, 0x30, 0x6D, 0x81, 0x30, 0x6C, 0x00, 0xEB,
+  0x44, 0x87, 0xFB, 0xA3, 0x00, 0xA2, 0x47, 0x81, 0x30, 0x6D, 0x01, 0x30, 0x6C, 0x91, 0xE8, 0x88,
+  0xFB, 0xA3, 0x01, 0x81, 0xA9, 0x30, 0x6C, 0x8A, 0x30, 0x6D, 0x01, 0x30, 0x6C, 0xCA, 0xC6, 0x88,
+  0xFB, 0xA3, 0x01, 0x48, 0xCB, 0x30, 0x6C, 0x8F, 0x30, 0x6D, 0x80, 0x30, 0x4D, 0xAF, 0x30, 0x6D,
+  0x00, 0x0A, 0xF9, 0x86, 0x04, 0x1F, 0x00, 0x96, 0x5F, 0x83, 0xFF, 0xFF, 0x01, 0xBE, 0xFF, 0x0C,
+  0x3F, 0x83, 0x04, 0x1F, 0x00, 0xB6, 0xDF, 0x82, 0xFF, 0xFF, 0x00, 0x24, 0xBF, 0x81, 0x04, 0x1F,
+  0x01, 0x34, 0xDF, 0xEF, 0xBF, 0x83, 0xFF, 0xFF, 0x01, 0xEF, 0xBF, 0x2C, 0xBF, 0x86, 0x04, 0x1F,
+  0x00, 0x12, 0x57, 0x98, 0x30, 0x6D, 0x01, 0x30, 0x6C, 0x89, 0xC8, 0x88, 0xFB, 0xA3, 0x01, 0x89,
+  0xE8, 0x28, 0x6C, 0x80, 0x30, 0x6D, 0x02, 0x30, 0x6C, 0x28, 0x6C, 0x69, 0x49, 0x88, 0xFB, 0xA3,
+  0x00, 0x40, 0xAC, 0x81, 0x30, 0x6D, 0x00, 0x81, 0xA9, 0x87, 0xFB, 0xA3, 0x02, 0xF3, 0x84, 0x30,
+  0x6C, 0x28, 0x6C, 0x81, 0x30, 0x6D, 0x01, 0x28, 0x6C, 0xD2, 0xE5, 0x88, 0xFB, 0xA3, 0x00, 0x40,
+  0xAB, 0x8A, 0x30, 0x6D, 0x80, 0x30, 0x6C, 0x00, 0xE3, 0x25, 0x88, 0xFB, 0xA3, 0x80, 0x30, 0x6C,
+  0x89, 0x30, 0x6D, 0x01, 0x30, 0x6C, 0x38, 0x8C, 0x88, 0xFB, 0xA3, 0x00, 0xDB, 0x25, 0x80, 0x30,
+  0x6C, 0x84, 0x30, 0x6D, 0x02, 0x30, 0x6C, 0x28, 0x6C, 0xAA, 0x47, 0x87, 0xFB, 0xA3, 0x00, 0xEB,
+  0x44, 0x81, 0x30, 0x6D, 0x01, 0x30, 0x6C, 0x91, 0xE8, 0x88, 0xFB, 0xA3, 0x01, 0x81, 0xA9, 0x30,
+  0x6C, 0x8A, 0x30, 0x6D, 0x01, 0x30, 0x6C, 0xCA, 0xC6, 0x88, 0xFB, 0xA3, 0x02, 0x48, 0xCB, 0x28,
+  0x4C, 0x30, 0x4D, 0xC0, 0x30, 0x6D, 0x01, 0x30, 0x4D, 0x12, 0x56, 0x87, 0x04, 0x1F, 0x00, 0xA6,
+  0x9F, 0x81, 0xFF, 0xFF, 0x01, 0xBE, 0xFF, 0x0C, 0x3F, 0x84, 0x04, 0x1F, 0x00, 0xB6, 0xDF, 0x82,
+  0xFF, 0xFF, 0x00, 0x24, 0xBF, 0x80, 0x04, 0x1F, 0x01, 0x34, 0xDF, 0xEF, 0xBF, 0x83, 0xFF, 0xFF,
+  0x01, 0xEF, 0xBF, 0x2C, 0xBF, 0x87, 0x04, 0x1F, 0x00, 0x19, 0xB3, 0x90, 0x30, 0x6D, 0x83, 0x28,
+  0x4D, 0x80, 0x30, 0x6D, 0x02, 0x30, 0x6C, 0x28, 0x6C, 0x81, 0xC8, 0x88, 0xFB, 0xA3, 0x01, 0x89,
+  0xE8, 0x28, 0x6C, 0x80, 0x28, 0x6D, 0x80, 0x28, 0x6C, 0x00, 0x40, 0xAB, 0x88, 0xFB, 0xA3, 0x04,
+  0x61, 0x4A, 0x28, 0x6C, 0x30, 0x6C, 0x28, 0x6C, 0xA2, 0x47, 0x87, 0xFB, 0xA3, 0x00, 0xD2, 0xE5,
+  0x84, 0x28, 0x6C, 0x00, 0xD2, 0xE5, 0x88, 0xFB, 0xA3, 0x00, 0x40, 0xAB, 0x80, 0x28, 0x6D, 0x86,
+  0x30, 0x6D, 0x80, 0x28, 0x6D, 0x80, 0x28, 0x6C, 0x00, 0xE3, 0x25, 0x88, 0xFB, 0xA3, 0x01, 0x30,
+  0x6C, 0x28, 0x6C, 0x88, 0x28, 0x6D, 0x02, 0x30, 0x6D, 0x28, 0x6C, 0x38, 0x8C, 0x88, 0xFB, 0xA3,
+  0x01, 0xDB, 0x25, 0x28, 0x6C, 0x80, 0x28, 0x4C, 0x83, 0x28, 0x6D, 0x80, 0x28, 0x6C, 0x00, 0x69,
+  0x49, 0x88, 0xFB, 0xA3, 0x00, 0x59, 0x0B, 0x80, 0x28, 0x6D, 0x01, 0x28, 0x6C, 0x91, 0xE8, 0x88,
+  0xFB, 0xA3, 0x01, 0x81, 0xA9, 0x28, 0x6C, 0x87, 0x30, 0x6D, 0x01, 0x28, 0x6D, 0x28, 0x4D, 0x80,
+  0x28, 0x6C, 0x00, 0xCA, 0xC6, 0x88, 0xFB, 0xA3, 0x03, 0x48, 0xEB, 0x28, 0x6C, 0x28, 0x4C, 0x28,
+  0x4D, 0x83, 0x28, 0x6D, 0x81, 0x30, 0x6D, 0x85, 0x28, 0x6D, 0x80, 0x30, 0x6D, 0x83, 0x28, 0x6D,
+  0x87, 0x30, 0x6D, 0x00, 0x28, 0x4D, 0x81, 0x30, 0x6D, 0x80, 0x28, 0x6D, 0x00, 0x30, 0x6D, 0x80,
+  0x30, 0x4D, 0x80, 0x28, 0x4D, 0x90, 0x30, 0x6D, 0x80, 0x28, 0x4D, 0x00, 0x28, 0x6D, 0x81, 0x30,
+  0x6D, 0x00, 0x21, 0x72, 0x88, 0x04, 0x1F, 0x03, 0xA6, 0xBF, 0xFF, 0xFF, 0xBE, 0xFF, 0x0C, 0x3F,
+  0x85, 0x04, 0x1F, 0x00, 0xB6, 0xDF, 0x82, 0xFF, 0xFF, 0x03, 0x24, 0xBF, 0x04, 0x1F, 0x34, 0xDF,
+  0xEF, 0xBF, 0x83, 0xFF, 0xFF, 0x01, 0xEF, 0xBF, 0x2C, 0xBF, 0x88, 0x04, 0x1F, 0x00, 0x28, 0xEF,
+  0x82, 0x30, 0x6D, 0x80, 0x28, 0x4D, 0x8A, 0x30, 0x6D, 0x86, 0x28, 0x6D, 0x01, 0x28, 0x6C, 0x81,
+  0xC8, 0x88, 0xFB, 0xA3, 0x00, 0x89, 0xE8, 0x80, 0x28, 0x6C, 0x80, 0x28, 0x6D, 0x80, 0x28, 0x6C,
+  0x00, 0xEB, 0x44, 0x87, 0xFB, 0xA3, 0x00, 0x89, 0xC8, 0x81, 0x28, 0x6C, 0x00, 0xCA, 0xE5, 0x87,
+  0xFB, 0xA3, 0x00, 0xAA, 0x47, 0x80, 0x28, 0x6C, 0x00, 0x28, 0x6D, 0x81, 0x28, 0x6C, 0x00, 0xD2,
+  0xE5, 0x88, 0xFB, 0xA3, 0x01, 0x40, 0xAB, 0x28, 0x6C, 0x88, 0x28, 0x6D, 0x03, 0x28, 0x6C, 0x28,
+  0x6D, 0x28, 0x6C, 0xE3, 0x25, 0x88, 0xFB, 0xA3, 0x00, 0x30, 0x6C, 0x80, 0x28, 0x6C, 0x87, 0x28,
+  0x6D, 0x80, 0x28, 0x6C, 0x00, 0x38, 0x8C, 0x88, 0xFB, 0xA3, 0x00, 0xDB, 0x25, 0x81, 0x28, 0x6C,
+  0x82, 0x28, 0x6D, 0x81, 0x28, 0x6C, 0x01, 0x30, 0x6C, 0xF3, 0x64, 0x87, 0xFB, 0xA3, 0x04, 0x9A,
+  0x08, 0x28, 0x6C, 0x28, 0x6D, 0x28, 0x6C, 0x91, 0xE8, 0x88, 0xFB, 0xA3, 0x00, 0x81, 0xA9, 0x80,
+  0x28, 0x6C, 0x88, 0x28, 0x6D, 0x80, 0x28, 0x6C, 0x00, 0xCA, 0xC6, 0x88, 0xFB, 0xA3, 0x00, 0x48,
+  0xCB, 0x80, 0x28, 0x6C, 0x00, 0x28, 0x4C, 0xC0, 0x28, 0x6D, 0x00, 0x28, 0xAE, 0x89, 0x04, 0x1F,
+  0x01, 0x7E, 0x1F, 0x0C, 0x3F, 0x86, 0x04, 0x1F, 0x00, 0xB6, 0xDF, 0x82, 0xFF, 0xFF, 0x02, 0x24,
+  0xBF, 0x2C, 0xDF, 0xEF, 0xBF, 0x83, 0xFF, 0xFF, 0x01, 0xEF, 0x9F, 0x2C, 0xBF, 0x88, 0x04, 0x1F,
+  0x00, 0x03, 0xDD, 0x9A, 0x28, 0x6D, 0x00, 0x81, 0xC8, 0x88, 0xFB, 0xA3, 0x02, 0x89, 0xE8, 0x28,
+  0x6D, 0x28, 0x6C, 0x80, 0x28, 0x6D, 0x02, 0x28, 0x4C, 0x28, 0x6C, 0xC2, 0xC6, 0x87, 0xFB, 0xA3,
+  0x00, 0xB2, 0x67, 0x81, 0x28, 0x6C, 0x00, 0xF3, 0x64, 0x87, 0xFB, 0xA3, 0x02, 0x81, 0xA9, 0x28,
+  0x6C, 0x28, 0x4C, 0x80, 0x28, 0x6D, 0x80, 0x28, 0x6C, 0x00, 0xD2, 0xE5, 0x88, 0xFB, 0xA3, 0x01,
+  0x40, 0xAB, 0x28, 0x6C, 0x8A, 0x28, 0x6D, 0x01, 0x28, 0x6C, 0xE3, 0x25, 0x88, 0xFB, 0xA3, 0x00,
+  0x30, 0x6C, 0x89, 0x28, 0x6D, 0x80, 0x28, 0x6C, 0x00, 0x38, 0x8C, 0x88, 0xFB, 0xA3, 0x00, 0xDB,
+  0x25, 0x80, 0x28, 0x6C, 0x84, 0x28, 0x6D, 0x80, 0x28, 0x6C, 0x01, 0x28, 0x4C, 0xB2, 0x86, 0x87,
+  0xFB, 0xA3, 0x04, 0xDB, 0x05, 0x28, 0x6C, 0x28, 0x6D, 0x28, 0x6C, 0x91, 0xE8, 0x88, 0xFB, 0xA3,
+  0x00, 0x81, 0xA9, 0x80, 0x28, 0x6C, 0x85, 0x28, 0x6D, 0x80, 0x28, 0x4D, 0x00, 0x28, 0x6D, 0x80,
+  0x28, 0x6C, 0x00, 0xCA, 0xC6, 0x88, 0xFB, 0xA3, 0x00, 0x48, 0xCB, 0x80, 0x28, 0x6C, 0xC2, 0x28,
+  0x6D, 0x00, 0x03, 0x7C, 0x92, 0x04, 0x1F, 0x00, 0xB6, 0xDF, 0x82, 0xFF, 0xFF, 0x01, 0x55, 0x5F,
+  0xEF, 0xBF, 0x83, 0xFF, 0xFF, 0x01, 0xEF, 0x9F, 0x2C, 0xBF, 0x89, 0x04, 0x1F, 0x00, 0x0A, 0xF9,
+  0x91, 0x28, 0x6D, 0x80, 0x28, 0x4C, 0x00, 0x28, 0x4D, 0x80, 0x28, 0x6D, 0x81, 0x28, 0x4D, 0x01,
+  0x28, 0x4C, 0x81, 0xC8, 0x88, 0xFB, 0xA3, 0x01, 0x89, 0xE8, 0x28, 0x6D, 0x81, 0x28, 0x4D, 0x80,
+  0x28, 0x4C, 0x00, 0x9A, 0x07, 0x87, 0xFB, 0xA3, 0x03, 0xDB, 0x05, 0x28, 0x6C, 0x28, 0x6D, 0x48,
+  0xCB, 0x88, 0xFB, 0xA3, 0x01, 0x59, 0x0A, 0x28, 0x6C, 0x82, 0x28, 0x4D, 0x01, 0x28, 0x6C, 0xD2,
+  0xE5, 0x88, 0xFB, 0xA3, 0x02, 0x40, 0xAB, 0x28, 0x4C, 0x28, 0x4D, 0x81, 0x28, 0x6D, 0x84, 0x28,
+  0x4D, 0x80, 0x28, 0x6D, 0x01, 0x28, 0x6C, 0xE3, 0x25, 0x88, 0xFB, 0xA3, 0x01, 0x30, 0x6C, 0x28,
+  0x6C, 0x82, 0x28, 0x4D, 0x84, 0x28, 0x6D, 0x02, 0x28, 0x6C, 0x28, 0x4C, 0x30, 0x8C, 0x88, 0xFB,
+  0xA3, 0x01, 0xDB, 0x25, 0x28, 0x6C, 0x80, 0x28, 0x6D, 0x80, 0x28, 0x4D, 0x00, 0x28, 0x6D, 0x80,
+  0x28, 0x4D, 0x80, 0x28, 0x6D, 0x01, 0x28, 0x6C, 0x71, 0x69, 0x88, 0xFB, 0xA3, 0x03, 0x48, 0xEB,
+  0x28, 0x6D, 0x28, 0x6C, 0x91, 0xE8, 0x88, 0xFB, 0xA3, 0x02, 0x81, 0xA9, 0x28, 0x6D, 0x28, 0x6C,
+  0x84, 0x28, 0x6D, 0x81, 0x28, 0x4D, 0x80, 0x28, 0x6D, 0x01, 0x28, 0x6C, 0xCA, 0xC6, 0x88, 0xFB,
+  0xA3, 0x00, 0x48, 0xCB, 0x80, 0x28, 0x6C, 0x00, 0x28, 0x4D, 0x82, 0x28, 0x6D, 0x80, 0x28, 0x4D,
+  0x9B, 0x28, 0x6D, 0x80, 0x28, 0x4D, 0x85, 0x28, 0x6D, 0x80, 0x28, 0x4D, 0x93, 0x28, 0x6D, 0x00,
+  0x12, 0x77, 0x92, 0x04, 0x1F, 0x00, 0xB6, 0xDF, 0x82, 0xFF, 0xFF, 0x00, 0xF7, 0xDF, 0x83, 0xFF,
+  0xFF, 0x01, 0xEF, 0xBF, 0x2C, 0xBF, 0x8A, 0x04, 0x1F, 0x00, 0x19, 0xD4, 0x87, 0x28, 0x6D, 0x01,
+  0x28, 0x4C, 0x28, 0x4D, 0x86, 0x28, 0x6D, 0x86, 0x28, 0x4D, 0x01, 0x28, 0x4C, 0x81, 0xC8, 0x88,
+  0xFB, 0xA3, 0x01, 0x89, 0xC8, 0x28, 0x4C, 0x81, 0x28, 0x4D, 0x80, 0x28, 0x4C, 0x00, 0x71, 0x69,
+  0x87, 0xFB, 0xA3, 0x00, 0xFB, 0x84, 0x80, 0x9A, 0x08, 0x00, 0xB2, 0x67, 0x87, 0xFB, 0xA3, 0x02,
+  0xFB, 0x84, 0x30, 0x6C, 0x28, 0x4C, 0x82, 0x28, 0x4D, 0x01, 0x28, 0x4C, 0xD2, 0xE5, 0x88, 0xFB,
+  0xA3, 0x01, 0x40, 0xAB, 0x28, 0x4C, 0x80, 0x28, 0x4D, 0x00, 0x79, 0x89, 0x88, 0x9A, 0x08, 0x00,
+  0xF3, 0x64, 0x88, 0xFB, 0xA3, 0x88, 0x9A, 0x08, 0x01, 0x89, 0xE8, 0x28, 0x4D, 0x80, 0x28, 0x4C,
+  0x00, 0x30, 0x8C, 0x88, 0xFB, 0xA3, 0x01, 0xDB, 0x25, 0x28, 0x4C, 0x86, 0x28, 0x4D, 0x80, 0x28,
+  0x4C, 0x01, 0x30, 0x8C, 0xFB, 0x84, 0x87, 0xFB, 0xA3, 0x00, 0xC2, 0xA6, 0x80, 0x9A, 0x08, 0x00,
+  0xCA, 0xC6, 0x88, 0xFB, 0xA3, 0x04, 0x79, 0xA9, 0x28, 0x4C, 0x28, 0x6C, 0x28, 0x4D, 0x69, 0x6A,
+  0x88, 0x9A, 0x08, 0x00, 0xE3, 0x24, 0x88, 0xFB, 0xA3, 0x00, 0xAA, 0x47, 0x88, 0x9A, 0x08, 0xBA,
+  0x28, 0x4D, 0x00, 0x21, 0x31, 0x92, 0x04, 0x1F, 0x00, 0xB6, 0xDF, 0x87, 0xFF, 0xFF, 0x01, 0xEF,
+  0xBF, 0x2C, 0xBF, 0x8B, 0x04, 0x1F, 0x00, 0x28, 0xAE, 0x99, 0x28, 0x4D, 0x01, 0x28, 0x4C, 0x81,
+  0xC8, 0x88, 0xFB, 0xA3, 0x01, 0x89, 0xC8, 0x28, 0x4C, 0x82, 0x28, 0x4D, 0x01, 0x28, 0x4C, 0x48,
+  0xCB, 0x94, 0xFB, 0xA3, 0x00, 0xDB, 0x05, 0x80, 0x28, 0x4C, 0x82, 0x28, 0x4D, 0x01, 0x28, 0x4C,
+  0xCA, 0xE5, 0x88, 0xFB, 0xA3, 0x01, 0x40, 0xAB, 0x28, 0x4C, 0x80, 0x28, 0x4D, 0x00, 0xCA, 0xC6,
+  0x9D, 0xFB, 0xA3, 0x01, 0xEB, 0x44, 0x28, 0x4D, 0x80, 0x28, 0x4C, 0x00, 0x30, 0x8C, 0x88, 0xFB,
+  0xA3, 0x00, 0xDB, 0x25, 0x80, 0x28, 0x4C, 0x86, 0x28, 0x4D, 0x80, 0x28, 0x4C, 0x00, 0xC2, 0xA6,
+  0x95, 0xFB, 0xA3, 0x00, 0x79, 0xA9, 0x80, 0x28, 0x4C, 0x01, 0x28, 0x4D, 0xAA, 0x47, 0x9E, 0xFB,
+  0xA3, 0x00, 0x30, 0x6C, 0xBA, 0x28, 0x4D, 0x00, 0x03, 0xBD, 0x91, 0x04, 0x1F, 0x00, 0xB6, 0xDF,
+  0x86, 0xFF, 0xFF, 0x01, 0xE7, 0x9F, 0x2C, 0xBF, 0x8B, 0x04, 0x1F, 0x00, 0x0B, 0x1A, 0x99, 0x28,
+  0x4D, 0x80, 0x28, 0x4C, 0x00, 0x81, 0xA8, 0x88, 0xFB, 0xA3, 0x01, 0x89, 0xC8, 0x28, 0x4C, 0x82,
+  0x28, 0x4D, 0x80, 0x28, 0x4C, 0x00, 0xF3, 0x64, 0x93, 0xFB, 0xA3, 0x00, 0xB2, 0x67, 0x81, 0x28,
+  0x4C, 0x80, 0x28, 0x4D, 0x80, 0x28, 0x4C, 0x00, 0xCA, 0xE5, 0x88, 0xFB, 0xA3, 0x01, 0x40, 0xAB,
+  0x28, 0x4C, 0x80, 0x28, 0x4D, 0x00, 0xC2, 0xC6, 0x9D, 0xFB, 0xA3, 0x00, 0xEB, 0x44, 0x81, 0x28,
+  0x4C, 0x00, 0x30, 0x6C, 0x88, 0xFB, 0xA3, 0x00, 0xDB, 0x25, 0x80, 0x28, 0x4C, 0x86, 0x28, 0x4D,
+  0x80, 0x28, 0x4C, 0x00, 0x79, 0xA9, 0x95, 0xFB, 0xA3, 0x00, 0x79, 0xA9, 0x81, 0x28, 0x4C, 0x00,
+  0xAA, 0x47, 0x9E, 0xFB, 0xA3, 0x00, 0x30, 0x6C, 0xBA, 0x28, 0x4D, 0x00, 0x12, 0x56, 0x91, 0x04,
+  0x1F, 0x00, 0xB6, 0xDF, 0x85, 0xFF, 0xFF, 0x01, 0xE7, 0x9F, 0x2C, 0xBF, 0x8C, 0x04, 0x1F, 0x00,
+  0x19, 0xB3, 0x99, 0x28, 0x4D, 0x80, 0x28, 0x4C, 0x00, 0x81, 0xA8, 0x88, 0xFB, 0xA3, 0x00, 0x89,
+  0xC8, 0x80, 0x28, 0x4C, 0x00, 0x28, 0x4D, 0x82, 0x28, 0x4C, 0x00, 0xCA, 0xE5, 0x93, 0xFB, 0xA3,
+  0x00, 0x89, 0xC8, 0x81, 0x28, 0x4C, 0x80, 0x28, 0x4D, 0x80, 0x28, 0x4C, 0x00, 0xCA, 0xE5, 0x88,
+  0xFB, 0xA3, 0x00, 0x40, 0xAB, 0x81, 0x28, 0x4C, 0x00, 0xC2, 0xC6, 0x9D, 0xFB, 0xA3, 0x00, 0xEB,
+  0x44, 0x81, 0x28, 0x4C, 0x00, 0x30, 0x6C, 0x88, 0xFB, 0xA3, 0x00, 0xDB, 0x25, 0x81, 0x28, 0x4C,
+  0x84, 0x28, 0x4D, 0x81, 0x28, 0x4C, 0x01, 0x38, 0x8B, 0xFB, 0x83, 0x94, 0xFB, 0xA3, 0x00, 0x79,
+  0xA9, 0x81, 0x28, 0x4C, 0x00, 0xAA, 0x47, 0x9E, 0xFB, 0xA3, 0x80, 0x28, 0x4C, 0x8B, 0x28, 0x4D,
+  0x83, 0x28, 0x4C, 0x01, 0x28, 0x4D, 0x28, 0x4C, 0x84, 0x28, 0x4D, 0x83, 0x28, 0x4C, 0x9A, 0x28,
+  0x4D, 0x00, 0x20, 0xAE, 0x91, 0x04, 0x1F, 0x00, 0xB6, 0xDF, 0x84, 0xFF, 0xFF, 0x01, 0xE7, 0x9F,
+  0x2C, 0xBF, 0x8C, 0x04, 0x1F, 0x01, 0x03, 0xDE, 0x28, 0x6D, 0x82, 0x28, 0x4D, 0x00, 0x28, 0x4C,
+  0x94, 0x28, 0x4D, 0x80, 0x28, 0x4C, 0x00, 0x81, 0xA8, 0x88, 0xFB, 0xA3, 0x00, 0x89, 0xC8, 0x80,
+  0x28, 0x4C, 0x00, 0x28, 0x4D, 0x82, 0x28, 0x4C, 0x00, 0xA2, 0x27, 0x93, 0xFB, 0xA3, 0x00, 0x61,
+  0x2A, 0x81, 0x28, 0x4C, 0x80, 0x28, 0x4D, 0x80, 0x28, 0x4C, 0x00, 0xCA, 0xE5, 0x88, 0xFB, 0xA3,
+  0x00, 0x40, 0xAB, 0x81, 0x28, 0x4C, 0x00, 0xC2, 0xC6, 0x9D, 0xFB, 0xA3, 0x00, 0xEB, 0x44, 0x81,
+  0x28, 0x4C, 0x00, 0x30, 0x6C, 0x88, 0xFB, 0xA3, 0x00, 0xDB, 0x25, 0x82, 0x28, 0x4C, 0x84, 0x28,
+  0x4D, 0x81, 0x28, 0x4C, 0x00, 0xCA, 0xE5, 0x94, 0xFB, 0xA3, 0x00, 0x79, 0xA9, 0x81, 0x28, 0x4C,
+  0x00, 0xAA, 0x47, 0x9E, 0xFB, 0xA3, 0x81, 0x28, 0x4C, 0x8A, 0x28, 0x4D, 0x83, 0x28, 0x4C, 0x01,
+  0x28, 0x4D, 0x28, 0x4C, 0x84, 0x28, 0x4D, 0x87, 0x28, 0x4C, 0x8D, 0x28, 0x4D, 0x81, 0x28, 0x4C,
+  0x84, 0x28, 0x4D, 0x01, 0x28, 0x4C, 0x12, 0xB8, 0x90, 0x04, 0x1F, 0x00, 0xB6, 0xDF, 0x83, 0xFF,
+  0xFF, 0x01, 0xE7, 0x9F, 0x2C, 0xBF, 0x8D, 0x04, 0x1F, 0x00, 0x12, 0x56, 0x83, 0x28, 0x4D, 0x00,
+  0x28, 0x4C, 0x91, 0x28, 0x4D, 0x83, 0x28, 0x4C, 0x00, 0x81, 0xA8, 0x88, 0xFB, 0xA3, 0x00, 0x89,
+  0xC8, 0x80, 0x28, 0x4C, 0x00, 0x28, 0x4D, 0x82, 0x28, 0x4C, 0x00, 0x79, 0x89, 0x93, 0xFB, 0xA3,
+  0x00, 0x38, 0x8C, 0x81, 0x28, 0x4C, 0x80, 0x28, 0x4D, 0x80, 0x28, 0x4C, 0x00, 0xCA, 0xE5, 0x88,
+  0xFB, 0xA3, 0x00, 0x40, 0xAB, 0x81, 0x28, 0x4C, 0x00, 0xC2, 0xC6, 0x9D, 0xFB, 0xA3, 0x00, 0xEB,
+  0x44, 0x81, 0x28, 0x4C, 0x00, 0x30, 0x6C, 0x88, 0xFB, 0xA3, 0x00, 0xDB, 0x25, 0x82, 0x28, 0x4C,
+  0x84, 0x28, 0x4D, 0x81, 0x28, 0x4C, 0x00, 0x89, 0xC8, 0x94, 0xFB, 0xA3, 0x00, 0x79, 0xA9, 0x81,
+  0x28, 0x4C, 0x00, 0xAA, 0x47, 0x9E, 0xFB, 0xA3, 0x81, 0x28, 0x4C, 0x90, 0x28, 0x4D, 0x80, 0x28,
+  0x4C, 0x87, 0x28, 0x4D, 0x83, 0x28, 0x4C, 0x8D, 0x28, 0x4D, 0x81, 0x28, 0x4C, 0x84, 0x28, 0x4D,
+  0x02, 0x28, 0x4C, 0x20, 0xCF, 0x03, 0xFE, 0x8F, 0x04, 0x1F, 0x00, 0xB6, 0xDF, 0x82, 0xFF, 0xFF,
+  0x01, 0xE7, 0x9F, 0x2C, 0xBF, 0x8D, 0x04, 0x1F, 0x01, 0x03, 0xDD, 0x28, 0x8D, 0x83, 0x28, 0x4D,
+  0x00, 0x28, 0x4C, 0x8D, 0x28, 0x4D, 0x87, 0x28, 0x4C, 0x00, 0x81, 0xA8, 0x88, 0xFB, 0xA3, 0x00,
+  0x89, 0xC8, 0x85, 0x28, 0x4C, 0x00, 0x50, 0xEA, 0x92, 0xFB, 0xA3, 0x00, 0xE3, 0x24, 0x86, 0x28,
+  0x4C, 0x00, 0xCA, 0xE5, 0x88, 0xFB, 0xA3, 0x00, 0x40, 0xAB, 0x81, 0x28, 0x4C, 0x00, 0xC2, 0xC6,
+  0x9D, 0xFB, 0xA3, 0x00, 0xEB, 0x44, 0x81, 0x28, 0x4C, 0x00, 0x30, 0x6C, 0x88, 0xFB, 0xA3, 0x00,
+  0xDB, 0x05, 0x8B, 0x28, 0x4C, 0x00, 0x40, 0xCB, 0x94, 0xFB, 0xA3, 0x00, 0x79, 0x89, 0x81, 0x28,
+  0x4C, 0x00, 0xAA, 0x47, 0x9E, 0xFB, 0xA3, 0xBD, 0x28, 0x4C, 0x00, 0x12, 0x36, 0x8F, 0x04, 0x1F,
+  0x00, 0xB6, 0xDF, 0x81, 0xFF, 0xFF, 0x01, 0xE7, 0x9F, 0x24, 0xBF, 0x8E, 0x04, 0x1F, 0x00, 0x19,
+  0xD4, 0x85, 0x28, 0x4C, 0x00, 0x28, 0x4D, 0x95, 0x28, 0x4C, 0x00, 0x81, 0xA8, 0x88, 0xFB, 0xA3,
+  0x00, 0x89, 0xC8, 0x85, 0x28, 0x4C, 0x01, 0x28, 0x6C, 0xFB, 0x84, 0x91, 0xFB, 0xA3, 0x00, 0xBA,
+  0x86, 0x86, 0x28, 0x4C, 0x00, 0xCA, 0xE5, 0x88, 0xFB, 0xA3, 0x00, 0x40, 0xAB, 0x81, 0x28, 0x4C,
+  0x00, 0xC2, 0xC6, 0x9D, 0xFB, 0xA3, 0x00, 0xEB, 0x44, 0x81, 0x28, 0x4C, 0x00, 0x30, 0x6C, 0x88,
+  0xFB, 0xA3, 0x00, 0xDB, 0x05, 0x8C, 0x28, 0x4C, 0x00, 0xDB, 0x05, 0x93, 0xFB, 0xA3, 0x00, 0x79,
+  0x89, 0x81, 0x28, 0x4C, 0x00, 0xAA, 0x47, 0x9E, 0xFB, 0xA3, 0xBD, 0x28, 0x4C, 0x01, 0x28, 0x6D,
+  0x0B, 0x5B, 0x8E, 0x04, 0x1F, 0x00, 0xB6, 0xDF, 0x80, 0xFF, 0xFF, 0x01, 0xE7, 0x9F, 0x24, 0xBF,
+  0x8E, 0x04, 0x1F, 0x01, 0x0B, 0x1A, 0x28, 0x4D, 0x9D, 0x28, 0x4C, 0x00, 0x81, 0xA8, 0x88, 0xFB,
+  0xA3, 0x01, 0x89, 0xC8, 0x20, 0x4C, 0x84, 0x28, 0x4C, 0x01, 0x20, 0x4C, 0xD3, 0x05, 0x91, 0xFB,
+  0xA3, 0x00, 0x91, 0xE8, 0x86, 0x28, 0x4C, 0x00, 0xCA, 0xE5, 0x88, 0xFB, 0xA3, 0x00, 0x38, 0xAB,
+  0x81, 0x28, 0x4C, 0x00, 0xC2, 0xC6, 0x9D, 0xFB, 0xA3, 0x00, 0xEB, 0x44, 0x81, 0x28, 0x4C, 0x00,
+  0x30, 0x6C, 0x88, 0xFB, 0xA3, 0x00, 0xDB, 0x25, 0x8B, 0x28, 0x4C, 0x01, 0x20, 0x4C, 0x91, 0xE8,
+  0x93, 0xFB, 0xA3, 0x00, 0x79, 0xA9, 0x81, 0x28, 0x4C, 0x00, 0xAA, 0x47, 0x9E, 0xFB, 0xA3, 0xBE,
+  0x28, 0x4C, 0x01, 0x20, 0xEF, 0x03, 0xFE, 0x8D, 0x04, 0x1F, 0x03, 0xB6, 0xDF, 0xFF, 0xFF, 0xE7,
+  0x9F, 0x24, 0xBF, 0x8E, 0x04, 0x1F, 0x01, 0x03, 0xDE, 0x20, 0xAE, 0x9D, 0x28, 0x4C, 0x01, 0x20,
+  0x4C, 0x81, 0xA8, 0x88, 0xFB, 0xA3, 0x01, 0x89, 0xC8, 0x20, 0x4C, 0x85, 0x28, 0x4C, 0x00, 0xAA,
+  0x67, 0x91, 0xFB, 0xA3, 0x00, 0x69, 0x49, 0x86, 0x28, 0x4C, 0x00, 0xCA, 0xE5, 0x88, 0xFB, 0xA3,
+  0x00, 0x38, 0xAB, 0x81, 0x28, 0x4C, 0x00, 0xC2, 0xC6, 0x9D, 0xFB, 0xA3, 0x00, 0xEB, 0x44, 0x81,
+  0x28, 0x4C, 0x00, 0x30, 0x6C, 0x88, 0xFB, 0xA3, 0x00, 0xDB, 0x25, 0x8C, 0x28, 0x4C, 0x00, 0x50,
+  0xEA, 0x93, 0xFB, 0xA3, 0x00, 0x79, 0xA9, 0x81, 0x28, 0x4C, 0x00, 0xAA, 0x47, 0x9E, 0xFB, 0xA3,
+  0xBF, 0x28, 0x4C, 0x01, 0x19, 0x51, 0x03, 0xFF, 0x8C, 0x04, 0x1F, 0x02, 0xB6, 0xDF, 0xE7, 0x9F,
+  0x24, 0xBF, 0x8E, 0x04, 0x1F, 0x01, 0x03, 0xFE, 0x19, 0x31, 0x9E, 0x28, 0x4C, 0x82, 0x20, 0x4C,
+  0x84, 0x20, 0x4B, 0x82, 0x20, 0x4C, 0x83, 0x28, 0x4C, 0x82, 0x20, 0x4C, 0x8F, 0x20, 0x4B, 0x81,
+  0x20, 0x4C, 0x83, 0x28, 0x4C, 0x82, 0x20, 0x4C, 0x85, 0x20, 0x4B, 0x82, 0x20, 0x4C, 0x00, 0x28,
+  0x4C, 0x81, 0x20, 0x4C, 0x9B, 0x20, 0x4B, 0x85, 0x20, 0x4C, 0x87, 0x20, 0x4B, 0x81, 0x20, 0x4C,
+  0x88, 0x28, 0x4C, 0x82, 0x20, 0x4C, 0x91, 0x20, 0x4B, 0x81, 0x20, 0x4C, 0x00, 0x28, 0x4C, 0x82,
+  0x20, 0x4C, 0x9A, 0x20, 0x4B, 0x82, 0x20, 0x4C, 0xBE, 0x28, 0x4C, 0x01, 0x19, 0x72, 0x03, 0xFE,
+  0x8B, 0x04, 0x1F, 0x01, 0x9E, 0x7F, 0x24, 0xBF, 0x8E, 0x04, 0x1F, 0x01, 0x03, 0xFE, 0x19, 0x31,
+  0x9F, 0x28, 0x4C, 0x8C, 0x20, 0x4C, 0x84, 0x28, 0x4C, 0x84, 0x20, 0x4C, 0x80, 0x20, 0x4B, 0x8D,
+  0x20, 0x4C, 0x84, 0x28, 0x4C, 0x8C, 0x20, 0x4C, 0x00, 0x28, 0x4C, 0x8A, 0x20, 0x4C, 0x83, 0x20,
+  0x4B, 0x82, 0x20, 0x4C, 0x80, 0x20, 0x4B, 0x8A, 0x20, 0x4C, 0x00, 0x28, 0x4C, 0x81, 0x20, 0x4C,
+  0x00, 0x20, 0x4B, 0x85, 0x20, 0x4C, 0x00, 0x20, 0x4B, 0x80, 0x20, 0x4C, 0x8A, 0x28, 0x4C, 0x97,
+  0x20, 0x4C, 0x00, 0x28, 0x4C, 0x86, 0x20, 0x4C, 0x00, 0x20, 0x4B, 0x99, 0x20, 0x4C, 0xBF, 0x28,
+  0x4C, 0x01, 0x21, 0x10, 0x03, 0x9D, 0x8A, 0x04, 0x1F, 0x00, 0x04, 0x3F, 0x8E, 0x04, 0x1F, 0x01,
+  0x03, 0x9C, 0x20, 0xF0, 0x98, 0x28, 0x4C, 0x84, 0x20, 0x4C, 0x80, 0x28, 0x4C, 0x8C, 0x20, 0x4C,
+  0x84, 0x28, 0x4C, 0x95, 0x20, 0x4C, 0x84, 0x28, 0x4C, 0x89, 0x20, 0x4C, 0x82, 0x28, 0x4C, 0xA1,
+  0x20, 0x4C, 0x80, 0x28, 0x4C, 0x88, 0x20, 0x4C, 0x00, 0x28, 0x4C, 0x80, 0x20, 0x4C, 0x8A, 0x28,
+  0x4C, 0x94, 0x20, 0x4C, 0x82, 0x28, 0x4C, 0x9F, 0x20, 0x4C, 0x8E, 0x28, 0x4C, 0x80, 0x20, 0x4C,
+  0x9F, 0x28, 0x4C, 0x80, 0x20, 0x4C, 0x8E, 0x28, 0x4C, 0x01, 0x20, 0x8E, 0x0A, 0xB8, 0x99, 0x04,
+  0x1F, 0x01, 0x12, 0x98, 0x20, 0x8D, 0x99, 0x28, 0x4C, 0xFF, 0x20, 0x4C, 0xFF, 0x20, 0x4C, 0x84,
+  0x20, 0x4C, 0x01, 0x19, 0x31, 0x0B, 0x1A, 0x95, 0x04, 0x1F, 0x01, 0x0A, 0xD9, 0x20, 0xEF, 0xFF,
+  0x20, 0x4C, 0xFF, 0x20, 0x4C, 0xA3, 0x20, 0x4C, 0x02, 0x20, 0xCF, 0x12, 0x35, 0x03, 0x7C, 0x8F,
+  0x04, 0x1F, 0x02, 0x03, 0x5B, 0x12, 0x56, 0x20, 0xCF, 0xFF, 0x20, 0x4C, 0xFF, 0x20, 0x4C, 0xA8,
+  0x20, 0x4C, 0x07, 0x20, 0xAE, 0x19, 0x93, 0x12, 0x56, 0x0A, 0xD9, 0x0B, 0x3B, 0x03, 0x9C, 0x03,
+  0xDE, 0x03, 0xFE, 0x81, 0x04, 0x1F, 0x05, 0x03, 0xFE, 0x03, 0x7C, 0x0A, 0xD9, 0x12, 0x35, 0x19,
+  0x72, 0x20, 0x8E, 0xAD, 0x20, 0x4C, 0x00, 0x28, 0xAD, 0x83, 0x41, 0x4F, 0x00, 0x30, 0xAD, 0x83,
+  0x20, 0x4C, 0x01, 0x30, 0xAD, 0x41, 0x4F, 0x85, 0x20, 0x4C, 0x02, 0x28, 0x6C, 0x41, 0x4F, 0x28,
+  0x8D, 0x83, 0x20, 0x4C, 0x00, 0x30, 0xEE, 0x83, 0x41, 0x4F, 0x00, 0x28, 0x8D, 0x83, 0x20, 0x4C,
+  0x00, 0x30, 0xCD, 0x88, 0x41, 0x4F, 0x00, 0x28, 0x6D, 0x83, 0x20, 0x4C, 0x00, 0x39, 0x0E, 0x82,
+  0x41, 0x4F, 0x01, 0x41, 0x4E, 0x28, 0x6C, 0x83, 0x20, 0x4C, 0x80, 0x39, 0x2E, 0x85, 0x20, 0x4C,
+  0x01, 0x39, 0x0E, 0x41, 0x2E, 0x90, 0x20, 0x4C, 0x00, 0x30, 0xEE, 0x87, 0x41, 0x4F, 0x00, 0x39,
+  0x0E, 0x81, 0x20, 0x4C, 0x00, 0x28, 0x8D, 0x87, 0x41, 0x4F, 0x00, 0x39, 0x2E, 0x82, 0x20, 0x4C,
+  0x86, 0x41, 0x4F, 0x00, 0x28, 0x8D, 0x83, 0x20, 0x4C, 0x01, 0x38, 0xEE, 0x41, 0x4F, 0x85, 0x20,
+  0x4C, 0x01, 0x38, 0xEE, 0x41, 0x4F, 0x81, 0x20, 0x4C, 0x01, 0x39, 0x0E, 0x30, 0xCE, 0x86, 0x20,
+  0x4C, 0x01, 0x30, 0xAD, 0x39, 0x2E, 0x84, 0x20, 0x4C, 0x00, 0x38, 0xEE, 0x81, 0x41, 0x4F, 0x00,
+  0x39, 0x0E, 0x84, 0x20, 0x4C, 0x00, 0x30, 0xAD, 0x85, 0x41, 0x4F, 0x00, 0x39, 0x0E, 0x84, 0x20,
+  0x4C, 0x00, 0x39, 0x0E, 0x87, 0x41, 0x4F, 0x00, 0x30, 0xCD, 0xE9, 0x20, 0x4C, 0x02, 0x28, 0x6C,
+  0xAC, 0xF8, 0xFF, 0xDF, 0x83, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0xB5, 0x79, 0x30, 0xAD, 0x81, 0x20,
+  0x4C, 0x02, 0xA4, 0xB7, 0xFF, 0xFF, 0x30, 0xCD, 0x84, 0x20, 0x4C, 0x02, 0x5A, 0x11, 0xFF, 0xFF,
+  0x7B, 0x74, 0x81, 0x20, 0x4C, 0x01, 0x39, 0x0E, 0xCE, 0x1B, 0x84, 0xFF, 0xFF, 0x01, 0xF7, 0xBF,
+  0x8C, 0x15, 0x82, 0x20, 0x4C, 0x00, 0xBD, 0x99, 0x88, 0xFF, 0xFF, 0x00, 0x62, 0x92, 0x81, 0x20,
+  0x4C, 0x01, 0x49, 0x8F, 0xD6, 0x9C, 0x84, 0xFF, 0xFF, 0x01, 0xEF, 0x7E, 0x7B, 0x54, 0x82, 0x20,
+  0x4C, 0x02, 0xEF, 0x5E, 0xFF, 0xFF, 0x7B, 0x33, 0x83, 0x20, 0x4C, 0x00, 0x62, 0x92, 0x80, 0xFF,
+  0xFF, 0x00, 0x28, 0x8D, 0x8F, 0x20, 0x4C, 0x00, 0xC6, 0x1A, 0x87, 0xFF, 0xFF, 0x00, 0xD6, 0x9C,
+  0x81, 0x20, 0x4C, 0x00, 0x7B, 0x54, 0x87, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x81, 0x20, 0x4C, 0x00,
+  0x49, 0xB0, 0x86, 0xFF, 0xFF, 0x01, 0xF7, 0xBF, 0x8C, 0x15, 0x82, 0x20, 0x4C, 0x02, 0xD6, 0x9C,
+  0xFF, 0xFF, 0x94, 0x36, 0x83, 0x20, 0x4C, 0x03, 0x49, 0xB0, 0xFF, 0xDF, 0xFF, 0xFF, 0x49, 0xAF,
+  0x80, 0x20, 0x4C, 0x01, 0xE6, 0xFD, 0xCE, 0x1B, 0x86, 0x20, 0x4C, 0x01, 0xB5, 0x79, 0xFF, 0xDF,
+  0x83, 0x20, 0x4C, 0x01, 0x30, 0xCD, 0xF7, 0x9E, 0x81, 0xFF, 0xFF, 0x01, 0xFF, 0xDF, 0x39, 0x2E,
+  0x83, 0x20, 0x4C, 0x00, 0x9C, 0x97, 0x86, 0xFF, 0xFF, 0x01, 0xDE, 0xDC, 0x51, 0xF0, 0x82, 0x20,
+  0x4C, 0x00, 0xE6, 0xFD, 0x87, 0xFF, 0xFF, 0x00, 0xBD, 0xB9, 0xE9, 0x20, 0x4C, 0x03, 0x94, 0x56,
+  0xFF, 0xFF, 0xC6, 0x1A, 0x94, 0x56, 0x82, 0x94, 0x36, 0x02, 0xBD, 0xB9, 0xFF, 0xFF, 0xAD, 0x38,
+  0x81, 0x20, 0x4C, 0x02, 0xA4, 0xD7, 0xFF, 0xFF, 0x30, 0xCD, 0x84, 0x20, 0x4C, 0x02, 0x5A, 0x31,
+  0xFF, 0xFF, 0x83, 0x94, 0x81, 0x20, 0x4C, 0x02, 0xD6, 0x5B, 0xFF, 0xFF, 0xB5, 0x38, 0x82, 0x94,
+  0x36, 0x03, 0x94, 0x56, 0xD6, 0x9C, 0xFF, 0xFF, 0x73, 0x33, 0x81, 0x20, 0x4C, 0x00, 0x6A, 0xD2,
+  0x82, 0x94, 0x36, 0x01, 0xFF, 0xFF, 0xDE, 0xBC, 0x82, 0x94, 0x36, 0x00, 0x41, 0x4E, 0x80, 0x20,
+  0x4C, 0x03, 0x28, 0x6C, 0xE6, 0xFD, 0xFF, 0xBF, 0xA4, 0xF7, 0x82, 0x94, 0x36, 0x03, 0x9C, 0x76,
+  0xE6, 0xFD, 0xFF, 0xFF, 0x5A, 0x31, 0x81, 0x20, 0x4C, 0x03, 0xEF, 0x7E, 0xFF, 0xFF, 0xF7, 0x9E,
+  0x39, 0x2E, 0x81, 0x20, 0x4C, 0x01, 0x30, 0xCD, 0xEF, 0x3D, 0x80, 0xFF, 0xFF, 0x00, 0x28, 0xAD,
+  0x8F, 0x20, 0x4C, 0x01, 0xCE, 0x1A, 0xF7, 0x9E, 0x86, 0x94, 0x36, 0x00, 0x7B, 0x54, 0x81, 0x20,
+  0x4C, 0x00, 0x49, 0xAF, 0x82, 0x94, 0x36, 0x01, 0xFF, 0xFF, 0xDE, 0xBC, 0x81, 0x94, 0x36, 0x00,
+  0x8C, 0x15, 0x81, 0x20, 0x4C, 0x02, 0x49, 0xD0, 0xFF, 0xFF, 0xC5, 0xFA, 0x83, 0x94, 0x36, 0x03,
+  0x94, 0x56, 0xD6, 0x9C, 0xFF, 0xFF, 0x73, 0x33, 0x81, 0x20, 0x4C, 0x03, 0xD6, 0x9C, 0xFF, 0xFF,
+  0xFF, 0xDF, 0x51, 0xD0, 0x81, 0x20, 0x4C, 0x01, 0x28, 0x6C, 0xD6, 0x9C, 0x80, 0xFF, 0xFF, 0x00,
+  0x49, 0xAF, 0x80, 0x20, 0x4C, 0x01, 0xD6, 0x7C, 0xDE, 0xBC, 0x86, 0x20, 0x4C, 0x01, 0xC6, 0x1A,
+  0xEF, 0x5E, 0x83, 0x20, 0x4C, 0x06, 0x83, 0x94, 0xFF, 0xFF, 0xB5, 0x58, 0x94, 0x36, 0xA4, 0xF7,
+  0xFF, 0xFF, 0x94, 0x16, 0x83, 0x20, 0x4C, 0x02, 0x9C, 0x97, 0xFF, 0xFF, 0x9C, 0x96, 0x83, 0x94,
+  0x36, 0x03, 0xA4, 0xB7, 0xF7, 0x9E, 0xEF, 0x7E, 0x30, 0xCD, 0x81, 0x20, 0x4C, 0x01, 0xE6, 0xFD,
+  0xE7, 0x3D, 0x86, 0x94, 0x36, 0x00, 0x6A, 0xD2, 0xE9, 0x20, 0x4C, 0x01, 0xE6, 0xFD, 0xDE, 0xBC,
+  0x85, 0x20, 0x4C, 0x01, 0xCE, 0x1B, 0xFF, 0xBF, 0x81, 0x20, 0x4C, 0x02, 0xA4, 0xD7, 0xFF, 0xFF,
+  0x30, 0xCD, 0x84, 0x20, 0x4C, 0x02, 0x5A, 0x31, 0xFF, 0xFF, 0x7B, 0x94, 0x80, 0x20, 0x4C, 0x02,
+  0x41, 0x6F, 0xFF, 0xFF, 0xA4, 0xD7, 0x84, 0x20, 0x4C, 0x02, 0x28, 0xAD, 0xF7, 0x9E, 0xC6, 0x1A,
+  0x86, 0x20, 0x4C, 0x01, 0xFF, 0xFF, 0xB5, 0x58, 0x85, 0x20, 0x4C, 0x02, 0x5A, 0x31, 0xFF, 0xFF,
+  0x8B, 0xD5, 0x84, 0x20, 0x4C, 0x02, 0x39, 0x2E, 0xFF, 0xFF, 0xAD, 0x18, 0x81, 0x20, 0x4C, 0x03,
+  0xEF, 0x7E, 0xCE, 0x3B, 0xEF, 0x5E, 0xC5, 0xDA, 0x81, 0x20, 0x4C, 0x04, 0xAD, 0x18, 0xF7, 0xBE,
+  0xC5, 0xDA, 0xFF, 0xFF, 0x28, 0xAD, 0x8F, 0x20, 0x4C, 0x01, 0xCE, 0x1A, 0xE7, 0x3D, 0x8F, 0x20,
+  0x4C, 0x01, 0xFF, 0xFF, 0xB5, 0x58, 0x85, 0x20, 0x4C, 0x02, 0x49, 0xD0, 0xFF, 0xFF, 0x83, 0xB4,
+  0x84, 0x20, 0x4C, 0x02, 0x28, 0xAD, 0xF7, 0x9E, 0xC6, 0x1A, 0x81, 0x20, 0x4C, 0x01, 0xD6, 0x9C,
+  0xDE, 0xDC, 0x80, 0xDE, 0xBC, 0x00, 0x28, 0x6D, 0x80, 0x20, 0x4C, 0x04, 0x94, 0x36, 0xFF, 0xFF,
+  0xBD, 0x99, 0xFF, 0xFF, 0x49, 0xAF, 0x80, 0x20, 0x4C, 0x01, 0xC5, 0xFA, 0xEF, 0x3D, 0x86, 0x20,
+  0x4C, 0x01, 0xD6, 0x9C, 0xDE, 0xBC, 0x83, 0x20, 0x4C, 0x02, 0xDE, 0x9C, 0xEF, 0x7E, 0x28, 0x8C,
+  0x80, 0x20, 0x4C, 0x01, 0xE6, 0xFD, 0xE7, 0x1D, 0x83, 0x20, 0x4C, 0x02, 0x9C, 0x97, 0xFF, 0xFF,
+  0x30, 0xCD, 0x84, 0x20, 0x4C, 0x02, 0x73, 0x33, 0xFF, 0xFF, 0x73, 0x13, 0x81, 0x20, 0x4C, 0x01,
+  0xE6, 0xFD, 0xCE, 0x5B, 0xF2, 0x20, 0x4C, 0x01, 0xEF, 0x7E, 0xBD, 0xDA, 0x85, 0x20, 0x4C, 0x02,
+  0xAC, 0xF8, 0xFF, 0xFF, 0x28, 0xAD, 0x80, 0x20, 0x4C, 0x02, 0xA4, 0xD7, 0xFF, 0xFF, 0x30, 0xED,
+  0x84, 0x20, 0x4C, 0x02, 0x5A, 0x31, 0xFF, 0xFF, 0x7B, 0x94, 0x80, 0x20, 0x4C, 0x02, 0x51, 0xF0,
+  0xFF, 0xFF, 0x83, 0xB4, 0x85, 0x20, 0x4C, 0x01, 0xDE, 0xFD, 0xD6, 0x7C, 0x86, 0x20, 0x4C, 0x01,
+  0xFF, 0xFF, 0xB5, 0x58, 0x85, 0x20, 0x4C, 0x02, 0x6A, 0xB2, 0xFF, 0xFF, 0x6A, 0xD2, 0x85, 0x20,
+  0x4C, 0x01, 0xFF, 0xBF, 0xBD, 0x99, 0x81, 0x20, 0x4C, 0x0B, 0xEF, 0x7E, 0xBD, 0xDA, 0x73, 0x33,
+  0xFF, 0xFF, 0x7B, 0x74, 0x20, 0x4C, 0x62, 0x92, 0xFF, 0xFF, 0x8B, 0xD5, 0xAD, 0x18, 0xFF, 0xFF,
+  0x28, 0xAD, 0x8F, 0x20, 0x4C, 0x01, 0xC6, 0x1A, 0xE7, 0x3D, 0x8F, 0x20, 0x4C, 0x01, 0xFF, 0xFF,
+  0xB5, 0x58, 0x85, 0x20, 0x4C, 0x02, 0x49, 0xD0, 0xFF, 0xFF, 0x83, 0xB4, 0x85, 0x20, 0x4C, 0x01,
+  0xDE, 0xFD, 0xD6, 0x9C, 0x81, 0x20, 0x4C, 0x0B, 0xD6, 0x9C, 0xDE, 0xBC, 0x52, 0x30, 0xFF, 0xFF,
+  0x94, 0x56, 0x20, 0x4C, 0x49, 0xD0, 0xFF, 0xDF, 0xA4, 0xD7, 0x8B, 0xF5, 0xFF, 0xFF, 0x49, 0xAF,
+  0x80, 0x20, 0x4C, 0x01, 0xB5, 0x59, 0xFF, 0xDF, 0x86, 0x20, 0x4C, 0x01, 0xE7, 0x1D, 0xCE, 0x3B,
+  0x82, 0x20, 0x4C, 0x02, 0x52, 0x10, 0xFF, 0xFF, 0x9C, 0xB7, 0x81, 0x20, 0x4C, 0x02, 0x8B, 0xF5,
+  0xFF, 0xFF, 0x62, 0x92, 0x82, 0x20, 0x4C, 0x02, 0x9C, 0x97, 0xFF, 0xFF, 0x30, 0xED, 0x84, 0x20,
+  0x4C, 0x02, 0x52, 0x30, 0xFF, 0xFF, 0x7B, 0x94, 0x81, 0x20, 0x4C, 0x01, 0xE6, 0xFD, 0xCE, 0x5B,
+  0xF0, 0x20, 0x4C, 0x03, 0x20, 0x2C, 0x20, 0x4C, 0xEF, 0x7E, 0xBD, 0xDA, 0x85, 0x20, 0x4C, 0x01,
+  0x41, 0x8F, 0x62, 0x91, 0x81, 0x20, 0x4C, 0x02, 0xA4, 0xD7, 0xFF, 0xFF, 0x30, 0xCD, 0x84, 0x20,
+  0x4C, 0x02, 0x52, 0x30, 0xFF, 0xFF, 0x7B, 0x94, 0x80, 0x20, 0x4C, 0x02, 0x51, 0xF0, 0xFF, 0xFF,
+  0x83, 0xB4, 0x85, 0x20, 0x4C, 0x01, 0x52, 0x10, 0x51, 0xF0, 0x86, 0x20, 0x4C, 0x02, 0xFF, 0xFF,
+  0xB5, 0x38, 0x20, 0x2C, 0x84, 0x20, 0x4C, 0x02, 0x62, 0xB2, 0xFF, 0xFF, 0x6A, 0xD2, 0x85, 0x20,
+  0x4C, 0x01, 0xFF, 0xBF, 0xBD, 0x99, 0x81, 0x20, 0x4C, 0x0B, 0xEF, 0x7E, 0xBD, 0xDA, 0x20, 0x4C,
+  0xCE, 0x1A, 0xF7, 0x9E, 0x49, 0xD0, 0xEF, 0x3D, 0xDE, 0xBC, 0x20, 0x6C, 0xAC, 0xF8, 0xFF, 0xFF,
+  0x28, 0xAD, 0x85, 0x20, 0x4C, 0x80, 0x20, 0x2C, 0x86, 0x20, 0x4C, 0x01, 0xC6, 0x1A, 0xE7, 0x3D,
+  0x8F, 0x20, 0x4C, 0x01, 0xFF, 0xFF, 0xB5, 0x58, 0x85, 0x20, 0x4C, 0x02, 0x49, 0xD0, 0xFF, 0xFF,
+  0x83, 0xB4, 0x85, 0x20, 0x4C, 0x01, 0xDE, 0xFD, 0xD6, 0x7C, 0x81, 0x20, 0x4C, 0x0B, 0xD6, 0x9C,
+  0xDE, 0xBC, 0x20, 0x4C, 0xAD, 0x18, 0xFF, 0xDF, 0x52, 0x10, 0xD6, 0x9C, 0xEF, 0x5E, 0x30, 0xCD,
+  0x8B, 0xF5, 0xFF, 0xFF, 0x49, 0xAF, 0x80, 0x20, 0x4C, 0x02, 0x9C, 0x97, 0xFF, 0xFF, 0x28, 0xAD,
+  0x85, 0x20, 0x4C, 0x01, 0xF7, 0x9E, 0xBD, 0x99, 0x82, 0x20, 0x4C, 0x02, 0xAD, 0x18, 0xFF, 0xFF,
+  0x49, 0x8F, 0x81, 0x20, 0x4C, 0x02, 0x31, 0x0E, 0xFF, 0xDF, 0xBD, 0xBA, 0x82, 0x20, 0x4C, 0x02,
+  0x9C, 0x97, 0xFF, 0xFF, 0x30, 0xCD, 0x84, 0x20, 0x4C, 0x02, 0x52, 0x30, 0xFF, 0xFF, 0x7B, 0x74,
+  0x81, 0x20, 0x4C, 0x01, 0xE6, 0xFD, 0xCE, 0x5B, 0xA0, 0x20, 0x4C, 0x80, 0x20, 0x2C, 0xA0, 0x20,
+  0x4C, 0x82, 0x20, 0x2C, 0xA8, 0x20, 0x4C, 0x01, 0xEF, 0x7E, 0xBD, 0xDA, 0x8A, 0x20, 0x4C, 0x02,
+  0xA4, 0xD7, 0xFF, 0xFF, 0x30, 0xCD, 0x84, 0x20, 0x4C, 0x02, 0x52, 0x30, 0xFF, 0xFF, 0x7B, 0x94,
+  0x80, 0x20, 0x4C, 0x02, 0x39, 0x4E, 0xFF, 0xFF, 0xAD, 0x38, 0x8F, 0x20, 0x4C, 0x01, 0xFF, 0xFF,
+  0xB5, 0x58, 0x85, 0x20, 0x4C, 0x02, 0x62, 0xB2, 0xFF, 0xFF, 0x6A, 0xD2, 0x85, 0x20, 0x4C, 0x01,
+  0xFF, 0xBF, 0xBD, 0x99, 0x81, 0x20, 0x4C, 0x0B, 0xEF, 0x7E, 0xBD, 0xDA, 0x20, 0x4C, 0x41, 0x8F,
+  0xFF, 0xDF, 0xF7, 0xBF, 0xFF, 0xFF, 0x52, 0x10, 0x20, 0x4C, 0xAC, 0xF8, 0xFF, 0xFF, 0x28, 0xAD,
+  0x8F, 0x20, 0x4C, 0x01, 0xC6, 0x1A, 0xE7, 0x3D, 0x8F, 0x20, 0x4C, 0x01, 0xFF, 0xFF, 0xB5, 0x58,
+  0x85, 0x20, 0x4C, 0x02, 0x49, 0xD0, 0xFF, 0xFF, 0x83, 0xB4, 0x84, 0x20, 0x4C, 0x02, 0x30, 0xED,
+  0xF7, 0xBF, 0xC5, 0xFA, 0x81, 0x20, 0x4C, 0x0B, 0xD6, 0x9C, 0xDE, 0xBC, 0x20, 0x4C, 0x30, 0xED,
+  0xEF, 0x7E, 0xF7, 0xBF, 0xFF, 0xFF, 0x73, 0x13, 0x20, 0x4C, 0x8B, 0xF5, 0xFF, 0xFF, 0x49, 0xAF,
+  0x80, 0x20, 0x4C, 0x02, 0x8B, 0xD5, 0xFF, 0xFF, 0x41, 0x6F, 0x84, 0x20, 0x4C, 0x02, 0x28, 0x6C,
+  0xFF, 0xFF, 0xA4, 0xF8, 0x81, 0x20, 0x4C, 0x02, 0x30, 0xAD, 0xF7, 0xBF, 0xCE, 0x3B, 0x83, 0x20,
+  0x4C, 0x02, 0xB5, 0x79, 0xFF, 0xDF, 0x39, 0x2E, 0x81, 0x20, 0x4C, 0x02, 0x9C, 0x97, 0xFF, 0xFF,
+  0x30, 0xCD, 0x84, 0x20, 0x4C, 0x02, 0x7B, 0x94, 0xFF, 0xFF, 0x6A, 0xF2, 0x81, 0x20, 0x4C, 0x01,
+  0xE6, 0xFD, 0xCE, 0x5B, 0xF2, 0x20, 0x4C, 0x01, 0xEF, 0x7E, 0xBD, 0xDA, 0x8A, 0x20, 0x4C, 0x02,
+  0xA4, 0xD7, 0xFF, 0xFF, 0x30, 0xCD, 0x84, 0x20, 0x4C, 0x02, 0x52, 0x30, 0xFF, 0xFF, 0x7B, 0x94,
+  0x81, 0x20, 0x4C, 0x02, 0xC5, 0xFA, 0xFF, 0xFF, 0xCE, 0x1B, 0x82, 0xB5, 0x58, 0x02, 0xAD, 0x38,
+  0x8C, 0x15, 0x30, 0xEE, 0x87, 0x20, 0x4C, 0x01, 0xFF, 0xFF, 0xB5, 0x58, 0x85, 0x20, 0x4C, 0x02,
+  0x62, 0xB2, 0xFF, 0xFF, 0x6A, 0xD2, 0x85, 0x20, 0x4C, 0x01, 0xFF, 0xBF, 0xBD, 0x99, 0x81, 0x20,
+  0x4C, 0x01, 0xEF, 0x7E, 0xBD, 0xDA, 0x80, 0x20, 0x4C, 0x02, 0x94, 0x56, 0xFF, 0xFF, 0xAD, 0x18,
+  0x80, 0x20, 0x4C, 0x02, 0xAC, 0xF8, 0xFF, 0xFF, 0x28, 0xAD, 0x8F, 0x20, 0x4C, 0x01, 0xC6, 0x1A,
+  0xF7, 0xBF, 0x85, 0xB5, 0x58, 0x01, 0xAD, 0x38, 0x28, 0x8D, 0x86, 0x20, 0x4C, 0x01, 0xFF, 0xFF,
+  0xB5, 0x58, 0x85, 0x20, 0x4C, 0x02, 0x49, 0xD0, 0xFF, 0xFF, 0xD6, 0x7B, 0x83, 0xB5, 0x58, 0x03,
+  0xB5, 0x59, 0xE7, 0x1D, 0xFF, 0xFF, 0x6A, 0xB2, 0x81, 0x20, 0x4C, 0x01, 0xD6, 0x9C, 0xDE, 0xBC,
+  0x80, 0x20, 0x4C, 0x02, 0x7B, 0x53, 0xFF, 0xFF, 0xC5, 0xFA, 0x80, 0x20, 0x4C, 0x02, 0x8B, 0xF5,
+  0xFF, 0xFF, 0x49, 0xAF, 0x80, 0x20, 0x4C, 0x02, 0x7B, 0x54, 0xFF, 0xFF, 0x52, 0x10, 0x84, 0x20,
+  0x4C, 0x02, 0x39, 0x2E, 0xFF, 0xFF, 0x94, 0x36, 0x81, 0x20, 0x4C, 0x02, 0x7B, 0x74, 0xFF, 0xFF,
+  0x73, 0x13, 0x83, 0x20, 0x4C, 0x02, 0x5A, 0x71, 0xFF, 0xFF, 0x8C, 0x15, 0x81, 0x20, 0x4C, 0x02,
+  0x9C, 0x97, 0xFF, 0xFF, 0xB5, 0x79, 0x83, 0xB5, 0x58, 0x03, 0xBD, 0xB9, 0xFF, 0xDF, 0xE7, 0x3D,
+  0x28, 0xAD, 0x81, 0x20, 0x4C, 0x01, 0xE6, 0xFD, 0xEF, 0x5E, 0x85, 0xB5, 0x58, 0x00, 0x62, 0xB2,
+  0xEA, 0x20, 0x4C, 0x01, 0xEF, 0x7E, 0xBD, 0xDA, 0x8A, 0x20, 0x4C, 0x02, 0xA4, 0xD7, 0xFF, 0xFF,
+  0x30, 0xCD, 0x84, 0x20, 0x4C, 0x02, 0x52, 0x30, 0xFF, 0xFF, 0x7B, 0x94, 0x81, 0x20, 0x4C, 0x02,
+  0x30, 0xCD, 0xB5, 0x58, 0xF7, 0xBF, 0x84, 0xFF, 0xFF, 0x01, 0xEF, 0x3D, 0x39, 0x2E, 0x84, 0x20,
+  0x4C, 0x80, 0x20, 0x2C, 0x02, 0xFF, 0xFF, 0xB5, 0x58, 0x20, 0x2C, 0x84, 0x20, 0x4C, 0x02, 0x62,
+  0xB2, 0xFF, 0xFF, 0x6A, 0xD2, 0x84, 0x20, 0x4C, 0x03, 0x20, 0x2C, 0xFF, 0xBF, 0xBD, 0x99, 0x20,
+  0x2C, 0x80, 0x20, 0x4C, 0x01, 0xEF, 0x7E, 0xBD, 0xDA, 0x80, 0x20, 0x4C, 0x02, 0x20, 0x6C, 0x51,
+  0xF0, 0x28, 0x8C, 0x80, 0x20, 0x4C, 0x02, 0xAC, 0xF8, 0xFF, 0xFF, 0x28, 0xAD, 0x85, 0x20, 0x4C,
+  0x00, 0x20, 0x2C, 0x87, 0x20, 0x4C, 0x00, 0xC6, 0x1A, 0x87, 0xFF, 0xFF, 0x02, 0x30, 0xED, 0x20,
+  0x4C, 0x20, 0x2C, 0x84, 0x20, 0x4C, 0x01, 0xFF, 0xFF, 0xB5, 0x58, 0x85, 0x20, 0x4C, 0x00, 0x49,
+  0xCF, 0x86, 0xFF, 0xFF, 0x01, 0xE7, 0x1D, 0x7B, 0x53, 0x82, 0x20, 0x4C, 0x01, 0xD6, 0x9C, 0xDE,
+  0xBC, 0x81, 0x20, 0x4C, 0x01, 0x49, 0xCF, 0x28, 0xAD, 0x80, 0x20, 0x4C, 0x02, 0x8B, 0xF5, 0xFF,
+  0xFF, 0x49, 0xAF, 0x80, 0x20, 0x4C, 0x02, 0x6A, 0xD2, 0xFF, 0xFF, 0x62, 0x92, 0x80, 0x20, 0x4C,
+  0x01, 0x6A, 0xD2, 0x73, 0x33, 0x80, 0x20, 0x4C, 0x02, 0x49, 0xD0, 0xFF, 0xFF, 0x83, 0x94, 0x81,
+  0x20, 0x4C, 0x02, 0xD6, 0x9C, 0xEF, 0x7E, 0x28, 0x8C, 0x84, 0x20, 0x4C, 0x01, 0xE6, 0xFD, 0xE7,
+  0x1D, 0x81, 0x20, 0x4C, 0x00, 0x9C, 0x97, 0x86, 0xFF, 0xFF, 0x01, 0xC6, 0x1A, 0x41, 0x6E, 0x82,
+  0x20, 0x4C, 0x00, 0xE6, 0xFD, 0x86, 0xFF, 0xFF, 0x00, 0x94, 0x36, 0x87, 0x20, 0x4C, 0x00, 0x20,
+  0x2C, 0xD5, 0x20, 0x4C, 0x87, 0x20, 0x2C, 0x03, 0x20, 0x4C, 0x20, 0x2B, 0xEF, 0x7E, 0xBD, 0xBA,
+  0x8A, 0x20, 0x2C, 0x02, 0xA4, 0xD7, 0xFF, 0xFF, 0x30, 0xCD, 0x84, 0x20, 0x2C, 0x02, 0x52, 0x10,
+  0xFF, 0xFF, 0x7B, 0x74, 0x82, 0x20, 0x2C, 0x80, 0x20, 0x2B, 0x82, 0x20, 0x4C, 0x03, 0x20, 0x6C,
+  0x73, 0x13, 0xFF, 0xFF, 0xAC, 0xF8, 0x86, 0x20, 0x2C, 0x01, 0xFF, 0xFF, 0xB5, 0x38, 0x84, 0x20,
+  0x2C, 0x03, 0x20, 0x4C, 0x62, 0xB2, 0xFF, 0xFF, 0x6A, 0xD2, 0x85, 0x20, 0x2C, 0x08, 0xFF, 0xBF,
+  0xBD, 0x99, 0x20, 0x2B, 0x20, 0x2C, 0x20, 0x2B, 0xEF, 0x7E, 0xBD, 0xBA, 0x20, 0x2C, 0x20, 0x4C,
+  0x82, 0x20, 0x2C, 0x03, 0x20, 0x4C, 0xAC, 0xF8, 0xFF, 0xFF, 0x28, 0xAC, 0x85, 0x20, 0x2C, 0x00,
+  0x20, 0x2B, 0x85, 0x20, 0x2C, 0x80, 0x20, 0x4C, 0x01, 0xC6, 0x1A, 0xE7, 0x3D, 0x80, 0x20, 0x4B,
+  0x83, 0x20, 0x4C, 0x01, 0x20, 0x4B, 0x20, 0x2B, 0x80, 0x20, 0x2C, 0x80, 0x20, 0x4C, 0x82, 0x20,
+  0x2C, 0x01, 0xFF, 0xFF, 0xB5, 0x38, 0x85, 0x20, 0x2C, 0x03, 0x49, 0xCF, 0xFF, 0xFF, 0x83, 0xB4,
+  0x20, 0x6C, 0x80, 0x20, 0x4C, 0x03, 0x20, 0x4B, 0xD6, 0x9C, 0xF7, 0xBE, 0x28, 0xAC, 0x83, 0x20,
+  0x2C, 0x01, 0xD6, 0x9C, 0xDE, 0xBC, 0x81, 0x20, 0x2C, 0x00, 0x20, 0x4C, 0x81, 0x20, 0x2C, 0x02,
+  0x8B, 0xD5, 0xFF, 0xFF, 0x49, 0xAF, 0x80, 0x20, 0x2C, 0x04, 0x5A, 0x31, 0xFF, 0xFF, 0x73, 0x13,
+  0x20, 0x2C, 0x51, 0xF0, 0x80, 0xFF, 0xFF, 0x04, 0x6A, 0xD2, 0x20, 0x4C, 0x5A, 0x51, 0xFF, 0xFF,
+  0x73, 0x13, 0x80, 0x20, 0x2C, 0x02, 0x20, 0x4C, 0xF7, 0x9E, 0xD6, 0x9C, 0x85, 0x73, 0x13, 0x02,
+  0xCE, 0x1A, 0xFF, 0xFF, 0x20, 0x4C, 0x80, 0x20, 0x2C, 0x02, 0x9C, 0x97, 0xFF, 0xFF, 0x30, 0xED,
+  0x80, 0x20, 0x4C, 0x03, 0x20, 0x4B, 0x49, 0xCF, 0xFF, 0xFF, 0xB5, 0x38, 0x80, 0x20, 0x4C, 0x82,
+  0x20, 0x2C, 0x01, 0xE6, 0xFD, 0xCE, 0x5B, 0x80, 0x20, 0x4B, 0x00, 0x20, 0x6C, 0x83, 0x20, 0x4C,
+  0x80, 0x20, 0x2C, 0x00, 0x20, 0x4C, 0x95, 0x20, 0x2C, 0x82, 0x20, 0x4C, 0x89, 0x20, 0x2C, 0x80,
+  0x20, 0x4C, 0x8C, 0x20, 0x2C, 0x84, 0x20, 0x4C, 0x8D, 0x20, 0x2C, 0x00, 0x20, 0x4C, 0x8C, 0x20,
+  0x2C, 0x81, 0x20, 0x4C, 0x8A, 0x20, 0x2C, 0x01, 0xEF, 0x7E, 0xBD, 0xBA, 0x89, 0x20, 0x2C, 0x03,
+  0x20, 0x2B, 0xA4, 0xD7, 0xFF, 0xFF, 0x30, 0xCD, 0x84, 0x20, 0x2C, 0x02, 0x52, 0x10, 0xFF, 0xFF,
+  0x7B, 0x74, 0x84, 0x20, 0x2C, 0x00, 0x20, 0x2B, 0x82, 0x20, 0x2C, 0x02, 0x20, 0x2B, 0xE7, 0x1D,
+  0xD6, 0x7B, 0x86, 0x20, 0x2C, 0x01, 0xFF, 0xFF, 0xB5, 0x38, 0x84, 0x20, 0x2C, 0x03, 0x20, 0x4C,
+  0x62, 0xB2, 0xFF, 0xFF, 0x6A, 0xD2, 0x85, 0x20, 0x2C, 0x01, 0xFF, 0xBF, 0xBD, 0x99, 0x81, 0x20,
+  0x2C, 0x01, 0xEF, 0x7E, 0xBD, 0xBA, 0x84, 0x20, 0x2C, 0x03, 0x20, 0x2B, 0xAC, 0xF8, 0xFF, 0xFF,
+  0x28, 0x8C, 0x8E, 0x20, 0x2C, 0x02, 0x20, 0x4C, 0xC6, 0x1A, 0xE7, 0x3D, 0x83, 0x20, 0x2B, 0x8A,
+  0x20, 0x2C, 0x01, 0xFF, 0xFF, 0xB5, 0x38, 0x85, 0x20, 0x2C, 0x02, 0x49, 0xAF, 0xFF, 0xFF, 0x83,
+  0xB4, 0x81, 0x20, 0x2C, 0x03, 0x20, 0x2B, 0x73, 0x13, 0xFF, 0xFF, 0x83, 0xB4, 0x83, 0x20, 0x2C,
+  0x02, 0xD6, 0x9C, 0xDE, 0xBC, 0x20, 0x2B, 0x84, 0x20, 0x2C, 0x02, 0x8B, 0xD5, 0xFF, 0xFF, 0x49,
+  0xAF, 0x80, 0x20, 0x2C, 0x0B, 0x49, 0x8F, 0xFF, 0xFF, 0x83, 0xB4, 0x20, 0x2C, 0xCE, 0x3B, 0xF7,
+  0xBF, 0xEF, 0x5E, 0xE6, 0xFD, 0x20, 0x6C, 0x6A, 0xD2, 0xFF, 0xFF, 0x62, 0x71, 0x80, 0x20, 0x2C,
+  0x01, 0x20, 0x2B, 0xF7, 0x9E, 0x88, 0xFF, 0xFF, 0x00, 0x20, 0x4C, 0x80, 0x20, 0x2C, 0x02, 0x9C,
+  0x97, 0xFF, 0xFF, 0x30, 0xCD, 0x80, 0x20, 0x2C, 0x80, 0x20, 0x2B, 0x02, 0xC6, 0x1A, 0xFF, 0xDF,
+  0x31, 0x0E, 0x83, 0x20, 0x2C, 0x01, 0xE6, 0xFD, 0xCE, 0x5B, 0x80, 0x20, 0x2B, 0xF0, 0x20, 0x2C,
+  0x01, 0xEF, 0x7E, 0xBD, 0xBA, 0x85, 0x20, 0x2C, 0x07, 0x94, 0x56, 0xE7, 0x1D, 0x20, 0x6C, 0x20,
+  0x2C, 0x20, 0x2B, 0xA4, 0xD7, 0xFF, 0xFF, 0x30, 0xCD, 0x84, 0x20, 0x2C, 0x02, 0x52, 0x10, 0xFF,
+  0xFF, 0x7B, 0x74, 0x80, 0x20, 0x2C, 0x02, 0x41, 0x8F, 0xEF, 0x3D, 0x73, 0x33, 0x84, 0x20, 0x2C,
+  0x03, 0x20, 0x2B, 0xDE, 0xFD, 0xD6, 0x9C, 0x20, 0x2B, 0x84, 0x20, 0x2C, 0x03, 0x20, 0x2B, 0xFF,
+  0xFF, 0xB5, 0x38, 0x20, 0x2B, 0x83, 0x20, 0x2C, 0x03, 0x20, 0x4C, 0x62, 0xB2, 0xFF, 0xFF, 0x6A,
+  0xD2, 0x84, 0x20, 0x2C, 0x02, 0x20, 0x2B, 0xFF, 0xBF, 0xBD, 0x99, 0x81, 0x20, 0x2C, 0x01, 0xEF,
+  0x7E, 0xBD, 0xBA, 0x84, 0x20, 0x2C, 0x03, 0x20, 0x2B, 0xAC, 0xF8, 0xFF, 0xFF, 0x28, 0x8C, 0x8E,
+  0x20, 0x2C, 0x03, 0x20, 0x4B, 0xC6, 0x1A, 0xE7, 0x3D, 0x18, 0x4B, 0x8D, 0x20, 0x2C, 0x02, 0x20,
+  0x2B, 0xFF, 0xFF, 0xB5, 0x38, 0x85, 0x20, 0x2C, 0x02, 0x49, 0xAF, 0xFF, 0xFF, 0x83, 0xB4, 0x82,
+  0x20, 0x2C, 0x03, 0x20, 0x6C, 0xEF, 0x3D, 0xE7, 0x1D, 0x20, 0x4C, 0x81, 0x20, 0x2C, 0x03, 0x20,
+  0x2B, 0xD6, 0x9C, 0xDE, 0xBC, 0x20, 0x2B, 0x84, 0x20, 0x2C, 0x02, 0x8B, 0xD5, 0xFF, 0xFF, 0x49,
+  0xAF, 0x80, 0x20, 0x2C, 0x0B, 0x30, 0xED, 0xFF, 0xFF, 0x94, 0x36, 0x6A, 0xD2, 0xFF, 0xFF, 0x8C,
+  0x15, 0x73, 0x33, 0xFF, 0xFF, 0x83, 0xB4, 0x7B, 0x73, 0xFF, 0xFF, 0x51, 0xF0, 0x80, 0x20, 0x2C,
+  0x02, 0x20, 0x2B, 0xF7, 0x9E, 0xD6, 0x5B, 0x85, 0x62, 0x91, 0x02, 0xC5, 0xDA, 0xFF, 0xFF, 0x20,
+  0x4C, 0x80, 0x20, 0x2C, 0x02, 0x9C, 0x97, 0xFF, 0xFF, 0x30, 0xCD, 0x81, 0x20, 0x2C, 0x03, 0x20,
+  0x2B, 0x62, 0x91, 0xFF, 0xFF, 0x94, 0x36, 0x83, 0x20, 0x2C, 0x01, 0xE6, 0xFD, 0xCE, 0x5B, 0x96,
+  0x20, 0x2C, 0x00, 0x20, 0x2B, 0xCE, 0x20, 0x2C, 0x87, 0x20, 0x4C, 0x04, 0x20, 0x2C, 0x18, 0x2C,
+  0xEF, 0x5E, 0xC6, 0x1A, 0x20, 0x2B, 0x83, 0x20, 0x4C, 0x08, 0x20, 0x4B, 0xB5, 0x58, 0xFF, 0xFF,
+  0x20, 0x6C, 0x20, 0x4C, 0x20, 0x4B, 0x9C, 0x97, 0xFF, 0xFF, 0x39, 0x2E, 0x84, 0x20, 0x4C, 0x02,
+  0x5A, 0x71, 0xFF, 0xFF, 0x7B, 0x53, 0x80, 0x20, 0x4C, 0x03, 0x49, 0xCF, 0xFF, 0xFF, 0x8B, 0xF5,
+  0x20, 0x4B, 0x83, 0x20, 0x4C, 0x03, 0x18, 0x4B, 0xE7, 0x1D, 0xD6, 0x5B, 0x20, 0x4B, 0x84, 0x20,
+  0x4C, 0x03, 0x18, 0x4B, 0xFF, 0xFF, 0xB5, 0x58, 0x20, 0x4B, 0x84, 0x20, 0x4C, 0x02, 0x62, 0x91,
+  0xFF, 0xFF, 0x73, 0x13, 0x84, 0x20, 0x4C, 0x08, 0x20, 0x6C, 0xFF, 0xDF, 0xB5, 0x79, 0x20, 0x4B,
+  0x20, 0x4C, 0x18, 0x4B, 0xEF, 0x7E, 0xBD, 0xDA, 0x20, 0x4B, 0x83, 0x20, 0x4C, 0x04, 0x20, 0x4B,
+  0xAC, 0xF8, 0xFF, 0xFF, 0x28, 0xAC, 0x20, 0x4C, 0x85, 0x20, 0x2C, 0x85, 0x20, 0x4C, 0x04, 0x20,
+  0x2C, 0x20, 0x4C, 0xC6, 0x1A, 0xE7, 0x3D, 0x18, 0x4B, 0x80, 0x18, 0x2C, 0x81, 0x20, 0x4C, 0x00,
+  0x20, 0x2C, 0x81, 0x20, 0x4C, 0x80, 0x20, 0x2C, 0x82, 0x20, 0x4C, 0x03, 0x18, 0x4B, 0xFF, 0xFF,
+  0xB5, 0x58, 0x20, 0x4B, 0x81, 0x20, 0x4C, 0x81, 0x20, 0x2C, 0x02, 0x49, 0xCF, 0xFF, 0xFF, 0x83,
+  0xB4, 0x82, 0x20, 0x4C, 0x03, 0x20, 0x2B, 0x8B, 0xF5, 0xFF, 0xFF, 0x6A, 0xD2, 0x81, 0x20, 0x4C,
+  0x03, 0x20, 0x4B, 0xD6, 0x9C, 0xDE, 0xBC, 0x20, 0x4B, 0x84, 0x20, 0x4C, 0x02, 0x8B, 0xF5, 0xFF,
+  0xFF, 0x49, 0xAF, 0x80, 0x20, 0x4C, 0x02, 0x20, 0x4B, 0xFF, 0xDF, 0xAD, 0x18, 0x80, 0xE6, 0xFD,
+  0x06, 0x20, 0x8C, 0x20, 0x4B, 0xCE, 0x5B, 0xF7, 0x7E, 0x9C, 0x96, 0xFF, 0xFF, 0x39, 0x4E, 0x80,
+  0x20, 0x4C, 0x03, 0x18, 0x4B, 0xF7, 0x9E, 0xBD, 0xDA, 0x18, 0x4B, 0x83, 0x20, 0x4B, 0x08, 0x18,
+  0x4B, 0xAC, 0xF8, 0xFF, 0xFF, 0x20, 0x6C, 0x20, 0x4C, 0x20, 0x4B, 0x9C, 0x97, 0xFF, 0xFF, 0x30,
+  0xCD, 0x82, 0x20, 0x4C, 0x03, 0x20, 0x4B, 0xDE, 0xDC, 0xEF, 0x5E, 0x28, 0x8C, 0x81, 0x20, 0x4C,
+  0x02, 0x18, 0x2B, 0xE6, 0xFD, 0xCE, 0x5B, 0x80, 0x20, 0x2C, 0x83, 0x20, 0x4C, 0x87, 0x20, 0x2C,
+  0x91, 0x20, 0x4C, 0x80, 0x20, 0x4B, 0x80, 0x20, 0x2C, 0x93, 0x20, 0x4C, 0x81, 0x20, 0x2C, 0x84,
+  0x20, 0x4C, 0x80, 0x20, 0x2C, 0x97, 0x20, 0x4C, 0x82, 0x20, 0x2C, 0x00, 0x20, 0x2B, 0x82, 0x20,
+  0x4C, 0x80, 0x18, 0x2B, 0x00, 0x20, 0x4C, 0x80, 0x18, 0x2B, 0x82, 0x18, 0x4C, 0x06, 0x20, 0x4C,
+  0x18, 0x4B, 0xBD, 0xDA, 0xFF, 0xDF, 0x73, 0x13, 0x41, 0x6E, 0x39, 0x4E, 0x81, 0x41, 0x6E, 0x09,
+  0x62, 0xB2, 0xF7, 0x9E, 0xD6, 0x9C, 0x18, 0x4B, 0x18, 0x4C, 0x18, 0x4B, 0x6B, 0x12, 0xFF, 0xFF,
+  0xAD, 0x38, 0x41, 0x8F, 0x82, 0x41, 0x6E, 0x03, 0x49, 0xCF, 0xC6, 0x1A, 0xFF, 0xFF, 0x49, 0xCF,
+  0x80, 0x18, 0x2B, 0x03, 0x20, 0x8C, 0xF7, 0x9E, 0xE7, 0x1D, 0x5A, 0x30, 0x82, 0x41, 0x6E, 0x05,
+  0x41, 0x6F, 0x8B, 0xF5, 0xFF, 0xFF, 0x9C, 0xB7, 0x20, 0x4B, 0x20, 0x4C, 0x83, 0x18, 0x4C, 0x04,
+  0x18, 0x4B, 0xFF, 0xFF, 0xAD, 0x58, 0x18, 0x4B, 0x18, 0x4C, 0x83, 0x20, 0x4C, 0x03, 0x31, 0x0D,
+  0xFF, 0xDF, 0xD6, 0x9C, 0x51, 0xF0, 0x82, 0x41, 0x6E, 0x03, 0x41, 0x8F, 0x9C, 0xB7, 0xFF, 0xFF,
+  0x83, 0xB4, 0x80, 0x18, 0x2B, 0x03, 0x18, 0x4B, 0xEF, 0x7E, 0xBD, 0xDA, 0x20, 0x4B, 0x80, 0x18,
+  0x2B, 0x06, 0x20, 0x4C, 0x20, 0x4B, 0x20, 0x4C, 0x20, 0x4B, 0xAC, 0xF8, 0xFF, 0xFF, 0x28, 0xAC,
+  0x80, 0x20, 0x4C, 0x00, 0x20, 0x2C, 0x80, 0x20, 0x4B, 0x80, 0x20, 0x4C, 0x86, 0x18, 0x4C, 0x04,
+  0x18, 0x2C, 0x18, 0x2B, 0xC6, 0x1A, 0xE7, 0x3D, 0x18, 0x4B, 0x80, 0x18, 0x2C, 0x00, 0x18, 0x2B,
+  0x80, 0x20, 0x4C, 0x84, 0x18, 0x4C, 0x00, 0x20, 0x8C, 0x81, 0x41, 0x6E, 0x02, 0x39, 0x6E, 0xFF,
+  0xFF, 0xBD, 0x99, 0x81, 0x41, 0x6E, 0x06, 0x39, 0x2E, 0x20, 0x4C, 0x20, 0x2C, 0x20, 0x4C, 0x49,
+  0xCF, 0xFF, 0xFF, 0x83, 0xB4, 0x80, 0x18, 0x2B, 0x00, 0x20, 0x4C, 0x80, 0x18, 0x4C, 0x03, 0x28,
+  0xCD, 0xF7, 0xBF, 0xCE, 0x5B, 0x18, 0x2B, 0x80, 0x18, 0x4C, 0x03, 0x18, 0x4B, 0xD6, 0x9C, 0xDE,
+  0xBC, 0x20, 0x4B, 0x80, 0x20, 0x4C, 0x80, 0x18, 0x2B, 0x80, 0x20, 0x4C, 0x02, 0x8B, 0xF5, 0xFF,
+  0xFF, 0x49, 0xAF, 0x80, 0x20, 0x4C, 0x04, 0x18, 0x4B, 0xEF, 0x7E, 0xF7, 0xBF, 0xFF, 0xFF, 0x62,
+  0xB1, 0x80, 0x18, 0x4B, 0x04, 0x49, 0xEF, 0xFF, 0xFF, 0xF7, 0xBF, 0xFF, 0xFF, 0x28, 0x8C, 0x80,
+  0x20, 0x4C, 0x04, 0x18, 0x4B, 0xF7, 0x9E, 0xBD, 0xDA, 0x20, 0x4B, 0x20, 0x4C, 0x82, 0x18, 0x2B,
+  0x02, 0x20, 0x4B, 0xAC, 0xF8, 0xFF, 0xFF, 0x80, 0x20, 0x4C, 0x03, 0x20, 0x4B, 0x9C, 0x97, 0xFF,
+  0xFF, 0x30, 0xCD, 0x82, 0x18, 0x4C, 0x03, 0x20, 0x4B, 0x7B, 0x73, 0xFF, 0xFF, 0x7B, 0x53, 0x81,
+  0x18, 0x4C, 0x03, 0x18, 0x4B, 0xE6, 0xFD, 0xD6, 0x7B, 0x41, 0x4F, 0x80, 0x41, 0x6E, 0x00, 0x41,
+  0x4E, 0x80, 0x41, 0x6E, 0x80, 0x41, 0x4E, 0x00, 0x30, 0xCD, 0x80, 0x20, 0x2C, 0x83, 0x20, 0x4C,
+  0x82, 0x18, 0x4C, 0x81, 0x18, 0x4B, 0x80, 0x18, 0x4C, 0x87, 0x20, 0x4C, 0x00, 0x18, 0x4C, 0x80,
+  0x18, 0x4B, 0x80, 0x18, 0x4C, 0x81, 0x20, 0x4C, 0x00, 0x18, 0x4B, 0x81, 0x18, 0x4C, 0x80, 0x18,
+  0x2B, 0x81, 0x20, 0x4C, 0x84, 0x18, 0x4C, 0x81, 0x20, 0x4C, 0x80, 0x20, 0x2C, 0x85, 0x20, 0x4C,
+  0x80, 0x20, 0x2C, 0x80, 0x20, 0x4C, 0x00, 0x18, 0x2B, 0x91, 0x20, 0x4C, 0x80, 0x20, 0x2C, 0x00,
+  0x20, 0x4C, 0x80, 0x20, 0x2C, 0x80, 0x20, 0x4C, 0x80, 0x18, 0x2B, 0x81, 0x18, 0x4C, 0x89, 0x18,
+  0x2B, 0x01, 0x41, 0x8E, 0xEF, 0x5E, 0x85, 0xFF, 0xFF, 0x01, 0xF7, 0x9E, 0x51, 0xF0, 0x81, 0x18,
+  0x2B, 0x01, 0x20, 0x4C, 0xBD, 0xB9, 0x86, 0xFF, 0xFF, 0x00, 0x9C, 0x96, 0x82, 0x18, 0x2B, 0x01,
+  0x73, 0x12, 0xFF, 0xDF, 0x85, 0xFF, 0xFF, 0x01, 0xDE, 0xDC, 0x30, 0xED, 0x86, 0x18, 0x2B, 0x01,
+  0xFF, 0xFF, 0xAD, 0x38, 0x86, 0x18, 0x2B, 0x00, 0x83, 0xD5, 0x86, 0xFF, 0xFF, 0x01, 0xCE, 0x3B,
+  0x20, 0x8C, 0x81, 0x18, 0x2B, 0x01, 0xEF, 0x7E, 0xBD, 0xBA, 0x85, 0x18, 0x2B, 0x02, 0xAC, 0xF8,
+  0xFF, 0xFF, 0x28, 0x8C, 0x8F, 0x18, 0x2B, 0x01, 0xC6, 0x1A, 0xE7, 0x3D, 0x8A, 0x18, 0x2B, 0x00,
+  0x7B, 0x53, 0x87, 0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x81, 0x18, 0x2B, 0x02, 0x49, 0xAF, 0xFF, 0xFF,
+  0x83, 0xB4, 0x84, 0x18, 0x2B, 0x02, 0xA4, 0xD7, 0xFF, 0xFF, 0x52, 0x10, 0x81, 0x18, 0x2B, 0x01,
+  0xD6, 0x9C, 0xDE, 0xBC, 0x85, 0x18, 0x2B, 0x02, 0x83, 0xD5, 0xFF, 0xFF, 0x49, 0xAF, 0x80, 0x20,
+  0x4C, 0x03, 0x18, 0x2B, 0xDE, 0xDC, 0xFF, 0xFF, 0xC5, 0xDA, 0x82, 0x18, 0x2B, 0x02, 0xAD, 0x18,
+  0xFF, 0xFF, 0xF7, 0x9E, 0x82, 0x18, 0x2B, 0x01, 0xF7, 0x9E, 0xBD, 0xBA, 0x85, 0x18, 0x2B, 0x02,
+  0xAC, 0xF8, 0xFF, 0xFF, 0x20, 0x4C, 0x80, 0x18, 0x2B, 0x02, 0x9C, 0x96, 0xFF, 0xFF, 0x30, 0xCD,
+  0x83, 0x18, 0x2B, 0x03, 0x20, 0x8C, 0xEF, 0x7E, 0xDE, 0xDC, 0x20, 0x4B, 0x81, 0x18, 0x2B, 0x00,
+  0xE6, 0xFD, 0x87, 0xFF, 0xFF, 0x00, 0xBD, 0x99, 0x87, 0x18, 0x2B, 0x00, 0x20, 0x4C, 0x84, 0x18,
+  0x2B, 0x00, 0x20, 0x4C, 0xA5, 0x18, 0x2B, 0x00, 0x20, 0x4C, 0x8C, 0x18, 0x2B, 0x00, 0x20, 0x4C,
+  0xA2, 0x18, 0x2B, 0x01, 0x30, 0xED, 0x7B, 0x73, 0x83, 0x8C, 0x15, 0x01, 0x7B, 0x94, 0x31, 0x0D,
+  0x83, 0x18, 0x2B, 0x01, 0x20, 0x4B, 0x62, 0xB1, 0x83, 0x8C, 0x15, 0x01, 0x8B, 0xF5, 0x52, 0x30,
+  0x84, 0x18, 0x2B, 0x01, 0x41, 0x8E, 0x83, 0xD4, 0x83, 0x8C, 0x15, 0x01, 0x73, 0x33, 0x28, 0x8C,
+  0x87, 0x18, 0x2B, 0x01, 0x8B, 0xF5, 0x62, 0x91, 0x87, 0x18, 0x2B, 0x01, 0x49, 0xEF, 0x83, 0xF5,
+  0x83, 0x8C, 0x15, 0x01, 0x6A, 0xF2, 0x20, 0x6C, 0x82, 0x18, 0x2B, 0x01, 0x83, 0xB4, 0x6A, 0xD2,
+  0x85, 0x18, 0x2B, 0x02, 0x5A, 0x71, 0x8C, 0x15, 0x20, 0x4C, 0x8F, 0x18, 0x2B, 0x01, 0x6A, 0xF2,
+  0x7B, 0x94, 0x8A, 0x18, 0x2B, 0x00, 0x49, 0xAF, 0x87, 0x8C, 0x15, 0x00, 0x8B, 0xF5, 0x81, 0x18,
+  0x2B, 0x02, 0x30, 0xCD, 0x8C, 0x15, 0x49, 0xCF, 0x84, 0x18, 0x2B, 0x02, 0x31, 0x0D, 0x8C, 0x15,
+  0x52, 0x30, 0x81, 0x18, 0x2B, 0x01, 0x73, 0x33, 0x73, 0x53, 0x85, 0x18, 0x2B, 0x02, 0x49, 0xEF,
+  0x8C, 0x15, 0x28, 0xCD, 0x81, 0x18, 0x2B, 0x02, 0x73, 0x33, 0x8C, 0x15, 0x39, 0x2E, 0x82, 0x18,
+  0x2B, 0x02, 0x30, 0xCD, 0x8C, 0x15, 0x7B, 0x94, 0x82, 0x18, 0x2B, 0x01, 0x83, 0xB4, 0x6A, 0xD2,
+  0x85, 0x18, 0x2B, 0x01, 0x5A, 0x71, 0x8B, 0xF5, 0x81, 0x18, 0x2B, 0x02, 0x5A, 0x30, 0x8C, 0x15,
+  0x20, 0x6C, 0x84, 0x18, 0x2B, 0x02, 0x62, 0x91, 0x8C, 0x15, 0x28, 0xCD, 0x81, 0x18, 0x2B, 0x00,
+  0x7B, 0x73, 0x87, 0x8C, 0x15, 0x00, 0x6A, 0xD2, 0xFF, 0x18, 0x2B, 0xFF, 0x18, 0x2B, 0xFF, 0x18,
+  0x2B, 0xFF, 0x18, 0x2B, 0xFF, 0x18, 0x2B, 0xFF, 0x18, 0x2B, 0xFF, 0x18, 0x2B, 0xFF, 0x18, 0x2B,
+  0xFF, 0x18, 0x2B, 0xFF, 0x18, 0x2B, 0xDF, 0x18, 0x2B, 0x00, 0x28, 0xAC, 0x87, 0x39, 0x4E, 0x00,
+  0x31, 0x0D, 0x83, 0x18, 0x2B, 0x01, 0x20, 0x4C, 0x39, 0x2E, 0x82, 0x39, 0x4E, 0x00, 0x31, 0x0D,
+  0x83, 0x18, 0x2B, 0x01, 0x18, 0x4B, 0x39, 0x2E, 0x84, 0x39, 0x4E, 0x01, 0x39, 0x2E, 0x20, 0x6C,
+  0x94, 0x18, 0x2B, 0x00, 0x30, 0xED, 0x82, 0x39, 0x4E, 0x01, 0x39, 0x2E, 0x20, 0x4C, 0x85, 0x18,
+  0x2B, 0x00, 0x28, 0x8C, 0x83, 0x39, 0x4E, 0x00, 0x28, 0xAC, 0x83, 0x18, 0x2B, 0x02, 0x28, 0xAC,
+  0x39, 0x4E, 0x20, 0x6C, 0x84, 0x18, 0x2B, 0x02, 0x28, 0x8C, 0x39, 0x4E, 0x20, 0x6C, 0x81, 0x18,
+  0x2B, 0x00, 0x39, 0x2E, 0x84, 0x39, 0x4E, 0x01, 0x39, 0x2E, 0x20, 0x8C, 0x86, 0x18, 0x2B, 0x00,
+  0x28, 0x8C, 0x81, 0x39, 0x4E, 0x00, 0x39, 0x2E, 0x84, 0x18, 0x2B, 0x02, 0x18, 0x4B, 0x39, 0x2E,
+  0x31, 0x0D, 0x85, 0x18, 0x2B, 0x80, 0x30, 0xED, 0x81, 0x18, 0x2B, 0x00, 0x28, 0x8C, 0x87, 0x39,
+  0x4E, 0x00, 0x30, 0xED, 0x84, 0x18, 0x2B, 0x00, 0x31, 0x0D, 0x82, 0x39, 0x4E, 0x01, 0x39, 0x0E,
+  0x20, 0x4B, 0x83, 0x18, 0x2B, 0x02, 0x31, 0x0D, 0x39, 0x2E, 0x20, 0x4C, 0x84, 0x18, 0x2B, 0x01,
+  0x28, 0xAC, 0x39, 0x2E, 0x93, 0x18, 0x2B, 0x00, 0x39, 0x2E, 0x81, 0x39, 0x4E, 0x00, 0x28, 0xAC,
+  0x84, 0x18, 0x2B, 0x00, 0x30, 0xED, 0x85, 0x39, 0x4E, 0x00, 0x28, 0xCD, 0x83, 0x18, 0x2B, 0x00,
+  0x20, 0x4C, 0x85, 0x39, 0x4E, 0x01, 0x39, 0x2E, 0x20, 0x4C, 0xCE, 0x18, 0x2B, 0x00, 0xAC, 0xF8,
+  0x87, 0xFF, 0xFF, 0x00, 0xEF, 0x7E, 0x82, 0x18, 0x2B, 0x01, 0x6A, 0xB2, 0xEF, 0x3D, 0x84, 0xFF,
+  0xFF, 0x01, 0xDE, 0xDC, 0x49, 0xF0, 0x81, 0x18, 0x2B, 0x00, 0x49, 0xAF, 0x86, 0xFF, 0xFF, 0x01,
+  0xF7, 0xBE, 0x8C, 0x15, 0x91, 0x18, 0x2B, 0x01, 0x41, 0x6F, 0xD6, 0x9C, 0x84, 0xFF, 0xFF, 0x01,
+  0xEF, 0x7E, 0x73, 0x53, 0x82, 0x18, 0x2B, 0x02, 0x20, 0x6C, 0xA4, 0xF7, 0xFF, 0xDF, 0x83, 0xFF,
+  0xFF, 0x02, 0xFF, 0xDF, 0xB5, 0x58, 0x28, 0x8C, 0x81, 0x18, 0x2B, 0x02, 0x9C, 0x76, 0xFF, 0xFF,
+  0xC6, 0x1A, 0x83, 0x18, 0x2B, 0x03, 0x28, 0x8C, 0xE6, 0xFD, 0xFF, 0xFF, 0x7B, 0x74, 0x80, 0x18,
+  0x2B, 0x00, 0x28, 0xCD, 0x86, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0xA4, 0xB7, 0x20, 0x4C, 0x84, 0x18,
+  0x2B, 0x00, 0xCE, 0x3B, 0x82, 0xFF, 0xFF, 0x00, 0x6A, 0xD2, 0x83, 0x18, 0x2B, 0x00, 0x49, 0xCF,
+  0x80, 0xFF, 0xFF, 0x01, 0xA4, 0xD7, 0x20, 0x4C, 0x83, 0x18, 0x2B, 0x01, 0xDE, 0xDC, 0xD6, 0x7B,
+  0x81, 0x18, 0x2B, 0x00, 0x94, 0x36, 0x87, 0xFF, 0xFF, 0x00, 0xE6, 0xFD, 0x82, 0x18, 0x2B, 0x01,
+  0x52, 0x10, 0xDE, 0xFD, 0x84, 0xFF, 0xFF, 0x01, 0xE7, 0x3D, 0x62, 0x91, 0x82, 0x18, 0x2B, 0x03,
+  0xF7, 0x9E, 0xFF, 0xFF, 0xCE, 0x3B, 0x30, 0xED, 0x83, 0x18, 0x2B, 0x02, 0xA4, 0xF7, 0xFF, 0xFF,
+  0x20, 0x8C, 0x91, 0x18, 0x2B, 0x00, 0x5A, 0x51, 0x82, 0xFF, 0xFF, 0x00, 0xDE, 0xBC, 0x84, 0x18,
+  0x2B, 0x00, 0xDE, 0xBC, 0x86, 0xFF, 0xFF, 0x01, 0xC5, 0xFA, 0x30, 0xED, 0x81, 0x18, 0x2B, 0x00,
+  0x6A, 0xD2, 0x86, 0xFF, 0xFF, 0x01, 0xEF, 0x7E, 0x73, 0x53, 0xCD, 0x18, 0x2B, 0x01, 0xAD, 0x18,
+  0xFF, 0xFF, 0x86, 0x94, 0x35, 0x00, 0x83, 0xD4, 0x81, 0x18, 0x2B, 0x03, 0x41, 0x8F, 0xFF, 0xDF,
+  0xE7, 0x3D, 0x9C, 0x76, 0x82, 0x94, 0x35, 0x03, 0x9C, 0xB7, 0xF7, 0x9E, 0xEF, 0x7E, 0x28, 0xCD,
+  0x80, 0x18, 0x2B, 0x02, 0x49, 0xAF, 0xFF, 0xFF, 0xC5, 0xDA, 0x83, 0x94, 0x35, 0x03, 0x94, 0x56,
+  0xD6, 0x9C, 0xFF, 0xFF, 0x73, 0x33, 0x8F, 0x18, 0x2B, 0x03, 0x20, 0x6C, 0xE6, 0xFD, 0xF7, 0xBF,
+  0xA4, 0xF7, 0x82, 0x94, 0x35, 0x03, 0x94, 0x76, 0xE6, 0xFD, 0xFF, 0xFF, 0x52, 0x30, 0x81, 0x18,
+  0x2B, 0x02, 0x94, 0x56, 0xFF, 0xFF, 0xC6, 0x1A, 0x83, 0x94, 0x35, 0x02, 0xBD, 0xB9, 0xFF, 0xFF,
+  0xAD, 0x18, 0x81, 0x18, 0x2B, 0x00, 0x9C, 0x96, 0x80, 0xFF, 0xFF, 0x00, 0x7B, 0x94, 0x82, 0x18,
+  0x2B, 0x00, 0xA4, 0xB7, 0x80, 0xFF, 0xFF, 0x00, 0x7B, 0x74, 0x80, 0x18, 0x2B, 0x02, 0x30, 0xCD,
+  0xFF, 0xFF, 0xCE, 0x5B, 0x83, 0x94, 0x35, 0x03, 0x94, 0x55, 0xCE, 0x1A, 0xFF, 0xFF, 0x8C, 0x15,
+  0x83, 0x18, 0x2B, 0x02, 0x41, 0x8F, 0xFF, 0xFF, 0xCE, 0x1A, 0x80, 0x94, 0x35, 0x01, 0xF7, 0xBF,
+  0xC6, 0x1A, 0x83, 0x18, 0x2B, 0x05, 0x49, 0xF0, 0xFF, 0xFF, 0xF7, 0x9E, 0xFF, 0xFF, 0xC6, 0x1A,
+  0x28, 0xCD, 0x82, 0x18, 0x2B, 0x01, 0xDE, 0xFC, 0xD6, 0x7B, 0x81, 0x18, 0x2B, 0x00, 0x52, 0x10,
+  0x81, 0x94, 0x35, 0x02, 0xA4, 0xD7, 0xFF, 0xFF, 0xC6, 0x1A, 0x81, 0x94, 0x35, 0x00, 0x7B, 0x94,
+  0x81, 0x18, 0x2B, 0x00, 0x30, 0xCD, 0x80, 0xF7, 0x7E, 0x00, 0x9C, 0xB6, 0x82, 0x94, 0x35, 0x03,
+  0x9C, 0x96, 0xEF, 0x5D, 0xFF, 0xDF, 0x41, 0x6E, 0x81, 0x18, 0x2B, 0x04, 0xF7, 0x9E, 0xF7, 0xBE,
+  0xFF, 0xFF, 0xE7, 0x1D, 0x41, 0xAF, 0x82, 0x18, 0x2B, 0x02, 0xA4, 0xF8, 0xFF, 0xFF, 0x20, 0x8C,
+  0x91, 0x18, 0x2B, 0x06, 0xB5, 0x79, 0xFF, 0xFF, 0x94, 0x56, 0x94, 0x35, 0xBD, 0xD9, 0xFF, 0xFF,
+  0x52, 0x30, 0x83, 0x18, 0x2B, 0x01, 0xDE, 0xBC, 0xEF, 0x5E, 0x84, 0x94, 0x35, 0x02, 0xB5, 0x58,
+  0xFF, 0xFF, 0xC6, 0x1A, 0x81, 0x18, 0x2B, 0x02, 0x6A, 0xD2, 0xFF, 0xFF, 0xB5, 0x79, 0x83, 0x94,
+  0x35, 0x03, 0x94, 0x76, 0xE6, 0xFD, 0xFF, 0xFF, 0x52, 0x30, 0xCC, 0x18, 0x2B, 0x01, 0xAD, 0x18,
+  0xFF, 0xFF, 0x8A, 0x18, 0x2B, 0x02, 0x8B, 0xF5, 0xFF, 0xFF, 0x49, 0xEF, 0x84, 0x18, 0x2B, 0x02,
+  0x73, 0x33, 0xFF, 0xFF, 0x6A, 0xF2, 0x80, 0x18, 0x2B, 0x02, 0x49, 0xAF, 0xFF, 0xFF, 0x83, 0xB4,
+  0x84, 0x18, 0x2B, 0x02, 0x28, 0x8C, 0xF7, 0x9E, 0xC5, 0xFA, 0x8F, 0x18, 0x2B, 0x02, 0x52, 0x30,
+  0xFF, 0xFF, 0x83, 0xD4, 0x84, 0x18, 0x2B, 0x02, 0x39, 0x2E, 0xFF, 0xFF, 0xAC, 0xF8, 0x81, 0x18,
+  0x2B, 0x02, 0xE6, 0xFD, 0xDE, 0xBC, 0x18, 0x4B, 0x84, 0x18, 0x2B, 0x02, 0xC6, 0x1A, 0xF7, 0xBF,
+  0x18, 0x4B, 0x80, 0x18, 0x2B, 0x04, 0x9C, 0x96, 0xFF, 0xFF, 0xB5, 0x79, 0xF7, 0xBF, 0x39, 0x4E,
+  0x80, 0x18, 0x2B, 0x04, 0x52, 0x30, 0xFF, 0xFF, 0xB5, 0x99, 0xFF, 0xFF, 0x7B, 0x74, 0x80, 0x18,
+  0x2B, 0x02, 0x30, 0xCD, 0xFF, 0xFF, 0x9C, 0xB7, 0x84, 0x18, 0x2B, 0x00, 0x18, 0x4B, 0x80, 0xDE,
+  0xFD, 0x83, 0x18, 0x2B, 0x02, 0x9C, 0xB7, 0xFF, 0xFF, 0x49, 0xEF, 0x80, 0x18, 0x2B, 0x02, 0xAD,
+  0x18, 0xFF, 0xFF, 0x41, 0x6E, 0x82, 0x18, 0x2B, 0x06, 0x49, 0xF0, 0xFF, 0xFF, 0x83, 0xD4, 0xA4,
+  0xF7, 0xFF, 0xFF, 0xE6, 0xFD, 0x41, 0x6F, 0x81, 0x18, 0x2B, 0x01, 0xDE, 0xFC, 0xD6, 0x7B, 0x85,
+  0x18, 0x2B, 0x02, 0x39, 0x6E, 0xFF, 0xFF, 0x8C, 0x15, 0x85, 0x18, 0x2B, 0x02, 0x73, 0x13, 0xFF,
+  0xFF, 0x6A, 0xF2, 0x84, 0x18, 0x2B, 0x02, 0x52, 0x30, 0xFF, 0xFF, 0x8B, 0xF5, 0x81, 0x18, 0x2B,
+  0x05, 0xF7, 0x9E, 0xBD, 0xB9, 0x7B, 0x73, 0xFF, 0xDF, 0xF7, 0xBE, 0x62, 0xD2, 0x81, 0x18, 0x2B,
+  0x02, 0xA4, 0xF8, 0xFF, 0xFF, 0x20, 0x8C, 0x90, 0x18, 0x2B, 0x02, 0x30, 0xED, 0xFF, 0xDF, 0xC5,
+  0xDA, 0x80, 0x18, 0x2B, 0x02, 0x39, 0x4E, 0xFF, 0xFF, 0xB5, 0x58, 0x83, 0x18, 0x2B, 0x80, 0xDE,
+  0xBC, 0x85, 0x18, 0x2B, 0x02, 0xAD, 0x18, 0xFF, 0xFF, 0x31, 0x0E, 0x80, 0x18, 0x2B, 0x02, 0x6A,
+  0xD2, 0xFF, 0xFF, 0x62, 0xD2, 0x84, 0x18, 0x2B, 0x02, 0x39, 0x2D, 0xFF, 0xFF, 0xAC, 0xF8, 0xCC,
+  0x18, 0x2B, 0x01, 0xAD, 0x18, 0xFF, 0xFF, 0x8A, 0x18, 0x2B, 0x02, 0x9C, 0x96, 0xFF, 0xFF, 0x28,
+  0xCD, 0x84, 0x18, 0x2B, 0x02, 0x52, 0x10, 0xFF, 0xFF, 0x7B, 0x74, 0x80, 0x18, 0x2B, 0x02, 0x49,
+  0xAF, 0xFF, 0xFF, 0x7B, 0x94, 0x85, 0x18, 0x2B, 0x01, 0xDE, 0xDC, 0xD6, 0x7B, 0x8F, 0x18, 0x2B,
+  0x02, 0x62, 0xB1, 0xFF, 0xFF, 0x62, 0xD2, 0x85, 0x18, 0x2B, 0x01, 0xF7, 0xBF, 0xB5, 0x99, 0x81,
+  0x18, 0x2B, 0x01, 0xEF, 0x7E, 0xBD, 0xB9, 0x85, 0x18, 0x2B, 0x02, 0xA4, 0xF7, 0xFF, 0xFF, 0x20,
+  0x8C, 0x80, 0x18, 0x2B, 0x0B, 0x9C, 0x96, 0xFF, 0xFF, 0x39, 0x6E, 0xEF, 0x5E, 0xCE, 0x3B, 0x18,
+  0x2B, 0x28, 0x8C, 0xE6, 0xFD, 0xD6, 0x9C, 0x52, 0x30, 0xFF, 0xFF, 0x7B, 0x74, 0x80, 0x18, 0x2B,
+  0x02, 0x28, 0xCD, 0xFF, 0xFF, 0x9C, 0xB7, 0x85, 0x18, 0x2B, 0x01, 0xC5, 0xFA, 0xEF, 0x5E, 0x82,
+  0x18, 0x2B, 0x02, 0x20, 0x6C, 0xEF, 0x7E, 0xD6, 0x9C, 0x81, 0x18, 0x2B, 0x02, 0x51, 0xF0, 0xFF,
+  0xFF, 0x9C, 0x76, 0x82, 0x18, 0x2B, 0x07, 0x49, 0xEF, 0xFF, 0xFF, 0x7B, 0x94, 0x18, 0x2B, 0x83,
+  0xB4, 0xFF, 0xDF, 0xF7, 0x9E, 0x62, 0x91, 0x80, 0x18, 0x2B, 0x01, 0xDE, 0xDC, 0xD6, 0x7B, 0x85,
+  0x18, 0x2B, 0x02, 0x39, 0x6E, 0xFF, 0xFF, 0x8C, 0x15, 0x85, 0x18, 0x2B, 0x02, 0x7B, 0x94, 0xFF,
+  0xFF, 0x49, 0xCF, 0x84, 0x18, 0x2B, 0x02, 0x31, 0x0D, 0xFF, 0xFF, 0x9C, 0x76, 0x81, 0x18, 0x2B,
+  0x06, 0xF7, 0x9E, 0xBD, 0xB9, 0x18, 0x2B, 0x52, 0x30, 0xEF, 0x7E, 0xFF, 0xFF, 0x8C, 0x15, 0x80,
+  0x18, 0x2B, 0x02, 0xA4, 0xF7, 0xFF, 0xFF, 0x20, 0x8C, 0x90, 0x18, 0x2B, 0x02, 0x83, 0xD5, 0xFF,
+  0xFF, 0x62, 0xB1, 0x81, 0x18, 0x2B, 0x02, 0xC5, 0xDA, 0xFF, 0xBF, 0x28, 0xCD, 0x82, 0x18, 0x2B,
+  0x80, 0xDE, 0xBC, 0x85, 0x18, 0x2B, 0x02, 0x83, 0xD5, 0xFF, 0xFF, 0x41, 0xAF, 0x80, 0x18, 0x2B,
+  0x02, 0x6A, 0xD2, 0xFF, 0xFF, 0x62, 0xD2, 0x85, 0x18, 0x2B, 0x01, 0xFF, 0xBF, 0xBD, 0x99, 0xCC,
+  0x18, 0x2B, 0x01, 0xAD, 0x18, 0xFF, 0xFF, 0x8A, 0x18, 0x2B, 0x02, 0x9C, 0x96, 0xFF, 0xFF, 0x28,
+  0xCD, 0x84, 0x18, 0x2B, 0x02, 0x52, 0x10, 0xFF, 0xFF, 0x7B, 0x74, 0x80, 0x18, 0x2B, 0x02, 0x49,
+  0xAF, 0xFF, 0xFF, 0x7B, 0x94, 0x85, 0x18, 0x2B, 0x01, 0xDE, 0xDC, 0xD6, 0x7B, 0x8F, 0x18, 0x2B,
+  0x02, 0x62, 0xB1, 0xFF, 0xFF, 0x62, 0xD2, 0x85, 0x18, 0x2B, 0x01, 0x5A, 0x50, 0x41, 0x8F, 0x81,
+  0x18, 0x2B, 0x01, 0xEF, 0x7E, 0xBD, 0xB9, 0x85, 0x18, 0x2B, 0x02, 0xA4, 0xF7, 0xFF, 0xFF, 0x20,
+  0x8C, 0x80, 0x18, 0x2B, 0x0B, 0x9C, 0x96, 0xFF, 0xFF, 0x28, 0xCD, 0x73, 0x33, 0xFF, 0xFF, 0x83,
+  0xB4, 0xA4, 0xD7, 0xFF, 0xFF, 0x49, 0xF0, 0x52, 0x10, 0xFF, 0xFF, 0x7B, 0x74, 0x80, 0x18, 0x2B,
+  0x02, 0x28, 0xCD, 0xFF, 0xFF, 0x9C, 0xB7, 0x85, 0x18, 0x2B, 0x01, 0xC5, 0xFA, 0xEF, 0x5E, 0x82,
+  0x18, 0x2B, 0x02, 0x73, 0x13, 0xFF, 0xFF, 0x7B, 0x73, 0x82, 0x18, 0x2B, 0x02, 0xD6, 0x9C, 0xEF,
+  0x5E, 0x20, 0x6C, 0x81, 0x18, 0x2B, 0x02, 0x49, 0xEF, 0xFF, 0xFF, 0x7B, 0x94, 0x80, 0x18, 0x2B,
+  0x06, 0x5A, 0x50, 0xF7, 0x7E, 0xFF, 0xFF, 0x83, 0xD5, 0x18, 0x2B, 0xDE, 0xDC, 0xD6, 0x7B, 0x85,
+  0x18, 0x2B, 0x02, 0x39, 0x6E, 0xFF, 0xFF, 0x8C, 0x15, 0x85, 0x18, 0x2B, 0x02, 0x7B, 0x94, 0xFF,
+  0xFF, 0x49, 0xCF, 0x84, 0x18, 0x2B, 0x02, 0x31, 0x0D, 0xFF, 0xFF, 0x9C, 0x76, 0x81, 0x18, 0x2B,
+  0x01, 0xF7, 0x9E, 0xBD, 0xB9, 0x80, 0x18, 0x2B, 0x07, 0x39, 0x2D, 0xDE, 0xBC, 0xFF, 0xFF, 0xB5,
+  0x59, 0x20, 0x6C, 0xA4, 0xF7, 0xFF, 0xFF, 0x20, 0x8C, 0x90, 0x18, 0x2B, 0x02, 0xE6, 0xFD, 0xE7,
+  0x3D, 0x18, 0x4B, 0x81, 0x18, 0x2B, 0x02, 0x62, 0xB1, 0xFF, 0xFF, 0x83, 0xB4, 0x82, 0x18, 0x2B,
+  0x80, 0xDE, 0xBC, 0x85, 0x18, 0x2B, 0x02, 0x83, 0xD5, 0xFF, 0xFF, 0x41, 0x8F, 0x80, 0x18, 0x2B,
+  0x02, 0x6A, 0xD2, 0xFF, 0xFF, 0x62, 0xD2, 0x85, 0x18, 0x2B, 0x01, 0xFF, 0xBF, 0xB5, 0x99, 0xCC,
+  0x18, 0x2B, 0x01, 0xAD, 0x18, 0xFF, 0xFF, 0x8A, 0x18, 0x2B, 0x02, 0x9C, 0x96, 0xFF, 0xFF, 0x28,
+  0xCC, 0x84, 0x18, 0x2B, 0x02, 0x52, 0x10, 0xFF, 0xFF, 0x7B, 0x74, 0x80, 0x18, 0x2B, 0x02, 0x41,
+  0xAF, 0xFF, 0xFF, 0x7B, 0xB4, 0x84, 0x18, 0x2B, 0x02, 0x28, 0xCD, 0xF7, 0xBF, 0xC5, 0xFA, 0x8F,
+  0x18, 0x2B, 0x02, 0x62, 0xB1, 0xFF, 0xFF, 0x62, 0xD2, 0x8A, 0x18, 0x2B, 0x01, 0xEF, 0x7E, 0xBD,
+  0xB9, 0x85, 0x18, 0x2B, 0x02, 0xA4, 0xF7, 0xFF, 0xFF, 0x20, 0x8C, 0x80, 0x18, 0x2B, 0x0B, 0x9C,
+  0x96, 0xFF, 0xFF, 0x28, 0xCC, 0x18, 0x2B, 0xC6, 0x1A, 0xF7, 0xBF, 0xFF, 0xFF, 0xA4, 0xF7, 0x18,
+  0x2B, 0x52, 0x10, 0xFF, 0xFF, 0x7B, 0x74, 0x80, 0x18, 0x2B, 0x02, 0x28, 0xCD, 0xFF, 0xFF, 0x9C,
+  0xB7, 0x84, 0x18, 0x2B, 0x02, 0x20, 0x6C, 0xE7, 0x1D, 0xDE, 0xBC, 0x82, 0x18, 0x2B, 0x02, 0xCE,
+  0x3B, 0xF7, 0x9E, 0x20, 0xAC, 0x82, 0x18, 0x2B, 0x02, 0x7B, 0x74, 0xFF, 0xFF, 0x6A, 0xF2, 0x81,
+  0x18, 0x2B, 0x02, 0x49, 0xEF, 0xFF, 0xFF, 0x7B, 0xB4, 0x81, 0x18, 0x2B, 0x05, 0x39, 0x6E, 0xDE,
+  0xDC, 0xFF, 0xFF, 0xAD, 0x38, 0xE7, 0x1D, 0xD6, 0x7B, 0x85, 0x18, 0x2B, 0x02, 0x39, 0x6E, 0xFF,
+  0xFF, 0x8C, 0x15, 0x85, 0x18, 0x2B, 0x02, 0x7B, 0x94, 0xFF, 0xFF, 0x49, 0xCF, 0x84, 0x18, 0x2B,
+  0x02, 0x31, 0x0D, 0xFF, 0xFF, 0x94, 0x76, 0x81, 0x18, 0x2B, 0x01, 0xF7, 0x9E, 0xBD, 0xB9, 0x81,
+  0x18, 0x2B, 0x06, 0x20, 0xAC, 0xBD, 0xB9, 0xFF, 0xFF, 0xD6, 0x7B, 0xBD, 0xB9, 0xFF, 0xFF, 0x20,
+  0x8C, 0x8F, 0x18, 0x2B, 0x02, 0x5A, 0x51, 0xFF, 0xFF, 0x8C, 0x35, 0x82, 0x18, 0x2B, 0x02, 0x18,
+  0x4B, 0xEF, 0x3D, 0xDE, 0xDC, 0x82, 0x18, 0x2B, 0x80, 0xDE, 0xBC, 0x85, 0x18, 0x2B, 0x02, 0xB5,
+  0x79, 0xFF, 0xFF, 0x30, 0xED, 0x80, 0x18, 0x2B, 0x02, 0x62, 0xD2, 0xFF, 0xFF, 0x62, 0xD2, 0x84,
+  0x18, 0x2B, 0x02, 0x41, 0x6E, 0xFF, 0xFF, 0xA4, 0xD7, 0xCC, 0x18, 0x2B, 0x01, 0xAD, 0x18, 0xFF,
+  0xFF, 0x86, 0xAD, 0x38, 0x00, 0x31, 0x0D, 0x81, 0x18, 0x2B, 0x02, 0x9C, 0x96, 0xFF, 0xFF, 0x28,
+  0xCC, 0x84, 0x18, 0x2B, 0x02, 0x52, 0x10, 0xFF, 0xFF, 0x7B, 0x73, 0x80, 0x18, 0x2B, 0x02, 0x41,
+  0xAF, 0xFF, 0xFF, 0xD6, 0x7B, 0x83, 0xAD, 0x38, 0x03, 0xB5, 0x58, 0xE7, 0x1D, 0xFF, 0xFF, 0x62,
+  0xB1, 0x8F, 0x18, 0x2B, 0x02, 0x62, 0xB1, 0xFF, 0xFF, 0x62, 0xD2, 0x8A, 0x18, 0x2B, 0x01, 0xEF,
+  0x7E, 0xBD, 0xB9, 0x85, 0x18, 0x2B, 0x02, 0xA4, 0xF7, 0xFF, 0xFF, 0x20, 0x8C, 0x80, 0x18, 0x2B,
+  0x0B, 0x9C, 0x96, 0xFF, 0xFF, 0x28, 0xCC, 0x18, 0x2B, 0x41, 0x8E, 0xFF, 0xDF, 0xEF, 0x5E, 0x28,
+  0xCC, 0x18, 0x2B, 0x52, 0x10, 0xFF, 0xFF, 0x7B, 0x73, 0x80, 0x18, 0x2B, 0x02, 0x28, 0xCD, 0xFF,
+  0xFF, 0xDE, 0xDC, 0x83, 0xAD, 0x38, 0x03, 0xAD, 0x58, 0xDE, 0xDC, 0xFF, 0xFF, 0x83, 0xB4, 0x81,
+  0x18, 0x2B, 0x02, 0x41, 0x8E, 0xFF, 0xFF, 0xA4, 0xF7, 0x83, 0x18, 0x2B, 0x02, 0x28, 0xAC, 0xF7,
+  0xBF, 0xC6, 0x1A, 0x81, 0x18, 0x2B, 0x02, 0x49, 0xEF, 0xFF, 0xFF, 0x7B, 0xB4, 0x82, 0x18, 0x2B,
+  0x01, 0x28, 0xAC, 0xC5, 0xDA, 0x80, 0xFF, 0xFF, 0x00, 0xD6, 0x7B, 0x85, 0x18, 0x2B, 0x02, 0x39,
+  0x6E, 0xFF, 0xFF, 0x8C, 0x15, 0x85, 0x18, 0x2B, 0x02, 0x7B, 0x94, 0xFF, 0xFF, 0x49, 0xCF, 0x84,
+  0x18, 0x2B, 0x02, 0x31, 0x0D, 0xFF, 0xFF, 0x94, 0x76, 0x81, 0x18, 0x2B, 0x01, 0xF7, 0x9E, 0xBD,
+  0xB9, 0x82, 0x18, 0x2B, 0x01, 0x18, 0x4B, 0x94, 0x56, 0x81, 0xFF, 0xFF, 0x00, 0x20, 0x8C, 0x8F,
+  0x18, 0x2B, 0x02, 0xB5, 0x79, 0xFF, 0xFF, 0x31, 0x2D, 0x83, 0x18, 0x2B, 0x02, 0x94, 0x55, 0xFF,
+  0xFF, 0x52, 0x30, 0x81, 0x18, 0x2B, 0x01, 0xDE, 0xBC, 0xF7, 0x7E, 0x84, 0xAD, 0x38, 0x02, 0xCE,
+  0x3B, 0xFF, 0xFF, 0xBD, 0xB9, 0x81, 0x18, 0x2B, 0x02, 0x62, 0xD2, 0xFF, 0xFF, 0xC6, 0x1A, 0x83,
+  0xAD, 0x38, 0x03, 0xB5, 0x79, 0xEF, 0x5E, 0xFF, 0xDF, 0x49, 0xEF, 0xCC, 0x18, 0x2B, 0x00, 0xAD,
+  0x18, 0x87, 0xFF, 0xFF, 0x00, 0x49, 0xCF, 0x81, 0x18, 0x2B, 0x02, 0x9C, 0x96, 0xFF, 0xFF, 0x28,
+  0xCC, 0x84, 0x18, 0x2B, 0x02, 0x52, 0x10, 0xFF, 0xFF, 0x7B, 0x73, 0x80, 0x18, 0x2B, 0x00, 0x41,
+  0xAF, 0x86, 0xFF, 0xFF, 0x01, 0xE7, 0x1D, 0x73, 0x53, 0x90, 0x18, 0x2B, 0x02, 0x62, 0xB1, 0xFF,
+  0xFF, 0x62, 0xD2, 0x8A, 0x18, 0x2B, 0x01, 0xEF, 0x7E, 0xBD, 0xB9, 0x85, 0x18, 0x2B, 0x02, 0xA4,
+  0xF7, 0xFF, 0xFF, 0x20, 0x8C, 0x80, 0x18, 0x2B, 0x02, 0x9C, 0x96, 0xFF, 0xFF, 0x28, 0xCC, 0x80,
+  0x18, 0x2B, 0x01, 0x39, 0x6E, 0x31, 0x0D, 0x80, 0x18, 0x2B, 0x02, 0x52, 0x10, 0xFF, 0xFF, 0x7B,
+  0x73, 0x80, 0x18, 0x2B, 0x00, 0x28, 0xCD, 0x86, 0xFF, 0xFF, 0x01, 0xEF, 0x5E, 0x8B, 0xF5, 0x82,
+  0x18, 0x2B, 0x02, 0x9C, 0x96, 0xFF, 0xFF, 0x49, 0xEF, 0x84, 0x18, 0x2B, 0x02, 0xAD, 0x18, 0xFF,
+  0xFF, 0x39, 0x4E, 0x80, 0x18, 0x2B, 0x02, 0x49, 0xEF, 0xFF, 0xFF, 0x7B, 0xB4, 0x83, 0x18, 0x2B,
+  0x03, 0x18, 0x4B, 0x9C, 0x96, 0xFF, 0xFF, 0xD6, 0x7B, 0x85, 0x18, 0x2B, 0x02, 0x39, 0x6E, 0xFF,
+  0xFF, 0x8C, 0x15, 0x85, 0x18, 0x2B, 0x02, 0x7B, 0x94, 0xFF, 0xFF, 0x49, 0xCF, 0x84, 0x18, 0x2B,
+  0x02, 0x31, 0x0D, 0xFF, 0xFF, 0x94, 0x76, 0x81, 0x18, 0x2B, 0x01, 0xF7, 0x9E, 0xBD, 0xB9, 0x84,
+  0x18, 0x2B, 0x03, 0x6B, 0x12, 0xF7, 0xBF, 0xFF, 0xFF, 0x20, 0x8C, 0x8E, 0x18, 0x2B, 0x02, 0x28,
+  0xCC, 0xFF, 0xDF, 0xBD, 0xD9, 0x84, 0x18, 0x2B, 0x02, 0x39, 0x2D, 0xFF, 0xFF, 0xAD, 0x38, 0x81,
+  0x18, 0x2B, 0x00, 0xDE, 0xBC, 0x85, 0xFF, 0xFF, 0x02, 0xF7, 0xBF, 0xAD, 0x38, 0x28, 0xAC, 0x81,
+  0x18, 0x2B, 0x00, 0x62, 0xD2, 0x86, 0xFF, 0xFF, 0x01, 0xDE, 0xDC, 0x62, 0xB1, 0xCD, 0x18, 0x2B,
+  0x01, 0xA5, 0x18, 0xFF, 0xFF, 0x86, 0x18, 0x4B, 0x82, 0x18, 0x2B, 0x02, 0x9C, 0x96, 0xFF, 0xFF,
+  0x28, 0xCC, 0x84, 0x18, 0x2B, 0x02, 0x52, 0x10, 0xFF, 0xFF, 0x7B, 0x73, 0x80, 0x18, 0x2B, 0x02,
+  0x41, 0xAF, 0xFF, 0xFF, 0x7B, 0xB4, 0x82, 0x18, 0x4B, 0x02, 0xD6, 0x9B, 0xF7, 0xBE, 0x20, 0xAC,
+  0x91, 0x18, 0x2B, 0x02, 0x62, 0xB1, 0xFF, 0xFF, 0x62, 0xD1, 0x8A, 0x18, 0x2B, 0x01, 0xEF, 0x7E,
+  0xBD, 0xB9, 0x85, 0x18, 0x2B, 0x02, 0xA4, 0xF7, 0xFF, 0xFF, 0x20, 0x8C, 0x80, 0x18, 0x2B, 0x02,
+  0x9C, 0x96, 0xFF, 0xFF, 0x28, 0xCC, 0x84, 0x18, 0x2B, 0x02, 0x52, 0x10, 0xFF, 0xFF, 0x7B, 0x73,
+  0x80, 0x18, 0x2B, 0x02, 0x28, 0xCC, 0xFF, 0xFF, 0x9C, 0xB7, 0x84, 0x18, 0x4B, 0x00, 0x18, 0x2A,
+  0x83, 0x18, 0x2B, 0x01, 0xBD, 0xD9, 0xF7, 0xBF, 0x85, 0x6A, 0xF2, 0x02, 0xA4, 0xD7, 0xFF, 0xFF,
+  0x5A, 0x71, 0x80, 0x18, 0x2B, 0x02, 0x49, 0xEF, 0xFF, 0xFF, 0x7B, 0x94, 0x85, 0x18, 0x2B, 0x01,
+  0xDE, 0xFC, 0xD6, 0x7B, 0x85, 0x18, 0x2B, 0x02, 0x39, 0x6E, 0xFF, 0xFF, 0x8C, 0x15, 0x85, 0x18,
+  0x2B, 0x02, 0x7B, 0x93, 0xFF, 0xFF, 0x49, 0xCF, 0x84, 0x18, 0x2B, 0x02, 0x31, 0x0D, 0xFF, 0xFF,
+  0x94, 0x76, 0x81, 0x18, 0x2B, 0x01, 0xF7, 0x9E, 0xBD, 0xB9, 0x85, 0x18, 0x2B, 0x02, 0xA4, 0xF7,
+  0xFF, 0xFF, 0x20, 0x8C, 0x8E, 0x18, 0x2B, 0x02, 0x49, 0xCF, 0xFF, 0xFF, 0xAD, 0x38, 0x85, 0x6A,
+  0xF2, 0x01, 0xEF, 0x5E, 0xCE, 0x5B, 0x81, 0x18, 0x2B, 0x80, 0xDE, 0xBC, 0x84, 0x18, 0x4B, 0x00,
+  0x18, 0x2A, 0x83, 0x18, 0x2B, 0x02, 0x62, 0xD2, 0xFF, 0xFF, 0x62, 0xD1, 0x83, 0x18, 0x4B, 0x80,
+  0x18, 0x2A, 0xCE, 0x18, 0x2B, 0x01, 0xA5, 0x18, 0xFF, 0xFF, 0x8A, 0x18, 0x2B, 0x02, 0x9C, 0x96,
+  0xFF, 0xFF, 0x28, 0xCC, 0x84, 0x18, 0x2B, 0x02, 0x52, 0x10, 0xFF, 0xFF, 0x7B, 0x73, 0x80, 0x18,
+  0x2B, 0x02, 0x41, 0xAF, 0xFF, 0xFF, 0x7B, 0x94, 0x82, 0x18, 0x2B, 0x02, 0x6B, 0x12, 0xFF, 0xFF,
+  0x7B, 0xB4, 0x91, 0x18, 0x2B, 0x02, 0x62, 0xB1, 0xFF, 0xFF, 0x62, 0xD1, 0x8A, 0x18, 0x2B, 0x01,
+  0xEF, 0x7E, 0xBD, 0xB9, 0x85, 0x18, 0x2B, 0x02, 0xA4, 0xF7, 0xFF, 0xFF, 0x20, 0x8C, 0x80, 0x18,
+  0x2B, 0x02, 0x9C, 0x96, 0xFF, 0xFF, 0x28, 0xCC, 0x84, 0x18, 0x2B, 0x02, 0x52, 0x10, 0xFF, 0xFF,
+  0x7B, 0x73, 0x80, 0x18, 0x2B, 0x02, 0x28, 0xCC, 0xFF, 0xFF, 0x9C, 0xB7, 0x8A, 0x18, 0x2B, 0x00,
+  0xBD, 0xDA, 0x88, 0xFF, 0xFF, 0x00, 0x5A, 0x71, 0x80, 0x18, 0x2B, 0x02, 0x49, 0xEF, 0xFF, 0xFF,
+  0x7B, 0x94, 0x85, 0x18, 0x2B, 0x01, 0xDE, 0xDC, 0xD6, 0x7B, 0x85, 0x18, 0x2B, 0x02, 0x39, 0x6E,
+  0xFF, 0xFF, 0x8C, 0x15, 0x85, 0x18, 0x2B, 0x02, 0x7B, 0x93, 0xFF, 0xFF, 0x49, 0xCF, 0x84, 0x18,
+  0x2B, 0x02, 0x31, 0x0D, 0xFF, 0xFF, 0x94, 0x76, 0x81, 0x18, 0x2B, 0x01, 0xF7, 0x9E, 0xBD, 0xB9,
+  0x85, 0x18, 0x2B, 0x02, 0xA4, 0xF7, 0xFF, 0xFF, 0x20, 0x8C, 0x8E, 0x18, 0x2B, 0x00, 0x49, 0xEF,
+  0x88, 0xFF, 0xFF, 0x00, 0xCE, 0x5B, 0x81, 0x18, 0x2B, 0x80, 0xDE, 0xBC, 0x8A, 0x18, 0x2B, 0x02,
+  0x62, 0xD2, 0xFF, 0xFF, 0x62, 0xD1, 0xD5, 0x18, 0x2B, 0x02, 0xA5, 0x17, 0xFF, 0xFF, 0x10, 0x2B,
+  0x89, 0x18, 0x2B, 0x02, 0x9C, 0x96, 0xFF, 0xFF, 0x28, 0xCC, 0x84, 0x18, 0x2B, 0x02, 0x52, 0x10,
+  0xFF, 0xFF, 0x7B, 0x73, 0x80, 0x18, 0x2B, 0x02, 0x41, 0xAF, 0xFF, 0xFF, 0x7B, 0xB4, 0x82, 0x18,
+  0x2B, 0x03, 0x18, 0x6B, 0xE7, 0x3D, 0xE7, 0x1D, 0x18, 0x4B, 0x90, 0x18, 0x2B, 0x02, 0x62, 0xB1,
+  0xFF, 0xFF, 0x62, 0xD1, 0x85, 0x18, 0x2B, 0x01, 0xDE, 0xDC, 0xA4, 0xD7, 0x81, 0x18, 0x2B, 0x01,
+  0xEF, 0x7E, 0xBD, 0xB9, 0x85, 0x18, 0x2B, 0x02, 0xA4, 0xF7, 0xFF, 0xFF, 0x20, 0x8C, 0x80, 0x18,
+  0x2B, 0x02, 0x9C, 0x96, 0xFF, 0xFF, 0x28, 0xCC, 0x84, 0x18, 0x2B, 0x02, 0x52, 0x10, 0xFF, 0xFF,
+  0x7B, 0x73, 0x80, 0x18, 0x2B, 0x02, 0x28, 0xCC, 0xFF, 0xFF, 0x9C, 0xB7, 0x8A, 0x18, 0x2B, 0x01,
+  0xBD, 0xDA, 0xF7, 0xBE, 0x85, 0x5A, 0x70, 0x02, 0x94, 0x76, 0xFF, 0xFF, 0x5A, 0x70, 0x80, 0x18,
+  0x2B, 0x02, 0x49, 0xEF, 0xFF, 0xFF, 0x7B, 0x94, 0x85, 0x18, 0x2B, 0x01, 0xDE, 0xFC, 0xD6, 0x7B,
+  0x85, 0x18, 0x2B, 0x02, 0x39, 0x6E, 0xFF, 0xFF, 0x8C, 0x15, 0x85, 0x18, 0x2B, 0x02, 0x7B, 0x93,
+  0xFF, 0xFF, 0x49, 0xCF, 0x84, 0x18, 0x2B, 0x02, 0x31, 0x0D, 0xFF, 0xFF, 0x94, 0x76, 0x81, 0x18,
+  0x2B, 0x01, 0xF7, 0x9E, 0xBD, 0xB9, 0x85, 0x18, 0x2B, 0x02, 0xA4, 0xF7, 0xFF, 0xFF, 0x20, 0x8C,
+  0x8E, 0x18, 0x2B, 0x03, 0x49, 0xEF, 0xFF, 0xFF, 0xA4, 0xF7, 0x5A, 0x70, 0x83, 0x5A, 0x71, 0x02,
+  0x5A, 0x70, 0xE7, 0x3D, 0xCE, 0x5B, 0x81, 0x18, 0x2B, 0x80, 0xDE, 0xBC, 0x8A, 0x18, 0x2B, 0x02,
+  0x62, 0xD2, 0xFF, 0xFF, 0x62, 0xD1, 0xD4, 0x18, 0x2B, 0x03, 0x18, 0x2A, 0xA5, 0x17, 0xFF, 0xFF,
+  0x10, 0x2A, 0x88, 0x18, 0x2B, 0x03, 0x18, 0x2A, 0x94, 0x56, 0xFF, 0xFF, 0x31, 0x0D, 0x84, 0x18,
+  0x2B, 0x02, 0x52, 0x50, 0xFF, 0xFF, 0x73, 0x53, 0x80, 0x18, 0x2B, 0x02, 0x41, 0xAE, 0xFF, 0xFF,
+  0x7B, 0xB4, 0x82, 0x18, 0x2B, 0x03, 0x18, 0x2A, 0x83, 0xF4, 0xFF, 0xFF, 0x62, 0xD2, 0x90, 0x18,
+  0x2B, 0x02, 0x5A, 0x91, 0xFF, 0xFF, 0x6B, 0x12, 0x84, 0x18, 0x2B, 0x03, 0x18, 0x6B, 0xFF, 0xDF,
+  0xB5, 0x78, 0x18, 0x2A, 0x80, 0x18, 0x2B, 0x02, 0xEF, 0x5E, 0xC5, 0xFA, 0x18, 0x2A, 0x83, 0x18,
+  0x2B, 0x03, 0x18, 0x2A, 0xAD, 0x58, 0xFF, 0xFF, 0x18, 0x6B, 0x80, 0x18, 0x2B, 0x02, 0x9C, 0x96,
+  0xFF, 0xFF, 0x28, 0xCC, 0x84, 0x18, 0x2B, 0x02, 0x52, 0x0F, 0xFF, 0xFF, 0x7B, 0x73, 0x80, 0x18,
+  0x2B, 0x02, 0x28, 0xCC, 0xFF, 0xFF, 0x9C, 0xB7, 0x8A, 0x18, 0x2B, 0x02, 0xBD, 0xD9, 0xF7, 0x9E,
+  0x10, 0x2A, 0x82, 0x18, 0x2A, 0x80, 0x18, 0x2B, 0x02, 0x6A, 0xF2, 0xFF, 0xFF, 0x5A, 0x70, 0x80,
+  0x18, 0x2B, 0x02, 0x49, 0xEF, 0xFF, 0xFF, 0x7B, 0xB4, 0x85, 0x18, 0x2B, 0x02, 0xDE, 0xFC, 0xD6,
+  0x7B, 0x18, 0x2A, 0x84, 0x18, 0x2B, 0x02, 0x39, 0x6E, 0xFF, 0xFF, 0x8C, 0x15, 0x85, 0x18, 0x2B,
+  0x02, 0x73, 0x73, 0xFF, 0xFF, 0x52, 0x10, 0x84, 0x18, 0x2B, 0x02, 0x39, 0x4E, 0xFF, 0xFF, 0x94,
+  0x55, 0x81, 0x18, 0x2B, 0x01, 0xF7, 0x9E, 0xBD, 0xB9, 0x85, 0x18, 0x2B, 0x02, 0xA4, 0xF7, 0xFF,
+  0xFF, 0x20, 0x8C, 0x8E, 0x18, 0x2B, 0x02, 0x49, 0xEF, 0xFF, 0xFF, 0x7B, 0xB4, 0x81, 0x18, 0x2B,
+  0x81, 0x18, 0x2A, 0x02, 0x10, 0x2A, 0xDE, 0xFC, 0xCE, 0x5B, 0x81, 0x18, 0x2B, 0x80, 0xDE, 0xBC,
+  0x8A, 0x18, 0x2B, 0x02, 0x62, 0xD2, 0xFF, 0xFF, 0x62, 0xD1, 0xD4, 0x18, 0x2B, 0x03, 0x18, 0x2A,
+  0xA5, 0x17, 0xFF, 0xFF, 0x10, 0x2A, 0x89, 0x18, 0x2B, 0x03, 0x62, 0xD1, 0xFF, 0xFF, 0xAD, 0x38,
+  0x41, 0x8E, 0x82, 0x39, 0x4E, 0x03, 0x41, 0xAF, 0xC6, 0x1A, 0xFF, 0xFF, 0x41, 0xCF, 0x80, 0x18,
+  0x2B, 0x02, 0x41, 0xAE, 0xFF, 0xFF, 0x7B, 0xB4, 0x83, 0x18, 0x2B, 0x03, 0x28, 0xCC, 0xF7, 0xBE,
+  0xCE, 0x5B, 0x18, 0x2A, 0x8F, 0x18, 0x2B, 0x03, 0x31, 0x0D, 0xFF, 0xDF, 0xD6, 0x9B, 0x49, 0xEF,
+  0x82, 0x39, 0x4E, 0x09, 0x39, 0x6E, 0x9C, 0x96, 0xFF, 0xFF, 0x7B, 0xB4, 0x18, 0x2A, 0x18, 0x2B,
+  0x18, 0x2A, 0xBD, 0xD9, 0xFF, 0xDF, 0x6B, 0x12, 0x83, 0x39, 0x4E, 0x08, 0x62, 0xB1, 0xF7, 0x9E,
+  0xD6, 0x9C, 0x18, 0x2A, 0x18, 0x2B, 0x18, 0x2A, 0x9C, 0x96, 0xFF, 0xFF, 0x28, 0xCC, 0x84, 0x18,
+  0x2B, 0x02, 0x52, 0x0F, 0xFF, 0xFF, 0x7B, 0x73, 0x80, 0x18, 0x2B, 0x03, 0x28, 0xCC, 0xFF, 0xFF,
+  0x9C, 0xB7, 0x18, 0x2A, 0x88, 0x18, 0x2B, 0x03, 0x18, 0x2A, 0xBD, 0xD9, 0xF7, 0x9E, 0x18, 0x2A,
+  0x84, 0x18, 0x2B, 0x02, 0x6A, 0xF2, 0xFF, 0xFF, 0x5A, 0x70, 0x80, 0x18, 0x2B, 0x02, 0x49, 0xEF,
+  0xFF, 0xFF, 0x7B, 0xB4, 0x84, 0x18, 0x2B, 0x03, 0x18, 0x2A, 0xDE, 0xFC, 0xD6, 0x7B, 0x18, 0x2A,
+  0x80, 0x18, 0x2B, 0x00, 0x20, 0x8C, 0x81, 0x39, 0x4E, 0x03, 0x52, 0x50, 0xFF, 0xFF, 0x9C, 0x96,
+  0x39, 0x4D, 0x80, 0x39, 0x4E, 0x00, 0x31, 0x0D, 0x81, 0x18, 0x2B, 0x03, 0x49, 0xEF, 0xFF, 0xFF,
+  0xC5, 0xFA, 0x41, 0xAE, 0x82, 0x39, 0x4E, 0x03, 0x41, 0x8E, 0xB5, 0x58, 0xFF, 0xFF, 0x62, 0xB1,
+  0x80, 0x18, 0x2B, 0x03, 0x18, 0x2A, 0xF7, 0x9E, 0xBD, 0xB9, 0x18, 0x2A, 0x83, 0x18, 0x2B, 0x03,
+  0x18, 0x2A, 0xA4, 0xF7, 0xFF, 0xFF, 0x20, 0x8B, 0x8E, 0x18, 0x2B, 0x02, 0x49, 0xEF, 0xFF, 0xFF,
+  0x7B, 0xB4, 0x84, 0x18, 0x2B, 0x05, 0x18, 0x2A, 0xDE, 0xFC, 0xCE, 0x5B, 0x18, 0x2A, 0x18, 0x2B,
+  0x18, 0x2A, 0x80, 0xDE, 0xBC, 0x00, 0x18, 0x2A, 0x89, 0x18, 0x2B, 0x02, 0x62, 0xD1, 0xFF, 0xFF,
+  0x62, 0xD1, 0xD4, 0x18, 0x2B, 0x03, 0x18, 0x2A, 0xA5, 0x17, 0xFF, 0xFF, 0x10, 0x2A, 0x89, 0x18,
+  0x2B, 0x01, 0x18, 0x4B, 0xBD, 0xB9, 0x86, 0xFF, 0xFF, 0x01, 0x9C, 0x96, 0x10, 0x2A, 0x80, 0x18,
+  0x2B, 0x02, 0x41, 0xAE, 0xFF, 0xFF, 0x7B, 0xB4, 0x83, 0x18, 0x2B, 0x03, 0x18, 0x2A, 0x9C, 0xD7,
+  0xFF, 0xFF, 0x49, 0xEF, 0x8F, 0x18, 0x2B, 0x01, 0x18, 0x2A, 0x83, 0xD4, 0x86, 0xFF, 0xFF, 0x01,
+  0xCE, 0x3A, 0x20, 0x6B, 0x80, 0x18, 0x2B, 0x02, 0x18, 0x2A, 0x39, 0x6E, 0xEF, 0x5E, 0x85, 0xFF,
+  0xFF, 0x07, 0xF7, 0x9E, 0x4A, 0x0F, 0x18, 0x2A, 0x10, 0x2A, 0x18, 0x2A, 0x9C, 0x96, 0xFF, 0xFF,
+  0x28, 0xCC, 0x81, 0x18, 0x2B, 0x80, 0x10, 0x2A, 0x03, 0x18, 0x2B, 0x52, 0x0F, 0xFF, 0xFF, 0x7B,
+  0x73, 0x80, 0x18, 0x2B, 0x03, 0x28, 0xCC, 0xFF, 0xFF, 0x9C, 0xB7, 0x18, 0x2A, 0x88, 0x18, 0x2B,
+  0x03, 0x18, 0x2A, 0xBD, 0xD9, 0xF7, 0x9E, 0x18, 0x2A, 0x84, 0x18, 0x2B, 0x02, 0x6A, 0xF2, 0xFF,
+  0xFF, 0x5A, 0x70, 0x80, 0x18, 0x2B, 0x02, 0x49, 0xEF, 0xFF, 0xFF, 0x7B, 0xB4, 0x84, 0x18, 0x2B,
+  0x02, 0x18, 0x2A, 0xDE, 0xFC, 0xD6, 0x7B, 0x80, 0x10, 0x2A, 0x01, 0x18, 0x2B, 0x94, 0x35, 0x87,
+  0xFF, 0xFF, 0x01, 0xE6, 0xFD, 0x18, 0x2A, 0x80, 0x18, 0x2B, 0x01, 0x10, 0x2A, 0x9C, 0xB7, 0x86,
+  0xFF, 0xFF, 0x01, 0xB5, 0x78, 0x18, 0x4A, 0x80, 0x18, 0x2B, 0x03, 0x18, 0x2A, 0xF7, 0x9E, 0xBD,
+  0xB9, 0x18, 0x2A, 0x83, 0x18, 0x2B, 0x03, 0x18, 0x2A, 0xA4, 0xF7, 0xFF, 0xFF, 0x20, 0x8B, 0x8E,
+  0x18, 0x2B, 0x02, 0x49, 0xEF, 0xFF, 0xFF, 0x7B, 0xB4, 0x83, 0x18, 0x2B, 0x80, 0x10, 0x2A, 0x01,
+  0xDE, 0xDC, 0xCE, 0x5B, 0x80, 0x10, 0x2A, 0x00, 0x18, 0x2A, 0x80, 0xDE, 0xBC, 0x02, 0x18, 0x2A,
+  0x10, 0x2A, 0x18, 0x2B, 0x80, 0x10, 0x2A, 0x84, 0x18, 0x2B, 0x04, 0x10, 0x2A, 0x62, 0xD1, 0xFF,
+  0xFF, 0x62, 0xD1, 0x10, 0x2A, 0x80, 0x18, 0x2B, 0x80, 0x10, 0x2A, 0x84, 0x18, 0x2B, 0x80, 0x10,
+  0x2A, 0x8C, 0x18, 0x2B, 0x01, 0x10, 0x2A, 0x18, 0x2B, 0x80, 0x10, 0x2A, 0x87, 0x18, 0x2B, 0x00,
+  0x10, 0x2A, 0xA1, 0x18, 0x2B, 0x89, 0x10, 0x2A, 0x01, 0x5A, 0x70, 0x83, 0xF4, 0x8B, 0x10, 0x2A,
+  0x02, 0x18, 0x2A, 0x5A, 0xB1, 0x83, 0xF4, 0x82, 0x8C, 0x15, 0x01, 0x83, 0xF4, 0x52, 0x2F, 0x82,
+  0x10, 0x2A, 0x02, 0x28, 0xCC, 0x8C, 0x15, 0x41, 0xAE, 0x84, 0x10, 0x2A, 0x02, 0x31, 0x0D, 0x8C,
+  0x15, 0x52, 0x0F, 0x91, 0x10, 0x2A, 0x01, 0x49, 0xCF, 0x83, 0xD4, 0x82, 0x8C, 0x15, 0x02, 0x8C,
+  0x14, 0x62, 0xD1, 0x18, 0x4B, 0x83, 0x10, 0x2A, 0x01, 0x28, 0xCC, 0x73, 0x73, 0x83, 0x8C, 0x15,
+  0x01, 0x7B, 0x93, 0x31, 0x0C, 0x82, 0x10, 0x2A, 0x02, 0x52, 0x30, 0x8C, 0x15, 0x18, 0x4B, 0x84,
+  0x10, 0x2A, 0x02, 0x28, 0xEC, 0x8C, 0x15, 0x41, 0xAE, 0x80, 0x10, 0x2A, 0x02, 0x18, 0x4B, 0x8B,
+  0xF4, 0x52, 0x30, 0x8A, 0x10, 0x2A, 0x01, 0x62, 0xD1, 0x7B, 0xB4, 0x85, 0x10, 0x2A, 0x02, 0x39,
+  0x6E, 0x8C, 0x15, 0x31, 0x0D, 0x80, 0x10, 0x2A, 0x02, 0x28, 0xCC, 0x8C, 0x15, 0x41, 0xAE, 0x85,
+  0x10, 0x2A, 0x01, 0x73, 0x53, 0x6B, 0x32, 0x81, 0x10, 0x2A, 0x00, 0x4A, 0x0F, 0x87, 0x8C, 0x15,
+  0x00, 0x73, 0x73, 0x83, 0x10, 0x2A, 0x01, 0x52, 0x50, 0x83, 0xF4, 0x82, 0x8C, 0x15, 0x02, 0x83,
+  0xF4, 0x5A, 0x90, 0x18, 0x2A, 0x82, 0x10, 0x2A, 0x01, 0x7B, 0xB4, 0x62, 0xD1, 0x85, 0x10, 0x2A,
+  0x03, 0x5A, 0x70, 0x83, 0xF4, 0x18, 0x4B, 0x10, 0x2A, 0x80, 0x18, 0x2B, 0x01, 0x10, 0x2A, 0x18,
+  0x2B, 0x86, 0x10, 0x2A, 0x00, 0x18, 0x2B, 0x80, 0x10, 0x2A, 0x02, 0x28, 0xCC, 0x8C, 0x15, 0x41,
+  0xAE, 0x81, 0x10, 0x2A, 0x00, 0x18, 0x2B, 0x81, 0x10, 0x2A, 0x01, 0x73, 0x53, 0x6B, 0x12, 0x80,
+  0x10, 0x2A, 0x00, 0x18, 0x2A, 0x80, 0x73, 0x32, 0x86, 0x10, 0x2A, 0x81, 0x18, 0x2B, 0x03, 0x10,
+  0x2A, 0x39, 0x4D, 0x8C, 0x15, 0x39, 0x4D, 0x84, 0x10, 0x2A, 0x80, 0x18, 0x2B, 0x92, 0x10, 0x2A,
+  0x00, 0x18, 0x2B, 0x8A, 0x10, 0x2A, 0x82, 0x18, 0x2B, 0x83, 0x10, 0x2A, 0x88, 0x18, 0x2B, 0x81,
+  0x10, 0x2A, 0x85, 0x18, 0x2B, 0x80, 0x10, 0x2A, 0x82, 0x18, 0x2B, 0xFF, 0x10, 0x2A, 0xB4, 0x10,
+  0x2A, 0x00, 0x10, 0x2B, 0x80, 0x10, 0x2A, 0x83, 0x10, 0x2B, 0x8C, 0x10, 0x2A, 0x85, 0x10, 0x2B,
+  0x8F, 0x10, 0x2A, 0x80, 0x10, 0x2B, 0x83, 0x10, 0x2A, 0x82, 0x10, 0x2B, 0x8C, 0x10, 0x2A, 0x81,
+  0x10, 0x2B, 0x88, 0x10, 0x2A, 0x82, 0x10, 0x2B, 0xA2, 0x10, 0x2A, 0x8B, 0x10, 0x2B, 0xFF, 0x10,
+  0x2A, 0xFF, 0x10, 0x2A, 0xFF, 0x10, 0x2A, 0xFF, 0x10, 0x2A, 0xFF, 0x10, 0x2A, 0xFF, 0x10, 0x2A,
+  0xFF, 0x10, 0x2A, 0xFF, 0x10, 0x2A, 0xFF, 0x10, 0x2A, 0xFF, 0x10, 0x2A, 0xFF, 0x10, 0x2A, 0xFF,
+  0x10, 0x2A, 0xFF, 0x10, 0x2A, 0xFF, 0x10, 0x2A, 0xFF, 0x10, 0x2A, 0xFF, 0x10, 0x2A, 0xFF, 0x10,
+  0x2A, 0xFF, 0x10, 0x2A, 0xFF, 0x10, 0x2A, 0xFF, 0x10, 0x2A, 0xFF, 0x10, 0x2A, 0xFF, 0x10, 0x2A,
+  0xFF, 0x10, 0x2A, 0xFF, 0x10, 0x2A, 0xFF, 0x10, 0x2A, 0xFF, 0x10, 0x2A, 0xFF, 0x10, 0x2A, 0xFF,
+  0x10, 0x2A, 0xFF, 0x10, 0x2A, 0xFF, 0x10, 0x2A, 0xFF, 0x10, 0x2A, 0xFF, 0x10, 0x2A, 0x9E, 0x10,
+  0x2A, 0x88, 0x18, 0x2A, 0x86, 0x10, 0x2A, 0x89, 0x18, 0x2A, 0x85, 0x10, 0x2A, 0x86, 0x18, 0x2A,
+  0xA2, 0x10, 0x2A, 0x82, 0x18, 0x2A, 0xB4, 0x10, 0x2A, 0x82, 0x18, 0x2A, 0xFF, 0x10, 0x2A, 0xAF,
+  0x10, 0x2A
 };
 
 #endif // SPLASH_DATA_H